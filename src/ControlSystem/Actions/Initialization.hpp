@@ -44,6 +44,7 @@ struct get_center_tags<domain::object_list<>> {
  * - Uses:
  *   - `control_system::Tags::MeasurementTimescales`
  *   - `control_system::Tags::WriteDataToDisk`
+ *   - `control_system::Tags::FunctionOfTimeRetention`
  *   - `control_system::Tags::ObserveCenters`
  *   - `domain::Tags::ExcisionCenter<domain::ObjectLabel::A>`
  *   - `domain::Tags::ExcisionCenter<domain::ObjectLabel::B>`
@@ -56,6 +57,7 @@ struct get_center_tags<domain::object_list<>> {
  *   - `control_system::Tags::TimescaleTuner<ControlSystem>`
  *   - `control_system::Tags::ControlError<ControlSystem>`
  *   - `control_system::Tags::IsActive<ControlSystem>`
+ *   - `control_system::Tags::WrittenHistoryTime`
  * - Removes: Nothing
  * - Modifies:
  *   - `control_system::Tags::Averager<ControlSystem>`
@@ -74,11 +76,13 @@ struct Initialize {
 
   using simple_tags =
       tmpl::push_back<typename ControlSystem::simple_tags,
-                      control_system::Tags::CurrentNumberOfMeasurements>;
+                      control_system::Tags::CurrentNumberOfMeasurements,
+                      control_system::Tags::WrittenHistoryTime>;
 
   using const_global_cache_tags = tmpl::flatten<tmpl::list<
       control_system::Tags::MeasurementsPerUpdate,
       control_system::Tags::WriteDataToDisk,
+      control_system::Tags::FunctionOfTimeRetention,
       control_system::Tags::ObserveCenters,
       typename detail::get_center_tags<
           typename ControlSystem::control_error::object_centers>::type>>;
@@ -18,6 +18,7 @@
 #include "DataStructures/DataBox/Tag.hpp"
 #include "Domain/Creators/DomainCreator.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Strahlkorper.hpp"
+#include "Options/Auto.hpp"
 #include "Options/Options.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Gsl.hpp"
@@ -118,6 +119,21 @@ struct MeasurementsPerUpdate {
   static int lower_bound() { return 1; }
   using group = ControlSystemGroup;
 };
+
+/// \ingroup OptionTagsGroup
+/// \ingroup ControlSystemGroup
+/// Option tag for how long the history of the controlled functions of time is
+/// kept before it is discarded.
+struct FunctionOfTimeRetention {
+  using type = Options::Auto<double, Options::AutoLabel::None>;
+  static constexpr Options::String help = {
+      "Keep the history of the controlled functions of time (and their "
+      "measurement timescales) only for this long before the most recent "
+      "measurement, and discard older pieces. Must be longer than any element "
+      "or observer needs to look back in time. Set to 'None' to keep the full "
+      "history."};
+  using group = ControlSystemGroup;
+};
 }  // namespace OptionTags
 
 /// \ingroup ControlSystemGroup
@@ -315,6 +331,27 @@ struct MeasurementsPerUpdate : db::SimpleTag {
   }
 };
 
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ControlSystemGroup
+/// Tag for how long the history of the controlled functions of time is kept
+/// before the most recent measurement, or `std::nullopt` to keep the full
+/// history. This will usually be stored in the global cache.
+///
+/// \see control_system::UpdateControlSystem
+struct FunctionOfTimeRetention : db::SimpleTag {
+  using type = std::optional<double>;
+
+  using option_tags = tmpl::list<OptionTags::FunctionOfTimeRetention>;
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const type& retention) {
+    if (retention.has_value() and *retention < 0.0) {
+      ERROR_NO_TRACE("The FunctionOfTimeRetention must be non-negative, but is "
+                     << *retention << ".");
+    }
+    return retention;
+  }
+};
+
 /// \ingroup DataBoxTagsGroup
 /// \ingroup ControlSystemGroup
 /// DataBox tag that keeps track of which measurement we are on.
@@ -322,6 +359,15 @@ struct CurrentNumberOfMeasurements : db::SimpleTag {
   using type = int;
 };
 
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ControlSystemGroup
+/// DataBox tag that holds the time of the latest piece of the history of the
+/// function of time that has been written to disk, if any (see
+/// `control_system::write_discarded_history_to_disk`).
+struct WrittenHistoryTime : db::SimpleTag {
+  using type = std::optional<double>;
+};
+
 namespace detail {
 
 CREATE_HAS_STATIC_MEMBER_VARIABLE(override_functions_of_time)
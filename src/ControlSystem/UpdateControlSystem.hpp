@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cmath>
+#include <optional>
 
 #include "ControlSystem/Averager.hpp"
 #include "ControlSystem/CalculateMeasurementTimescales.hpp"
@@ -43,6 +44,7 @@ namespace control_system {
  * - \link Tags::WriteDataToDisk WriteDataToDisk \endlink
  * - \link Tags::CurrentNumberOfMeasurements CurrentNumberOfMeasurements
  *   \endlink
+ * - \link Tags::WrittenHistoryTime WrittenHistoryTime \endlink
  *
  * And the \link control_system::Tags::MeasurementsPerUpdate \endlink must be in
  * the GlobalCache. If these tags are not present, a build error will occur.
@@ -76,6 +78,17 @@ namespace control_system {
  *    functions of time with the control signal and update the measurement
  *    timescales with the new measurement timescale (both of these are
  *    `Parallel::mutate` calls).
+ * 9. If `control_system::Tags::FunctionOfTimeRetention` is set, discard the
+ *    history of the function of time and the measurement timescale that is
+ *    older than the retention time before the current measurement. Otherwise
+ *    every update adds a piece to the functions of time that is never removed,
+ *    so they grow without bound over a long evolution, and so do the
+ *    checkpoints and volume files that contain them. If the
+ *    `control_system::Tags::WriteDataToDisk` tag is set to `true`, the
+ *    discarded pieces are written to disk first (see
+ *    `control_system::write_discarded_history_to_disk`), and
+ *    `control_system::Tags::WrittenHistoryTime` keeps track of the pieces that
+ *    have been written.
  */
 template <typename ControlSystem>
 struct UpdateControlSystem {
@@ -211,6 +224,29 @@ struct UpdateControlSystem {
     Parallel::mutate<Tags::MeasurementTimescales, UpdateFunctionOfTime>(
         cache, function_of_time_name, current_measurement_expiration_time,
         new_measurement_timescale, new_measurement_expiration_time);
+
+    // Begin step 9
+    // Discard the history of the functions of time that nothing needs anymore.
+    // All elements have contributed to the measurement at `time`, so the
+    // slowest element has reached `time` and the retention time covers
+    // anything that still looks back in time.
+    const std::optional<double>& retention =
+        Parallel::get<Tags::FunctionOfTimeRetention>(cache);
+    if (retention.has_value()) {
+      const double truncation_time = time - *retention;
+      if (Parallel::get<control_system::Tags::WriteDataToDisk>(cache)) {
+        // LCOV_EXCL_START
+        write_discarded_history_to_disk<ControlSystem>(
+            make_not_null(&db::get_mutable_reference<
+                          control_system::Tags::WrittenHistoryTime>(box)),
+            truncation_time, cache, function_of_time);
+        // LCOV_EXCL_STOP
+      }
+      Parallel::mutate<::domain::Tags::FunctionsOfTime, TruncateFunctionOfTime>(
+          cache, function_of_time_name, truncation_time);
+      Parallel::mutate<Tags::MeasurementTimescales, TruncateFunctionOfTime>(
+          cache, function_of_time_name, truncation_time);
+    }
   }
 };
 }  // namespace control_system
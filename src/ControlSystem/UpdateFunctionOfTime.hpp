@@ -43,4 +43,18 @@ struct ResetFunctionOfTimeExpirationTime {
     (*f_of_t_list).at(f_of_t_name)->reset_expiration_time(new_expiration_time);
   }
 };
+
+/// \ingroup ControlSystemGroup
+/// Discards the history of a FunctionOfTime in the global cache that is only
+/// needed before `truncation_time`. Intended to be used in Parallel::mutate.
+struct TruncateFunctionOfTime {
+  static void apply(
+      const gsl::not_null<std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>*>
+          f_of_t_list,
+      const std::string& f_of_t_name, const double truncation_time) {
+    (*f_of_t_list).at(f_of_t_name)->truncate_at_time(truncation_time);
+  }
+};
 }  // namespace control_system
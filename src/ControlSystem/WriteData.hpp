@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <string>
@@ -14,11 +16,14 @@
 #include "ControlSystem/Component.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTimeHelpers.hpp"
+#include "Domain/FunctionsOfTime/PiecewisePolynomial.hpp"
 #include "Domain/FunctionsOfTime/QuaternionFunctionOfTime.hpp"
 #include "IO/Observer/ReductionActions.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace control_system {
 /*!
@@ -128,4 +133,107 @@ void write_components_to_disk(
     );
   }
 }
+
+/*!
+ * \ingroup ControlSystemGroup
+ * \brief Writes the pieces of a function of time to disk that will be
+ * discarded when its history is truncated at `truncation_time`.
+ *
+ * \details Together with the pieces that remain in the function of time, the
+ * written pieces reconstruct the full function of time. The pieces are written
+ * to the reduction file next to the data written by
+ * `control_system::write_components_to_disk`, with one subfile for each
+ * component, e.g.
+ *
+ * - /ControlSystems/SystemA/History/X.dat
+ *
+ * Each row holds the time at which the piece starts, followed by the function
+ * and its derivatives up to `ControlSystem::deriv_order` at that time. For a
+ * `domain::FunctionsOfTime::QuaternionFunctionOfTime` the pieces of the
+ * controlled angle are written, from which the quaternions follow by
+ * integrating the quaternion ODE. Nothing is written for other types of
+ * functions of time.
+ *
+ * The truncation of the function of time in the cache of this node may not
+ * have been applied yet when the next truncation is written, so pieces at or
+ * before `written_history_time` are skipped because they have been written
+ * already. The `written_history_time` is set to the time of the latest piece
+ * that is written.
+ */
+template <typename ControlSystem, typename Metavariables>
+void write_discarded_history_to_disk(
+    const gsl::not_null<std::optional<double>*> written_history_time,
+    const double truncation_time, Parallel::GlobalCache<Metavariables>& cache,
+    const std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>&
+        function_of_time) {
+  constexpr size_t deriv_order = ControlSystem::deriv_order;
+  using StoredInfos = std::vector<
+      domain::FunctionsOfTime::FunctionOfTimeHelpers::StoredInfo<deriv_order +
+                                                                 1>>;
+  const StoredInfos* deriv_info = nullptr;
+  if (const auto* const quat_func_of_time = dynamic_cast<
+          const domain::FunctionsOfTime::QuaternionFunctionOfTime<
+              deriv_order>*>(function_of_time.get());
+      quat_func_of_time != nullptr) {
+    deriv_info = &quat_func_of_time->get_angle_deriv_info();
+  } else if (const auto* const piecewise_polynomial = dynamic_cast<
+                 const domain::FunctionsOfTime::PiecewisePolynomial<
+                     deriv_order>*>(function_of_time.get());
+             piecewise_polynomial != nullptr) {
+    deriv_info = &piecewise_polynomial->get_deriv_info();
+  } else {
+    return;
+  }
+
+  // Same search as in `truncate_stored_infos_at_time`: all pieces before the
+  // one that is needed at `truncation_time` are discarded
+  const auto upper_bound_piece = std::lower_bound(
+      deriv_info->begin(), deriv_info->end(), truncation_time,
+      [](const auto& info, const double t) { return info.time < t; });
+  if (std::distance(deriv_info->begin(), upper_bound_piece) <= 1) {
+    return;
+  }
+  const auto first_needed = std::prev(upper_bound_piece, 1);
+
+  auto& observer_writer_proxy = Parallel::get_parallel_component<
+      observers::ObserverWriter<Metavariables>>(cache);
+  std::vector<std::string> legend{"Time", "FunctionOfTime"};
+  for (size_t deriv = 1; deriv <= deriv_order; ++deriv) {
+    legend.push_back(
+        (deriv == 1 ? std::string{"dt"} : "d" + std::to_string(deriv) + "t") +
+        "FunctionOfTime");
+  }
+  const size_t num_components =
+      deriv_info->front().stored_quantities[0].size();
+  for (auto piece = deriv_info->begin(); piece != first_needed; ++piece) {
+    if (written_history_time->has_value() and
+        piece->time <= **written_history_time) {
+      continue;
+    }
+    for (size_t i = 0; i < num_components; ++i) {
+      const std::optional<std::string> component_name_opt =
+          ControlSystem::component_name(i, num_components);
+      if (not component_name_opt) {
+        continue;
+      }
+      // The pieces store the coefficients of the polynomial, so the
+      // derivatives are recovered by multiplying with factorials
+      std::vector<double> row{piece->time};
+      double factorial = 1.0;
+      for (size_t deriv = 0; deriv <= deriv_order; ++deriv) {
+        factorial *= std::max(1.0, static_cast<double>(deriv));
+        row.push_back(factorial *
+                      gsl::at(piece->stored_quantities, deriv)[i]);
+      }
+      Parallel::threaded_action<
+          observers::ThreadedActions::WriteReductionDataRow>(
+          // Node 0 is always the writer
+          observer_writer_proxy[0],
+          "/ControlSystems/" + ControlSystem::name() + "/History/" +
+              *component_name_opt,
+          legend, std::make_tuple(std::move(row)));
+    }
+    *written_history_time = piece->time;
+  }
+}
 }  // namespace control_system
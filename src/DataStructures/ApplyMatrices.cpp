@@ -6,7 +6,6 @@
 #include <array>
 #include <complex>
 #include <cstddef>
-#include <memory>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
@@ -15,6 +14,7 @@
 #include "Utilities/Blas.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/MemoryPool.hpp"
 
 namespace {
 void multiply_in_first_dimension(const gsl::not_null<double*> result,
@@ -42,8 +42,7 @@ void do_transpose(const gsl::not_null<double*> result, const double* const data,
 }
 
 struct Scratch {
-  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
-  std::unique_ptr<double[]> buffer;
+  memory_pool::unique_array<double> buffer;
   double* a;
   double* b;
 };
@@ -66,8 +65,7 @@ Scratch get_scratch(const std::array<MatrixType, Dim>& matrices,
     }
   }
   Scratch result{};
-  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
-  result.buffer = cpp20::make_unique_for_overwrite<double[]>(2 * size);
+  result.buffer = memory_pool::make_unique_for_overwrite<double>(2 * size);
   result.a = &result.buffer[0];
   result.b = &result.buffer[size];
   return result;
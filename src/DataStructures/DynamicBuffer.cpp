@@ -13,7 +13,7 @@ DynamicBuffer<T>::DynamicBuffer(const size_t number_of_vectors,
                                 const size_t number_of_grid_points)
     : number_of_grid_points_(number_of_grid_points), data_(number_of_vectors) {
   if constexpr (is_data_vector_type) {
-    buffer_.resize(number_of_vectors * number_of_grid_points);
+    buffer_.destructive_resize(number_of_vectors * number_of_grid_points);
     set_references();
   } else {
     static_assert(
@@ -82,7 +82,9 @@ class DynamicBuffer {
   // fundamental type T the data is saved in `data_` directly.
   std::vector<T> data_;
   // memory buffer for all DataVectors. Unused in case of fundamental type T.
-  std::vector<double> buffer_;
+  // This is an owning `DataVector` rather than a `std::vector` so the memory
+  // comes from the `memory_pool` and isn't value-initialized.
+  DataVector buffer_{};
 };
 
 template <typename T>
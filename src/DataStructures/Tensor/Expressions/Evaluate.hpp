@@ -6,10 +6,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <blaze/math/Subvector.h>
 #include <complex>
 #include <cstddef>
 #include <type_traits>
+#include <utility>
 
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -95,6 +98,12 @@ constexpr bool is_evaluated_lhs_multi_index(
   return true;
 }
 
+/// The number of grid points of each component that `tenex::evaluate_fused`
+/// computes at a time. All RHS operands of a block stay in the L1 cache for
+/// typical expressions, while the block is still long enough for the Blaze
+/// expressions to be vectorized.
+constexpr size_t fused_evaluation_block_size = 64;
+
 template <typename SymmList>
 struct CheckNoLhsAntiSymmetries;
 
@@ -133,20 +142,29 @@ struct CheckNoLhsAntiSymmetries<SymmList<Symm...>> {
  * implementation-dependent. Specifically, the safety of the operation depends
  * on the order of LHS component access and assignment.
  *
+ * If `FuseComponents == true`, the whole RHS expression is evaluated for all
+ * LHS components one block of `fused_evaluation_block_size` grid points at a
+ * time, instead of one LHS component at a time. This is only supported for
+ * vector data types and requires `EvaluateSubtrees == false`. The LHS tensor
+ * must not appear in the RHS expression.
+ *
  * \note `LhsTensorIndices` must be passed by reference because non-type
  * template parameters cannot be class types until C++20.
  *
  * @tparam EvaluateSubtrees whether or not to evaluate subtrees of RHS
  * expression
+ * @tparam FuseComponents whether or not to evaluate all LHS components in a
+ * single pass over the grid points
  * @tparam LhsTensorIndices the `TensorIndex`s of the `Tensor` on the LHS of the
  * tensor expression, e.g. `ti::a`, `ti::b`, `ti::c`
  * @param lhs_tensor pointer to the resultant LHS `Tensor` to fill
  * @param rhs_tensorexpression the RHS TensorExpression to be evaluated
  */
-template <bool EvaluateSubtrees, auto&... LhsTensorIndices,
-          typename LhsDataType, typename LhsSymmetry, typename LhsIndexList,
-          typename Derived, typename RhsDataType, typename RhsSymmetry,
-          typename RhsIndexList, typename... RhsTensorIndices>
+template <bool EvaluateSubtrees, bool FuseComponents,
+          auto&... LhsTensorIndices, typename LhsDataType,
+          typename LhsSymmetry, typename LhsIndexList, typename Derived,
+          typename RhsDataType, typename RhsSymmetry, typename RhsIndexList,
+          typename... RhsTensorIndices>
 void evaluate_impl(
     const gsl::not_null<Tensor<LhsDataType, LhsSymmetry, LhsIndexList>*>
         lhs_tensor,
@@ -232,7 +250,17 @@ void evaluate_impl(
                 "the derived TensorExpression types' member, "
                 "height_relative_to_closest_tensor_leaf_in_subtree.");
 
-  if constexpr (EvaluateSubtrees) {
+  static_assert(
+      not(FuseComponents and EvaluateSubtrees),
+      "Fused evaluation evaluates the RHS expression as a whole, so it cannot "
+      "be combined with the evaluation of subtrees.");
+  static_assert(
+      not FuseComponents or (is_derived_of_vector_impl_v<LhsDataType> and
+                             is_derived_of_vector_impl_v<RhsDataType>),
+      "Fused evaluation is only supported for Tensors whose data type is a "
+      "vector type, such as DataVector or ComplexDataVector.");
+
+  if constexpr (EvaluateSubtrees or FuseComponents) {
     // Make sure the LHS tensor doesn't also appear in the RHS tensor expression
     (~rhs_tensorexpression).assert_lhs_tensor_not_in_rhs_expression(lhs_tensor);
     // If the LHS data type is a vector, size the LHS tensor components if their
@@ -271,24 +299,72 @@ void evaluate_impl(
   using rhs_expression_type =
       typename std::decay_t<decltype(~rhs_tensorexpression)>;
 
+  // Maps the multi-index of a LHS component to the multi-index of the RHS
+  // component it is computed from
+  const auto get_rhs_multi_index =
+      [&index_transformation, &lhs_spatial_spacetime_index_positions,
+       &rhs_spatial_spacetime_index_positions](
+          std::array<size_t, num_lhs_indices> lhs_multi_index) {
+        for (size_t j = 0; j < lhs_spatial_spacetime_index_positions.size();
+             j++) {
+          gsl::at(lhs_multi_index,
+                  gsl::at(lhs_spatial_spacetime_index_positions, j)) -= 1;
+        }
+        auto rhs_multi_index =
+            transform_multi_index(lhs_multi_index, index_transformation);
+        for (size_t j = 0; j < rhs_spatial_spacetime_index_positions.size();
+             j++) {
+          gsl::at(rhs_multi_index,
+                  gsl::at(rhs_spatial_spacetime_index_positions, j)) += 1;
+        }
+        return rhs_multi_index;
+      };
+
+  if constexpr (FuseComponents) {
+    // The storage indices of the evaluated LHS components and the RHS
+    // multi-indices they are computed from
+    std::array<std::pair<size_t, std::array<size_t, num_rhs_indices>>,
+               lhs_tensor_type::size()>
+        evaluated_components{};
+    size_t number_of_evaluated_components = 0;
+    for (size_t i = 0; i < lhs_tensor_type::size(); i++) {
+      const auto lhs_multi_index =
+          lhs_tensor_type::structure::get_canonical_tensor_index(i);
+      if (is_evaluated_lhs_multi_index(lhs_multi_index,
+                                       lhs_spatial_spacetime_index_positions,
+                                       lhs_time_index_positions)) {
+        gsl::at(evaluated_components, number_of_evaluated_components) = {
+            i, get_rhs_multi_index(lhs_multi_index)};
+        ++number_of_evaluated_components;
+      }
+    }
+
+    // Each block of every RHS operand is loaded from memory once for all LHS
+    // components, instead of once per LHS component
+    const size_t number_of_points = get_size((*lhs_tensor)[0]);
+    for (size_t block_start = 0; block_start < number_of_points;
+         block_start += fused_evaluation_block_size) {
+      const size_t block_size = std::min(fused_evaluation_block_size,
+                                         number_of_points - block_start);
+      for (size_t k = 0; k < number_of_evaluated_components; k++) {
+        const auto& [lhs_storage_index, rhs_multi_index] =
+            gsl::at(evaluated_components, k);
+        blaze::subvector((*lhs_tensor)[lhs_storage_index], block_start,
+                         block_size, blaze::unchecked) =
+            blaze::subvector((~rhs_tensorexpression).get(rhs_multi_index),
+                             block_start, block_size, blaze::unchecked);
+      }
+    }
+    return;
+  }
+
   for (size_t i = 0; i < lhs_tensor_type::size(); i++) {
-    auto lhs_multi_index =
+    const auto lhs_multi_index =
         lhs_tensor_type::structure::get_canonical_tensor_index(i);
     if (is_evaluated_lhs_multi_index(lhs_multi_index,
                                      lhs_spatial_spacetime_index_positions,
                                      lhs_time_index_positions)) {
-      for (size_t j = 0; j < lhs_spatial_spacetime_index_positions.size();
-           j++) {
-        gsl::at(lhs_multi_index,
-                gsl::at(lhs_spatial_spacetime_index_positions, j)) -= 1;
-      }
-      auto rhs_multi_index =
-          transform_multi_index(lhs_multi_index, index_transformation);
-      for (size_t j = 0; j < rhs_spatial_spacetime_index_positions.size();
-           j++) {
-        gsl::at(rhs_multi_index,
-                gsl::at(rhs_spatial_spacetime_index_positions, j)) += 1;
-      }
+      const auto rhs_multi_index = get_rhs_multi_index(lhs_multi_index);
 
       // The expression will either be evaluated as one whole expression
       // or it will be split up into subtrees that are evaluated one at a time.
@@ -456,7 +532,53 @@ void evaluate(
       typename std::decay_t<decltype(~rhs_tensorexpression)>;
   constexpr bool evaluate_subtrees =
       rhs_expression_type::primary_subtree_contains_primary_start;
-  detail::evaluate_impl<evaluate_subtrees, LhsTensorIndices...>(
+  detail::evaluate_impl<evaluate_subtrees, false, LhsTensorIndices...>(
+      lhs_tensor, rhs_tensorexpression);
+}
+
+/*!
+ * \ingroup TensorExpressionsGroup
+ * \brief Assign the result of a RHS tensor expression to a tensor with the LHS
+ * index order set in the template parameters, computing all LHS components in
+ * a single pass over the grid points
+ *
+ * \details See `tenex::evaluate` for basic functionality.
+ *
+ * `tenex::evaluate` computes one LHS component at a time, so every RHS operand
+ * that contributes to several LHS components, e.g. the inverse metric in a
+ * contraction, is streamed from memory once per LHS component. Instead,
+ * `tenex::evaluate_fused` computes all LHS components for one block of
+ * `tenex::detail::fused_evaluation_block_size` grid points before moving on to
+ * the next block, so the operands of a block are reused from the cache. Within
+ * a block each component is still computed with a vectorized Blaze
+ * expression. The RHS expression is never split into subtrees (see the
+ * `TensorExpression` documentation), so this is most beneficial for
+ * expressions with few operations per component and many LHS components
+ * sharing the same operands, e.g. raising or lowering the indices of a
+ * higher-rank tensor.
+ *
+ * The LHS `Tensor` cannot be part of the RHS expression, and the data type of
+ * the tensors must be a vector type, such as `DataVector`.
+ *
+ * \note `LhsTensorIndices` must be passed by reference because non-type
+ * template parameters cannot be class types until C++20.
+ *
+ * @tparam LhsTensorIndices the `TensorIndex`s of the `Tensor` on the LHS of the
+ * tensor expression, e.g. `ti::a`, `ti::b`, `ti::c`
+ * @param lhs_tensor pointer to the resultant LHS `Tensor` to fill
+ * @param rhs_tensorexpression the RHS TensorExpression to be evaluated
+ */
+template <auto&... LhsTensorIndices, typename LhsDataType, typename LhsSymmetry,
+          typename LhsIndexList, typename Derived, typename RhsDataType,
+          typename RhsSymmetry, typename RhsIndexList,
+          typename... RhsTensorIndices>
+void evaluate_fused(
+    const gsl::not_null<Tensor<LhsDataType, LhsSymmetry, LhsIndexList>*>
+        lhs_tensor,
+    const TensorExpression<Derived, RhsDataType, RhsSymmetry, RhsIndexList,
+                           tmpl::list<RhsTensorIndices...>>&
+        rhs_tensorexpression) {
+  detail::evaluate_impl<false, true, LhsTensorIndices...>(
       lhs_tensor, rhs_tensorexpression);
 }
 
@@ -625,7 +747,7 @@ void update(
       .template assert_lhs_tensorindices_same_in_rhs<lhs_tensorindex_list>(
           lhs_tensor);
 
-  detail::evaluate_impl<false, LhsTensorIndices...>(lhs_tensor,
-                                                    rhs_tensorexpression);
+  detail::evaluate_impl<false, false, LhsTensorIndices...>(
+      lhs_tensor, rhs_tensorexpression);
 }
 }  // namespace tenex
@@ -37,7 +37,7 @@
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/MakeSignalingNan.hpp"
-#include "Utilities/MemoryHelpers.hpp"
+#include "Utilities/MemoryPool.hpp"
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/TMPL.hpp"
@@ -87,9 +87,10 @@ class Variables;
  * In Debug mode, or if the macro `SPECTRE_NAN_INIT` is defined, the contents
  * are initialized with `NaN`s.
  *
- * `Variables` stores the data it owns in a `std::unique_ptr<double[]>`
+ * `Variables` stores the data it owns in a `memory_pool::unique_array`
  * instead of a `std::vector` because `std::vector` value-initializes its
- * contents, which is very slow.
+ * contents, which is very slow. The memory comes from the `memory_pool`, so
+ * temporary `Variables` can reuse memory when the pool is enabled.
  */
 template <typename... Tags>
 class Variables<tmpl::list<Tags...>> {
@@ -551,7 +552,7 @@ class Variables<tmpl::list<Tags...>> {
 
   std::array<value_type, number_of_independent_components>
       variable_data_impl_static_;
-  std::unique_ptr<value_type[]> variable_data_impl_dynamic_{};
+  memory_pool::unique_array<value_type> variable_data_impl_dynamic_{};
   bool owning_{true};
   size_t size_ = 0;
   size_t number_of_grid_points_ = 0;
@@ -648,7 +649,7 @@ void Variables<tmpl::list<Tags...>>::initialize(
       variable_data_impl_dynamic_.reset();
     } else {
       variable_data_impl_dynamic_ =
-          cpp20::make_unique_for_overwrite<value_type[]>(size_);
+          memory_pool::make_unique_for_overwrite<value_type>(size_);
     }
     add_reference_variable_data();
 #if defined(SPECTRE_DEBUG) || defined(SPECTRE_NAN_INIT)
@@ -27,7 +27,7 @@
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeString.hpp"
 #include "Utilities/MakeWithValue.hpp"  // IWYU pragma: keep
-#include "Utilities/MemoryHelpers.hpp"
+#include "Utilities/MemoryPool.hpp"
 #include "Utilities/PrintHelpers.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/StdArrayHelpers.hpp"
@@ -298,7 +298,7 @@ class VectorImpl
   void pup(PUP::er& p);
 
  protected:
-  std::unique_ptr<value_type[]> owned_data_{};
+  memory_pool::unique_array<value_type> owned_data_{};
   std::array<T, StaticSize> static_owned_data_{};
   bool owning_{true};
 
@@ -323,10 +323,10 @@ class VectorImpl
     }
   }
 
-  SPECTRE_ALWAYS_INLINE std::unique_ptr<value_type[]> heap_alloc_if_necessary(
-      const size_t set_size) {
+  SPECTRE_ALWAYS_INLINE memory_pool::unique_array<value_type>
+  heap_alloc_if_necessary(const size_t set_size) {
     return set_size > StaticSize
-               ? cpp20::make_unique_for_overwrite<value_type[]>(set_size)
+               ? memory_pool::make_unique_for_overwrite<value_type>(set_size)
                : nullptr;
   }
 };
@@ -19,8 +19,13 @@
 class DataVector;
 template <size_t VolumeDim>
 class Domain;
+namespace domain {
+template <size_t Dim, typename Frame>
+class BlockSearchTree;
+}  // namespace domain
 /// \endcond
 
+/// @{
 /// \ingroup ComputationalDomainGroup
 ///
 /// Computes the block logical coordinates and the containing `BlockId` of
@@ -50,9 +55,40 @@ class Domain;
 /// typical use cases.  This means that `block_logical_coordinates`
 /// does not assume that grid and distorted frames are equal in
 /// `Block`s that lack a distorted frame.
+///
+/// \details The candidate blocks for each point are pruned with a
+/// `domain::BlockSearchTree` before any map is inverted. For time-independent
+/// domains the tree cached by `Domain::block_search_tree` is used. For
+/// time-dependent domains the tree is constructed at `time` for more than a few
+/// points, and otherwise all blocks are checked. The overload that takes a
+/// `domain::BlockSearchTree` allows reusing the tree across calls, e.g. when
+/// locating several sets of points at the same time. The tree should have been
+/// constructed from `domain` at `time`. Since its bounding boxes are only
+/// approximate, the blocks that aren't candidates are checked as well for
+/// points that no candidate block contains, so a tree constructed at a
+/// different time only costs performance. Points outside the domain therefore
+/// always cost a check of all blocks. In either case, the block that contained
+/// the previous point is tried first, which avoids the tree search for coherent
+/// point sets such as the collocation points of a `Strahlkorper`. The hint is
+/// only accepted for points in the interior of that block, so points on shared
+/// block boundaries are still assigned to the block with the smallest
+/// `BlockId`.
+template <size_t Dim, typename Frame>
+auto block_logical_coordinates(
+    const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Frame>& x,
+    double time = std::numeric_limits<double>::signaling_NaN(),
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time = std::unordered_map<
+            std::string,
+            std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>{})
+    -> std::vector<std::optional<
+        IdPair<domain::BlockId, tnsr::I<double, Dim, ::Frame::BlockLogical>>>>;
+
 template <size_t Dim, typename Frame>
 auto block_logical_coordinates(
     const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Frame>& x,
+    const domain::BlockSearchTree<Dim, Frame>& search_tree,
     double time = std::numeric_limits<double>::signaling_NaN(),
     const std::unordered_map<
         std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
@@ -61,3 +97,4 @@ auto block_logical_coordinates(
             std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>{})
     -> std::vector<std::optional<
         IdPair<domain::BlockId, tnsr::I<double, Dim, ::Frame::BlockLogical>>>>;
+/// @}
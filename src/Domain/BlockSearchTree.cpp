@@ -0,0 +1,245 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/BlockSearchTree.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/IndexIterator.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Block.hpp"
+#include "Domain/Domain.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace domain {
+namespace {
+template <size_t Dim>
+tnsr::I<DataVector, Dim, ::Frame::BlockLogical> sample_points(
+    const size_t points_per_dimension) {
+  const Index<Dim> extents(points_per_dimension);
+  tnsr::I<DataVector, Dim, ::Frame::BlockLogical> result(extents.product());
+  const double spacing = 2.0 / static_cast<double>(points_per_dimension - 1);
+  for (IndexIterator<Dim> index(extents); index; ++index) {
+    for (size_t d = 0; d < Dim; ++d) {
+      result.get(d)[index.collapsed_index()] =
+          -1.0 + spacing * static_cast<double>(index()[d]);
+    }
+  }
+  return result;
+}
+
+// Maps the block logical `points` to `Frame`, or returns `std::nullopt` if
+// the block can't contain points in `Frame`
+template <size_t Dim, typename Frame>
+std::optional<tnsr::I<DataVector, Dim, Frame>> map_sample_points(
+    const Block<Dim>& block,
+    const tnsr::I<DataVector, Dim, ::Frame::BlockLogical>& points,
+    const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time) {
+  tnsr::I<DataVector, Dim, Frame> result{};
+  if (block.is_time_dependent()) {
+    const auto grid_points = block.moving_mesh_logical_to_grid_map()(points);
+    if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+      result = block.moving_mesh_grid_to_inertial_map()(grid_points, time,
+                                                        functions_of_time);
+    } else if constexpr (std::is_same_v<Frame, ::Frame::Distorted>) {
+      if (not block.has_distorted_frame()) {
+        return std::nullopt;
+      }
+      result = block.moving_mesh_grid_to_distorted_map()(grid_points, time,
+                                                         functions_of_time);
+    } else {
+      static_assert(std::is_same_v<Frame, ::Frame::Grid>,
+                    "Cannot convert from given frame to Grid frame");
+      (void)time;
+      result = grid_points;
+    }
+  } else {
+    // If the map is time-independent, then the grid, distorted, and inertial
+    // frames are the same.
+    const auto inertial_points = block.stationary_map()(points);
+    for (size_t d = 0; d < Dim; ++d) {
+      result.get(d) = inertial_points.get(d);
+    }
+  }
+  return result;
+}
+}  // namespace
+
+template <size_t Dim, typename Frame>
+BlockSearchTree<Dim, Frame>::BlockSearchTree(
+    const Domain<Dim>& domain, const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time)
+    : number_of_blocks_(domain.blocks().size()),
+      bounding_boxes_(number_of_blocks_) {
+  const auto logical_points = sample_points<Dim>(points_per_dimension);
+  for (const auto& block : domain.blocks()) {
+    const auto mapped_points = map_sample_points<Dim, Frame>(
+        block, logical_points, time, functions_of_time);
+    if (not mapped_points.has_value()) {
+      continue;
+    }
+    std::array<std::array<double, Dim>, 2> box{};
+    double largest_side = 0.0;
+    for (size_t d = 0; d < Dim; ++d) {
+      const auto [min, max] = std::minmax_element(
+          mapped_points->get(d).begin(), mapped_points->get(d).end());
+      gsl::at(box[0], d) = *min;
+      gsl::at(box[1], d) = *max;
+      largest_side = std::max(largest_side, *max - *min);
+    }
+    const double padding = padding_fraction * largest_side;
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(box[0], d) -= padding;
+      gsl::at(box[1], d) += padding;
+    }
+    bounding_boxes_[block.id()] = box;
+    ordered_block_ids_.push_back(block.id());
+  }
+  if (not ordered_block_ids_.empty()) {
+    nodes_.reserve(2 * ordered_block_ids_.size());
+    build_node(0, ordered_block_ids_.size());
+  }
+}
+
+template <size_t Dim, typename Frame>
+size_t BlockSearchTree<Dim, Frame>::build_node(const size_t begin,
+                                               const size_t end) {
+  const size_t node_index = nodes_.size();
+  nodes_.emplace_back();
+  Node node{};
+  node.begin = begin;
+  node.end = end;
+  node.lower_bound = (*bounding_boxes_[ordered_block_ids_[begin]])[0];
+  node.upper_bound = (*bounding_boxes_[ordered_block_ids_[begin]])[1];
+  for (size_t i = begin + 1; i < end; ++i) {
+    const auto& box = *bounding_boxes_[ordered_block_ids_[i]];
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(node.lower_bound, d) =
+          std::min(gsl::at(node.lower_bound, d), gsl::at(box[0], d));
+      gsl::at(node.upper_bound, d) =
+          std::max(gsl::at(node.upper_bound, d), gsl::at(box[1], d));
+    }
+  }
+  if (end - begin > max_blocks_per_leaf) {
+    // Split along the axis in which the centers of the boxes are spread the
+    // most, putting half of the blocks in each child
+    const auto center = [this](const size_t block_id, const size_t d) {
+      const auto& box = *bounding_boxes_[block_id];
+      return 0.5 * (gsl::at(box[0], d) + gsl::at(box[1], d));
+    };
+    size_t split_dim = 0;
+    double largest_spread = -1.0;
+    for (size_t d = 0; d < Dim; ++d) {
+      double min_center = center(ordered_block_ids_[begin], d);
+      double max_center = min_center;
+      for (size_t i = begin + 1; i < end; ++i) {
+        min_center = std::min(min_center, center(ordered_block_ids_[i], d));
+        max_center = std::max(max_center, center(ordered_block_ids_[i], d));
+      }
+      if (max_center - min_center > largest_spread) {
+        largest_spread = max_center - min_center;
+        split_dim = d;
+      }
+    }
+    const size_t middle = begin + (end - begin) / 2;
+    std::nth_element(
+        ordered_block_ids_.begin() + static_cast<std::ptrdiff_t>(begin),
+        ordered_block_ids_.begin() + static_cast<std::ptrdiff_t>(middle),
+        ordered_block_ids_.begin() + static_cast<std::ptrdiff_t>(end),
+        [&center, &split_dim](const size_t lhs, const size_t rhs) {
+          return center(lhs, split_dim) < center(rhs, split_dim);
+        });
+    node.left_child = build_node(begin, middle);
+    node.right_child = build_node(middle, end);
+  }
+  nodes_[node_index] = node;
+  return node_index;
+}
+
+template <size_t Dim, typename Frame>
+bool BlockSearchTree<Dim, Frame>::bounding_box_contains(
+    const size_t block_id, const tnsr::I<double, Dim, Frame>& x) const {
+  ASSERT(block_id < number_of_blocks_,
+         "Block ID " << block_id << " is out of range for a domain with "
+                     << number_of_blocks_ << " blocks.");
+  const auto& box = bounding_boxes_[block_id];
+  if (not box.has_value()) {
+    return false;
+  }
+  for (size_t d = 0; d < Dim; ++d) {
+    if (x.get(d) < gsl::at((*box)[0], d) or x.get(d) > gsl::at((*box)[1], d)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <size_t Dim, typename Frame>
+void BlockSearchTree<Dim, Frame>::candidate_blocks(
+    const gsl::not_null<std::vector<size_t>*> candidates,
+    const tnsr::I<double, Dim, Frame>& x) const {
+  candidates->clear();
+  if (nodes_.empty()) {
+    return;
+  }
+  // The depth of the tree is logarithmic in the number of blocks, so this
+  // stack stays small
+  std::array<size_t, 64> stack{};
+  size_t stack_size = 0;
+  gsl::at(stack, stack_size++) = 0;
+  while (stack_size > 0) {
+    const Node& node = nodes_[gsl::at(stack, --stack_size)];
+    bool node_contains_x = true;
+    for (size_t d = 0; d < Dim; ++d) {
+      if (x.get(d) < gsl::at(node.lower_bound, d) or
+          x.get(d) > gsl::at(node.upper_bound, d)) {
+        node_contains_x = false;
+        break;
+      }
+    }
+    if (not node_contains_x) {
+      continue;
+    }
+    if (node.left_child == no_child) {
+      for (size_t i = node.begin; i < node.end; ++i) {
+        if (bounding_box_contains(ordered_block_ids_[i], x)) {
+          candidates->push_back(ordered_block_ids_[i]);
+        }
+      }
+    } else {
+      gsl::at(stack, stack_size++) = node.right_child;
+      gsl::at(stack, stack_size++) = node.left_child;
+    }
+  }
+  // Blocks are checked in order of their ID so that points on shared block
+  // boundaries are assigned to the block with the smallest ID
+  std::sort(candidates->begin(), candidates->end());
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+#define FRAME(data) BOOST_PP_TUPLE_ELEM(1, data)
+
+#define INSTANTIATE(_, data) \
+  template class BlockSearchTree<DIM(data), FRAME(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3),
+                        (::Frame::Grid, ::Frame::Distorted, ::Frame::Inertial))
+
+#undef FRAME
+#undef DIM
+#undef INSTANTIATE
+}  // namespace domain
@@ -0,0 +1,108 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+template <size_t VolumeDim>
+class Domain;
+/// \endcond
+
+namespace domain {
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief A bounding-volume hierarchy over the `Block`s of a `Domain`, used to
+ * prune the blocks whose maps have to be inverted to locate a point.
+ *
+ * \details Each block is enclosed in an axis-aligned bounding box in `Frame`.
+ * The box is computed by mapping a uniform grid of
+ * `points_per_dimension` block logical points per dimension and padding the
+ * result by `padding_fraction` of its largest side, which accounts for the
+ * curvature of the block's faces between the sampled points. The boxes are
+ * then sorted into a binary tree by recursively splitting the set of blocks
+ * along the axis in which their centers are spread the most, so a point can
+ * be tested against all boxes in \f$O(\log N_\mathrm{blocks})\f$.
+ *
+ * For time-dependent blocks the boxes in the `Frame::Inertial` and
+ * `Frame::Distorted` frames are computed by mapping the (time-independent)
+ * grid-frame samples to `time`. This only requires forward map evaluations, so
+ * the tree is cheap to rebuild whenever the time changes. Blocks that lack a
+ * distorted frame are never candidates for points in `Frame::Distorted`,
+ * consistent with `block_logical_coordinates`.
+ *
+ * \see block_logical_coordinates
+ */
+template <size_t Dim, typename Frame>
+class BlockSearchTree {
+ public:
+  /// Number of block logical points per dimension at which the maps are
+  /// sampled to construct the bounding boxes
+  static constexpr size_t points_per_dimension = 9;
+  /// Padding added to the sampled bounding boxes, as a fraction of their
+  /// largest side
+  static constexpr double padding_fraction = 0.1;
+
+  BlockSearchTree() = default;
+
+  BlockSearchTree(
+      const Domain<Dim>& domain,
+      double time = std::numeric_limits<double>::signaling_NaN(),
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time = std::unordered_map<
+              std::string,
+              std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>{});
+
+  /// The number of blocks in the domain the tree was constructed from
+  size_t number_of_blocks() const { return number_of_blocks_; }
+
+  /// Whether the bounding box of the block `block_id` contains `x`
+  bool bounding_box_contains(size_t block_id,
+                             const tnsr::I<double, Dim, Frame>& x) const;
+
+  /// Sets `candidates` to the IDs of all blocks whose bounding box contains
+  /// `x`, in increasing order
+  void candidate_blocks(gsl::not_null<std::vector<size_t>*> candidates,
+                        const tnsr::I<double, Dim, Frame>& x) const;
+
+ private:
+  static constexpr size_t no_child = std::numeric_limits<size_t>::max();
+  static constexpr size_t max_blocks_per_leaf = 2;
+
+  struct Node {
+    std::array<double, Dim> lower_bound{};
+    std::array<double, Dim> upper_bound{};
+    // Range of `ordered_block_ids_` covered by this node
+    size_t begin = 0;
+    size_t end = 0;
+    size_t left_child = no_child;
+    size_t right_child = no_child;
+  };
+
+  size_t build_node(size_t begin, size_t end);
+
+  size_t number_of_blocks_ = 0;
+  // Bounding boxes indexed by block ID. Blocks that can never contain a point
+  // in `Frame` have no box.
+  std::vector<std::optional<std::array<std::array<double, Dim>, 2>>>
+      bounding_boxes_{};
+  // IDs of all blocks that have a bounding box, ordered such that the blocks
+  // below each node of the tree are contiguous
+  std::vector<size_t> ordered_block_ids_{};
+  std::vector<Node> nodes_{};
+};
+}  // namespace domain
@@ -3,9 +3,14 @@
 
 #include "Domain/Domain.hpp"
 
+#include <memory>
+#include <mutex>
 #include <ostream>
 #include <pup.h>  // IWYU pragma: keep
+#include <tuple>
 
+#include "DataStructures/Tensor/IndexType.hpp"
+#include "Domain/BlockSearchTree.hpp"
 #include "Domain/CoordinateMaps/CoordinateMap.hpp"  // IWYU pragma: keep
 #include "Domain/DomainHelpers.hpp"
 #include "Domain/Structure/BlockNeighbor.hpp"  // IWYU pragma: keep
@@ -15,14 +20,34 @@
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 
-namespace Frame {
-struct Inertial;
-struct BlockLogical;
-}  // namespace Frame
+template <size_t VolumeDim>
+struct Domain<VolumeDim>::BlockSearchTrees {
+  std::mutex mutex{};
+  std::tuple<std::unique_ptr<domain::BlockSearchTree<VolumeDim, Frame::Grid>>,
+             std::unique_ptr<
+                 domain::BlockSearchTree<VolumeDim, Frame::Distorted>>,
+             std::unique_ptr<
+                 domain::BlockSearchTree<VolumeDim, Frame::Inertial>>>
+      trees{};
+};
+
+template <size_t VolumeDim>
+Domain<VolumeDim>::Domain()
+    : block_search_trees_(std::make_unique<BlockSearchTrees>()) {}
+
+template <size_t VolumeDim>
+Domain<VolumeDim>::~Domain() = default;
+
+template <size_t VolumeDim>
+Domain<VolumeDim>::Domain(Domain&&) = default;
+
+template <size_t VolumeDim>
+Domain<VolumeDim>& Domain<VolumeDim>::operator=(Domain<VolumeDim>&&) = default;
 
 template <size_t VolumeDim>
 Domain<VolumeDim>::Domain(std::vector<Block<VolumeDim>> blocks)
-    : blocks_(std::move(blocks)) {}
+    : blocks_(std::move(blocks)),
+      block_search_trees_(std::make_unique<BlockSearchTrees>()) {}
 
 template <size_t VolumeDim>
 Domain<VolumeDim>::Domain(
@@ -34,7 +59,8 @@ Domain<VolumeDim>::Domain(
     std::unordered_map<std::string, std::unordered_set<std::string>>
         block_groups)
     : excision_spheres_(std::move(excision_spheres)),
-      block_groups_(std::move(block_groups)) {
+      block_groups_(std::move(block_groups)),
+      block_search_trees_(std::make_unique<BlockSearchTrees>()) {
   std::vector<DirectionMap<VolumeDim, BlockNeighbor<VolumeDim>>>
       neighbors_of_all_blocks;
   set_internal_boundaries<VolumeDim>(&neighbors_of_all_blocks, maps);
@@ -61,7 +87,8 @@ Domain<VolumeDim>::Domain(
     std::unordered_map<std::string, std::unordered_set<std::string>>
         block_groups)
     : excision_spheres_(std::move(excision_spheres)),
-      block_groups_(std::move(block_groups)) {
+      block_groups_(std::move(block_groups)),
+      block_search_trees_(std::make_unique<BlockSearchTrees>()) {
   ASSERT(
       maps.size() == corners_of_all_blocks.size(),
       "Must pass same number of maps as block corner sets, but maps.size() == "
@@ -103,6 +130,7 @@ void Domain<VolumeDim>::inject_time_dependent_map_for_block(
       std::move(moving_mesh_grid_to_inertial_map),
       std::move(moving_mesh_grid_to_distorted_map),
       std::move(moving_mesh_distorted_to_inertial_map));
+  block_search_trees_ = std::make_unique<BlockSearchTrees>();
 }
 
 template <size_t VolumeDim>
@@ -112,6 +140,25 @@ bool Domain<VolumeDim>::is_time_dependent() const {
   });
 }
 
+template <size_t VolumeDim>
+template <typename Frame>
+const domain::BlockSearchTree<VolumeDim, Frame>&
+Domain<VolumeDim>::block_search_tree() const {
+  ASSERT(not is_time_dependent(),
+         "The search tree of a time-dependent domain depends on the time, so "
+         "it isn't cached. Construct a domain::BlockSearchTree instead.");
+  ASSERT(block_search_trees_ != nullptr,
+         "Can't use the search tree of a moved-from domain.");
+  const std::lock_guard lock{block_search_trees_->mutex};
+  auto& tree =
+      std::get<std::unique_ptr<domain::BlockSearchTree<VolumeDim, Frame>>>(
+          block_search_trees_->trees);
+  if (tree == nullptr) {
+    tree = std::make_unique<domain::BlockSearchTree<VolumeDim, Frame>>(*this);
+  }
+  return *tree;
+}
+
 template <size_t VolumeDim>
 bool operator==(const Domain<VolumeDim>& lhs, const Domain<VolumeDim>& rhs) {
   return lhs.blocks() == rhs.blocks() and
@@ -149,6 +196,9 @@ void Domain<VolumeDim>::pup(PUP::er& p) {
   if (version >= 1) {
     p | block_groups_;
   }
+  if (p.isUnpacking()) {
+    block_search_trees_ = std::make_unique<BlockSearchTrees>();
+  }
 }
 
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
@@ -164,6 +214,15 @@ void Domain<VolumeDim>::pup(PUP::er& p) {
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
 
+#undef INSTANTIATE
+
+#define INSTANTIATE(_, data)                                      \
+  template const domain::BlockSearchTree<DIM(data), FRAME(data)>& \
+  Domain<DIM(data)>::block_search_tree<FRAME(data)>() const;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3),
+                        (::Frame::Grid, ::Frame::Distorted, ::Frame::Inertial))
+
 #undef DIM
 #undef FRAME
 #undef INSTANTIATE
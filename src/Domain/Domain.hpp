@@ -29,6 +29,8 @@ class er;
 }  // namespace PUP
 /// \cond
 namespace domain {
+template <size_t Dim, typename Frame>
+class BlockSearchTree;
 template <typename SourceFrame, typename TargetFrame, size_t Dim>
 class CoordinateMapBase;
 }  // namespace domain
@@ -114,12 +116,12 @@ class Domain {
          std::unordered_map<std::string, std::unordered_set<std::string>>
              block_groups = {});
 
-  Domain() = default;
-  ~Domain() = default;
+  Domain();
+  ~Domain();
   Domain(const Domain&) = delete;
-  Domain(Domain&&) = default;
+  Domain(Domain&&);
   Domain<VolumeDim>& operator=(const Domain<VolumeDim>&) = delete;
-  Domain<VolumeDim>& operator=(Domain<VolumeDim>&&) = default;
+  Domain<VolumeDim>& operator=(Domain<VolumeDim>&&);
 
   void inject_time_dependent_map_for_block(
       size_t block_id,
@@ -137,6 +139,18 @@ class Domain {
 
   bool is_time_dependent() const;
 
+  /*!
+   * \brief The `domain::BlockSearchTree` of the blocks in `Frame`, which
+   * `block_logical_coordinates` uses to locate points.
+   *
+   * \details The tree is constructed the first time it is requested and reused
+   * afterwards. It is not serialized. This function can be called from
+   * multiple threads at once. Only time-independent domains cache the tree,
+   * because for time-dependent domains it depends on the time.
+   */
+  template <typename Frame>
+  const domain::BlockSearchTree<VolumeDim, Frame>& block_search_tree() const;
+
   const std::unordered_map<std::string, ExcisionSphere<VolumeDim>>&
   excision_spheres() const {
     return excision_spheres_;
@@ -159,6 +173,9 @@ class Domain {
       excision_spheres_{};
   std::unordered_map<std::string, std::unordered_set<std::string>>
       block_groups_{};
+  struct BlockSearchTrees;
+  // Built on first use by `block_search_tree()`
+  std::unique_ptr<BlockSearchTrees> block_search_trees_;
 };
 
 template <size_t VolumeDim>
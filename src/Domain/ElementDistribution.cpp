@@ -3,11 +3,14 @@
 
 #include "Domain/ElementDistribution.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
 #include <functional>
 #include <optional>
+#include <ostream>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -15,6 +18,7 @@
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/IndexType.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Block.hpp"
 #include "Domain/CreateInitialElement.hpp"
 #include "Domain/ElementMap.hpp"
@@ -22,11 +26,14 @@
 #include "Domain/Structure/CreateInitialMesh.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/HilbertCurve.hpp"
 #include "Domain/Structure/InitialElementIds.hpp"
+#include "Domain/Structure/SegmentId.hpp"
 #include "Domain/Structure/ZCurve.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Options/ParseOptions.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
@@ -76,8 +83,94 @@ double get_num_points_and_grid_spacing_cost(
 
   return mesh.number_of_grid_points() / sqrt(min_grid_spacing);
 }
+
+// The centers of the `element_ids` in `block` in the grid frame
+template <size_t Dim>
+std::vector<std::array<double, Dim>> grid_frame_element_centers(
+    const Block<Dim>& block, const std::vector<ElementId<Dim>>& element_ids) {
+  tnsr::I<DataVector, Dim, Frame::BlockLogical> logical_centers(
+      element_ids.size());
+  for (size_t i = 0; i < element_ids.size(); ++i) {
+    for (size_t d = 0; d < Dim; ++d) {
+      logical_centers.get(d)[i] = element_ids[i].segment_id(d).midpoint();
+    }
+  }
+  std::vector<std::array<double, Dim>> result(element_ids.size());
+  const auto copy_to_result = [&result](const auto& centers) {
+    for (size_t i = 0; i < result.size(); ++i) {
+      for (size_t d = 0; d < Dim; ++d) {
+        gsl::at(result[i], d) = centers.get(d)[i];
+      }
+    }
+  };
+  if (block.is_time_dependent()) {
+    copy_to_result(block.moving_mesh_logical_to_grid_map()(logical_centers));
+  } else {
+    // The grid and inertial frames coincide for time-independent blocks
+    copy_to_result(block.stationary_map()(logical_centers));
+  }
+  return result;
+}
+
+// Splits the elements in [begin, end) into `weights.size()` contiguous
+// sections with costs proportional to `weights`, and returns the index one past
+// the last element of each section. As in `BlockZCurveProcDistribution`, the
+// target cost of each section is recomputed from the cost that remains to be
+// distributed, and each section gets at least one element if any remain.
+std::vector<size_t> split_by_cost(const std::vector<double>& ordered_costs,
+                                  const size_t begin, const size_t end,
+                                  const std::vector<double>& weights) {
+  std::vector<size_t> section_ends(weights.size(), end);
+  double cost_remaining = 0.0;
+  for (size_t i = begin; i < end; ++i) {
+    cost_remaining += ordered_costs[i];
+  }
+  double weight_remaining = alg::accumulate(weights, 0.0);
+  size_t current = begin;
+  for (size_t section = 0; section + 1 < weights.size(); ++section) {
+    const double target_cost =
+        cost_remaining * weights[section] / weight_remaining;
+    double cost_of_section = 0.0;
+    if (current < end) {
+      cost_of_section = ordered_costs[current];
+      ++current;
+    }
+    while (current < end and
+           abs(target_cost - (cost_of_section + ordered_costs[current])) <
+               abs(target_cost - cost_of_section)) {
+      cost_of_section += ordered_costs[current];
+      ++current;
+    }
+    cost_remaining -= cost_of_section;
+    weight_remaining -= weights[section];
+    section_ends[section] = current;
+  }
+  return section_ends;
+}
+
+// The node of each global proc, assuming the procs on each node are numbered
+// contiguously
+std::vector<size_t> nodes_of_procs(const std::vector<size_t>& procs_per_node) {
+  std::vector<size_t> result{};
+  for (size_t node = 0; node < procs_per_node.size(); ++node) {
+    result.insert(result.end(), procs_per_node[node], node);
+  }
+  return result;
+}
 }  //  namespace
 
+std::ostream& operator<<(std::ostream& os,
+                         const ElementDistributionStrategy t) {
+  switch (t) {
+    case ElementDistributionStrategy::ZCurve:
+      return os << "ZCurve";
+    case ElementDistributionStrategy::HilbertCurve:
+      return os << "HilbertCurve";
+    default:
+      ERROR("Unknown element distribution strategy.");
+  }
+}
+
 template <size_t Dim>
 std::unordered_map<ElementId<Dim>, double> get_element_costs(
     const std::vector<Block<Dim>>& blocks,
@@ -305,10 +398,217 @@ size_t BlockZCurveProcDistribution<Dim>::get_proc_for_element(
       "of BlockZCurveProcDistribution.");
 }
 
+template <size_t Dim>
+HilbertCurveNodeProcDistribution<Dim>::HilbertCurveNodeProcDistribution(
+    const std::unordered_map<ElementId<Dim>, double>& element_costs,
+    const std::vector<size_t>& procs_per_node,
+    const std::vector<Block<Dim>>& blocks,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    const std::unordered_set<size_t>& global_procs_to_ignore) {
+  ASSERT(not blocks.empty(), "Must have a non-zero number of blocks.");
+  ASSERT(
+      initial_refinement_levels.size() == blocks.size(),
+      "`initial_refinement_levels` is not the same size as number of blocks");
+
+  // Collect the elements of all blocks and their positions
+  std::vector<std::array<double, Dim>> centers{};
+  for (const auto& block : blocks) {
+    const std::vector<ElementId<Dim>> block_element_ids = initial_element_ids(
+        block.id(), initial_refinement_levels[block.id()]);
+    const auto block_centers =
+        grid_frame_element_centers(block, block_element_ids);
+    ordered_element_ids_.insert(ordered_element_ids_.end(),
+                                block_element_ids.begin(),
+                                block_element_ids.end());
+    centers.insert(centers.end(), block_centers.begin(), block_centers.end());
+  }
+  const size_t num_elements = ordered_element_ids_.size();
+  ASSERT(element_costs.size() == num_elements,
+         "`element_costs` is not the same size as the total number of elements "
+         "computed from `initial_refinement_levels`");
+
+  // Quantize the centers on a uniform grid covering their bounding box and
+  // order the elements along the Hilbert curve through that grid. Elements
+  // that fall into the same grid cell are ordered by their ID so the
+  // distribution is deterministic.
+  std::array<double, Dim> lower_bound = centers[0];
+  std::array<double, Dim> upper_bound = centers[0];
+  for (const auto& center : centers) {
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(lower_bound, d) =
+          std::min(gsl::at(lower_bound, d), gsl::at(center, d));
+      gsl::at(upper_bound, d) =
+          std::max(gsl::at(upper_bound, d), gsl::at(center, d));
+    }
+  }
+  const auto largest_coordinate =
+      static_cast<double>(two_to_the(bits_per_dimension) - 1);
+  std::vector<std::pair<size_t, ElementId<Dim>>> curve_indices(num_elements);
+  for (size_t i = 0; i < num_elements; ++i) {
+    std::array<size_t, Dim> coords{};
+    for (size_t d = 0; d < Dim; ++d) {
+      const double extent = gsl::at(upper_bound, d) - gsl::at(lower_bound, d);
+      gsl::at(coords, d) =
+          extent > 0.0
+              ? static_cast<size_t>(std::round(
+                    largest_coordinate *
+                    (gsl::at(centers[i], d) - gsl::at(lower_bound, d)) /
+                    extent))
+              : 0;
+    }
+    curve_indices[i] =
+        std::make_pair(hilbert_curve_index(coords, bits_per_dimension),
+                       ordered_element_ids_[i]);
+  }
+  alg::sort(curve_indices);
+  std::vector<double> ordered_costs(num_elements);
+  for (size_t i = 0; i < num_elements; ++i) {
+    ordered_element_ids_[i] = curve_indices[i].second;
+    ordered_costs[i] = element_costs.at(ordered_element_ids_[i]);
+  }
+
+  // The procs on each node that may have elements. Nodes without such procs
+  // are skipped entirely.
+  std::vector<std::vector<size_t>> usable_procs_by_node{};
+  std::vector<double> node_weights{};
+  size_t first_proc_on_node = 0;
+  for (const size_t procs_on_node : procs_per_node) {
+    std::vector<size_t> usable_procs{};
+    for (size_t proc = first_proc_on_node;
+         proc < first_proc_on_node + procs_on_node; ++proc) {
+      if (global_procs_to_ignore.count(proc) == 0) {
+        usable_procs.push_back(proc);
+      }
+    }
+    first_proc_on_node += procs_on_node;
+    if (not usable_procs.empty()) {
+      node_weights.push_back(static_cast<double>(usable_procs.size()));
+      usable_procs_by_node.push_back(std::move(usable_procs));
+    }
+  }
+  ASSERT(not usable_procs_by_node.empty(),
+         "Must have a non-zero number of processors to distribute elements "
+         "to.");
+
+  // Split the curve between nodes first, then split the section of each node
+  // between its procs
+  const std::vector<size_t> node_ends =
+      split_by_cost(ordered_costs, 0, num_elements, node_weights);
+  size_t node_begin = 0;
+  for (size_t node = 0; node < usable_procs_by_node.size(); ++node) {
+    const auto& usable_procs = usable_procs_by_node[node];
+    const std::vector<size_t> proc_ends =
+        split_by_cost(ordered_costs, node_begin, node_ends[node],
+                      std::vector<double>(usable_procs.size(), 1.0));
+    size_t element_index = node_begin;
+    for (size_t i = 0; i < usable_procs.size(); ++i) {
+      for (; element_index < proc_ends[i]; ++element_index) {
+        element_procs_.emplace(ordered_element_ids_[element_index],
+                               usable_procs[i]);
+      }
+    }
+    node_begin = node_ends[node];
+  }
+}
+
+template <size_t Dim>
+size_t HilbertCurveNodeProcDistribution<Dim>::get_proc_for_element(
+    const ElementId<Dim>& element_id) const {
+  const auto found_proc = element_procs_.find(element_id);
+  if (found_proc == element_procs_.end()) {
+    ERROR("Element " << element_id
+                     << " is not one of the initial elements of the domain.");
+  }
+  return found_proc->second;
+}
+
+template <size_t Dim>
+ElementDistributionStatistics element_distribution_statistics(
+    const std::vector<Block<Dim>>& blocks,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    const std::unordered_map<ElementId<Dim>, double>& element_costs,
+    const std::vector<size_t>& procs_per_node,
+    const std::function<size_t(const ElementId<Dim>&)>& proc_for_element) {
+  const std::vector<size_t> node_of_proc = nodes_of_procs(procs_per_node);
+  std::unordered_map<size_t, size_t> elements_per_proc{};
+  std::unordered_map<size_t, size_t> cross_proc_faces_per_proc{};
+  std::unordered_map<size_t, double> cost_per_proc{};
+  std::unordered_set<size_t> nodes_with_elements{};
+  ElementDistributionStatistics result{};
+  // Each internal face is seen from both sides
+  size_t internal_face_sides = 0;
+  size_t cross_proc_face_sides = 0;
+  size_t cross_node_face_sides = 0;
+  double total_cost = 0.0;
+  for (const auto& block : blocks) {
+    for (const auto& element_id : initial_element_ids(
+             block.id(), initial_refinement_levels[block.id()])) {
+      const size_t proc = proc_for_element(element_id);
+      ASSERT(proc < node_of_proc.size(),
+             "Element " << element_id << " is assigned to proc " << proc
+                        << ", but there are only " << node_of_proc.size()
+                        << " procs.");
+      ++result.number_of_elements;
+      ++elements_per_proc[proc];
+      cost_per_proc[proc] += element_costs.at(element_id);
+      total_cost += element_costs.at(element_id);
+      nodes_with_elements.insert(node_of_proc[proc]);
+      const Element<Dim> element =
+          Initialization::create_initial_element(element_id, block,
+                                                 initial_refinement_levels);
+      for (const auto& [direction, neighbors] : element.neighbors()) {
+        (void)direction;
+        for (const auto& neighbor_id : neighbors) {
+          ++internal_face_sides;
+          const size_t neighbor_proc = proc_for_element(neighbor_id);
+          if (neighbor_proc != proc) {
+            ++cross_proc_face_sides;
+            ++cross_proc_faces_per_proc[proc];
+            if (node_of_proc.at(neighbor_proc) != node_of_proc[proc]) {
+              ++cross_node_face_sides;
+            }
+          }
+        }
+      }
+    }
+  }
+  result.number_of_procs_with_elements = elements_per_proc.size();
+  result.number_of_nodes_with_elements = nodes_with_elements.size();
+  result.number_of_internal_faces = internal_face_sides / 2;
+  result.number_of_cross_proc_faces = cross_proc_face_sides / 2;
+  result.number_of_cross_node_faces = cross_node_face_sides / 2;
+  double max_cost = 0.0;
+  for (const auto& [proc, num_elements] : elements_per_proc) {
+    const double surface_to_volume =
+        static_cast<double>(cross_proc_faces_per_proc[proc]) /
+        static_cast<double>(num_elements);
+    result.max_surface_to_volume =
+        std::max(result.max_surface_to_volume, surface_to_volume);
+    result.average_surface_to_volume += surface_to_volume;
+    max_cost = std::max(max_cost, cost_per_proc[proc]);
+  }
+  if (not elements_per_proc.empty()) {
+    const auto num_procs = static_cast<double>(elements_per_proc.size());
+    result.average_surface_to_volume /= num_procs;
+    result.load_imbalance = max_cost * num_procs / total_cost;
+  }
+  return result;
+}
+
 #define GET_DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATION(r, data)                                               \
   template class BlockZCurveProcDistribution<GET_DIM(data)>;                 \
+  template class HilbertCurveNodeProcDistribution<GET_DIM(data)>;            \
+  template ElementDistributionStatistics element_distribution_statistics(    \
+      const std::vector<Block<GET_DIM(data)>>& blocks,                       \
+      const std::vector<std::array<size_t, GET_DIM(data)>>&                  \
+          initial_refinement_levels,                                         \
+      const std::unordered_map<ElementId<GET_DIM(data)>, double>&            \
+          element_costs,                                                     \
+      const std::vector<size_t>& procs_per_node,                             \
+      const std::function<size_t(const ElementId<GET_DIM(data)>&)>&          \
+          proc_for_element);                                                 \
   double get_num_points_and_grid_spacing_cost(                               \
       const ElementId<GET_DIM(data)>& element_id,                            \
       const Block<GET_DIM(data)>& block,                                     \
@@ -330,3 +630,20 @@ GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
 #undef GET_DIM
 #undef INSTANTIATION
 }  // namespace domain
+
+template <>
+domain::ElementDistributionStrategy
+Options::create_from_yaml<domain::ElementDistributionStrategy>::create<void>(
+    const Options::Option& options) {
+  const auto type_read = options.parse_as<std::string>();
+  if ("ZCurve" == type_read) {
+    return domain::ElementDistributionStrategy::ZCurve;
+  } else if ("HilbertCurve" == type_read) {
+    return domain::ElementDistributionStrategy::HilbertCurve;
+  }
+  PARSE_ERROR(options.context(),
+              "Failed to convert \""
+                  << type_read
+                  << "\" to domain::ElementDistributionStrategy. Must be one "
+                     "of ZCurve or HilbertCurve.");
+}
@@ -5,6 +5,8 @@
 
 #include <array>
 #include <cstddef>
+#include <functional>
+#include <iosfwd>
 #include <optional>
 #include <unordered_map>
 #include <unordered_set>
@@ -21,6 +23,14 @@ namespace Spectral {
 enum class Quadrature;
 }  // namespace Spectral
 
+/// \cond
+namespace Options {
+class Option;
+template <typename T>
+struct create_from_yaml;
+}  // namespace Options
+/// \endcond
+
 namespace domain {
 /// The weighting scheme for assigning computational costs to `Element`s for
 /// distributing balanced compuational costs per processor (see
@@ -39,6 +49,20 @@ enum class ElementWeight {
   NumGridPointsAndGridSpacing
 };
 
+/// The strategy for distributing `Element`s to processors
+enum class ElementDistributionStrategy {
+  /// Order the `Element`s in each `Block` along a Morton curve and assign them
+  /// to processors in order of their `Block` (see
+  /// `BlockZCurveProcDistribution`)
+  ZCurve,
+  /// Order all `Element`s along a Hilbert curve through their physical
+  /// positions and assign them first to nodes and then to the processors on
+  /// each node (see `HilbertCurveNodeProcDistribution`)
+  HilbertCurve
+};
+
+std::ostream& operator<<(std::ostream& os, ElementDistributionStrategy t);
+
 /// \brief Get the cost of each `Element` in a list of `Block`s where
 /// `element_weight` specifies which weight distribution scheme to use
 ///
@@ -106,7 +130,7 @@ std::unordered_map<ElementId<Dim>, double> get_element_costs(
  * assigned in no more than two orthogonally connected clusters. In principle, a
  * Hilbert curve could potentially improve upon the gains obtained by this class
  * by guaranteeing that all elements within each block form a single
- * orthogonally connected cluster.
+ * orthogonally connected cluster (see `HilbertCurveNodeProcDistribution`).
  *
  * The assignment of portions of blocks to processors may use partial blocks,
  * and/or multiple blocks to ensure an even distribution of elements to
@@ -117,6 +141,7 @@ std::unordered_map<ElementId<Dim>, double> get_element_costs(
  * globally, though it would likely be more efficient to prioritize minimization
  * of inter-node communication, because communication across interconnects is
  * the primary cost of communication in charm++ runs.
+ * `HilbertCurveNodeProcDistribution` implements this prioritization.
  *
  * \warning The use of the Morton curve to generate a well-clustered element
  * distribution currently assumes that the refinement is uniform over each
@@ -163,4 +188,125 @@ struct BlockZCurveProcDistribution {
   std::vector<std::vector<std::pair<size_t, size_t>>>
       block_element_distribution_;
 };
+
+/*!
+ * \brief Distribution strategy for assigning elements to CPUs using a Hilbert
+ * space-filling curve through the physical positions of all `Element`s, which
+ * first divides the `Element`s between nodes and then between the CPUs on each
+ * node
+ *
+ * \details The `Element`s of all `Block`s are ordered along a single Hilbert
+ * curve (see `hilbert_curve_index`) through the centers of the `Element`s in
+ * the grid frame. The centers are quantized on a uniform grid with
+ * \f$2^b\f$ points per dimension spanning their bounding box, where \f$b\f$
+ * is `bits_per_dimension`. Because the curve is built from physical positions
+ * rather than from the `SegmentId`s within each `Block`, it runs continuously
+ * across `Block` boundaries regardless of the relative orientation of
+ * neighboring `Block`s, so a contiguous section of the curve that spans
+ * several `Block`s still forms a compact cluster. In contrast,
+ * `BlockZCurveProcDistribution` traverses the `Block`s in the order of their
+ * IDs, which need not be neighbors.
+ *
+ * The curve is then divided hierarchically. First, it is split into one
+ * contiguous section per node, where the target cost of each node is
+ * proportional to the number of CPUs on that node that are allowed to have
+ * `Element`s. Then the section of each node is split between the CPUs of that
+ * node. Both splits use the same adaptive target cost as
+ * `BlockZCurveProcDistribution`. Since the interfaces between the sections of
+ * different nodes are fixed before the CPUs within a node are considered, the
+ * surface of each node's cluster (and therefore the number of mortars that
+ * communicate across the interconnect) is minimized independently of how many
+ * CPUs share the node.
+ *
+ * Global CPU numbers are assumed to be contiguous on each node, as in
+ * Charm++, so the CPUs on node \f$n\f$ are numbered from
+ * \f$\sum_{m<n} N_m\f$ where \f$N_m\f$ is `procs_per_node[m]`.
+ *
+ * \tparam Dim the number of spatial dimensions of the `Block`s
+ */
+template <size_t Dim>
+class HilbertCurveNodeProcDistribution {
+ public:
+  /// The number of bits per dimension used to quantize the `Element` centers
+  static constexpr size_t bits_per_dimension = Dim == 3 ? 21 : 31;
+
+  /// The `procs_per_node` argument holds the total number of procs on each
+  /// node, including those in `global_procs_to_ignore`.
+  HilbertCurveNodeProcDistribution(
+      const std::unordered_map<ElementId<Dim>, double>& element_costs,
+      const std::vector<size_t>& procs_per_node,
+      const std::vector<Block<Dim>>& blocks,
+      const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+      const std::unordered_set<size_t>& global_procs_to_ignore = {});
+
+  /// Gets the suggested processor number for a particular `ElementId`
+  size_t get_proc_for_element(const ElementId<Dim>& element_id) const;
+
+  /// All `ElementId`s in the order in which they lie on the Hilbert curve
+  const std::vector<ElementId<Dim>>& ordered_element_ids() const {
+    return ordered_element_ids_;
+  }
+
+ private:
+  std::vector<ElementId<Dim>> ordered_element_ids_{};
+  std::unordered_map<ElementId<Dim>, size_t> element_procs_{};
+};
+
+/// Measures of the communication cost of an element distribution, as computed
+/// by `element_distribution_statistics`.
+///
+/// Here a "face" is a pair of neighboring `Element`s, i.e. a mortar, so an
+/// `Element` face that abuts two finer neighbors counts twice. Each face is
+/// counted once in the totals.
+struct ElementDistributionStatistics {
+  size_t number_of_elements = 0;
+  size_t number_of_procs_with_elements = 0;
+  size_t number_of_nodes_with_elements = 0;
+  /// Faces between two `Element`s of the domain, i.e. excluding external
+  /// boundaries
+  size_t number_of_internal_faces = 0;
+  /// Faces between `Element`s on different procs
+  size_t number_of_cross_proc_faces = 0;
+  /// Faces between `Element`s on different nodes
+  size_t number_of_cross_node_faces = 0;
+  /// The largest number of faces to other procs per `Element` on a single proc
+  double max_surface_to_volume = 0.0;
+  /// The number of faces to other procs per `Element`, averaged over all procs
+  /// that have `Element`s
+  double average_surface_to_volume = 0.0;
+  /// The largest cost on any proc divided by the average cost per proc
+  double load_imbalance = 0.0;
+};
+
+/// \brief Computes the `ElementDistributionStatistics` of the assignment of
+/// the initial `Element`s to procs given by `proc_for_element`
+///
+/// \details This allows comparing distribution strategies for a domain without
+/// running a simulation. The neighbors of each `Element` are found with
+/// `domain::Initialization::create_initial_element`, so the faces account for
+/// the orientation of neighboring `Block`s. Procs are assigned to nodes as
+/// described in `HilbertCurveNodeProcDistribution`.
+template <size_t Dim>
+ElementDistributionStatistics element_distribution_statistics(
+    const std::vector<Block<Dim>>& blocks,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    const std::unordered_map<ElementId<Dim>, double>& element_costs,
+    const std::vector<size_t>& procs_per_node,
+    const std::function<size_t(const ElementId<Dim>&)>& proc_for_element);
 }  // namespace domain
+
+/// \cond
+template <>
+struct Options::create_from_yaml<domain::ElementDistributionStrategy> {
+  template <typename Metavariables>
+  static domain::ElementDistributionStrategy create(
+      const Options::Option& options) {
+    return create<void>(options);
+  }
+};
+
+template <>
+domain::ElementDistributionStrategy
+Options::create_from_yaml<domain::ElementDistributionStrategy>::create<void>(
+    const Options::Option& options);
+/// \endcond
@@ -70,6 +70,13 @@ class FunctionOfTime : public PUP::able {
     ERROR("Cannot reset expiration time of this FunctionOfTime.");
   }
 
+  /// Discards the history of the function that is only needed to evaluate it
+  /// at times before `time`, so the function can't be evaluated before `time`
+  /// anymore. FunctionsOfTime that are updated during a run store a piece of
+  /// the function for every update, and this keeps their size bounded. By
+  /// default, a FunctionOfTime holds no history so this does nothing.
+  virtual void truncate_at_time(double /*time*/) {}
+
   /// The DataVector can be of any size
   virtual std::array<DataVector, 1> func(double t) const = 0;
   /// The DataVector can be of any size
@@ -3,8 +3,12 @@
 
 #include "Domain/FunctionsOfTime/FunctionOfTimeHelpers.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
 #include <pup.h>
 #include <pup_stl.h>
+#include <vector>
 
 #include "Utilities/EqualWithinRoundoff.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
@@ -89,6 +93,29 @@ const StoredInfo<MaxDerivPlusOne, StoreCoefs>& stored_info_from_upper_bound(
   return *std::prev(upper_bound_stored_info, 1);
 }
 
+template <size_t MaxDerivPlusOne, bool StoreCoefs>
+size_t truncate_stored_infos_at_time(
+    const gsl::not_null<std::vector<StoredInfo<MaxDerivPlusOne, StoreCoefs>>*>
+        all_stored_infos,
+    const double t) {
+  // Same search as in `stored_info_from_upper_bound`. The StoredInfo before
+  // the first one at or after `t` is needed to evaluate the function at `t`
+  // because the functions are left-continuous.
+  const auto upper_bound_stored_info = std::lower_bound(
+      all_stored_infos->begin(), all_stored_infos->end(), t,
+      [](const StoredInfo<MaxDerivPlusOne, StoreCoefs>& d, double t0) {
+        return d.time < t0;
+      });
+  if (std::distance(all_stored_infos->begin(), upper_bound_stored_info) <= 1) {
+    return 0;
+  }
+  const auto num_erased = static_cast<size_t>(
+      std::distance(all_stored_infos->begin(), upper_bound_stored_info) - 1);
+  all_stored_infos->erase(all_stored_infos->begin(),
+                          std::prev(upper_bound_stored_info, 1));
+  return num_erased;
+}
+
 template <size_t MaxDerivPlusOne, bool StoreCoefs>
 bool operator==(
     const domain::FunctionsOfTime::FunctionOfTimeHelpers::StoredInfo<
@@ -119,8 +146,8 @@ std::ostream& operator<<(std::ostream& os,
   return os;
 }
 
-// explicit instantiation of StoredInfo class and stored_info_from_upper_bound
-// function for MaxDerivPlusOne = {1,2,3,4,5}
+// explicit instantiation of StoredInfo class, stored_info_from_upper_bound and
+// truncate_stored_infos_at_time functions for MaxDerivPlusOne = {1,2,3,4,5}
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 #define STORECOEF(data) BOOST_PP_TUPLE_ELEM(1, data)
 
@@ -139,11 +166,15 @@ GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3, 4, 5), (true, false))
 
 #undef INSTANTIATE
 
-#define INSTANTIATE(_, data)                             \
-  template const StoredInfo<DIM(data), STORECOEF(data)>& \
-  stored_info_from_upper_bound(                          \
-      const double,                                      \
-      const std::vector<StoredInfo<DIM(data), STORECOEF(data)>>&);
+#define INSTANTIATE(_, data)                                        \
+  template const StoredInfo<DIM(data), STORECOEF(data)>&            \
+  stored_info_from_upper_bound(                                     \
+      const double,                                                 \
+      const std::vector<StoredInfo<DIM(data), STORECOEF(data)>>&);  \
+  template size_t truncate_stored_infos_at_time(                    \
+      const gsl::not_null<                                          \
+          std::vector<StoredInfo<DIM(data), STORECOEF(data)>>*>,    \
+      const double);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3, 4, 5), (true, false))
 
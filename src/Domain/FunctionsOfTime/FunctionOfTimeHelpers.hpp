@@ -7,9 +7,11 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <limits>
 #include <ostream>
 #include <pup.h>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "Utilities/Gsl.hpp"
@@ -68,6 +70,17 @@ const StoredInfo<MaxDerivPlusOne, StoreCoefs>& stored_info_from_upper_bound(
     const double t, const std::vector<StoredInfo<MaxDerivPlusOne, StoreCoefs>>&
                         all_stored_infos);
 
+/// Erases all StoredInfos from the front of `all_stored_infos` that are not
+/// needed to evaluate the function at times `t` or later. The StoredInfo that
+/// `stored_info_from_upper_bound` returns for `t` and all later StoredInfos are
+/// kept, so at least one StoredInfo always remains. Returns the number of
+/// erased StoredInfos.
+template <size_t MaxDerivPlusOne, bool StoreCoefs>
+size_t truncate_stored_infos_at_time(
+    gsl::not_null<std::vector<StoredInfo<MaxDerivPlusOne, StoreCoefs>>*>
+        all_stored_infos,
+    double t);
+
 template <size_t MaxDerivPlusOne, bool StoreCoefs>
 bool operator==(
     const domain::FunctionsOfTime::FunctionOfTimeHelpers::StoredInfo<
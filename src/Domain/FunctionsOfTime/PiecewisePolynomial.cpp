@@ -134,6 +134,12 @@ void PiecewisePolynomial<MaxDeriv>::reset_expiration_time(
                                                next_expiration_time);
 }
 
+template <size_t MaxDeriv>
+void PiecewisePolynomial<MaxDeriv>::truncate_at_time(const double time) {
+  FunctionOfTimeHelpers::truncate_stored_infos_at_time(
+      make_not_null(&deriv_info_at_update_times_), time);
+}
+
 template <size_t MaxDeriv>
 void PiecewisePolynomial<MaxDeriv>::pup(PUP::er& p) {
   FunctionOfTime::pup(p);
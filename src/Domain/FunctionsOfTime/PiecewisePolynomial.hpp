@@ -70,6 +70,11 @@ class PiecewisePolynomial : public FunctionOfTime {
   /// Resets the expiration time to a later time.
   void reset_expiration_time(double next_expiration_time) override;
 
+  /// Discards the pieces of the function that are only needed before `time`.
+  /// The lower bound of `time_bounds()` becomes the time of the earliest
+  /// remaining piece.
+  void truncate_at_time(double time) override;
+
   /// Returns the domain of validity of the function,
   /// including the extrapolation region.
   std::array<double, 2> time_bounds() const override {
@@ -50,6 +50,22 @@ void QuaternionFunctionOfTime<MaxDeriv>::update(
   update_stored_info();
 }
 
+template <size_t MaxDeriv>
+void QuaternionFunctionOfTime<MaxDeriv>::truncate_at_time(const double time) {
+  // The quaternions are stored at the same times as the angle pieces, so both
+  // are truncated consistently
+  angle_f_of_t_.truncate_at_time(time);
+  FunctionOfTimeHelpers::truncate_stored_infos_at_time(
+      make_not_null(&stored_quaternions_and_times_), time);
+  ASSERT(angle_f_of_t_.get_deriv_info().size() ==
+             stored_quaternions_and_times_.size(),
+         "The number of stored angles and quaternions differs after truncating "
+         "at time "
+             << time << ": " << angle_f_of_t_.get_deriv_info().size()
+             << " stored angles and " << stored_quaternions_and_times_.size()
+             << " stored quaternions.");
+}
+
 template <size_t MaxDeriv>
 void QuaternionFunctionOfTime<MaxDeriv>::update_stored_info() {
   const auto& angle_deriv_info = angle_f_of_t_.get_deriv_info();
@@ -82,6 +82,10 @@ class QuaternionFunctionOfTime : public FunctionOfTime {
     angle_f_of_t_.reset_expiration_time(next_expiration_time);
   }
 
+  /// Discards the stored quaternions and angle pieces that are only needed
+  /// before `time`.
+  void truncate_at_time(double time) override;
+
   /// Returns domain of validity for the function of time
   std::array<double, 2> time_bounds() const override {
     return angle_f_of_t_.time_bounds();
@@ -141,6 +145,13 @@ class QuaternionFunctionOfTime : public FunctionOfTime {
     return angle_f_of_t_.func_and_2_derivs(t);
   }
 
+  /// Return a const reference to the stored deriv info of the angle
+  /// PiecewisePolynomial
+  const std::vector<FunctionOfTimeHelpers::StoredInfo<MaxDeriv + 1>>&
+  get_angle_deriv_info() const {
+    return angle_f_of_t_.get_deriv_info();
+  }
+
  private:
   template <size_t LocalMaxDeriv>
   friend bool operator==(  // NOLINT(readability-redundant-declaration)
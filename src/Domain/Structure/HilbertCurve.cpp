@@ -0,0 +1,90 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/Structure/HilbertCurve.hpp"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace domain {
+
+template <size_t Dim>
+size_t hilbert_curve_index(const std::array<size_t, Dim>& coordinates,
+                           const size_t bits_per_dimension) {
+  ASSERT(bits_per_dimension > 0 and
+             Dim * bits_per_dimension <=
+                 static_cast<size_t>(std::numeric_limits<size_t>::digits),
+         "Cannot compute a Hilbert curve index with "
+             << bits_per_dimension << " bits in each of " << Dim
+             << " dimensions.");
+  std::array<size_t, Dim> x = coordinates;
+#ifdef SPECTRE_DEBUG
+  for (size_t d = 0; d < Dim; ++d) {
+    ASSERT(bits_per_dimension == std::numeric_limits<size_t>::digits or
+               gsl::at(x, d) < two_to_the(bits_per_dimension),
+           "Coordinate " << gsl::at(x, d) << " in dimension " << d
+                         << " doesn't fit in " << bits_per_dimension
+                         << " bits.");
+  }
+#endif  // SPECTRE_DEBUG
+
+  // Transform the coordinates in place to the "transposed" Hilbert index,
+  // working from the most significant bit down. At each level the lower bits
+  // are reflected and the axes exchanged so that the sub-curve in each
+  // quadrant connects to its neighbors.
+  const size_t most_significant_bit = two_to_the(bits_per_dimension - 1);
+  for (size_t q = most_significant_bit; q > 1; q >>= 1) {
+    const size_t lower_bits = q - 1;
+    for (size_t d = 0; d < Dim; ++d) {
+      if ((gsl::at(x, d) & q) != 0) {
+        gsl::at(x, 0) ^= lower_bits;
+      } else {
+        const size_t swapped_bits =
+            (gsl::at(x, 0) ^ gsl::at(x, d)) & lower_bits;
+        gsl::at(x, 0) ^= swapped_bits;
+        gsl::at(x, d) ^= swapped_bits;
+      }
+    }
+  }
+  // Gray encode
+  for (size_t d = 1; d < Dim; ++d) {
+    gsl::at(x, d) ^= gsl::at(x, d - 1);
+  }
+  size_t gray_correction = 0;
+  for (size_t q = most_significant_bit; q > 1; q >>= 1) {
+    if ((gsl::at(x, Dim - 1) & q) != 0) {
+      gray_correction ^= q - 1;
+    }
+  }
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(x, d) ^= gray_correction;
+  }
+
+  // Interleave the bits of the transposed index, most significant first
+  size_t index = 0;
+  for (size_t bit = bits_per_dimension; bit-- > 0;) {
+    for (size_t d = 0; d < Dim; ++d) {
+      index = (index << 1) | ((gsl::at(x, d) >> bit) & 1);
+    }
+  }
+  return index;
+}
+
+#define GET_DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data)                              \
+  template size_t hilbert_curve_index(                      \
+      const std::array<size_t, GET_DIM(data)>& coordinates, \
+      size_t bits_per_dimension);
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef GET_DIM
+#undef INSTANTIATION
+}  // namespace domain
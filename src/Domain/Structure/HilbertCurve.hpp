@@ -0,0 +1,36 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace domain {
+/// \brief Computes the index along a Hilbert curve of the point with integer
+/// coordinates `coordinates` on a grid with \f$2^b\f$ points per dimension,
+/// where \f$b\f$ is `bits_per_dimension`
+///
+/// \details Consecutive indices along the Hilbert curve always refer to grid
+/// points that are adjacent along a single axis, so any contiguous section of
+/// the curve forms a single orthogonally connected cluster. This is the
+/// property that distinguishes the Hilbert curve from the Morton curve (see
+/// `z_curve_index`), which permits diagonal and long-range jumps. Here is a
+/// sketch of the 2D curve on a grid with 4x4 points:
+///
+/// \code
+///        x-->
+///        0   1   2   3
+/// y  0 | 0   1  14  15
+/// |  1 | 3   2  13  12
+/// v  2 | 4   7   8  11
+///    3 | 5   6   9  10
+/// \endcode
+///
+/// The index is computed with the algorithm of \cite Skilling2004, which works
+/// in any number of dimensions. The product of `Dim` and `bits_per_dimension`
+/// must not exceed the number of bits in a `size_t`.
+template <size_t Dim>
+size_t hilbert_curve_index(const std::array<size_t, Dim>& coordinates,
+                           size_t bits_per_dimension);
+}  // namespace domain
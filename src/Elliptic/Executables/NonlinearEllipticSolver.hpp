@@ -28,6 +28,7 @@
 #include "ParallelAlgorithms/Actions/AddComputeTags.hpp"
 #include "ParallelAlgorithms/LinearSolver/Actions/MakeIdentityIfSkipped.hpp"
 #include "ParallelAlgorithms/LinearSolver/Gmres/Gmres.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Actions/ResetCoarseOperator.hpp"
 #include "ParallelAlgorithms/LinearSolver/Multigrid/Actions/RestrictFields.hpp"
 #include "ParallelAlgorithms/LinearSolver/Multigrid/Multigrid.hpp"
 #include "ParallelAlgorithms/LinearSolver/Schwarz/Actions/CommunicateOverlapFields.hpp"
@@ -233,6 +234,8 @@ struct Solver {
               typename schwarz_smoother::options_group>,
           LinearSolver::Schwarz::Actions::ResetSubdomainSolver<
               typename schwarz_smoother::options_group>,
+          LinearSolver::multigrid::Actions::ResetCoarseOperator<
+              volume_dim, typename multigrid::options_group>,
           typename linear_solver::template solve<tmpl::list<
               typename multigrid::template solve<
                   build_operator_actions<true>,
@@ -0,0 +1,201 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Elliptic/SubdomainPreconditioners/FastDiagonalization.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "Elliptic/DiscontinuousGalerkin/Penalty.hpp"
+#include "NumericalAlgorithms/LinearAlgebra/FindGeneralizedEigenvalues.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace elliptic::subdomain_preconditioners::detail {
+
+void flat_laplacian_1d(const gsl::not_null<Matrix*> stiffness,
+                       const gsl::not_null<DataVector*> mass,
+                       const std::vector<Mesh<1>>& meshes,
+                       const std::vector<double>& jacobians,
+                       const bool lower_boundary_is_dirichlet,
+                       const bool upper_boundary_is_dirichlet,
+                       const double penalty_parameter) {
+  ASSERT(not meshes.empty() and meshes.size() == jacobians.size(),
+         "Expected one Jacobian for each of the " << meshes.size()
+                                                  << " meshes, but got "
+                                                  << jacobians.size() << ".");
+  const size_t num_elements = meshes.size();
+  size_t num_points = 0;
+  for (const auto& mesh : meshes) {
+    num_points += mesh.number_of_grid_points();
+  }
+  *stiffness = Matrix(num_points, num_points, 0.);
+  mass->destructive_resize(num_points);
+
+  // Volume contributions, and the values and logical derivatives of the basis
+  // functions of every element at its lower and upper face
+  std::vector<size_t> offsets(num_elements);
+  std::vector<std::array<DataVector, 2>> face_values(num_elements);
+  std::vector<std::array<DataVector, 2>> face_derivatives(num_elements);
+  size_t offset = 0;
+  for (size_t element = 0; element < num_elements; ++element) {
+    const auto& mesh = meshes[element];
+    const double jacobian = jacobians[element];
+    const size_t num_element_points = mesh.number_of_grid_points();
+    const auto& weights = Spectral::quadrature_weights(mesh);
+    const Matrix& diff_matrix = Spectral::differentiation_matrix(mesh);
+    for (size_t i = 0; i < num_element_points; ++i) {
+      (*mass)[offset + i] = weights[i] * jacobian;
+      for (size_t j = 0; j < num_element_points; ++j) {
+        double integral = 0.;
+        for (size_t k = 0; k < num_element_points; ++k) {
+          integral += diff_matrix(k, i) * weights[k] * diff_matrix(k, j);
+        }
+        (*stiffness)(offset + i, offset + j) = integral / jacobian;
+      }
+    }
+    const Matrix face_interpolation =
+        Spectral::interpolation_matrix(mesh, DataVector{-1., 1.});
+    for (size_t side = 0; side < 2; ++side) {
+      auto& values = gsl::at(face_values[element], side);
+      auto& derivatives = gsl::at(face_derivatives[element], side);
+      values.destructive_resize(num_element_points);
+      derivatives = DataVector{num_element_points, 0.};
+      for (size_t i = 0; i < num_element_points; ++i) {
+        values[i] = face_interpolation(side, i);
+        for (size_t k = 0; k < num_element_points; ++k) {
+          derivatives[i] += face_interpolation(side, k) * diff_matrix(k, i);
+        }
+      }
+      derivatives /= jacobian;
+    }
+    offsets[element] = offset;
+    offset += num_element_points;
+  }
+
+  // Face contributions of the symmetric interior-penalty scheme. The `jump` is
+  // the jump of the field across the face in the direction of the `normal`,
+  // and the `normal_derivative` is the average normal derivative.
+  DataVector jump{num_points};
+  DataVector normal_derivative{num_points};
+  const auto add_face = [&stiffness, &jump, &normal_derivative,
+                         &num_points](const double penalty) {
+    for (size_t i = 0; i < num_points; ++i) {
+      for (size_t j = 0; j < num_points; ++j) {
+        (*stiffness)(i, j) += penalty * jump[i] * jump[j] -
+                              normal_derivative[i] * jump[j] -
+                              jump[i] * normal_derivative[j];
+      }
+    }
+  };
+  const auto element_penalty = [&meshes, &jacobians,
+                                &penalty_parameter](const size_t element) {
+    return elliptic::dg::penalty(DataVector{1, 2. * jacobians[element]},
+                                 meshes[element].number_of_grid_points(),
+                                 penalty_parameter)[0];
+  };
+  const auto set_face_data = [&offsets, &meshes, &face_values,
+                               &face_derivatives, &jump, &normal_derivative](
+                                 const size_t element, const size_t side,
+                                 const double jump_sign,
+                                 const double derivative_factor) {
+    const auto& values = gsl::at(face_values[element], side);
+    const auto& derivatives = gsl::at(face_derivatives[element], side);
+    for (size_t i = 0; i < meshes[element].number_of_grid_points(); ++i) {
+      jump[offsets[element] + i] = jump_sign * values[i];
+      normal_derivative[offsets[element] + i] =
+          derivative_factor * derivatives[i];
+    }
+  };
+  // Internal faces
+  for (size_t element = 0; element + 1 < num_elements; ++element) {
+    jump = 0.;
+    normal_derivative = 0.;
+    set_face_data(element, 1, 1., 0.5);
+    set_face_data(element + 1, 0, -1., 0.5);
+    // The penalty of internal faces uses the smaller element size and the
+    // larger number of points (see `elliptic::dg::DgOperator`)
+    add_face(elliptic::dg::penalty(
+        DataVector{1, 2. * std::min(jacobians[element],
+                                    jacobians[element + 1])},
+        std::max(meshes[element].number_of_grid_points(),
+                 meshes[element + 1].number_of_grid_points()),
+        penalty_parameter)[0]);
+  }
+  // Dirichlet boundaries. Neumann boundaries add no terms.
+  if (lower_boundary_is_dirichlet) {
+    jump = 0.;
+    normal_derivative = 0.;
+    set_face_data(0, 0, 1., -1.);
+    add_face(element_penalty(0));
+  }
+  if (upper_boundary_is_dirichlet) {
+    jump = 0.;
+    normal_derivative = 0.;
+    set_face_data(num_elements - 1, 1, 1., 1.);
+    add_face(element_penalty(num_elements - 1));
+  }
+}
+
+void fast_diagonalization_1d(const gsl::not_null<Matrix*> eigenvectors,
+                             const gsl::not_null<Matrix*> inverse_eigenvectors,
+                             const gsl::not_null<DataVector*> eigenvalues,
+                             const Matrix& stiffness, const DataVector& mass,
+                             const size_t first_point, const size_t num_points,
+                             const bool massive) {
+  ASSERT(first_point + num_points <= mass.size(),
+         "Can't restrict the operator of size "
+             << mass.size() << " to " << num_points
+             << " points starting at point " << first_point << ".");
+  Matrix restricted_stiffness(num_points, num_points);
+  Matrix restricted_mass(num_points, num_points, 0.);
+  for (size_t i = 0; i < num_points; ++i) {
+    for (size_t j = 0; j < num_points; ++j) {
+      restricted_stiffness(i, j) = stiffness(first_point + i, first_point + j);
+    }
+    restricted_mass(i, i) = mass[first_point + i];
+  }
+  // The eigenvalues of the symmetric-definite problem are real
+  eigenvalues->destructive_resize(num_points);
+  DataVector eigenvalues_imaginary_part{num_points};
+  *eigenvectors = Matrix(num_points, num_points);
+  find_generalized_eigenvalues(eigenvalues,
+                               make_not_null(&eigenvalues_imaginary_part),
+                               eigenvectors, std::move(restricted_stiffness),
+                               std::move(restricted_mass));
+#ifdef SPECTRE_DEBUG
+  for (size_t i = 0; i < num_points; ++i) {
+    ASSERT(abs(eigenvalues_imaginary_part[i]) <=
+               1.e-10 * max(abs(*eigenvalues)),
+           "The 1D operator has a complex eigenvalue "
+               << (*eigenvalues)[i] << " + " << eigenvalues_imaginary_part[i]
+               << "i. Is the stiffness matrix symmetric?");
+  }
+#endif  // SPECTRE_DEBUG
+  *inverse_eigenvectors = *eigenvectors;
+  try {
+    blaze::invert(*inverse_eigenvectors);
+  } catch (const std::invalid_argument& e) {
+    ERROR("Could not invert the eigenvectors of the 1D operator (size "
+          << num_points << "): " << e.what());
+  }
+  if (massive) {
+    for (size_t j = 0; j < num_points; ++j) {
+      for (size_t i = 0; i < num_points; ++i) {
+        (*inverse_eigenvectors)(i, j) /= mass[first_point + j];
+      }
+    }
+  }
+}
+
+}  // namespace elliptic::subdomain_preconditioners::detail
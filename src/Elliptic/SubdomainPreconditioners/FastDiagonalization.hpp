@@ -0,0 +1,525 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <pup.h>
+#include <pup_stl.h>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/IndexIterator.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/Element.hpp"
+#include "Domain/Structure/Side.hpp"
+#include "Domain/Tags.hpp"
+#include "Elliptic/DiscontinuousGalerkin/SubdomainOperator/Tags.hpp"
+#include "Elliptic/DiscontinuousGalerkin/Tags.hpp"
+#include "Elliptic/Systems/Poisson/BoundaryConditions/Robin.hpp"
+#include "NumericalAlgorithms/Convergence/HasConverged.hpp"
+#include "NumericalAlgorithms/LinearSolver/LinearSolver.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "ParallelAlgorithms/LinearSolver/Schwarz/OverlapHelpers.hpp"
+#include "ParallelAlgorithms/LinearSolver/Schwarz/Tags.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace elliptic::subdomain_preconditioners {
+
+/// \cond
+template <size_t Dim, typename LinearSolverRegistrars>
+class FastDiagonalization;
+/// \endcond
+
+namespace Registrars {
+template <size_t Dim>
+struct FastDiagonalization {
+  template <typename LinearSolverRegistrars>
+  using f = subdomain_preconditioners::FastDiagonalization<
+      Dim, LinearSolverRegistrars>;
+};
+}  // namespace Registrars
+
+namespace detail {
+/*!
+ * \brief Symmetric interior-penalty discretization of the 1D flat-space
+ * operator \f$-\partial_x^2\f$ on a line of elements
+ *
+ * The `meshes` and `jacobians` describe the elements on the line in ascending
+ * order, where the `jacobians` are the (constant) logical-to-inertial Jacobians
+ * \f$\partial x / \partial \xi\f$. The `stiffness` matrix is symmetric and the
+ * `mass` is the diagonal (quadrature) mass matrix. The penalty on the faces is
+ * the one of the elliptic DG schemes (see `elliptic::dg::penalty`). The ends
+ * of the line impose homogeneous Dirichlet or Neumann boundary conditions.
+ */
+void flat_laplacian_1d(gsl::not_null<Matrix*> stiffness,
+                       gsl::not_null<DataVector*> mass,
+                       const std::vector<Mesh<1>>& meshes,
+                       const std::vector<double>& jacobians,
+                       bool lower_boundary_is_dirichlet,
+                       bool upper_boundary_is_dirichlet,
+                       double penalty_parameter);
+
+/*!
+ * \brief Factorize the 1D operator for the fast-diagonalization method
+ *
+ * Restricts the `stiffness` \f$K\f$ and `mass` \f$M\f$ to the `num_points`
+ * points starting at `first_point`, which sets the solution to zero on all
+ * other points, and solves the generalized eigenvalue problem \f$K S = M S
+ * \Lambda\f$. Returns the `eigenvectors` \f$S\f$, the `eigenvalues`
+ * \f$\Lambda\f$, and the `inverse_eigenvectors` \f$S^{-1}M^{-1}\f$ if the
+ * operator is `massive`, or \f$S^{-1}\f$ otherwise.
+ */
+void fast_diagonalization_1d(gsl::not_null<Matrix*> eigenvectors,
+                             gsl::not_null<Matrix*> inverse_eigenvectors,
+                             gsl::not_null<DataVector*> eigenvalues,
+                             const Matrix& stiffness, const DataVector& mass,
+                             size_t first_point, size_t num_points,
+                             bool massive);
+}  // namespace detail
+
+/*!
+ * \brief Invert a flat-space Laplacian on the subdomain with the
+ * fast-diagonalization method
+ *
+ * This linear solver approximates the subdomain operator by a flat-space
+ * Laplacian on a tensor-product grid and inverts it directly, following
+ * \cite Lynch1964 and \cite Lottes2005. It is intended as the `Solver` of
+ * `elliptic::subdomain_preconditioners::MinusLaplacian`, either directly or as
+ * preconditioner for an iterative solver, and solves the operator that
+ * `MinusLaplacian` passes to it.
+ *
+ * The subdomain is extended to a box: in every dimension the element's grid
+ * points are extended by the overlap points of a single conforming neighbor
+ * (aligned, with the same number of grid points in the other dimensions) on
+ * either side. In each dimension \f$d\f$ we build the symmetric
+ * interior-penalty stiffness matrix \f$K_d\f$ and the diagonal mass matrix
+ * \f$M_d\f$ of the 1D Laplacian on the line of elements (see
+ * `detail::flat_laplacian_1d`), using the mean Jacobian of each element, and
+ * restrict them to the box. The
+ * box operator is the Kronecker sum \f$A = \sum_d M_1 \otimes \dots \otimes
+ * K_d \otimes \dots \otimes M_D\f$. With the generalized eigenvectors
+ * \f$K_d S_d = M_d S_d \Lambda_d\f$ its inverse is
+ *
+ * \f{equation}
+ * A^{-1} = (S_1 \otimes \dots \otimes S_D) \, \Big(\sum_d I \otimes \dots
+ * \otimes \Lambda_d \otimes \dots \otimes I\Big)^{-1} \, (S_1^{-1} M_1^{-1}
+ * \otimes \dots \otimes S_D^{-1} M_D^{-1}) \text{,}
+ * \f}
+ *
+ * which is applied with `apply_matrices` in \f$\mathcal{O}(N^{D+1})\f$
+ * operations and stores only \f$D\f$ matrices of size \f$N^2\f$, where \f$N\f$
+ * is the number of grid points per dimension in the box. In contrast,
+ * `LinearSolver::Serial::ExplicitInverse` stores a matrix of size \f$N^{2D}\f$
+ * and applies it in \f$\mathcal{O}(N^{2D})\f$ operations. The factorization
+ * is computed on the first solve and cached until `reset()`.
+ *
+ * \par Approximations
+ * - Curved elements are treated as rectangular with their mean Jacobian.
+ * - Overlaps with neighbors that are not conforming in the above sense are
+ *   ignored: the solution is zero there and the subdomain face is treated like
+ *   a homogeneous Dirichlet boundary. The solution on the corners of the box
+ *   that are not covered by an overlap is discarded.
+ * - External boundaries impose homogeneous Dirichlet or Neumann conditions
+ *   based on the `Poisson::BoundaryConditions::Robin` conditions that
+ *   `MinusLaplacian` passes to the subdomain operator.
+ * - Modes of the operator with vanishing eigenvalue (only in subdomains
+ *   bounded by Neumann conditions in all dimensions) are projected out.
+ *
+ * The `LinearOperator` passed to `solve` must be a
+ * `elliptic::dg::subdomain_operator::SubdomainOperator`, which identifies the
+ * `options_group` of the Schwarz solver that defines the subdomain geometry.
+ * The `operator_args` are the DataBox and the map of boundary conditions.
+ */
+template <size_t Dim, typename LinearSolverRegistrars =
+                          tmpl::list<Registrars::FastDiagonalization<Dim>>>
+class FastDiagonalization
+    : public LinearSolver::Serial::LinearSolver<LinearSolverRegistrars> {
+ private:
+  using Base = LinearSolver::Serial::LinearSolver<LinearSolverRegistrars>;
+
+ public:
+  using options = tmpl::list<>;
+  static constexpr Options::String help =
+      "Approximate the subdomain operator by a flat-space Laplacian on a "
+      "tensor-product grid and invert it with the fast-diagonalization "
+      "method. This is much cheaper than building an explicit inverse, both "
+      "in memory and in computation.";
+
+  FastDiagonalization() = default;
+  FastDiagonalization(const FastDiagonalization& /*rhs*/) = default;
+  FastDiagonalization& operator=(const FastDiagonalization& /*rhs*/) = default;
+  FastDiagonalization(FastDiagonalization&& /*rhs*/) = default;
+  FastDiagonalization& operator=(FastDiagonalization&& /*rhs*/) = default;
+  ~FastDiagonalization() = default;
+
+  /// \cond
+  explicit FastDiagonalization(CkMigrateMessage* m) : Base(m) {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(FastDiagonalization);  // NOLINT
+  /// \endcond
+
+  template <typename LinearOperator, typename VarsType, typename SourceType,
+            typename... OperatorArgs>
+  Convergence::HasConverged solve(
+      gsl::not_null<VarsType*> solution, const LinearOperator& linear_operator,
+      const SourceType& source,
+      const std::tuple<OperatorArgs...>& operator_args) const;
+
+  /// Flags the operator to require re-initialization. No memory is released.
+  /// Call this function to rebuild the solver when the operator changed.
+  void reset() override {
+    box_num_points_ = std::numeric_limits<size_t>::max();
+  }
+
+  /// Number of grid points in each dimension of the box that the subdomain is
+  /// extended to
+  const Index<Dim>& box_extents() const { return box_extents_; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override {
+    p | box_num_points_;
+    p | box_extents_;
+    p | element_box_indices_;
+    p | overlap_box_indices_;
+    p | eigenvectors_;
+    p | inverse_eigenvectors_;
+    p | inverse_eigenvalue_sums_;
+  }
+
+  std::unique_ptr<Base> get_clone() const override {
+    return std::make_unique<FastDiagonalization>(*this);
+  }
+
+ private:
+  template <typename OptionsGroup, typename DbTagsList,
+            typename BoundaryConditions, typename SourceType>
+  void initialize(const db::DataBox<DbTagsList>& box,
+                  const BoundaryConditions& boundary_conditions,
+                  const SourceType& source) const;
+
+  // Caches for successive solves of the same operator
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable size_t box_num_points_ = std::numeric_limits<size_t>::max();
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable Index<Dim> box_extents_{};
+  // The box index of each grid point in the element and in the overlaps
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable std::vector<size_t> element_box_indices_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable LinearSolver::Schwarz::OverlapMap<Dim, std::vector<size_t>>
+      overlap_box_indices_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable std::array<Matrix, Dim> eigenvectors_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable std::array<Matrix, Dim> inverse_eigenvectors_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable DataVector inverse_eigenvalue_sums_{};
+
+  // Buffers to avoid re-allocating memory for applying the operator
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable DataVector source_workspace_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable DataVector intermediate_workspace_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable DataVector solution_workspace_{};
+};
+
+template <size_t Dim, typename LinearSolverRegistrars>
+template <typename OptionsGroup, typename DbTagsList,
+          typename BoundaryConditions, typename SourceType>
+void FastDiagonalization<Dim, LinearSolverRegistrars>::initialize(
+    const db::DataBox<DbTagsList>& box,
+    const BoundaryConditions& boundary_conditions,
+    const SourceType& source) const {
+  using LinearSolver::Schwarz::Tags::Overlaps;
+  using inv_jacobian_tag =
+      domain::Tags::InverseJacobian<Dim, Frame::ElementLogical,
+                                    Frame::Inertial>;
+  const auto& element = db::get<domain::Tags::Element<Dim>>(box);
+  const auto& mesh = db::get<domain::Tags::Mesh<Dim>>(box);
+  const auto& inv_jacobian = db::get<inv_jacobian_tag>(box);
+  const auto& overlap_elements =
+      db::get<Overlaps<domain::Tags::Element<Dim>, Dim, OptionsGroup>>(box);
+  const auto& overlap_meshes =
+      db::get<Overlaps<domain::Tags::Mesh<Dim>, Dim, OptionsGroup>>(box);
+  const auto& overlap_inv_jacobians =
+      db::get<Overlaps<inv_jacobian_tag, Dim, OptionsGroup>>(box);
+  const auto& overlap_extents = db::get<
+      Overlaps<elliptic::dg::subdomain_operator::Tags::ExtrudingExtent, Dim,
+               OptionsGroup>>(box);
+  const double penalty_parameter =
+      db::get<elliptic::dg::Tags::PenaltyParameter>(box);
+  const bool massive = db::get<elliptic::dg::Tags::Massive>(box);
+  ASSERT(source.element_data.number_of_grid_points() ==
+             mesh.number_of_grid_points(),
+         "The source has " << source.element_data.number_of_grid_points()
+                           << " grid points on the element, but the mesh has "
+                           << mesh.number_of_grid_points() << ".");
+
+  const auto is_dirichlet = [&boundary_conditions](
+                                const size_t block_id,
+                                const Direction<Dim>& direction) {
+    const auto found =
+        boundary_conditions.find(std::make_pair(block_id, direction));
+    ASSERT(found != boundary_conditions.end(),
+           "No boundary condition for block " << block_id << ", direction "
+                                              << direction << ".");
+    const auto robin_bc =
+        dynamic_cast<const Poisson::BoundaryConditions::Robin<Dim>*>(
+            &found->second);
+    ASSERT(robin_bc != nullptr,
+           "The boundary condition in block "
+               << block_id << ", direction " << direction
+               << " is not of the expected type "
+                  "'Poisson::BoundaryConditions::Robin<"
+               << Dim << ">'.");
+    return robin_bc->dirichlet_weight() != 0.;
+  };
+  // The flat-space approximation uses the mean Jacobian of each element
+  const auto mean_jacobian =
+      [](const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                               Frame::Inertial>& local_inv_jacobian,
+         const size_t d) {
+        DataVector normal_magnitude = square(local_inv_jacobian.get(d, 0));
+        for (size_t i = 1; i < Dim; ++i) {
+          normal_magnitude += square(local_inv_jacobian.get(d, i));
+        }
+        return static_cast<double>(normal_magnitude.size()) /
+               sum(sqrt(normal_magnitude));
+      };
+
+  // Select the overlaps that extend the subdomain to a box, and factorize the
+  // 1D operators on the line of elements in each dimension
+  std::array<size_t, Dim> lower_offsets{};
+  std::array<std::array<std::optional<LinearSolver::Schwarz::OverlapId<Dim>>,
+                        2>,
+             Dim>
+      box_overlap_ids{};
+  for (size_t d = 0; d < Dim; ++d) {
+    std::vector<Mesh<1>> line_meshes{mesh.slice_through(d)};
+    std::vector<double> line_jacobians{mean_jacobian(inv_jacobian, d)};
+    std::array<bool, 2> boundary_is_dirichlet{{true, true}};
+    std::array<size_t, 2> extruding_extents{{0, 0}};
+    for (const Side side : {Side::Lower, Side::Upper}) {
+      const size_t side_index = side == Side::Lower ? 0 : 1;
+      const Direction<Dim> direction{d, side};
+      if (element.external_boundaries().count(direction) == 1) {
+        gsl::at(boundary_is_dirichlet, side_index) =
+            is_dirichlet(element.id().block_id(), direction);
+        continue;
+      }
+      const auto& neighbors = element.neighbors().at(direction);
+      if (neighbors.size() != 1 or not neighbors.orientation().is_aligned()) {
+        continue;
+      }
+      const LinearSolver::Schwarz::OverlapId<Dim> overlap_id{
+          direction, *neighbors.begin()};
+      if (not source.overlap_data.contains(overlap_id) or
+          overlap_extents.at(overlap_id) == 0) {
+        continue;
+      }
+      const auto& neighbor_mesh = overlap_meshes.at(overlap_id);
+      if (neighbor_mesh.slice_away(d).extents() !=
+          mesh.slice_away(d).extents()) {
+        continue;
+      }
+      gsl::at(gsl::at(box_overlap_ids, d), side_index) = overlap_id;
+      gsl::at(extruding_extents, side_index) = overlap_extents.at(overlap_id);
+      const double neighbor_jacobian =
+          mean_jacobian(overlap_inv_jacobians.at(overlap_id), d);
+      if (side == Side::Lower) {
+        line_meshes.insert(line_meshes.begin(), neighbor_mesh.slice_through(d));
+        line_jacobians.insert(line_jacobians.begin(), neighbor_jacobian);
+      } else {
+        line_meshes.push_back(neighbor_mesh.slice_through(d));
+        line_jacobians.push_back(neighbor_jacobian);
+      }
+      // The far face of the neighbor faces either an external boundary or
+      // another element outside the subdomain, where the solution is zero
+      const auto& neighbor = overlap_elements.at(overlap_id);
+      if (neighbor.external_boundaries().count(direction) == 1) {
+        gsl::at(boundary_is_dirichlet, side_index) =
+            is_dirichlet(neighbor.id().block_id(), direction);
+      }
+    }
+    gsl::at(lower_offsets, d) = extruding_extents[0];
+    box_extents_[d] =
+        extruding_extents[0] + mesh.extents(d) + extruding_extents[1];
+    Matrix stiffness{};
+    DataVector mass{};
+    detail::flat_laplacian_1d(make_not_null(&stiffness), make_not_null(&mass),
+                              line_meshes, line_jacobians,
+                              boundary_is_dirichlet[0],
+                              boundary_is_dirichlet[1], penalty_parameter);
+    DataVector eigenvalues{};
+    detail::fast_diagonalization_1d(
+        make_not_null(&gsl::at(eigenvectors_, d)),
+        make_not_null(&gsl::at(inverse_eigenvectors_, d)),
+        make_not_null(&eigenvalues), stiffness, mass,
+        gsl::at(box_overlap_ids, d)[0].has_value()
+            ? line_meshes.front().extents(0) - extruding_extents[0]
+            : 0,
+        box_extents_[d], massive);
+    // Accumulate the eigenvalues of the Kronecker sum
+    if (d == 0) {
+      inverse_eigenvalue_sums_ = DataVector{box_extents_.product(), 0.};
+    }
+    for (IndexIterator<Dim> box_index(box_extents_); box_index; ++box_index) {
+      inverse_eigenvalue_sums_[box_index.collapsed_index()] +=
+          eigenvalues[box_index()[d]];
+    }
+  }
+  box_num_points_ = box_extents_.product();
+  // Project out vanishing modes, which only exist in pure-Neumann subdomains
+  const double max_eigenvalue_sum = max(abs(inverse_eigenvalue_sums_));
+  for (double& eigenvalue_sum : inverse_eigenvalue_sums_) {
+    eigenvalue_sum = std::abs(eigenvalue_sum) > 1.e-12 * max_eigenvalue_sum
+                         ? 1. / eigenvalue_sum
+                         : 0.;
+  }
+
+  // Map the grid points of the element and the overlaps into the box
+  element_box_indices_.resize(mesh.number_of_grid_points());
+  for (IndexIterator<Dim> index(mesh.extents()); index; ++index) {
+    Index<Dim> box_index = index();
+    for (size_t d = 0; d < Dim; ++d) {
+      box_index[d] += gsl::at(lower_offsets, d);
+    }
+    element_box_indices_[index.collapsed_index()] =
+        collapsed_index(box_index, box_extents_);
+  }
+  overlap_box_indices_.clear();
+  for (size_t d = 0; d < Dim; ++d) {
+    for (size_t side_index = 0; side_index < 2; ++side_index) {
+      const auto& overlap_id = gsl::at(gsl::at(box_overlap_ids, d), side_index);
+      if (not overlap_id.has_value()) {
+        continue;
+      }
+      Index<Dim> overlap_extents_index = mesh.extents();
+      overlap_extents_index[d] = overlap_extents.at(*overlap_id);
+      auto& box_indices = overlap_box_indices_[*overlap_id];
+      box_indices.resize(overlap_extents_index.product());
+      for (IndexIterator<Dim> index(overlap_extents_index); index; ++index) {
+        Index<Dim> box_index = index();
+        for (size_t e = 0; e < Dim; ++e) {
+          if (e != d) {
+            box_index[e] += gsl::at(lower_offsets, e);
+          }
+        }
+        if (side_index == 1) {
+          box_index[d] += gsl::at(lower_offsets, d) + mesh.extents(d);
+        }
+        box_indices[index.collapsed_index()] =
+            collapsed_index(box_index, box_extents_);
+      }
+    }
+  }
+}
+
+template <size_t Dim, typename LinearSolverRegistrars>
+template <typename LinearOperator, typename VarsType, typename SourceType,
+          typename... OperatorArgs>
+Convergence::HasConverged FastDiagonalization<Dim, LinearSolverRegistrars>::
+    solve(const gsl::not_null<VarsType*> solution,
+          const LinearOperator& /*linear_operator*/, const SourceType& source,
+          const std::tuple<OperatorArgs...>& operator_args) const {
+  static_assert(
+      sizeof...(OperatorArgs) == 2,
+      "The FastDiagonalization solver expects the DataBox and the boundary "
+      "conditions as operator arguments, as passed by the MinusLaplacian "
+      "subdomain preconditioner.");
+  if (UNLIKELY(box_num_points_ == std::numeric_limits<size_t>::max())) {
+    initialize<typename std::decay_t<LinearOperator>::options_group>(
+        get<0>(operator_args), get<1>(operator_args), source);
+  }
+  static constexpr size_t num_components =
+      VarsType::ElementData::number_of_independent_components;
+  // Gather the source into the box. Corners of the box that are not covered by
+  // an overlap remain zero.
+  source_workspace_.destructive_resize(num_components * box_num_points_);
+  source_workspace_ = 0.;
+  const size_t num_points_element = element_box_indices_.size();
+  for (size_t component = 0; component < num_components; ++component) {
+    for (size_t i = 0; i < num_points_element; ++i) {
+      source_workspace_[component * box_num_points_ +
+                        element_box_indices_[i]] =
+          source.element_data.data()[component * num_points_element + i];
+    }
+  }
+  for (const auto& [overlap_id, box_indices] : overlap_box_indices_) {
+    const auto& overlap_source = source.overlap_data.at(overlap_id);
+    const size_t num_points_overlap = box_indices.size();
+    for (size_t component = 0; component < num_components; ++component) {
+      for (size_t i = 0; i < num_points_overlap; ++i) {
+        source_workspace_[component * box_num_points_ + box_indices[i]] =
+            overlap_source.data()[component * num_points_overlap + i];
+      }
+    }
+  }
+  // Apply the inverse
+  intermediate_workspace_.destructive_resize(source_workspace_.size());
+  apply_matrices(make_not_null(&intermediate_workspace_),
+                 inverse_eigenvectors_, source_workspace_, box_extents_);
+  for (size_t component = 0; component < num_components; ++component) {
+    for (size_t i = 0; i < box_num_points_; ++i) {
+      intermediate_workspace_[component * box_num_points_ + i] *=
+          inverse_eigenvalue_sums_[i];
+    }
+  }
+  solution_workspace_.destructive_resize(source_workspace_.size());
+  apply_matrices(make_not_null(&solution_workspace_), eigenvectors_,
+                 intermediate_workspace_, box_extents_);
+  // Scatter the solution back to the subdomain
+  for (size_t component = 0; component < num_components; ++component) {
+    for (size_t i = 0; i < num_points_element; ++i) {
+      solution->element_data.data()[component * num_points_element + i] =
+          solution_workspace_[component * box_num_points_ +
+                              element_box_indices_[i]];
+    }
+  }
+  for (auto& [overlap_id, overlap_solution] : solution->overlap_data) {
+    const auto box_indices = overlap_box_indices_.find(overlap_id);
+    if (box_indices == overlap_box_indices_.end()) {
+      std::fill(overlap_solution.data(),
+                overlap_solution.data() + overlap_solution.size(), 0.);
+      continue;
+    }
+    const size_t num_points_overlap = box_indices->second.size();
+    for (size_t component = 0; component < num_components; ++component) {
+      for (size_t i = 0; i < num_points_overlap; ++i) {
+        overlap_solution.data()[component * num_points_overlap + i] =
+            solution_workspace_[component * box_num_points_ +
+                                box_indices->second[i]];
+      }
+    }
+  }
+  return {0, 0};
+}
+
+/// \cond
+template <size_t Dim, typename LinearSolverRegistrars>
+// NOLINTNEXTLINE
+PUP::able::PUP_ID FastDiagonalization<Dim, LinearSolverRegistrars>::my_PUP_ID =
+    0;
+/// \endcond
+
+}  // namespace elliptic::subdomain_preconditioners
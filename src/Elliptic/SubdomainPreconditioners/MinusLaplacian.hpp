@@ -21,6 +21,7 @@
 #include "Elliptic/BoundaryConditions/BoundaryCondition.hpp"
 #include "Elliptic/BoundaryConditions/BoundaryConditionType.hpp"
 #include "Elliptic/DiscontinuousGalerkin/SubdomainOperator/SubdomainOperator.hpp"
+#include "Elliptic/SubdomainPreconditioners/FastDiagonalization.hpp"
 #include "Elliptic/Systems/Poisson/BoundaryConditions/Robin.hpp"
 #include "Elliptic/Systems/Poisson/FirstOrderSystem.hpp"
 #include "Elliptic/Systems/Poisson/Tags.hpp"
@@ -55,7 +56,8 @@ template <size_t Dim, typename OptionsGroup,
               ::LinearSolver::Serial::Registrars::Gmres<
                   ::LinearSolver::Schwarz::ElementCenteredSubdomainData<
                       Dim, tmpl::list<Poisson::Tags::Field>>>,
-              ::LinearSolver::Serial::Registrars::ExplicitInverse>>>
+              ::LinearSolver::Serial::Registrars::ExplicitInverse,
+              Registrars::FastDiagonalization<Dim>>>>
 struct MinusLaplacian {
   template <typename LinearSolverRegistrars>
   using f = subdomain_preconditioners::MinusLaplacian<Dim, OptionsGroup, Solver,
@@ -90,14 +92,17 @@ struct MinusLaplacian {
  * `LinearSolver::Schwarz::Schwarz` solver that defines the subdomain geometry.
  * \tparam Solver Any class that provides a `solve` and a `reset` function,
  * but typically a `LinearSolver::Serial::LinearSolver`. The solver will be
- * factory-created from input-file options.
+ * factory-created from input-file options. The default solvers include
+ * `elliptic::subdomain_preconditioners::FastDiagonalization`, which inverts
+ * the Laplacian without storing a matrix representation of it.
  */
 template <size_t Dim, typename OptionsGroup,
           typename Solver = LinearSolver::Serial::LinearSolver<tmpl::list<
               ::LinearSolver::Serial::Registrars::Gmres<
                   ::LinearSolver::Schwarz::ElementCenteredSubdomainData<
                       Dim, tmpl::list<Poisson::Tags::Field>>>,
-              ::LinearSolver::Serial::Registrars::ExplicitInverse>>,
+              ::LinearSolver::Serial::Registrars::ExplicitInverse,
+              Registrars::FastDiagonalization<Dim>>>,
           typename LinearSolverRegistrars =
               tmpl::list<Registrars::MinusLaplacian<Dim, OptionsGroup, Solver>>>
 class MinusLaplacian
@@ -3,6 +3,7 @@
 
 #include "Elliptic/SubdomainPreconditioners/RegisterDerived.hpp"
 
+#include "Elliptic/SubdomainPreconditioners/FastDiagonalization.hpp"
 #include "Elliptic/Systems/Poisson/Tags.hpp"
 #include "NumericalAlgorithms/LinearSolver/ExplicitInverse.hpp"
 #include "NumericalAlgorithms/LinearSolver/Gmres.hpp"
@@ -19,7 +20,9 @@ void register_derived_with_charm_impl() {
           tmpl::list<::LinearSolver::Serial::Registrars::Gmres<
                          ::LinearSolver::Schwarz::ElementCenteredSubdomainData<
                              Dim, tmpl::list<Poisson::Tags::Field>>>,
-                     ::LinearSolver::Serial::Registrars::ExplicitInverse>>>();
+                     ::LinearSolver::Serial::Registrars::ExplicitInverse,
+                     elliptic::subdomain_preconditioners::Registrars::
+                         FastDiagonalization<Dim>>>>();
 }
 }  // namespace
 
@@ -21,11 +21,13 @@
 #include "Domain/Structure/TrimMap.hpp"
 #include "Domain/Tags.hpp"
 #include "Evolution/BoundaryCorrectionTags.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryCorrectionWaitTimes.hpp"
 #include "Evolution/DiscontinuousGalerkin/InboxTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/LiftFromBoundary.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarData.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/NormalVectorTags.hpp"
+#include "Evolution/DiscontinuousGalerkin/Tags/BoundaryCorrectionWaitTimes.hpp"
 #include "Evolution/DiscontinuousGalerkin/Tags/NeighborMesh.hpp"
 #include "Evolution/DiscontinuousGalerkin/UsingSubcell.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
@@ -49,6 +51,7 @@
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -771,6 +774,8 @@ struct ApplyBoundaryCorrectionsToTimeDerivative {
   using const_global_cache_tags =
       tmpl::list<evolution::Tags::BoundaryCorrection<System>,
                  ::dg::Tags::Formulation>;
+  using simple_tags =
+      tmpl::list<evolution::dg::Tags::BoundaryCorrectionWaitTimes>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             typename ArrayIndex, typename ActionList,
@@ -791,8 +796,18 @@ struct ApplyBoundaryCorrectionsToTimeDerivative {
 
     if (not receive_boundary_data_global_time_stepping<Metavariables>(
             make_not_null(&box), make_not_null(&inboxes))) {
+      db::mutate<evolution::dg::Tags::BoundaryCorrectionWaitTimes>(
+          make_not_null(&box),
+          [](const gsl::not_null<BoundaryCorrectionWaitTimes*> wait_times) {
+            wait_times->start_waiting(sys::wall_time());
+          });
       return {Parallel::AlgorithmExecution::Retry, std::nullopt};
     }
+    db::mutate<evolution::dg::Tags::BoundaryCorrectionWaitTimes>(
+        make_not_null(&box),
+        [](const gsl::not_null<BoundaryCorrectionWaitTimes*> wait_times) {
+          wait_times->stop_waiting(sys::wall_time());
+        });
 
     db::mutate_apply<
         ApplyBoundaryCorrections<false, System, VolumeDim, DenseOutput>>(
@@ -819,6 +834,8 @@ struct ApplyLtsBoundaryCorrections {
   using const_global_cache_tags =
       tmpl::list<evolution::Tags::BoundaryCorrection<System>,
                  ::dg::Tags::Formulation>;
+  using simple_tags =
+      tmpl::list<evolution::dg::Tags::BoundaryCorrectionWaitTimes>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             typename ArrayIndex, typename ActionList,
@@ -839,8 +856,18 @@ struct ApplyLtsBoundaryCorrections {
 
     if (not receive_boundary_data_local_time_stepping<Metavariables, false>(
             make_not_null(&box), make_not_null(&inboxes))) {
+      db::mutate<evolution::dg::Tags::BoundaryCorrectionWaitTimes>(
+          make_not_null(&box),
+          [](const gsl::not_null<BoundaryCorrectionWaitTimes*> wait_times) {
+            wait_times->start_waiting(sys::wall_time());
+          });
       return {Parallel::AlgorithmExecution::Retry, std::nullopt};
     }
+    db::mutate<evolution::dg::Tags::BoundaryCorrectionWaitTimes>(
+        make_not_null(&box),
+        [](const gsl::not_null<BoundaryCorrectionWaitTimes*> wait_times) {
+          wait_times->stop_waiting(sys::wall_time());
+        });
 
     db::mutate_apply<
         ApplyBoundaryCorrections<true, System, VolumeDim, DenseOutput>>(
@@ -34,6 +34,7 @@
 #include "Evolution/DiscontinuousGalerkin/MortarData.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/NormalVectorTags.hpp"
+#include "Evolution/DiscontinuousGalerkin/Tags/SendBoundaryDataEarly.hpp"
 #include "Evolution/DiscontinuousGalerkin/UsingSubcell.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
@@ -51,6 +52,7 @@
 #include "Time/TakeStep.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MemoryPool.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -99,6 +101,17 @@ struct get_primitive_tags_for_face {
  * interior contributions to the time derivatives (both nonconservative products
  * and source terms). The internal mortar data is also computed.
  *
+ * If `evolution::dg::Tags::SendBoundaryDataEarly` is set, the mortar data is
+ * sent to the neighbors as soon as it is available, i.e. before the divergence
+ * of the fluxes is added to the time derivative and before the external
+ * boundary conditions are applied, so that the communication overlaps with the
+ * remaining volume work. This is only done with global time stepping. With
+ * local time stepping the step is taken before the data is sent, so the
+ * complete time derivative is computed first. The time elements spend waiting
+ * for boundary data is recorded by the actions that apply the boundary
+ * corrections in `evolution::dg::Tags::BoundaryCorrectionWaitTimes` and can be
+ * observed with `evolution::dg::Events::ObserveBoundaryCorrectionWaitTimes`.
+ *
  * The general first-order hyperbolic evolution equation solved for conservative
  * systems is:
  *
@@ -341,7 +354,8 @@ struct ComputeTimeDerivative {
   using const_global_cache_tags = tmpl::append<
       tmpl::list<::dg::Tags::Formulation,
                  evolution::Tags::BoundaryCorrection<EvolutionSystem>,
-                 domain::Tags::ExternalBoundaryConditions<Dim>>>;
+                 domain::Tags::ExternalBoundaryConditions<Dim>,
+                 evolution::dg::Tags::SendBoundaryDataEarly>>;
 
   template <typename DbTagsList, typename... InboxTags, typename ArrayIndex,
             typename ActionList, typename ParallelComponent,
@@ -478,7 +492,7 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
   using VarsFaceTemporaries = Variables<all_face_temporary_tags>;
   using DgPackagedDataVarsOnFace = Variables<all_mortar_tags>;
   const size_t number_of_grid_points = mesh.number_of_grid_points();
-  auto buffer = cpp20::make_unique_for_overwrite<double[]>(
+  auto buffer = memory_pool::make_unique_for_overwrite<double>(
       (VarsTemporaries::number_of_independent_components +
        VarsFluxes::number_of_independent_components +
        VarsPartialDerivatives::number_of_independent_components +
@@ -541,32 +555,50 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
           box);
     }
   }
-  db::mutate_apply<
-      tmpl::list<dt_variables_tag>,
-      typename compute_volume_time_derivative_terms::argument_tags>(
-      [&dg_formulation, &div_fluxes, &det_inverse_jacobian,
-       &div_mesh_velocity = db::get<::domain::Tags::DivMeshVelocity>(box),
-       &evolved_variables = db::get<variables_tag>(box),
-       &inertial_coordinates =
-           db::get<domain::Tags::Coordinates<Dim, Frame::Inertial>>(box),
-       &logical_to_inertial_inv_jacobian =
-           db::get<::domain::Tags::InverseJacobian<Dim, Frame::ElementLogical,
-                                                   Frame::Inertial>>(box),
-       &mesh, &mesh_velocity = db::get<::domain::Tags::MeshVelocity<Dim>>(box),
-       &partial_derivs, &temporaries, &volume_fluxes](
-          const gsl::not_null<Variables<
-              db::wrap_tags_in<::Tags::dt, typename variables_tag::tags_list>>*>
-              dt_vars_ptr,
-          const auto&... time_derivative_args) {
-        detail::volume_terms<compute_volume_time_derivative_terms>(
-            dt_vars_ptr, make_not_null(&volume_fluxes),
-            make_not_null(&partial_derivs), make_not_null(&temporaries),
-            make_not_null(&div_fluxes), evolved_variables, dg_formulation, mesh,
-            inertial_coordinates, logical_to_inertial_inv_jacobian,
-            det_inverse_jacobian, mesh_velocity, div_mesh_velocity,
-            time_derivative_args...);
-      },
-      make_not_null(&box));
+  // When sending early, the boundary data is sent to the neighbors before the
+  // flux divergence is computed and the external boundary conditions are
+  // applied, so the communication overlaps with that work. With local time
+  // stepping the step has to be taken before sending, which requires the
+  // complete time derivative.
+  const bool send_boundary_data_early =
+      not LocalTimeStepping and
+      db::get<evolution::dg::Tags::SendBoundaryDataEarly>(box);
+  const auto compute_volume_terms = [&box, &dg_formulation, &div_fluxes,
+                                     &det_inverse_jacobian, &mesh,
+                                     &partial_derivs, &temporaries,
+                                     &volume_fluxes](
+                                        const detail::VolumeTermsPhase phase) {
+    db::mutate_apply<
+        tmpl::list<dt_variables_tag>,
+        typename compute_volume_time_derivative_terms::argument_tags>(
+        [&dg_formulation, &div_fluxes, &det_inverse_jacobian,
+         &div_mesh_velocity = db::get<::domain::Tags::DivMeshVelocity>(box),
+         &evolved_variables = db::get<variables_tag>(box),
+         &inertial_coordinates =
+             db::get<domain::Tags::Coordinates<Dim, Frame::Inertial>>(box),
+         &logical_to_inertial_inv_jacobian =
+             db::get<::domain::Tags::InverseJacobian<
+                 Dim, Frame::ElementLogical, Frame::Inertial>>(box),
+         &mesh,
+         &mesh_velocity = db::get<::domain::Tags::MeshVelocity<Dim>>(box),
+         &partial_derivs, &phase, &temporaries, &volume_fluxes](
+            const gsl::not_null<Variables<db::wrap_tags_in<
+                ::Tags::dt, typename variables_tag::tags_list>>*>
+                dt_vars_ptr,
+            const auto&... time_derivative_args) {
+          detail::volume_terms<compute_volume_time_derivative_terms>(
+              dt_vars_ptr, make_not_null(&volume_fluxes),
+              make_not_null(&partial_derivs), make_not_null(&temporaries),
+              make_not_null(&div_fluxes), evolved_variables, dg_formulation,
+              mesh, inertial_coordinates, logical_to_inertial_inv_jacobian,
+              det_inverse_jacobian, mesh_velocity, div_mesh_velocity, phase,
+              time_derivative_args...);
+        },
+        make_not_null(&box));
+  };
+  compute_volume_terms(send_boundary_data_early
+                           ? detail::VolumeTermsPhase::BeforeFluxDivergence
+                           : detail::VolumeTermsPhase::All);
 
   const Variables<detail::get_primitive_vars_tags_from_system<EvolutionSystem>>*
       primitive_vars{nullptr};
@@ -579,9 +611,31 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
       tmpl::all<derived_boundary_corrections, std::is_final<tmpl::_1>>::value,
       "All createable classes for boundary corrections must be marked "
       "final.");
+  // The external boundary conditions need the complete volume time derivative
+  // on the boundary faces, so when sending early they are applied after the
+  // flux divergence below.
+  const auto apply_external_boundary_conditions = [&boundary_correction, &box,
+                                                   &partial_derivs,
+                                                   &primitive_vars,
+                                                   &temporaries,
+                                                   &volume_fluxes]() {
+    tmpl::for_each<derived_boundary_corrections>(
+        [&boundary_correction, &box, &partial_derivs, &primitive_vars,
+         &temporaries, &volume_fluxes](auto derived_correction_v) {
+          using DerivedCorrection =
+              tmpl::type_from<decltype(derived_correction_v)>;
+          if (typeid(boundary_correction) == typeid(DerivedCorrection)) {
+            detail::apply_boundary_conditions_on_all_external_faces<
+                EvolutionSystem, Dim>(
+                make_not_null(&box),
+                dynamic_cast<const DerivedCorrection&>(boundary_correction),
+                temporaries, volume_fluxes, partial_derivs, primitive_vars);
+          }
+        });
+  };
   tmpl::for_each<derived_boundary_corrections>(
-      [&boundary_correction, &box, &partial_derivs, &primitive_vars,
-       &temporaries, &volume_fluxes, &packaged_data_buffer,
+      [&boundary_correction, &box, &primitive_vars, &temporaries,
+       &volume_fluxes, &packaged_data_buffer,
        &face_temporaries](auto derived_correction_v) {
         using DerivedCorrection =
             tmpl::type_from<decltype(derived_correction_v)>;
@@ -599,15 +653,12 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
               db::get<variables_tag>(box), volume_fluxes, temporaries,
               primitive_vars,
               typename DerivedCorrection::dg_package_data_volume_tags{});
-
-          detail::apply_boundary_conditions_on_all_external_faces<
-              EvolutionSystem, Dim>(
-              make_not_null(&box),
-              dynamic_cast<const DerivedCorrection&>(boundary_correction),
-              temporaries, volume_fluxes, partial_derivs, primitive_vars);
         }
       });
 
+  if (not send_boundary_data_early) {
+    apply_external_boundary_conditions();
+  }
   if constexpr (LocalTimeStepping) {
     take_step<EvolutionSystem, LocalTimeStepping, DgStepChoosers>(
         make_not_null(&box));
@@ -615,6 +666,11 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
 
   send_data_for_fluxes<ParallelComponent>(make_not_null(&cache),
                                           make_not_null(&box), volume_fluxes);
+
+  if (send_boundary_data_early) {
+    compute_volume_terms(detail::VolumeTermsPhase::FluxDivergence);
+    apply_external_boundary_conditions();
+  }
   return {Parallel::AlgorithmExecution::Continue, std::nullopt};
 }
 
@@ -19,6 +19,18 @@
 #include "Utilities/TMPL.hpp"
 
 namespace evolution::dg::Actions::detail {
+/// Which of the steps of `volume_terms` to do
+enum class VolumeTermsPhase {
+  /// All of them
+  All,
+  /// Everything before the flux divergence, i.e. the partial derivatives, the
+  /// fluxes, the temporaries, and the time derivatives without the flux
+  /// divergence
+  BeforeFluxDivergence,
+  /// Only add the flux divergence to the time derivatives
+  FluxDivergence
+};
+
 /*
  * Computes the volume terms for a discontinuous Galerkin scheme.
  *
@@ -58,6 +70,11 @@ namespace evolution::dg::Actions::detail {
  *    Note that the computation of the flux divergence and adding that to the
  *    time derivative must be done *after* the mesh velocity is subtracted
  *    from the fluxes.
+ *
+ * The `phase` selects whether all of these steps are done, only steps 1-3, or
+ * only step 4. Splitting the work lets the caller send the boundary data,
+ * which only needs the fluxes and temporaries, before the flux divergence is
+ * computed. The buffers must be kept unchanged between the two phases.
  */
 template <typename ComputeVolumeTimeDerivativeTerms, size_t Dim,
           typename... TimeDerivativeArguments, typename... VariablesTags,
@@ -90,5 +107,6 @@ void volume_terms(
     const std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>&
         mesh_velocity,
     const std::optional<Scalar<DataVector>>& div_mesh_velocity,
+    VolumeTermsPhase phase,
     const TimeDerivativeArguments&... time_derivative_args);
 }  // namespace evolution::dg::Actions::detail
@@ -29,6 +29,84 @@
 #include "Utilities/TMPL.hpp"
 
 namespace evolution::dg::Actions::detail {
+// Computes the divergence of the `volume_fluxes` and adds it to the time
+// derivatives. This is step 4 of `volume_terms`.
+template <size_t Dim, typename... VariablesTags, typename... FluxVariablesTags>
+void add_flux_divergence(
+    const gsl::not_null<Variables<tmpl::list<::Tags::dt<VariablesTags>...>>*>
+        dt_vars_ptr,
+    [[maybe_unused]] const gsl::not_null<
+        Variables<tmpl::list<::Tags::div<::Tags::Flux<
+            FluxVariablesTags, tmpl::size_t<Dim>, Frame::Inertial>>...>>*>
+        div_fluxes,
+    [[maybe_unused]] const Variables<tmpl::list<::Tags::Flux<
+        FluxVariablesTags, tmpl::size_t<Dim>, Frame::Inertial>...>>&
+        volume_fluxes,
+    const ::dg::Formulation dg_formulation, const Mesh<Dim>& mesh,
+    [[maybe_unused]] const tnsr::I<DataVector, Dim, Frame::Inertial>&
+        inertial_coordinates,
+    [[maybe_unused]] const InverseJacobian<DataVector, Dim,
+                                           Frame::ElementLogical,
+                                           Frame::Inertial>&
+        logical_to_inertial_inverse_jacobian,
+    [[maybe_unused]] const Scalar<DataVector>* const det_inverse_jacobian) {
+  static constexpr bool has_fluxes = sizeof...(FluxVariablesTags) != 0;
+  using flux_variables = tmpl::list<FluxVariablesTags...>;
+  if constexpr (has_fluxes) {
+    if (dg_formulation == ::dg::Formulation::StrongInertial) {
+      divergence(div_fluxes, volume_fluxes, mesh,
+                 logical_to_inertial_inverse_jacobian);
+    } else if (dg_formulation == ::dg::Formulation::WeakInertial) {
+      // We should ideally not recompute the
+      // det_jac_times_inverse_jacobian for non-moving meshes.
+      if constexpr (Dim == 1) {
+        weak_divergence(div_fluxes, volume_fluxes, mesh, {});
+      } else {
+        // The Jacobian should be computed as a compute tag
+        const auto jacobian =
+            determinant_and_inverse(logical_to_inertial_inverse_jacobian)
+                .second;
+        InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Inertial>
+            det_jac_times_inverse_jacobian{};
+        ::dg::metric_identity_det_jac_times_inv_jac(
+            make_not_null(&det_jac_times_inverse_jacobian), mesh,
+            inertial_coordinates, jacobian);
+        weak_divergence(div_fluxes, volume_fluxes, mesh,
+                        det_jac_times_inverse_jacobian);
+      }
+      ASSERT(det_inverse_jacobian != nullptr,
+             "The determinant of the inverse Jacobian shouldn't be nullptr "
+             "when using the weak form.");
+      (*div_fluxes) *= get(*det_inverse_jacobian);
+    } else {
+      ERROR("Unsupported DG formulation: " << dg_formulation);
+    }
+    tmpl::for_each<flux_variables>(
+        [&dg_formulation, &dt_vars_ptr, &div_fluxes](auto var_tag_v) {
+          using var_tag = typename decltype(var_tag_v)::type;
+          auto& dt_var = get<::Tags::dt<var_tag>>(*dt_vars_ptr);
+          const auto& div_flux = get<::Tags::div<
+              ::Tags::Flux<var_tag, tmpl::size_t<Dim>, Frame::Inertial>>>(
+              *div_fluxes);
+          if (dg_formulation == ::dg::Formulation::StrongInertial) {
+            for (size_t storage_index = 0; storage_index < dt_var.size();
+                 ++storage_index) {
+              dt_var[storage_index] -= div_flux[storage_index];
+            }
+          } else {
+            for (size_t storage_index = 0; storage_index < dt_var.size();
+                 ++storage_index) {
+              dt_var[storage_index] += div_flux[storage_index];
+            }
+          }
+        });
+  } else {
+    (void)dt_vars_ptr;
+    (void)dg_formulation;
+    (void)mesh;
+  }
+}
+
 /*
  * Computes the volume terms for a discontinuous Galerkin scheme.
  *
@@ -68,6 +146,11 @@ namespace evolution::dg::Actions::detail {
  *    Note that the computation of the flux divergence and adding that to the
  *    time derivative must be done *after* the mesh velocity is subtracted
  *    from the fluxes.
+ *
+ * The `phase` selects whether all of these steps are done, only steps 1-3, or
+ * only step 4. Splitting the work lets the caller send the boundary data,
+ * which only needs the fluxes and temporaries, before the flux divergence is
+ * computed. The buffers must be kept unchanged between the two phases.
  */
 template <typename ComputeVolumeTimeDerivativeTerms, size_t Dim,
           typename... TimeDerivativeArguments, typename... VariablesTags,
@@ -100,6 +183,7 @@ void volume_terms(
     const std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>&
         mesh_velocity,
     const std::optional<Scalar<DataVector>>& div_mesh_velocity,
+    const VolumeTermsPhase phase,
     const TimeDerivativeArguments&... time_derivative_args) {
   static constexpr bool has_partial_derivs = sizeof...(PartialDerivTags) != 0;
   static constexpr bool has_fluxes = sizeof...(FluxVariablesTags) != 0;
@@ -116,6 +200,14 @@ void volume_terms(
   using flux_variables =
       tmpl::list<FluxVariablesTags...>;
 
+  if (phase == VolumeTermsPhase::FluxDivergence) {
+    add_flux_divergence(dt_vars_ptr, div_fluxes, *volume_fluxes,
+                        dg_formulation, mesh, inertial_coordinates,
+                        logical_to_inertial_inverse_jacobian,
+                        det_inverse_jacobian);
+    return;
+  }
+
   // Compute d_i u_\alpha for nonconservative products
   if constexpr (has_partial_derivs) {
     partial_derivatives<partial_derivative_tags>(
@@ -238,56 +330,11 @@ void volume_terms(
 
   // Add the flux divergence term to du_\alpha/dt, which must be done
   // after the corrections for the moving mesh are made.
-  if constexpr (has_fluxes) {
-    if (dg_formulation == ::dg::Formulation::StrongInertial) {
-      divergence(div_fluxes, *volume_fluxes, mesh,
-                 logical_to_inertial_inverse_jacobian);
-    } else if (dg_formulation == ::dg::Formulation::WeakInertial) {
-      // We should ideally not recompute the
-      // det_jac_times_inverse_jacobian for non-moving meshes.
-      if constexpr (Dim == 1) {
-        weak_divergence(div_fluxes, *volume_fluxes, mesh, {});
-      } else {
-        // The Jacobian should be computed as a compute tag
-        const auto jacobian =
-            determinant_and_inverse(logical_to_inertial_inverse_jacobian)
-                .second;
-        InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Inertial>
-            det_jac_times_inverse_jacobian{};
-        ::dg::metric_identity_det_jac_times_inv_jac(
-            make_not_null(&det_jac_times_inverse_jacobian), mesh,
-            inertial_coordinates, jacobian);
-        weak_divergence(div_fluxes, *volume_fluxes, mesh,
-                        det_jac_times_inverse_jacobian);
-      }
-      ASSERT(det_inverse_jacobian != nullptr,
-             "The determinant of the inverse Jacobian shouldn't be nullptr "
-             "when using the weak form.");
-      (*div_fluxes) *= get(*det_inverse_jacobian);
-    } else {
-      ERROR("Unsupported DG formulation: " << dg_formulation);
-    }
-    tmpl::for_each<flux_variables>(
-        [&dg_formulation, &dt_vars_ptr, &div_fluxes](auto var_tag_v) {
-          using var_tag = typename decltype(var_tag_v)::type;
-          auto& dt_var = get<::Tags::dt<var_tag>>(*dt_vars_ptr);
-          const auto& div_flux = get<::Tags::div<
-              ::Tags::Flux<var_tag, tmpl::size_t<Dim>, Frame::Inertial>>>(
-              *div_fluxes);
-          if (dg_formulation == ::dg::Formulation::StrongInertial) {
-            for (size_t storage_index = 0; storage_index < dt_var.size();
-                 ++storage_index) {
-              dt_var[storage_index] -= div_flux[storage_index];
-            }
-          } else {
-            for (size_t storage_index = 0; storage_index < dt_var.size();
-                 ++storage_index) {
-              dt_var[storage_index] += div_flux[storage_index];
-            }
-          }
-        });
-  } else {
-    (void)dg_formulation;
+  if (phase == VolumeTermsPhase::All) {
+    add_flux_divergence(dt_vars_ptr, div_fluxes, *volume_fluxes,
+                        dg_formulation, mesh, inertial_coordinates,
+                        logical_to_inertial_inverse_jacobian,
+                        det_inverse_jacobian);
   }
 }
 }  // namespace evolution::dg::Actions::detail
@@ -0,0 +1,61 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DiscontinuousGalerkin/BoundaryCorrectionWaitTimes.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <ostream>
+#include <pup.h>
+
+#include "Parallel/PupStlCpp17.hpp"
+
+namespace evolution::dg {
+void BoundaryCorrectionWaitTimes::start_waiting(const double wall_time) {
+  if (not wait_start_time_.has_value()) {
+    wait_start_time_ = wall_time;
+  }
+}
+
+void BoundaryCorrectionWaitTimes::stop_waiting(const double wall_time) {
+  ++number_of_steps_;
+  if (wait_start_time_.has_value()) {
+    const double wait_time = wall_time - *wait_start_time_;
+    ++number_of_waits_;
+    total_wait_time_ += wait_time;
+    max_wait_time_ = std::max(max_wait_time_, wait_time);
+    wait_start_time_ = std::nullopt;
+  }
+}
+
+void BoundaryCorrectionWaitTimes::pup(PUP::er& p) {
+  p | wait_start_time_;
+  p | number_of_steps_;
+  p | number_of_waits_;
+  p | total_wait_time_;
+  p | max_wait_time_;
+}
+
+bool operator==(const BoundaryCorrectionWaitTimes& lhs,
+                const BoundaryCorrectionWaitTimes& rhs) {
+  return lhs.wait_start_time_ == rhs.wait_start_time_ and
+         lhs.number_of_steps_ == rhs.number_of_steps_ and
+         lhs.number_of_waits_ == rhs.number_of_waits_ and
+         lhs.total_wait_time_ == rhs.total_wait_time_ and
+         lhs.max_wait_time_ == rhs.max_wait_time_;
+}
+
+bool operator!=(const BoundaryCorrectionWaitTimes& lhs,
+                const BoundaryCorrectionWaitTimes& rhs) {
+  return not(lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os,
+                         const BoundaryCorrectionWaitTimes& wait_times) {
+  return os << "Waited in " << wait_times.number_of_waits() << " of "
+            << wait_times.number_of_steps() << " steps for a total of "
+            << wait_times.total_wait_time() << "s (max "
+            << wait_times.max_wait_time() << "s)";
+}
+}  // namespace evolution::dg
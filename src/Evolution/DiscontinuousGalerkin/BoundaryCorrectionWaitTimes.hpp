@@ -0,0 +1,74 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <optional>
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace evolution::dg {
+/*!
+ * \brief Measures how long an element waits for the boundary data of its
+ * neighbors before it can apply the boundary corrections.
+ *
+ * The action applying the boundary corrections calls `start_waiting` every
+ * time it finds that data from a neighbor is still missing, and
+ * `stop_waiting` once all data has arrived. Only the first `start_waiting` of
+ * each step starts the timer, so the wait time of a step is the wall time
+ * between the first failed and the successful attempt. Steps in which all data
+ * had already arrived count as steps without a wait.
+ *
+ * The wall times are passed in rather than read from a clock so the class can
+ * be tested deterministically. Use `sys::wall_time()`.
+ */
+class BoundaryCorrectionWaitTimes {
+ public:
+  /// Record that boundary data is still missing at `wall_time`
+  void start_waiting(double wall_time);
+
+  /// Record that all boundary data has arrived at `wall_time`
+  void stop_waiting(double wall_time);
+
+  /// Whether the element is currently waiting for boundary data
+  bool is_waiting() const { return wait_start_time_.has_value(); }
+
+  /// Number of steps in which the boundary corrections were applied
+  size_t number_of_steps() const { return number_of_steps_; }
+
+  /// Number of steps in which boundary data was still missing when the
+  /// boundary corrections were first attempted
+  size_t number_of_waits() const { return number_of_waits_; }
+
+  /// Total wall time in seconds spent waiting for boundary data
+  double total_wait_time() const { return total_wait_time_; }
+
+  /// Longest wall time in seconds spent waiting for boundary data in a step
+  double max_wait_time() const { return max_wait_time_; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  friend bool operator==(const BoundaryCorrectionWaitTimes& lhs,
+                         const BoundaryCorrectionWaitTimes& rhs);
+
+  std::optional<double> wait_start_time_{};
+  size_t number_of_steps_ = 0;
+  size_t number_of_waits_ = 0;
+  double total_wait_time_ = 0.;
+  double max_wait_time_ = 0.;
+};
+
+bool operator!=(const BoundaryCorrectionWaitTimes& lhs,
+                const BoundaryCorrectionWaitTimes& rhs);
+
+std::ostream& operator<<(std::ostream& os,
+                         const BoundaryCorrectionWaitTimes& wait_times);
+}  // namespace evolution::dg
@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <functional>
+#include <optional>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -20,6 +21,7 @@
 #include "Domain/ElementDistribution.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/InitialElementIds.hpp"
+#include "Evolution/DiscontinuousGalerkin/Initialization/ElementDistributionTag.hpp"
 #include "Evolution/DiscontinuousGalerkin/Initialization/QuadratureTag.hpp"
 #include "Parallel/Algorithms/AlgorithmArray.hpp"
 #include "Parallel/GlobalCache.hpp"
@@ -48,17 +50,21 @@ CREATE_HAS_STATIC_MEMBER_VARIABLE_V(local_time_stepping)
  * This parallel component will perform the actions specified by the
  * `PhaseDepActionList`.
  *
- * The element assignment to processors is performed by
- * `domain::BlockZCurveProcDistribution` (using a Morton space-filling curve),
- * unless `static constexpr bool use_z_order_distribution = false;` is specified
- * in the `Metavariables`, in which case elements are assigned to processors via
- * round-robin assignment. In both cases, an unordered set of `size_t`s can be
- * passed to the `allocate_array` function which represents physical processors
- * to avoid placing elements on. If the space-filling curve is used, then if
- * `static constexpr bool local_time_stepping = true;` is specified
- * in the `Metavariables`, `Element`s will be distributed according to their
- * computational costs determined by the number of grid points and minimum grid
- * spacing of that `Element` (see
+ * The element assignment to processors is performed according to the
+ * `evolution::dg::Tags::ElementDistribution` input option, either by
+ * `domain::BlockZCurveProcDistribution` (using a Morton space-filling curve
+ * within each block) or by `domain::HilbertCurveNodeProcDistribution` (using a
+ * Hilbert space-filling curve through the whole domain, split first between
+ * nodes and then between the processors on each node). If
+ * `static constexpr bool use_z_order_distribution = false;` is specified
+ * in the `Metavariables`, the option is ignored and elements are assigned to
+ * processors via round-robin assignment. In all cases, an unordered set of
+ * `size_t`s can be passed to the `allocate_array` function which represents
+ * physical processors to avoid placing elements on. If a space-filling curve
+ * is used, then if `static constexpr bool local_time_stepping = true;` is
+ * specified in the `Metavariables`, `Element`s will be distributed according
+ * to their computational costs determined by the number of grid points and
+ * minimum grid spacing of that `Element` (see
  * `domain::get_num_points_and_grid_spacing_cost()`), else the computational
  * cost is determined only by the number of grid points in the `Element`.
  */
@@ -71,7 +77,9 @@ struct DgElementArray {
   using phase_dependent_action_list = PhaseDepActionList;
   using array_index = ElementId<volume_dim>;
 
-  using const_global_cache_tags = tmpl::list<domain::Tags::Domain<volume_dim>>;
+  using const_global_cache_tags =
+      tmpl::list<domain::Tags::Domain<volume_dim>,
+                 evolution::dg::Tags::ElementDistribution>;
 
   using simple_tags_from_options = Parallel::get_simple_tags_from_options<
       Parallel::get_initialization_actions_list<phase_dependent_action_list>>;
@@ -134,9 +142,27 @@ void DgElementArray<Metavariables, PhaseDepActionList>::allocate_array(
               ? domain::ElementWeight::NumGridPointsAndGridSpacing
               : domain::ElementWeight::NumGridPoints,
           quadrature);
-  const domain::BlockZCurveProcDistribution<volume_dim> element_distribution{
-      element_costs,   num_of_procs_to_use, blocks, initial_refinement_levels,
-      initial_extents, procs_to_ignore};
+  std::optional<domain::BlockZCurveProcDistribution<volume_dim>>
+      z_curve_distribution{};
+  std::optional<domain::HilbertCurveNodeProcDistribution<volume_dim>>
+      hilbert_curve_distribution{};
+  if (use_z_order_distribution) {
+    if (Parallel::get<evolution::dg::Tags::ElementDistribution>(local_cache) ==
+        domain::ElementDistributionStrategy::HilbertCurve) {
+      std::vector<size_t> procs_per_node(number_of_nodes);
+      for (size_t node = 0; node < number_of_nodes; ++node) {
+        procs_per_node[node] =
+            Parallel::procs_on_node<size_t>(node, local_cache);
+      }
+      hilbert_curve_distribution.emplace(element_costs, procs_per_node, blocks,
+                                         initial_refinement_levels,
+                                         procs_to_ignore);
+    } else {
+      z_curve_distribution.emplace(element_costs, num_of_procs_to_use, blocks,
+                                   initial_refinement_levels, initial_extents,
+                                   procs_to_ignore);
+    }
+  }
 
   // Will be used to print domain diagnostic info
   std::vector<size_t> elements_per_core(number_of_procs, 0_st);
@@ -156,7 +182,9 @@ void DgElementArray<Metavariables, PhaseDepActionList>::allocate_array(
     if (use_z_order_distribution) {
       for (const auto& element_id : element_ids) {
         const size_t target_proc =
-            element_distribution.get_proc_for_element(element_id);
+            hilbert_curve_distribution.has_value()
+                ? hilbert_curve_distribution->get_proc_for_element(element_id)
+                : z_curve_distribution->get_proc_for_element(element_id);
         dg_element_array(element_id)
             .insert(global_cache, initialization_items, target_proc);
 
@@ -0,0 +1,41 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Domain/ElementDistribution.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags/OptionsGroup.hpp"
+#include "Options/Options.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace evolution::dg {
+namespace OptionTags {
+/// The strategy for distributing the elements to processors.
+struct ElementDistribution {
+  using type = domain::ElementDistributionStrategy;
+  using group = ::dg::OptionTags::DiscontinuousGalerkinGroup;
+  static constexpr Options::String help =
+      "The strategy for distributing the initial elements to processors. "
+      "ZCurve orders the elements of each block along a Morton curve. "
+      "HilbertCurve orders all elements along a Hilbert curve through their "
+      "positions and splits them between nodes before splitting them between "
+      "the cores of each node, which reduces communication across nodes.";
+};
+}  // namespace OptionTags
+
+namespace Tags {
+/// The strategy for distributing the initial elements to processors.
+///
+/// \see DgElementArray
+struct ElementDistribution : db::SimpleTag {
+  using type = domain::ElementDistributionStrategy;
+
+  using option_tags = tmpl::list<OptionTags::ElementDistribution>;
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const type& element_distribution) {
+    return element_distribution;
+  }
+};
+}  // namespace Tags
+}  // namespace evolution::dg
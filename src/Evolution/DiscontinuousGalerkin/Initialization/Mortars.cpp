@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <optional>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -13,20 +14,74 @@
 #include "Domain/Structure/CreateInitialMesh.hpp"
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/Element.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/OrientationMap.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarData.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Projection.hpp"
 #include "Time/TimeStepId.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 
-namespace evolution::dg::Initialization::detail {
+namespace evolution::dg::Initialization {
+namespace detail {
 namespace {
 template <size_t Dim>
 using Key = std::pair<Direction<Dim>, ElementId<Dim>>;
 template <typename MappedType, size_t Dim>
 using MortarMap =
     std::unordered_map<Key<Dim>, MappedType, boost::hash<Key<Dim>>>;
+
+// Creates the mortars of the `element`, given a function that returns the
+// face mesh of a neighbor in the `element`'s orientation
+template <size_t Dim, typename NeighborFaceMesh>
+void make_mortars(
+    const gsl::not_null<MortarMap<evolution::dg::MortarData<Dim>, Dim>*>
+        mortar_data,
+    const gsl::not_null<MortarMap<Mesh<Dim - 1>, Dim>*> mortar_meshes,
+    const gsl::not_null<
+        MortarMap<std::array<Spectral::MortarSize, Dim - 1>, Dim>*>
+        mortar_sizes,
+    const gsl::not_null<MortarMap<TimeStepId, Dim>*> mortar_next_temporal_ids,
+    const gsl::not_null<
+        DirectionMap<Dim, std::optional<Variables<tmpl::list<
+                              evolution::dg::Tags::MagnitudeOfNormal,
+                              evolution::dg::Tags::NormalCovector<Dim>>>>>*>
+        normal_covector_quantities,
+    const Element<Dim>& element, const TimeStepId& next_temporal_id,
+    const Mesh<Dim>& volume_mesh, const NeighborFaceMesh& neighbor_face_mesh) {
+  mortar_data->clear();
+  mortar_meshes->clear();
+  mortar_sizes->clear();
+  mortar_next_temporal_ids->clear();
+  normal_covector_quantities->clear();
+  for (const auto& [direction, neighbors] : element.neighbors()) {
+    (*normal_covector_quantities)[direction] = std::nullopt;
+    for (const auto& neighbor : neighbors) {
+      const auto mortar_id = std::make_pair(direction, neighbor);
+      mortar_data->emplace(mortar_id, MortarData<Dim>{1});
+      mortar_meshes->emplace(
+          mortar_id,
+          ::dg::mortar_mesh(volume_mesh.slice_away(direction.dimension()),
+                            neighbor_face_mesh(direction, neighbor,
+                                               neighbors.orientation())));
+      mortar_sizes->emplace(
+          mortar_id,
+          ::dg::mortar_size(element.id(), neighbor, direction.dimension(),
+                            neighbors.orientation()));
+      // Since no communication needs to happen for boundary conditions
+      // the temporal id is not advanced on the boundary, so we only need to
+      // initialize it on internal boundaries
+      mortar_next_temporal_ids->insert({mortar_id, next_temporal_id});
+    }
+  }
+
+  for (const auto& direction : element.external_boundaries()) {
+    (*normal_covector_quantities)[direction] = std::nullopt;
+  }
+}
 }  // namespace
 
 template <size_t Dim>
@@ -57,37 +112,61 @@ mortars_apply_impl(const std::vector<std::array<size_t, Dim>>& initial_extents,
                         tmpl::list<evolution::dg::Tags::MagnitudeOfNormal,
                                    evolution::dg::Tags::NormalCovector<Dim>>>>>
       normal_covector_quantities{};
-  for (const auto& [direction, neighbors] : element.neighbors()) {
-    normal_covector_quantities[direction] = std::nullopt;
-    for (const auto& neighbor : neighbors) {
-      const auto mortar_id = std::make_pair(direction, neighbor);
-      mortar_data.emplace(mortar_id, MortarData<Dim>{1});
-      mortar_meshes.emplace(
-          mortar_id,
-          ::dg::mortar_mesh(volume_mesh.slice_away(direction.dimension()),
-                            ::domain::Initialization::create_initial_mesh(
-                                initial_extents, neighbor, quadrature,
-                                neighbors.orientation())
-                                .slice_away(direction.dimension())));
-      mortar_sizes.emplace(
-          mortar_id,
-          ::dg::mortar_size(element.id(), neighbor, direction.dimension(),
-                            neighbors.orientation()));
-      // Since no communication needs to happen for boundary conditions
-      // the temporal id is not advanced on the boundary, so we only need to
-      // initialize it on internal boundaries
-      mortar_next_temporal_ids.insert({mortar_id, next_temporal_id});
-    }
-  }
-
-  for (const auto& direction : element.external_boundaries()) {
-    normal_covector_quantities[direction] = std::nullopt;
-  }
-
+  make_mortars(make_not_null(&mortar_data), make_not_null(&mortar_meshes),
+               make_not_null(&mortar_sizes),
+               make_not_null(&mortar_next_temporal_ids),
+               make_not_null(&normal_covector_quantities), element,
+               next_temporal_id, volume_mesh,
+               [&initial_extents, &quadrature](
+                   const Direction<Dim>& direction,
+                   const ElementId<Dim>& neighbor,
+                   const OrientationMap<Dim>& orientation) {
+                 return ::domain::Initialization::create_initial_mesh(
+                            initial_extents, neighbor, quadrature, orientation)
+                     .slice_away(direction.dimension());
+               });
   return {std::move(mortar_data), std::move(mortar_meshes),
           std::move(mortar_sizes), std::move(mortar_next_temporal_ids),
           std::move(normal_covector_quantities)};
 }
+}  // namespace detail
+
+template <size_t Dim>
+void project_mortars(
+    const gsl::not_null<typename Tags::MortarData<Dim>::type*> mortar_data,
+    const gsl::not_null<typename Tags::MortarMesh<Dim>::type*> mortar_meshes,
+    const gsl::not_null<typename Tags::MortarSize<Dim>::type*> mortar_sizes,
+    const gsl::not_null<typename Tags::MortarNextTemporalId<Dim>::type*>
+        mortar_next_temporal_ids,
+    const gsl::not_null<
+        typename evolution::dg::Tags::NormalCovectorAndMagnitude<Dim>::type*>
+        normal_covector_quantities,
+    const Element<Dim>& new_element, const Mesh<Dim>& new_mesh,
+    const std::unordered_map<ElementId<Dim>, Mesh<Dim>>& new_neighbor_meshes,
+    const TimeStepId& next_temporal_id) {
+#ifdef SPECTRE_DEBUG
+  for (const auto& [mortar_id, data] : *mortar_data) {
+    ASSERT(not data.local_mortar_data().has_value() and
+               not data.neighbor_mortar_data().has_value(),
+           "Mortar " << mortar_id.first << "," << mortar_id.second
+                     << " of element " << new_element.id()
+                     << " still holds boundary data. The mortars can only be "
+                        "projected between steps.");
+  }
+#endif  // SPECTRE_DEBUG
+  detail::make_mortars(
+      mortar_data, mortar_meshes, mortar_sizes, mortar_next_temporal_ids,
+      normal_covector_quantities, new_element, next_temporal_id, new_mesh,
+      [&new_neighbor_meshes, &new_element](
+          const Direction<Dim>& direction, const ElementId<Dim>& neighbor,
+          const OrientationMap<Dim>& orientation) {
+        ASSERT(new_neighbor_meshes.count(neighbor) == 1,
+               "No mesh for neighbor " << neighbor << " of element "
+                                       << new_element.id() << ".");
+        return orientation.inverse_map()(new_neighbor_meshes.at(neighbor))
+            .slice_away(direction.dimension());
+      });
+}
 
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
@@ -112,14 +191,32 @@ mortars_apply_impl(const std::vector<std::array<size_t, Dim>>& initial_extents,
                    std::optional<Variables<tmpl::list<                         \
                        evolution::dg::Tags::MagnitudeOfNormal,                 \
                        evolution::dg::Tags::NormalCovector<DIM(data)>>>>>>     \
-  mortars_apply_impl(                                                          \
+  detail::mortars_apply_impl(                                                  \
       const std::vector<std::array<size_t, DIM(data)>>& initial_extents,       \
       const Spectral::Quadrature quadrature,                                   \
       const Element<DIM(data)>& element, const TimeStepId& next_temporal_id,   \
-      const Mesh<DIM(data)>& volume_mesh);
+      const Mesh<DIM(data)>& volume_mesh);                                     \
+  template void project_mortars(                                               \
+      const gsl::not_null<typename Tags::MortarData<DIM(data)>::type*>         \
+          mortar_data,                                                         \
+      const gsl::not_null<typename Tags::MortarMesh<DIM(data)>::type*>         \
+          mortar_meshes,                                                       \
+      const gsl::not_null<typename Tags::MortarSize<DIM(data)>::type*>         \
+          mortar_sizes,                                                        \
+      const gsl::not_null<                                                     \
+          typename Tags::MortarNextTemporalId<DIM(data)>::type*>               \
+          mortar_next_temporal_ids,                                            \
+      const gsl::not_null<typename evolution::dg::Tags::                       \
+                              NormalCovectorAndMagnitude<DIM(data)>::type*>    \
+          normal_covector_quantities,                                          \
+      const Element<DIM(data)>& new_element,                                   \
+      const Mesh<DIM(data)>& new_mesh,                                         \
+      const std::unordered_map<ElementId<DIM(data)>, Mesh<DIM(data)>>&         \
+          new_neighbor_meshes,                                                 \
+      const TimeStepId& next_temporal_id);
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
 
 #undef INSTANTIATION
 #undef DIM
-}  // namespace evolution::dg::Initialization::detail
+}  // namespace evolution::dg::Initialization
@@ -19,6 +19,7 @@
 #include "Domain/Creators/Tags/InitialExtents.hpp"
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/Element.hpp"
+#include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/Neighbors.hpp"
 #include "Domain/Structure/OrientationMap.hpp"
 #include "Domain/Tags.hpp"
@@ -31,6 +32,7 @@
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
 #include "Time/Tags.hpp"
 #include "Time/TimeStepId.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -67,6 +69,37 @@ mortars_apply_impl(const std::vector<std::array<size_t, Dim>>& initial_extents,
                    const Mesh<Dim>& volume_mesh);
 }  // namespace detail
 
+/*!
+ * \brief Project the mortars of an element after AMR changed the element or
+ * its neighbors.
+ *
+ * The mortars are rebuilt for the neighbors of the `new_element`, so mortars
+ * to neighbors that no longer exist are removed and mortars to new neighbors
+ * are added. The mortar meshes combine the face of the `new_mesh` with the
+ * faces of the `new_neighbor_meshes`, which are given in the orientation of
+ * each neighbor. The normal covectors are reset because the geometry of the
+ * element may have changed.
+ *
+ * The boundary data on the mortars isn't projected, so this must be called
+ * between steps, when all boundary corrections have been applied and the
+ * mortars hold no data. This is the case for global time stepping. With local
+ * time stepping the mortar histories would have to be projected as well, which
+ * isn't supported yet.
+ */
+template <size_t Dim>
+void project_mortars(
+    gsl::not_null<typename Tags::MortarData<Dim>::type*> mortar_data,
+    gsl::not_null<typename Tags::MortarMesh<Dim>::type*> mortar_meshes,
+    gsl::not_null<typename Tags::MortarSize<Dim>::type*> mortar_sizes,
+    gsl::not_null<typename Tags::MortarNextTemporalId<Dim>::type*>
+        mortar_next_temporal_ids,
+    gsl::not_null<
+        typename evolution::dg::Tags::NormalCovectorAndMagnitude<Dim>::type*>
+        normal_covector_quantities,
+    const Element<Dim>& new_element, const Mesh<Dim>& new_mesh,
+    const std::unordered_map<ElementId<Dim>, Mesh<Dim>>& new_neighbor_meshes,
+    const TimeStepId& next_temporal_id);
+
 /*!
  * \brief Initialize mortars between elements for exchanging boundary correction
  * terms.
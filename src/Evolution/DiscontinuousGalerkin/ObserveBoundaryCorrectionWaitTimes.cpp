@@ -0,0 +1,32 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DiscontinuousGalerkin/ObserveBoundaryCorrectionWaitTimes.hpp"
+
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <utility>
+
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/TypeOfObservation.hpp"
+
+namespace evolution::dg::Events {
+ObserveBoundaryCorrectionWaitTimes::ObserveBoundaryCorrectionWaitTimes(
+    const std::string& subfile_name)
+    : subfile_path_("/" + subfile_name) {}
+
+std::pair<observers::TypeOfObservation, observers::ObservationKey>
+ObserveBoundaryCorrectionWaitTimes::
+    get_observation_type_and_key_for_registration() const {
+  return {observers::TypeOfObservation::Reduction,
+          observers::ObservationKey(subfile_path_ + ".dat")};
+}
+
+void ObserveBoundaryCorrectionWaitTimes::pup(PUP::er& p) {
+  Event::pup(p);
+  p | subfile_path_;
+}
+
+PUP::able::PUP_ID ObserveBoundaryCorrectionWaitTimes::my_PUP_ID = 0;  // NOLINT
+}  // namespace evolution::dg::Events
@@ -0,0 +1,164 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <pup.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Evolution/DiscontinuousGalerkin/BoundaryCorrectionWaitTimes.hpp"
+#include "Evolution/DiscontinuousGalerkin/Tags/BoundaryCorrectionWaitTimes.hpp"
+#include "IO/Observer/ArrayComponentId.hpp"
+#include "IO/Observer/Helpers.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"  // IWYU pragma: keep
+#include "IO/Observer/ReductionActions.hpp"  // IWYU pragma: keep
+#include "IO/Observer/TypeOfObservation.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/ArrayIndex.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
+#include "Parallel/Reduction.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace Tags {
+struct Time;
+}  // namespace Tags
+/// \endcond
+
+namespace evolution::dg::Events {
+/*!
+ * \brief %Observe how long the elements wait for the boundary data of their
+ * neighbors.
+ *
+ * Writes reduction quantities:
+ * - `%Time`
+ * - `NumberOfElements`
+ * - `Minimum mean wait time`
+ * - `Maximum mean wait time`
+ * - `Mean wait time`
+ * - `Maximum wait time`
+ *
+ * The mean wait time of an element is the total wall time in seconds it has
+ * spent waiting for boundary data divided by the number of steps it has taken,
+ * as recorded in `evolution::dg::Tags::BoundaryCorrectionWaitTimes`. The
+ * minimum, maximum and mean are taken over all elements. The maximum wait time
+ * is the longest wait of any element in a single step. All quantities are
+ * accumulated since the start of the evolution.
+ */
+class ObserveBoundaryCorrectionWaitTimes : public Event {
+ private:
+  using ReductionData = Parallel::ReductionData<
+      Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+      Parallel::ReductionDatum<size_t, funcl::Plus<>>,
+      Parallel::ReductionDatum<double, funcl::Min<>>,
+      Parallel::ReductionDatum<double, funcl::Max<>>,
+      Parallel::ReductionDatum<double, funcl::Plus<>, funcl::Divides<>,
+                               std::index_sequence<1>>,
+      Parallel::ReductionDatum<double, funcl::Max<>>>;
+
+ public:
+  /// The name of the subfile inside the HDF5 file
+  struct SubfileName {
+    using type = std::string;
+    static constexpr Options::String help = {
+        "The name of the subfile inside the HDF5 file without an extension and "
+        "without a preceding '/'."};
+  };
+
+  /// \cond
+  explicit ObserveBoundaryCorrectionWaitTimes(CkMigrateMessage* /*unused*/) {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ObserveBoundaryCorrectionWaitTimes);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<SubfileName>;
+  static constexpr Options::String help =
+      "Observe how long the elements wait for the boundary data of their "
+      "neighbors.\n"
+      "\n"
+      "Writes reduction quantities:\n"
+      "- Time\n"
+      "- NumberOfElements\n"
+      "- Minimum mean wait time\n"
+      "- Maximum mean wait time\n"
+      "- Mean wait time\n"
+      "- Maximum wait time\n"
+      "\n"
+      "The mean wait time of an element is the wall time in seconds it has\n"
+      "spent waiting for boundary data per step. The maximum wait time is the\n"
+      "longest wait of any element in a single step.";
+
+  ObserveBoundaryCorrectionWaitTimes() = default;
+  explicit ObserveBoundaryCorrectionWaitTimes(const std::string& subfile_name);
+
+  using observed_reduction_data_tags =
+      observers::make_reduction_data_tags<tmpl::list<ReductionData>>;
+
+  using compute_tags_for_observation_box = tmpl::list<>;
+
+  using argument_tags =
+      tmpl::list<::Tags::Time, Tags::BoundaryCorrectionWaitTimes>;
+
+  template <typename ArrayIndex, typename ParallelComponent,
+            typename Metavariables>
+  void operator()(const double time,
+                  const BoundaryCorrectionWaitTimes& wait_times,
+                  Parallel::GlobalCache<Metavariables>& cache,
+                  const ArrayIndex& array_index,
+                  const ParallelComponent* const /*meta*/) const {
+    const double mean_wait_time =
+        wait_times.number_of_steps() == 0
+            ? 0.
+            : wait_times.total_wait_time() /
+                  static_cast<double>(wait_times.number_of_steps());
+
+    auto& local_observer = *Parallel::local_branch(
+        Parallel::get_parallel_component<observers::Observer<Metavariables>>(
+            cache));
+    Parallel::simple_action<observers::Actions::ContributeReductionData>(
+        local_observer, observers::ObservationId(time, subfile_path_ + ".dat"),
+        observers::ArrayComponentId{
+            std::add_pointer_t<ParallelComponent>{nullptr},
+            Parallel::ArrayIndex<ArrayIndex>(array_index)},
+        subfile_path_,
+        std::vector<std::string>{"Time", "NumberOfElements",
+                                 "Minimum mean wait time",
+                                 "Maximum mean wait time", "Mean wait time",
+                                 "Maximum wait time"},
+        ReductionData{time, size_t{1}, mean_wait_time, mean_wait_time,
+                      mean_wait_time, wait_times.max_wait_time()});
+  }
+
+  using observation_registration_tags = tmpl::list<>;
+  std::pair<observers::TypeOfObservation, observers::ObservationKey>
+  get_observation_type_and_key_for_registration() const;
+
+  using is_ready_argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  bool needs_evolved_variables() const override { return false; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override;
+
+ private:
+  std::string subfile_path_;
+};
+}  // namespace evolution::dg::Events
@@ -0,0 +1,15 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryCorrectionWaitTimes.hpp"
+
+namespace evolution::dg::Tags {
+/// \brief How long the element has waited for the boundary data of its
+/// neighbors. See `evolution::dg::BoundaryCorrectionWaitTimes`.
+struct BoundaryCorrectionWaitTimes : db::SimpleTag {
+  using type = evolution::dg::BoundaryCorrectionWaitTimes;
+};
+}  // namespace evolution::dg::Tags
@@ -0,0 +1,41 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags/OptionsGroup.hpp"
+#include "Options/Options.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace evolution::dg {
+namespace OptionTags {
+/// Whether to send the boundary data to the neighbors before the flux
+/// divergence is computed and the external boundary conditions are applied.
+struct SendBoundaryDataEarly {
+  using type = bool;
+  using group = ::dg::OptionTags::DiscontinuousGalerkinGroup;
+  static constexpr Options::String help =
+      "Send the boundary data to the neighbors before computing the flux "
+      "divergence and applying the external boundary conditions, so the "
+      "communication overlaps with that work. Ignored with local time "
+      "stepping, where the step must be taken before the data is sent.";
+};
+}  // namespace OptionTags
+
+namespace Tags {
+/// Whether to send the boundary data to the neighbors before the flux
+/// divergence is computed and the external boundary conditions are applied.
+///
+/// See `evolution::dg::Actions::ComputeTimeDerivative`.
+struct SendBoundaryDataEarly : db::SimpleTag {
+  using type = bool;
+
+  using option_tags = tmpl::list<OptionTags::SendBoundaryDataEarly>;
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const type send_boundary_data_early) {
+    return send_boundary_data_early;
+  }
+};
+}  // namespace Tags
+}  // namespace evolution::dg
@@ -20,6 +20,7 @@
 #include "Utilities/Blas.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/ErrorHandling/FloatingPointExceptions.hpp"
+#include "Utilities/MemoryHelpers.hpp"
 
 template <size_t VolumeDim, bool UseNumericalInitialData>
 struct EvolutionMetavars
@@ -93,6 +93,7 @@
 #include "ParallelAlgorithms/Actions/MutateApply.hpp"
 #include "ParallelAlgorithms/Actions/TerminatePhase.hpp"
 #include "ParallelAlgorithms/Events/Factory.hpp"
+#include "ParallelAlgorithms/Events/MonitorActionTimings.hpp"
 #include "ParallelAlgorithms/Events/MonitorMemory.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Actions/RunEventsAndTriggers.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Completion.hpp"
@@ -151,6 +152,7 @@
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/ErrorHandling/FloatingPointExceptions.hpp"
 #include "Utilities/Functional.hpp"
+#include "Utilities/MemoryHelpers.hpp"
 #include "Utilities/ProtocolHelpers.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -188,6 +190,10 @@ struct EvolutionMetavars {
   // 2nd or 3rd order piecewise polynomial functions of time using
   // `read_spec_piecewise_polynomial()`
   static constexpr bool override_functions_of_time = false;
+  // Buffer the many rows of reduction data (norms, time steps, control
+  // systems) that are observed every few steps and write them in batches. See
+  // `observers::BufferedReductionWriter`.
+  static constexpr size_t max_buffered_reduction_rows = 1000;
 
   using initialize_initial_data_dependent_quantities_actions =
       tmpl::list<Actions::MutateApply<
@@ -408,6 +414,7 @@ struct EvolutionMetavars {
                 intrp::Events::InterpolateWithoutInterpComponent<
                     3, ExcisionBoundaryB, EvolutionMetavars,
                     interpolator_source_vars>,
+                Events::MonitorActionTimings<3, ::Tags::Time>,
                 Events::MonitorMemory<3, ::Tags::Time>, Events::Completion,
                 dg::Events::field_observations<volume_dim, Tags::Time,
                                                observe_fields,
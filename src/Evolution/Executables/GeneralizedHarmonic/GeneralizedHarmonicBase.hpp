@@ -24,6 +24,7 @@
 #include "Evolution/DiscontinuousGalerkin/Actions/ComputeTimeDerivative.hpp"
 #include "Evolution/DiscontinuousGalerkin/DgElementArray.hpp"
 #include "Evolution/DiscontinuousGalerkin/Initialization/Mortars.hpp"
+#include "Evolution/DiscontinuousGalerkin/ObserveBoundaryCorrectionWaitTimes.hpp"
 #include "Evolution/EventsAndDenseTriggers/DenseTrigger.hpp"
 #include "Evolution/EventsAndDenseTriggers/DenseTriggers/Factory.hpp"
 #include "Evolution/Initialization/DgDomain.hpp"
@@ -296,10 +297,12 @@ struct FactoryCreation : tt::ConformsTo<Options::protocols::FactoryCreation> {
       tmpl::pair<DenseTrigger, DenseTriggers::standard_dense_triggers>,
       tmpl::pair<DomainCreator<volume_dim>, domain_creators<volume_dim>>,
       tmpl::pair<Event,
-                 tmpl::flatten<tmpl::list<Events::Completion,
-                                          typename detail::ObserverTags<
-                                              volume_dim>::field_observations,
-                                          Events::time_events<system>>>>,
+                 tmpl::flatten<tmpl::list<
+                     Events::Completion,
+                     evolution::dg::Events::ObserveBoundaryCorrectionWaitTimes,
+                     typename detail::ObserverTags<
+                         volume_dim>::field_observations,
+                     Events::time_events<system>>>>,
       tmpl::pair<GeneralizedHarmonic::BoundaryConditions::BoundaryCondition<
                      volume_dim>,
                  GeneralizedHarmonic::BoundaryConditions::
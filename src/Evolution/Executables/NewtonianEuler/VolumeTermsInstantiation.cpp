@@ -56,6 +56,7 @@ namespace evolution::dg::Actions::detail {
       const std::optional<tnsr::I<DataVector, DIM(data), Frame::Inertial>>&   \
           mesh_velocity,                                                      \
       const std::optional<Scalar<DataVector>>& div_mesh_velocity,             \
+      const VolumeTermsPhase phase,                                           \
       const tnsr::I<DataVector, DIM(data)>& momentum_density,                 \
       const Scalar<DataVector>& energy_density,                               \
       const tnsr::I<DataVector, DIM(data)>& velocity,                         \
@@ -113,6 +114,7 @@ template void volume_terms<::NewtonianEuler::TimeDerivativeTerms<
     [[maybe_unused]] const Scalar<DataVector>* const det_inverse_jacobian,
     const std::optional<tnsr::I<DataVector, 3, Frame::Inertial>>& mesh_velocity,
     const std::optional<Scalar<DataVector>>& div_mesh_velocity,
+    const VolumeTermsPhase phase,
     const tnsr::I<DataVector, 3>& momentum_density,
     const Scalar<DataVector>& energy_density,
     const tnsr::I<DataVector, 3>& velocity, const Scalar<DataVector>& pressure,
@@ -158,6 +160,7 @@ template void volume_terms<::NewtonianEuler::TimeDerivativeTerms<
     [[maybe_unused]] const Scalar<DataVector>* const det_inverse_jacobian,
     const std::optional<tnsr::I<DataVector, 3, Frame::Inertial>>& mesh_velocity,
     const std::optional<Scalar<DataVector>>& div_mesh_velocity,
+    const VolumeTermsPhase phase,
     const tnsr::I<DataVector, 3>& momentum_density,
     const Scalar<DataVector>& energy_density,
     const tnsr::I<DataVector, 3>& velocity, const Scalar<DataVector>& pressure,
@@ -0,0 +1,61 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <optional>
+#include <tuple>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Evolution/Systems/Cce/OptionTags.hpp"
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+#include "Utilities/ThreadPool.hpp"
+
+namespace Cce {
+namespace Actions {
+
+/*!
+ * \ingroup ActionsGroup
+ * \brief Sets the number of threads of the `thread_pool` that shares the
+ * hypersurface integration and the spin-weighted transforms of the
+ * characteristic evolution.
+ *
+ * \details The thread pool is not part of the checkpoint, so this action should
+ * be placed both in the initialization and at the start of the evolution
+ * action list so that the threads are recreated after a restart. The pool is
+ * only replaced if the number of threads changes.
+ *
+ * Uses:
+ * - GlobalCache:
+ *   - `Tags::NumberOfThreads`
+ *
+ * \ref DataBoxGroup changes:
+ * - Adds: nothing
+ * - Removes: nothing
+ * - Modifies: nothing
+ */
+struct InitializeThreadPool {
+  using const_global_cache_tags = tmpl::list<Tags::NumberOfThreads>;
+
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTags>& /*box*/,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    const size_t number_of_threads =
+        Parallel::get<Tags::NumberOfThreads>(cache);
+    if (thread_pool::number_of_threads() != number_of_threads) {
+      thread_pool::set_number_of_threads(number_of_threads);
+    }
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+}  // namespace Actions
+}  // namespace Cce
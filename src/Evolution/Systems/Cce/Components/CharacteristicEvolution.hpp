@@ -14,6 +14,7 @@
 #include "Evolution/Systems/Cce/Actions/InitializeCharacteristicEvolutionTime.hpp"
 #include "Evolution/Systems/Cce/Actions/InitializeCharacteristicEvolutionVariables.hpp"
 #include "Evolution/Systems/Cce/Actions/InitializeFirstHypersurface.hpp"
+#include "Evolution/Systems/Cce/Actions/InitializeThreadPool.hpp"
 #include "Evolution/Systems/Cce/Actions/InsertInterpolationScriData.hpp"
 #include "Evolution/Systems/Cce/Actions/RequestBoundaryData.hpp"
 #include "Evolution/Systems/Cce/Actions/ScriObserveInterpolated.hpp"
@@ -102,6 +103,7 @@ struct CharacteristicEvolution {
       Cce::System<Metavariables::uses_partially_flat_cartesian_coordinates>;
 
   using initialize_action_list = tmpl::list<
+      Actions::InitializeThreadPool,
       Actions::InitializeCharacteristicEvolutionVariables<Metavariables>,
       Actions::InitializeCharacteristicEvolutionTime<
           typename Metavariables::evolved_coordinates_variables_tag,
@@ -193,6 +195,8 @@ struct CharacteristicEvolution {
       ::Actions::UpdateU<cce_system>>;
 
   using extract_action_list = tmpl::list<
+      // The thread pool must be recreated after restarts
+      Actions::InitializeThreadPool,
       Actions::RequestBoundaryData<
           typename Metavariables::cce_boundary_component,
           CharacteristicEvolution<Metavariables>>,
@@ -17,6 +17,7 @@
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/StaticCache.hpp"
+#include "Utilities/ThreadPool.hpp"
 #include "Utilities/VectorAlgebra.hpp"
 
 namespace Cce {
@@ -147,6 +148,88 @@ void transpose_to_reals_then_imags_radial_stripes(
 }
 }  // namespace detail
 
+namespace {
+// Solves the linear system for the H hypersurface equation along the radial
+// stripe at the angular collocation point `offset`. The `operator_matrix` is
+// a buffer of size `2 * number_of_radial_points` squared.
+void solve_h_linear_system_at_angular_point(
+    const gsl::not_null<DataVector*> linear_solve_buffer,
+    const gsl::not_null<Matrix*> operator_matrix, const size_t offset,
+    const Matrix& derivative_matrix, const ComplexDataVector& linear_factor,
+    const ComplexDataVector& linear_factor_of_conjugate,
+    const ComplexDataVector& boundary, const ComplexDataVector& one_minus_y,
+    const size_t number_of_radial_points,
+    const size_t number_of_angular_points) {
+  // on repeated evaluations, the matrix gets permuted by the dgesv routine.
+  // We'll ignore its pivots and just overwrite the whole thing on each
+  // pass. There are probably optimizations that can be made which make use
+  // of the pivots.
+
+  // first we apply the (1 - y) \partial_y part of the matrix
+  // to the upper right (real-real) and lower left (imag-imag) part of the
+  // matrix
+  for (size_t matrix_block = 0; matrix_block < 2; ++matrix_block) {
+    for (size_t i = 0; i < number_of_radial_points; ++i) {
+      for (size_t j = 0; j < number_of_radial_points; ++j) {
+        (*operator_matrix)(i + matrix_block * number_of_radial_points,
+                           j + matrix_block * number_of_radial_points) =
+            derivative_matrix(i, j) *
+            real(one_minus_y[i * number_of_angular_points]);
+      }
+    }
+  }
+
+  // zero out the lower left and upper right part of the matrix
+  for (size_t i = 0; i < number_of_radial_points; ++i) {
+    for (size_t j = 0; j < number_of_radial_points; ++j) {
+      (*operator_matrix)(i + number_of_radial_points, j) = 0.0;
+      (*operator_matrix)(i, j + number_of_radial_points) = 0.0;
+    }
+  }
+
+  // gather the contributions to the matrix blocks from the linear factors
+  // each, we zero the first row
+  for (size_t i = 0; i < number_of_radial_points; ++i) {
+    const size_t linear_factor_index = offset + i * number_of_angular_points;
+    // upper left
+    (*operator_matrix)(i, i) +=
+        real(linear_factor[linear_factor_index] +
+             linear_factor_of_conjugate[linear_factor_index]);
+    (*operator_matrix)(0, i) = 0.0;
+    // upper right
+    (*operator_matrix)(i, number_of_radial_points + i) -=
+        imag(linear_factor[linear_factor_index] -
+             linear_factor_of_conjugate[linear_factor_index]);
+    (*operator_matrix)(0, number_of_radial_points + i) = 0.0;
+    // lower left
+    (*operator_matrix)(number_of_radial_points + i, i) +=
+        imag(linear_factor[linear_factor_index] +
+             linear_factor_of_conjugate[linear_factor_index]);
+    (*operator_matrix)(number_of_radial_points, i) = 0.0;
+    // lower right
+    (*operator_matrix)(number_of_radial_points + i,
+                       number_of_radial_points + i) +=
+        real(linear_factor[linear_factor_index] -
+             linear_factor_of_conjugate[linear_factor_index]);
+    (*operator_matrix)(number_of_radial_points, number_of_radial_points + i) =
+        0.0;
+  }
+  (*operator_matrix)(0, 0) = 1.0;
+  (*operator_matrix)(number_of_radial_points, number_of_radial_points) = 1.0;
+  // put the data currently in integrand into a real DataVector of twice the
+  // length
+  (*linear_solve_buffer)[offset * 2 * number_of_radial_points] =
+      real(boundary[offset]);
+  (*linear_solve_buffer)[(offset * 2 + 1) * number_of_radial_points] =
+      imag(boundary[offset]);
+  DataVector linear_solve_buffer_view{
+      linear_solve_buffer->data() + offset * 2 * number_of_radial_points,
+      2 * number_of_radial_points};
+  lapack::general_matrix_linear_solve(make_not_null(&linear_solve_buffer_view),
+                                      operator_matrix);
+}
+}  // namespace
+
 // generic template applies to `Tags::BondiBeta` and `Tags::BondiU`
 template <template <typename> class BoundaryPrefix, typename Tag>
 void RadialIntegrateBondi<BoundaryPrefix, Tag>::apply(
@@ -220,9 +303,6 @@ void RadialIntegrateBondi<BoundaryPrefix, Tags::BondiH>::apply(
   const size_t number_of_angular_points =
       Spectral::Swsh::number_of_swsh_collocation_points(l_max);
 
-  Matrix operator_matrix(2 * number_of_radial_points,
-                         2 * number_of_radial_points);
-
   ComplexDataVector integrand =
       get(pole_of_integrand).data() +
       get(one_minus_y).data() * get(regular_integrand).data();
@@ -244,76 +324,29 @@ void RadialIntegrateBondi<BoundaryPrefix, Tags::BondiH>::apply(
       Spectral::differentiation_matrix<Spectral::Basis::Legendre,
                                        Spectral::Quadrature::GaussLobatto>(
           number_of_radial_points);
-  for (size_t offset = 0; offset < number_of_angular_points; ++offset) {
-    // on repeated evaluations, the matrix gets permuted by the dgesv routine.
-    // We'll ignore its pivots and just overwrite the whole thing on each
-    // pass. There are probably optimizations that can be made which make use
-    // of the pivots.
-
-    // first we apply the (1 - y) \partial_y part of the matrix
-    // to the upper right (real-real) and lower left (imag-imag) part of the
-    // matrix
-    for (size_t matrix_block = 0; matrix_block < 2; ++matrix_block) {
-      for (size_t i = 0; i < number_of_radial_points; ++i) {
-        for (size_t j = 0; j < number_of_radial_points; ++j) {
-          operator_matrix(i + matrix_block * number_of_radial_points,
-                          j + matrix_block * number_of_radial_points) =
-              derivative_matrix(i, j) *
-              real(get(one_minus_y).data()[i * number_of_angular_points]);
+  // The linear solves at the angular collocation points are independent, so
+  // they are split among the threads of the pool. Each chunk needs its own
+  // operator matrix because the solve overwrites it. The concurrent calls to
+  // LAPACK's dgesv on disjoint arrays require a thread-safe LAPACK (e.g.
+  // OpenBLAS built with USE_THREAD=1 or USE_LOCKING=1, or MKL).
+  thread_pool::parallel_for(
+      number_of_angular_points,
+      [&linear_solve_buffer, &derivative_matrix, &linear_factor,
+       &linear_factor_of_conjugate, &boundary, &one_minus_y,
+       &number_of_radial_points, &number_of_angular_points](
+          const size_t first_offset, const size_t last_offset) {
+        Matrix operator_matrix(2 * number_of_radial_points,
+                               2 * number_of_radial_points);
+        for (size_t offset = first_offset; offset < last_offset; ++offset) {
+          solve_h_linear_system_at_angular_point(
+              make_not_null(&linear_solve_buffer),
+              make_not_null(&operator_matrix), offset, derivative_matrix,
+              get(linear_factor).data(),
+              get(linear_factor_of_conjugate).data(), get(boundary).data(),
+              get(one_minus_y).data(), number_of_radial_points,
+              number_of_angular_points);
         }
-      }
-    }
-
-    // zero out the lower left and upper right part of the matrix
-    for (size_t i = 0; i < number_of_radial_points; ++i) {
-      for (size_t j = 0; j < number_of_radial_points; ++j) {
-        operator_matrix(i + number_of_radial_points, j) = 0.0;
-        operator_matrix(i, j + number_of_radial_points) = 0.0;
-      }
-    }
-
-    // gather the contributions to the matrix blocks from the linear factors
-    // each, we zero the first row
-    for (size_t i = 0; i < number_of_radial_points; ++i) {
-      const size_t linear_factor_index = offset + i * number_of_angular_points;
-      // upper left
-      operator_matrix(i, i) +=
-          real(get(linear_factor).data()[linear_factor_index] +
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(0, i) = 0.0;
-      // upper right
-      operator_matrix(i, number_of_radial_points + i) -=
-          imag(get(linear_factor).data()[linear_factor_index] -
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(0, number_of_radial_points + i) = 0.0;
-      // lower left
-      operator_matrix(number_of_radial_points + i, i) +=
-          imag(get(linear_factor).data()[linear_factor_index] +
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(number_of_radial_points, i) = 0.0;
-      // lower right
-      operator_matrix(number_of_radial_points + i,
-                      number_of_radial_points + i) +=
-          real(get(linear_factor).data()[linear_factor_index] -
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(number_of_radial_points, number_of_radial_points + i) =
-          0.0;
-    }
-    operator_matrix(0, 0) = 1.0;
-    operator_matrix(number_of_radial_points, number_of_radial_points) = 1.0;
-    // put the data currently in integrand into a real DataVector of twice the
-    // length
-    linear_solve_buffer[offset * 2 * number_of_radial_points] =
-        real(get(boundary).data()[offset]);
-    linear_solve_buffer[(offset * 2 + 1) * number_of_radial_points] =
-        imag(get(boundary).data()[offset]);
-    DataVector linear_solve_buffer_view{
-        linear_solve_buffer.data() + offset * 2 * number_of_radial_points,
-        2 * number_of_radial_points};
-    lapack::general_matrix_linear_solve(
-        make_not_null(&linear_solve_buffer_view),
-        make_not_null(&operator_matrix));
-  }
+      });
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
   raw_transpose(make_not_null(reinterpret_cast<double*>(
                     get(*integral_result).data().data())),
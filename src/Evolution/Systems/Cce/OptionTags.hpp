@@ -14,6 +14,7 @@
 #include "Evolution/Systems/Cce/InterfaceManagers/GhInterfaceManager.hpp"
 #include "Evolution/Systems/Cce/InterfaceManagers/GhLocalTimeStepping.hpp"
 #include "Evolution/Systems/Cce/InterfaceManagers/GhLockstep.hpp"
+#include "Evolution/Systems/Cce/PrefetchingWorldtubeBufferUpdater.hpp"
 #include "Evolution/Systems/Cce/WorldtubeDataManager.hpp"
 #include "NumericalAlgorithms/Interpolation/SpanInterpolator.hpp"
 #include "Options/Auto.hpp"
@@ -150,6 +151,33 @@ struct H5LookaheadTimes {
   using group = Cce;
 };
 
+struct H5PrefetchDepth {
+  using type = size_t;
+  static constexpr Options::String help{
+      "Number of upcoming caches of the h5 data to read in the background "
+      "while the current one is used. Zero reads synchronously, and so do "
+      "non-SMP builds of Charm++."};
+  static size_t suggested_value() { return 1; }
+  using group = Cce;
+};
+
+struct NumberOfThreads {
+  using type = size_t;
+  static constexpr Options::String help{
+      "Number of threads that share the hypersurface integration and the "
+      "spin-weighted transforms of the characteristic evolution. The extra "
+      "threads are not Charm++ PEs, so leave idle cores for them. When PEs "
+      "are pinned with +setcpuaffinity or +pemap, the extra threads avoid "
+      "the core of the PE that runs the characteristic evolution (on Linux "
+      "only, so don't pin PEs elsewhere). LAPACK must be thread-safe (e.g. "
+      "OpenBLAS built with USE_THREAD=1 or USE_LOCKING=1), and multithreaded "
+      "BLAS and libsharp OpenMP threads should be disabled with "
+      "OPENBLAS_NUM_THREADS=1 and OMP_NUM_THREADS=1."};
+  static size_t suggested_value() { return 1; }
+  static size_t lower_bound() { return 1; }
+  using group = Cce;
+};
+
 struct H5Interpolator {
   using type = std::unique_ptr<intrp::SpanInterpolator>;
   static constexpr Options::String help{
@@ -281,19 +309,22 @@ struct CceEvolutionPrefix : Tag {
   }
 };
 
-/// A tag that constructs a `MetricWorldtubeDataManager` from options
+/// A tag that constructs a `MetricWorldtubeDataManager` or a
+/// `BondiWorldtubeDataManager` from options, reading the H5 data ahead in the
+/// background with a `PrefetchingWorldtubeBufferUpdater`
 struct H5WorldtubeBoundaryDataManager : db::SimpleTag {
   using type = std::unique_ptr<WorldtubeDataManager>;
   using option_tags =
       tmpl::list<OptionTags::LMax, OptionTags::BoundaryDataFilename,
-                 OptionTags::H5LookaheadTimes, OptionTags::H5Interpolator,
-                 OptionTags::H5IsBondiData, OptionTags::FixSpecNormalization,
+                 OptionTags::H5LookaheadTimes, OptionTags::H5PrefetchDepth,
+                 OptionTags::H5Interpolator, OptionTags::H5IsBondiData,
+                 OptionTags::FixSpecNormalization,
                  OptionTags::StandaloneExtractionRadius>;
 
   static constexpr bool pass_metavariables = false;
   static type create_from_options(
       const size_t l_max, const std::string& filename,
-      const size_t number_of_lookahead_times,
+      const size_t number_of_lookahead_times, const size_t prefetch_depth,
       const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
       const bool h5_is_bondi_data, const bool fix_spec_normalization,
       const std::optional<double> extraction_radius) {
@@ -308,13 +339,19 @@ struct H5WorldtubeBoundaryDataManager : db::SimpleTag {
             "clearer.\n");
       }
       return std::make_unique<BondiWorldtubeDataManager>(
-          std::make_unique<BondiWorldtubeH5BufferUpdater>(filename,
-                                                          extraction_radius),
+          std::make_unique<
+              PrefetchingWorldtubeBufferUpdater<cce_bondi_input_tags>>(
+              std::make_unique<BondiWorldtubeH5BufferUpdater>(
+                  filename, extraction_radius),
+              prefetch_depth),
           l_max, number_of_lookahead_times, interpolator->get_clone());
     } else {
       return std::make_unique<MetricWorldtubeDataManager>(
-          std::make_unique<MetricWorldtubeH5BufferUpdater>(filename,
-                                                           extraction_radius),
+          std::make_unique<
+              PrefetchingWorldtubeBufferUpdater<cce_metric_input_tags>>(
+              std::make_unique<MetricWorldtubeH5BufferUpdater>(
+                  filename, extraction_radius),
+              prefetch_depth),
           l_max, number_of_lookahead_times, interpolator->get_clone(),
           fix_spec_normalization);
     }
@@ -340,6 +377,18 @@ struct NumberOfRadialPoints : db::SimpleTag,
   }
 };
 
+/// The number of threads of the `thread_pool` used by the characteristic
+/// evolution
+struct NumberOfThreads : db::SimpleTag {
+  using type = size_t;
+  using option_tags = tmpl::list<OptionTags::NumberOfThreads>;
+
+  static constexpr bool pass_metavariables = false;
+  static size_t create_from_options(const size_t number_of_threads) {
+    return number_of_threads;
+  }
+};
+
 struct ObservationLMax : db::SimpleTag {
   using type = size_t;
   using option_tags = tmpl::list<OptionTags::ObservationLMax>;
@@ -0,0 +1,187 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Systems/Cce/PrefetchingWorldtubeBufferUpdater.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <pup.h>
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Parallel/Printf.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+
+namespace Cce {
+
+template <typename BufferTags>
+PrefetchingWorldtubeBufferUpdater<BufferTags>::
+    PrefetchingWorldtubeBufferUpdater(
+        std::unique_ptr<WorldtubeBufferUpdater<BufferTags>> buffer_updater,
+        const size_t prefetch_depth)
+    : buffer_updater_{std::move(buffer_updater)},
+      prefetch_depth_{prefetch_depth} {}
+
+template <typename BufferTags>
+double PrefetchingWorldtubeBufferUpdater<BufferTags>::update_buffers_for_time(
+    const gsl::not_null<Variables<BufferTags>*> buffers,
+    const gsl::not_null<size_t*> time_span_start,
+    const gsl::not_null<size_t*> time_span_end, const double time,
+    const size_t computation_l_max, const size_t interpolator_length,
+    const size_t buffer_depth) const {
+  discard_prefetched_windows();
+  return buffer_updater_->update_buffers_for_time(
+      buffers, time_span_start, time_span_end, time, computation_l_max,
+      interpolator_length, buffer_depth);
+}
+
+template <typename BufferTags>
+double PrefetchingWorldtubeBufferUpdater<
+    BufferTags>::update_buffers_for_time_with_lock(
+    const gsl::not_null<Variables<BufferTags>*> buffers,
+    const gsl::not_null<size_t*> time_span_start,
+    const gsl::not_null<size_t*> time_span_end, const double time,
+    const size_t computation_l_max, const size_t interpolator_length,
+    const size_t buffer_depth,
+    const gsl::not_null<Parallel::NodeLock*> hdf5_lock) const {
+  // The same conditions for a full update as the H5 buffer updaters
+  const DataVector& time_buffer = buffer_updater_->get_time_buffer();
+  if (*time_span_end >= time_buffer.size()) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  if (*time_span_end > interpolator_length and
+      time_buffer[*time_span_end - interpolator_length] > time) {
+    // the next time an update will be required
+    return time_buffer[*time_span_end - interpolator_length + 1];
+  }
+
+  const auto required_span = detail::create_span_for_time_value(
+      time, buffer_depth, interpolator_length, 0, time_buffer.size(),
+      time_buffer);
+  const double wait_start = sys::wall_time();
+  if (not pending_windows_.empty() and
+      pending_windows_.front().time_span_start == required_span.first and
+      pending_windows_.front().time_span_end == required_span.second) {
+    *buffers = pending_windows_.front().buffers.get();
+    *time_span_start = required_span.first;
+    *time_span_end = required_span.second;
+    pending_windows_.pop_front();
+    ++number_of_prefetched_windows_;
+  } else {
+    discard_prefetched_windows();
+    {
+      const std::lock_guard hold_lock(*hdf5_lock);
+      const std::lock_guard hold_read_lock(read_mutex_);
+      buffer_updater_->update_buffers_for_time(
+          buffers, time_span_start, time_span_end, time, computation_l_max,
+          interpolator_length, buffer_depth);
+    }
+    ++number_of_synchronous_reads_;
+  }
+  stall_time_ += sys::wall_time() - wait_start;
+
+  if (*time_span_end >= time_buffer.size()) {
+    Parallel::printf(
+        "Worldtube data prefetching: %zu windows read ahead, %zu windows read "
+        "synchronously, %f seconds spent waiting for data.\n",
+        number_of_prefetched_windows_, number_of_synchronous_reads_,
+        stall_time_);
+  } else {
+    schedule_prefetches(*time_span_end, computation_l_max, interpolator_length,
+                        buffer_depth, buffers->number_of_grid_points(),
+                        hdf5_lock);
+  }
+  // the next time an update will be required
+  return time_buffer[std::min(*time_span_end - interpolator_length + 1,
+                              time_buffer.size() - 1)];
+}
+
+template <typename BufferTags>
+void PrefetchingWorldtubeBufferUpdater<BufferTags>::schedule_prefetches(
+    const size_t loaded_time_span_end, const size_t computation_l_max,
+    const size_t interpolator_length, const size_t buffer_depth,
+    const size_t buffer_size,
+    const gsl::not_null<Parallel::NodeLock*> hdf5_lock) const {
+  const DataVector& time_buffer = buffer_updater_->get_time_buffer();
+  size_t time_span_end = pending_windows_.empty()
+                             ? loaded_time_span_end
+                             : pending_windows_.back().time_span_end;
+  while (pending_windows_.size() < prefetch_depth_ and
+         time_span_end < time_buffer.size()) {
+    // The next full update is requested at the first time past
+    // `time_buffer[time_span_end - interpolator_length]`, and any time up to
+    // the following data point gives the same window.
+    const double predicted_time =
+        0.5 * (time_buffer[time_span_end - interpolator_length] +
+               time_buffer[time_span_end - interpolator_length + 1]);
+    const auto predicted_span = detail::create_span_for_time_value(
+        predicted_time, buffer_depth, interpolator_length, 0,
+        time_buffer.size(), time_buffer);
+    if (predicted_span.second <= time_span_end) {
+      break;
+    }
+    const auto read_window = [this, predicted_time, computation_l_max,
+                              interpolator_length, buffer_depth, buffer_size,
+                              hdf5_lock]() {
+      Variables<BufferTags> prefetched_buffers{buffer_size};
+      size_t prefetched_time_span_start = 0;
+      size_t prefetched_time_span_end = 0;
+      const std::lock_guard hold_lock(*hdf5_lock);
+      const std::lock_guard hold_read_lock(read_mutex_);
+      buffer_updater_->update_buffers_for_time(
+          make_not_null(&prefetched_buffers),
+          make_not_null(&prefetched_time_span_start),
+          make_not_null(&prefetched_time_span_end), predicted_time,
+          computation_l_max, interpolator_length, buffer_depth);
+      return prefetched_buffers;
+    };
+    // Without SMP the `hdf5_lock` doesn't exclude other threads from the file,
+    // so the read is deferred until the window is requested on this thread
+    pending_windows_.push_back(PendingWindow{
+        predicted_span.first, predicted_span.second,
+        std::async(Parallel::NodeLock::locks_all_threads
+                       ? std::launch::async
+                       : std::launch::deferred,
+                   read_window)});
+    time_span_end = predicted_span.second;
+  }
+}
+
+template <typename BufferTags>
+void PrefetchingWorldtubeBufferUpdater<
+    BufferTags>::discard_prefetched_windows() const {
+  // Waits for the outstanding reads so the wrapped updater is no longer in use
+  pending_windows_.clear();
+}
+
+template <typename BufferTags>
+std::unique_ptr<WorldtubeBufferUpdater<BufferTags>>
+PrefetchingWorldtubeBufferUpdater<BufferTags>::get_clone() const {
+  return std::make_unique<PrefetchingWorldtubeBufferUpdater>(
+      buffer_updater_->get_clone(), prefetch_depth_);
+}
+
+template <typename BufferTags>
+void PrefetchingWorldtubeBufferUpdater<BufferTags>::pup(PUP::er& p) {
+  if (p.isPacking() or p.isSizing()) {
+    // Don't serialize while a background read is using the wrapped updater
+    discard_prefetched_windows();
+  }
+  p | buffer_updater_;
+  p | prefetch_depth_;
+  p | stall_time_;
+  p | number_of_prefetched_windows_;
+  p | number_of_synchronous_reads_;
+}
+
+template class PrefetchingWorldtubeBufferUpdater<cce_metric_input_tags>;
+template class PrefetchingWorldtubeBufferUpdater<cce_bondi_input_tags>;
+}  // namespace Cce
@@ -0,0 +1,177 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace Cce {
+
+/*!
+ * \brief A `WorldtubeBufferUpdater` that reads the upcoming time windows of
+ * another updater in the background while the current window is consumed.
+ *
+ * \details The wrapped updater (typically a `MetricWorldtubeH5BufferUpdater`
+ * or a `BondiWorldtubeH5BufferUpdater`) performs the actual reads. Each time
+ * the buffers are refilled, the windows that the next `prefetch_depth`
+ * refills will request are predicted from the time at which the current
+ * window runs out, and are read by background tasks. When the
+ * `WorldtubeDataManager` requests the next window, the prefetched buffers are
+ * moved into place, so the evolution only waits on the file system if the
+ * read hasn't finished yet. If the requested window differs from the
+ * prediction (e.g. because a time step spans more than the data in a window),
+ * the prefetched windows are discarded and the requested window is read
+ * synchronously.
+ *
+ * The time spent waiting for data, either on an outstanding background read
+ * or on a synchronous read, is accumulated in `stall_time()` and reported
+ * together with the number of prefetched and synchronously read windows when
+ * the last window of the data is loaded.
+ *
+ * Reading ahead is only done through `update_buffers_for_time_with_lock()`,
+ * because the background reads must hold the `hdf5_lock` while accessing the
+ * file. `update_buffers_for_time()` reads synchronously. Prefetched windows
+ * are not serialized, so they are read again after migration.
+ *
+ * The background reads run on threads started with `std::async`, so they can
+ * only exclude other users of the file through the `hdf5_lock` if it is a
+ * real lock, i.e. if Charm++ is built in SMP mode (see
+ * `Parallel::NodeLock::locks_all_threads`). In non-SMP builds the windows are
+ * therefore not read in the background. They are still predicted and queued,
+ * but each one is read on the calling thread once it is requested, like
+ * without prefetching.
+ */
+template <typename BufferTags>
+class PrefetchingWorldtubeBufferUpdater
+    : public WorldtubeBufferUpdater<BufferTags> {
+ public:
+  // charm needs the empty constructor
+  PrefetchingWorldtubeBufferUpdater() = default;
+
+  /// `prefetch_depth` is the number of windows that are read ahead. A value
+  /// of zero disables reading ahead.
+  PrefetchingWorldtubeBufferUpdater(
+      std::unique_ptr<WorldtubeBufferUpdater<BufferTags>> buffer_updater,
+      size_t prefetch_depth);
+
+  WRAPPED_PUPable_decl_template(PrefetchingWorldtubeBufferUpdater);  // NOLINT
+
+  explicit PrefetchingWorldtubeBufferUpdater(CkMigrateMessage* /*unused*/) {}
+
+  /// Updates the buffers synchronously using the wrapped updater, discarding
+  /// any prefetched windows.
+  double update_buffers_for_time(
+      gsl::not_null<Variables<BufferTags>*> buffers,
+      gsl::not_null<size_t*> time_span_start,
+      gsl::not_null<size_t*> time_span_end, double time,
+      size_t computation_l_max, size_t interpolator_length,
+      size_t buffer_depth) const override;
+
+  /// Updates the buffers from a prefetched window if possible, and starts
+  /// reading the following windows in the background. Returns the next time
+  /// at which a full update will be needed, like the wrapped updater.
+  double update_buffers_for_time_with_lock(
+      gsl::not_null<Variables<BufferTags>*> buffers,
+      gsl::not_null<size_t*> time_span_start,
+      gsl::not_null<size_t*> time_span_end, double time,
+      size_t computation_l_max, size_t interpolator_length,
+      size_t buffer_depth,
+      gsl::not_null<Parallel::NodeLock*> hdf5_lock) const override;
+
+  std::unique_ptr<WorldtubeBufferUpdater<BufferTags>> get_clone()
+      const override;
+
+  bool time_is_outside_range(const double time) const override {
+    return buffer_updater_->time_is_outside_range(time);
+  }
+
+  size_t get_l_max() const override { return buffer_updater_->get_l_max(); }
+
+  double get_extraction_radius() const override {
+    return buffer_updater_->get_extraction_radius();
+  }
+
+  bool has_version_history() const override {
+    return buffer_updater_->has_version_history();
+  }
+
+  DataVector& get_time_buffer() override {
+    return buffer_updater_->get_time_buffer();
+  }
+
+  size_t prefetch_depth() const { return prefetch_depth_; }
+
+  /// The total wall time in seconds that `update_buffers_for_time_with_lock()`
+  /// has spent waiting for data
+  double stall_time() const { return stall_time_; }
+
+  /// The number of windows that were supplied from a background read
+  size_t number_of_prefetched_windows() const {
+    return number_of_prefetched_windows_;
+  }
+
+  /// The number of windows that had to be read synchronously
+  size_t number_of_synchronous_reads() const {
+    return number_of_synchronous_reads_;
+  }
+
+  /// Serialization for Charm++.
+  void pup(PUP::er& p) override;
+
+ private:
+  struct PendingWindow {
+    size_t time_span_start;
+    size_t time_span_end;
+    std::future<Variables<BufferTags>> buffers;
+  };
+
+  // Starts background reads of the windows following the one that ends at
+  // `loaded_time_span_end` until `prefetch_depth_` windows are pending
+  void schedule_prefetches(size_t loaded_time_span_end,
+                           size_t computation_l_max, size_t interpolator_length,
+                           size_t buffer_depth, size_t buffer_size,
+                           gsl::not_null<Parallel::NodeLock*> hdf5_lock) const;
+
+  void discard_prefetched_windows() const;
+
+  std::unique_ptr<WorldtubeBufferUpdater<BufferTags>> buffer_updater_;
+  size_t prefetch_depth_ = 1;
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable double stall_time_ = 0.0;
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable size_t number_of_prefetched_windows_ = 0;
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable size_t number_of_synchronous_reads_ = 0;
+  // Serializes the use of `buffer_updater_` between the background reads,
+  // since the H5 updaters share a file handle.
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable std::mutex read_mutex_{};
+  // Declared last so that the outstanding reads are finished before the
+  // members they use are destroyed.
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable std::deque<PendingWindow> pending_windows_{};
+};
+
+/// \cond
+template <typename BufferTags>
+PUP::able::PUP_ID
+    PrefetchingWorldtubeBufferUpdater<BufferTags>::my_PUP_ID = 0;  // NOLINT
+/// \endcond
+}  // namespace Cce
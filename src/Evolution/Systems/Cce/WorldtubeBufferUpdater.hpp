@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <utility>
@@ -22,6 +23,7 @@
 #include "IO/H5/Version.hpp"
 #include "NumericalAlgorithms/Spectral/SwshTags.hpp"
 #include "Parallel/CharmPupable.hpp"
+#include "Parallel/NodeLock.hpp"
 #include "Parallel/PupStlCpp17.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
@@ -108,6 +110,8 @@ using cce_bondi_input_tags =
 /// \cond
 class MetricWorldtubeH5BufferUpdater;
 class BondiWorldtubeH5BufferUpdater;
+template <typename BufferTags>
+class PrefetchingWorldtubeBufferUpdater;
 /// \endcond
 
 /*!
@@ -140,12 +144,21 @@ class BondiWorldtubeH5BufferUpdater;
  *  The override should return the vector of times that it can produce modal
  *  data at. For instance, if associated with a file input, this will be the
  *  times at each of the rows of the time-series data.
+ *
+ *  Derived classes may also override
+ *  `WorldtubeBufferUpdater::update_buffers_for_time_with_lock()`, which is the
+ *  function called by the `WorldtubeDataManager`s. The default implementation
+ *  holds the `hdf5_lock` for the entire `update_buffers_for_time()` call.
+ *  Updaters that read ahead in the background (see
+ *  `PrefetchingWorldtubeBufferUpdater`) override it to hold the lock only
+ *  while they access the file.
  */
 template <typename BufferTags>
 class WorldtubeBufferUpdater : public PUP::able {
  public:
   using creatable_classes =
-      tmpl::list<MetricWorldtubeH5BufferUpdater, BondiWorldtubeH5BufferUpdater>;
+      tmpl::list<MetricWorldtubeH5BufferUpdater, BondiWorldtubeH5BufferUpdater,
+                 PrefetchingWorldtubeBufferUpdater<BufferTags>>;
 
   WRAPPED_PUPable_abstract(WorldtubeBufferUpdater);  // NOLINT
 
@@ -156,6 +169,19 @@ class WorldtubeBufferUpdater : public PUP::able {
       size_t computation_l_max, size_t interpolator_length,
       size_t buffer_depth) const = 0;
 
+  virtual double update_buffers_for_time_with_lock(
+      const gsl::not_null<Variables<BufferTags>*> buffers,
+      const gsl::not_null<size_t*> time_span_start,
+      const gsl::not_null<size_t*> time_span_end, const double time,
+      const size_t computation_l_max, const size_t interpolator_length,
+      const size_t buffer_depth,
+      const gsl::not_null<Parallel::NodeLock*> hdf5_lock) const {
+    const std::lock_guard hold_lock(*hdf5_lock);
+    return update_buffers_for_time(buffers, time_span_start, time_span_end,
+                                   time, computation_l_max,
+                                   interpolator_length, buffer_depth);
+  }
+
   virtual std::unique_ptr<WorldtubeBufferUpdater> get_clone() const = 0;
 
   virtual bool time_is_outside_range(double time) const = 0;
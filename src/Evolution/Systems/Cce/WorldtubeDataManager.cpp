@@ -6,7 +6,6 @@
 #include <complex>
 #include <cstddef>
 #include <memory>
-#include <mutex>
 #include <utility>
 
 #include "DataStructures/ComplexModalVector.hpp"
@@ -77,14 +76,11 @@ bool MetricWorldtubeDataManager::populate_hypersurface_boundary_data(
   if (buffer_updater_->time_is_outside_range(time)) {
     return false;
   }
-  {
-    const std::lock_guard hold_lock(*hdf5_lock);
-    buffer_updater_->update_buffers_for_time(
-        make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
-        make_not_null(&time_span_end_), time, l_max_,
-        interpolator_->required_number_of_points_before_and_after(),
-        buffer_depth_);
-  }
+  buffer_updater_->update_buffers_for_time_with_lock(
+      make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
+      make_not_null(&time_span_end_), time, l_max_,
+      interpolator_->required_number_of_points_before_and_after(),
+      buffer_depth_, hdf5_lock);
   const auto interpolation_time_span = detail::create_span_for_time_value(
       time, 0, interpolator_->required_number_of_points_before_and_after(),
       time_span_start_, time_span_end_, buffer_updater_->get_time_buffer());
@@ -314,14 +310,11 @@ bool BondiWorldtubeDataManager::populate_hypersurface_boundary_data(
   if (buffer_updater_->time_is_outside_range(time)) {
     return false;
   }
-  {
-    const std::lock_guard hold_lock(*hdf5_lock);
-    buffer_updater_->update_buffers_for_time(
-        make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
-        make_not_null(&time_span_end_), time, l_max_,
-        interpolator_->required_number_of_points_before_and_after(),
-        buffer_depth_);
-  }
+  buffer_updater_->update_buffers_for_time_with_lock(
+      make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
+      make_not_null(&time_span_end_), time, l_max_,
+      interpolator_->required_number_of_points_before_and_after(),
+      buffer_depth_, hdf5_lock);
   auto interpolation_time_span = detail::create_span_for_time_value(
       time, 0, interpolator_->required_number_of_points_before_and_after(),
       time_span_start_, time_span_end_, buffer_updater_->get_time_buffer());
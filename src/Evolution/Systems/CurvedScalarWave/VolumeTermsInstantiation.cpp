@@ -49,6 +49,7 @@ namespace evolution::dg::Actions::detail {
       const std::optional<tnsr::I<DataVector, DIM(data), Frame::Inertial>>&   \
           mesh_velocity,                                                      \
       const std::optional<Scalar<DataVector>>& div_mesh_velocity,             \
+      const VolumeTermsPhase phase,                                           \
       const Scalar<DataVector>& pi,                                           \
       const tnsr::i<DataVector, DIM(data), Frame::Inertial>& phi,             \
       const Scalar<DataVector>& lapse,                                        \
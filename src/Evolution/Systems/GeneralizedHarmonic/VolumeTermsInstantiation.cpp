@@ -53,6 +53,7 @@ namespace evolution::dg::Actions::detail {
       const std::optional<tnsr::I<DataVector, DIM(data), Frame::Inertial>>&   \
           mesh_velocity,                                                      \
       const std::optional<Scalar<DataVector>>& div_mesh_velocity,             \
+      const VolumeTermsPhase phase,                                           \
       const tnsr::aa<DataVector, DIM(data)>& spacetime_metric,                \
       const tnsr::aa<DataVector, DIM(data)>& pi,                              \
       const tnsr::iaa<DataVector, DIM(data)>& phi,                            \
@@ -47,6 +47,7 @@ template void volume_terms<::grmhd::GhValenciaDivClean::TimeDerivativeTerms>(
     [[maybe_unused]] const Scalar<DataVector>* const det_inverse_jacobian,
     const std::optional<tnsr::I<DataVector, 3, Frame::Inertial>>& mesh_velocity,
     const std::optional<Scalar<DataVector>>& div_mesh_velocity,
+    const VolumeTermsPhase phase,
     // GH argument tags
     const tnsr::aa<DataVector, 3>& spacetime_metric,
     const tnsr::aa<DataVector, 3>& pi, const tnsr::iaa<DataVector, 3>& phi,
@@ -7,10 +7,14 @@
 #include <array>
 #include <cmath>
 #include <limits>
+#include <optional>
+#include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
 #include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 
@@ -167,6 +171,179 @@ std::optional<PrimitiveRecoveryData> NewmanHamlin::apply(
                 relative_tolerance_ * (current_pressure + previous_pressure);
   }  // while loop
 }
+
+template <size_t ThermodynamicDim>
+void NewmanHamlin::apply(
+    const gsl::not_null<std::vector<std::optional<PrimitiveRecoveryData>>*>
+        primitive_data,
+    const DataVector& initial_guess_for_pressure,
+    const DataVector& total_energy_density,
+    const DataVector& momentum_density_squared,
+    const DataVector& momentum_density_dot_magnetic_field,
+    const DataVector& magnetic_field_squared,
+    const DataVector& rest_mass_density_times_lorentz_factor,
+    const DataVector& electron_fraction,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state) {
+  const size_t number_of_points = total_energy_density.size();
+  ASSERT(primitive_data->size() == number_of_points,
+         "Expected primitive data for " << number_of_points
+                                        << " points, but got "
+                                        << primitive_data->size());
+
+  // The state of the iteration at each point. See the pointwise `apply` above
+  // for a description of the individual steps.
+  DataVector d_in_cubic(number_of_points);
+  DataVector minimum_pressure(number_of_points);
+  DataVector current_pressure(number_of_points);
+  DataVector previous_pressure(number_of_points);
+  std::vector<std::array<double, 3>> aitken_pressure(number_of_points);
+  std::vector<size_t> valid_entries_in_aitken_pressure(number_of_points, 1);
+  std::vector<bool> converged(number_of_points, false);
+  // The points that are still iterating, in increasing order
+  std::vector<size_t> active_points{};
+  active_points.reserve(number_of_points);
+
+  for (size_t s = 0; s < number_of_points; ++s) {
+    (*primitive_data)[s] = std::nullopt;
+    const double local_d_in_cubic =
+        0.5 * (momentum_density_squared[s] * magnetic_field_squared[s] -
+               square(momentum_density_dot_magnetic_field[s]));
+    if (UNLIKELY(-1e-12 * square(momentum_density_dot_magnetic_field[s]) >
+                 local_d_in_cubic)) {
+      continue;
+    }
+    d_in_cubic[s] = std::max(0.0, local_d_in_cubic);
+    minimum_pressure[s] =
+        std::max(0.0, cbrt(6.75 * d_in_cubic[s]) - total_energy_density[s] -
+                          0.5 * magnetic_field_squared[s]);
+    current_pressure[s] =
+        std::max(minimum_pressure[s], initial_guess_for_pressure[s]);
+    aitken_pressure[s] = {{current_pressure[s],
+                           std::numeric_limits<double>::signaling_NaN(),
+                           std::numeric_limits<double>::signaling_NaN()}};
+    active_points.push_back(s);
+  }
+
+  // Arguments of the equation of state at the points that are still
+  // iterating, stored contiguously so the equation of state is called once per
+  // iteration
+  DataVector eos_rest_mass_density(number_of_points);
+  DataVector eos_specific_enthalpy(number_of_points);
+  Scalar<DataVector> active_rest_mass_density{};
+  Scalar<DataVector> active_specific_enthalpy{};
+  Scalar<DataVector> active_pressure{};
+
+  for (size_t iteration_step = 0; not active_points.empty();
+       ++iteration_step) {
+    size_t number_of_active_points = 0;
+    for (size_t i = 0; i < active_points.size(); ++i) {
+      const size_t s = active_points[i];
+      if (UNLIKELY(max_iterations_ == iteration_step and not converged[s])) {
+        continue;
+      }
+
+      previous_pressure[s] = current_pressure[s];
+      current_pressure[s] = std::max(current_pressure[s], minimum_pressure[s]);
+      const double a_in_cubic = total_energy_density[s] + current_pressure[s] +
+                                0.5 * magnetic_field_squared[s];
+      if (UNLIKELY(a_in_cubic <= 0.0)) {
+        continue;
+      }
+      const double phi = acos(sqrt(6.75 * d_in_cubic[s] / cube(a_in_cubic)));
+      const double root_of_cubic =
+          (a_in_cubic / 3.0) * (1.0 - 2.0 * cos((2.0 / 3.0) * (M_PI + phi)));
+      const double rho_h_w_squared = root_of_cubic - magnetic_field_squared[s];
+      if (UNLIKELY(rho_h_w_squared <= 0.0)) {
+        continue;
+      }
+      const double v_squared =
+          (momentum_density_squared[s] * square(rho_h_w_squared) +
+           square(momentum_density_dot_magnetic_field[s]) *
+               (magnetic_field_squared[s] + 2.0 * rho_h_w_squared)) /
+          square(rho_h_w_squared * root_of_cubic);
+      if (UNLIKELY(v_squared < 0.0 or v_squared >= 1.0)) {
+        continue;
+      }
+      const double current_lorentz_factor = sqrt(1.0 / (1.0 - v_squared));
+      const double current_rest_mass_density =
+          rest_mass_density_times_lorentz_factor[s] / current_lorentz_factor;
+
+      if (converged[s]) {
+        (*primitive_data)[s] = PrimitiveRecoveryData{
+            current_rest_mass_density, current_lorentz_factor,
+            current_pressure[s], rho_h_w_squared, electron_fraction[s]};
+        continue;
+      }
+
+      const double current_specific_enthalpy =
+          rho_h_w_squared /
+          (current_rest_mass_density * square(current_lorentz_factor));
+      if (UNLIKELY(1.0 - 1.0e-12 > current_specific_enthalpy)) {
+        continue;
+      }
+
+      eos_rest_mass_density[number_of_active_points] =
+          current_rest_mass_density;
+      eos_specific_enthalpy[number_of_active_points] =
+          std::max(1.0, current_specific_enthalpy);
+      // Compacting in place is safe because the write index never exceeds the
+      // read index
+      active_points[number_of_active_points] = s;
+      ++number_of_active_points;
+    }
+    active_points.resize(number_of_active_points);
+    if (active_points.empty()) {
+      break;
+    }
+
+    get(active_rest_mass_density)
+        .set_data_ref(eos_rest_mass_density.data(), number_of_active_points);
+    if constexpr (ThermodynamicDim == 1) {
+      active_pressure =
+          equation_of_state.pressure_from_density(active_rest_mass_density);
+    } else if constexpr (ThermodynamicDim == 2) {
+      get(active_specific_enthalpy)
+          .set_data_ref(eos_specific_enthalpy.data(), number_of_active_points);
+      active_pressure = equation_of_state.pressure_from_density_and_enthalpy(
+          active_rest_mass_density, active_specific_enthalpy);
+    } else if constexpr (ThermodynamicDim == 3) {
+      ERROR("3d EOS not implemented");
+    }
+
+    for (size_t i = 0; i < number_of_active_points; ++i) {
+      const size_t s = active_points[i];
+      current_pressure[s] = get(active_pressure)[i];
+      auto& point_aitken_pressure = aitken_pressure[s];
+      size_t& valid_entries = valid_entries_in_aitken_pressure[s];
+      gsl::at(point_aitken_pressure, valid_entries++) = current_pressure[s];
+      if (3 == valid_entries) {
+        const double aitken_residual =
+            (point_aitken_pressure[2] - point_aitken_pressure[1]) /
+            (point_aitken_pressure[1] - point_aitken_pressure[0]);
+        if (0.0 <= aitken_residual and aitken_residual < 1.0) {
+          previous_pressure[s] = current_pressure[s];
+          current_pressure[s] =
+              point_aitken_pressure[1] +
+              (point_aitken_pressure[2] - point_aitken_pressure[1]) /
+                  (1.0 - aitken_residual);
+          point_aitken_pressure = {
+              {current_pressure[s],
+               std::numeric_limits<double>::signaling_NaN(),
+               std::numeric_limits<double>::signaling_NaN()}};
+          valid_entries = 1;
+        } else {
+          point_aitken_pressure[0] = point_aitken_pressure[1];
+          point_aitken_pressure[1] = point_aitken_pressure[2];
+          valid_entries = 2;
+        }
+      }
+      converged[s] = fabs(current_pressure[s] - previous_pressure[s]) <=
+                     relative_tolerance_ *
+                         (current_pressure[s] + previous_pressure[s]);
+    }
+  }
+}
 }  // namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes
 
 #define THERMODIM(data) BOOST_PP_TUPLE_ELEM(0, data)
@@ -186,5 +363,27 @@ std::optional<PrimitiveRecoveryData> NewmanHamlin::apply(
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2))
 
+#undef INSTANTIATION
+
+#define INSTANTIATION(_, data)                                                \
+  template void                                                               \
+  grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin::apply<     \
+      THERMODIM(data)>(                                                       \
+      const gsl::not_null<std::vector<std::optional<                          \
+          grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::                 \
+              PrimitiveRecoveryData>>*>                                       \
+          primitive_data,                                                     \
+      const DataVector& initial_guess_for_pressure,                           \
+      const DataVector& total_energy_density,                                 \
+      const DataVector& momentum_density_squared,                             \
+      const DataVector& momentum_density_dot_magnetic_field,                  \
+      const DataVector& magnetic_field_squared,                               \
+      const DataVector& rest_mass_density_times_lorentz_factor,               \
+      const DataVector& electron_fraction,                                    \
+      const EquationsOfState::EquationOfState<true, THERMODIM(data)>&         \
+          equation_of_state);
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2))
+
 #undef INSTANTIATION
 #undef THERMODIM
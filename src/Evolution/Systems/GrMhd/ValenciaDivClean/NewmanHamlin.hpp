@@ -6,10 +6,20 @@
 #include <cstddef>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
 
+/// \cond
+namespace gsl {
+template <typename T>
+class not_null;
+}  // namespace gsl
+
+class DataVector;
+/// \endcond
+
 // IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
 
 namespace grmhd {
@@ -43,9 +53,22 @@ namespace PrimitiveRecoverySchemes {
  * density, momentum density, specific internal energy density, and magnetic
  * field, and \f$\gamma\f$ and \f$\gamma^{mn}\f$ are the determinant and inverse
  * of the spatial metric \f$\gamma_{mn}\f$.
+ *
+ * The overload taking `DataVector`s recovers the primitives at many points at
+ * once. The fixed-point iteration runs in lockstep at all points, so the
+ * equation of state is evaluated once per iteration for all points that are
+ * still iterating instead of once per iteration at every point. A point drops
+ * out of the iteration as soon as it converges or fails, and its entry in
+ * `primitive_data` is set or left as `std::nullopt`, respectively. The results
+ * are identical to calling the pointwise overload at each point.
  */
 class NewmanHamlin {
  public:
+  /// `PrimitiveFromConservative` calls the `DataVector` overload of `apply`
+  /// once for all points instead of calling the pointwise overload at every
+  /// point. Schemes without this flag are always called pointwise.
+  static constexpr bool supports_batched_recovery = true;
+
   template <size_t ThermodynamicDim>
   static std::optional<PrimitiveRecoveryData> apply(
       double initial_guess_for_pressure, double total_energy_density,
@@ -55,6 +78,20 @@ class NewmanHamlin {
       const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
           equation_of_state);
 
+  template <size_t ThermodynamicDim>
+  static void apply(
+      gsl::not_null<std::vector<std::optional<PrimitiveRecoveryData>>*>
+          primitive_data,
+      const DataVector& initial_guess_for_pressure,
+      const DataVector& total_energy_density,
+      const DataVector& momentum_density_squared,
+      const DataVector& momentum_density_dot_magnetic_field,
+      const DataVector& magnetic_field_squared,
+      const DataVector& rest_mass_density_times_lorentz_factor,
+      const DataVector& electron_fraction,
+      const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+          equation_of_state);
+
   static const std::string name() { return "Newman Hamlin"; }
 
  private:
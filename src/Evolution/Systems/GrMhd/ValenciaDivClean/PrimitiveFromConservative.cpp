@@ -3,10 +3,14 @@
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
 
+#include <algorithm>
+#include <array>
 #include <iomanip>
 #include <limits>
+#include <numeric>
 #include <optional>
 #include <ostream>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
@@ -26,14 +30,80 @@
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/TMPL.hpp"
-
-// IWYU pragma: no_include <array>
+#include "Utilities/TypeTraits/CreateHasStaticMemberVariable.hpp"
 
 // IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
 // IWYU pragma: no_forward_declare Tensor
 
 namespace grmhd::ValenciaDivClean {
+namespace {
+CREATE_HAS_STATIC_MEMBER_VARIABLE(supports_batched_recovery)
+CREATE_HAS_STATIC_MEMBER_VARIABLE_V(supports_batched_recovery)
+
+template <typename PrimitiveRecoveryScheme>
+constexpr bool use_batched_recovery() {
+  if constexpr (has_supports_batched_recovery_v<PrimitiveRecoveryScheme>) {
+    return PrimitiveRecoveryScheme::supports_batched_recovery;
+  } else {
+    return false;
+  }
+}
+
+// Tries the `PrimitiveRecoveryScheme` at all `unrecovered_points` with a single
+// call to its `DataVector` overload of `apply`. The `arguments` are the
+// arguments of `apply` at all points, in order. They are gathered into
+// contiguous buffers unless the scheme is tried at every point.
+template <typename PrimitiveRecoveryScheme, size_t ThermodynamicDim>
+void batched_recovery(
+    const gsl::not_null<std::vector<
+        std::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>>*>
+        primitive_data,
+    const std::vector<size_t>& unrecovered_points,
+    const std::array<const DataVector*, 7>& arguments,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state) {
+  const auto call_apply =
+      [&equation_of_state](
+          const gsl::not_null<std::vector<
+              std::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>>*>
+              local_primitive_data,
+          const auto& local_arguments) {
+        PrimitiveRecoveryScheme::template apply<ThermodynamicDim>(
+            local_primitive_data, *gsl::at(local_arguments, 0),
+            *gsl::at(local_arguments, 1), *gsl::at(local_arguments, 2),
+            *gsl::at(local_arguments, 3), *gsl::at(local_arguments, 4),
+            *gsl::at(local_arguments, 5), *gsl::at(local_arguments, 6),
+            equation_of_state);
+      };
+  const size_t number_of_points = unrecovered_points.size();
+  if (number_of_points == primitive_data->size()) {
+    call_apply(primitive_data, arguments);
+    return;
+  }
+
+  DataVector buffer(arguments.size() * number_of_points);
+  std::array<DataVector, 7> gathered_arguments{};
+  std::array<const DataVector*, 7> gathered_argument_pointers{};
+  for (size_t j = 0; j < arguments.size(); ++j) {
+    gsl::at(gathered_arguments, j)
+        .set_data_ref(&buffer[j * number_of_points], number_of_points);
+    for (size_t i = 0; i < number_of_points; ++i) {
+      gsl::at(gathered_arguments, j)[i] =
+          (*gsl::at(arguments, j))[unrecovered_points[i]];
+    }
+    gsl::at(gathered_argument_pointers, j) = &gsl::at(gathered_arguments, j);
+  }
+  std::vector<std::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>>
+      gathered_primitive_data(number_of_points);
+  call_apply(make_not_null(&gathered_primitive_data),
+             gathered_argument_pointers);
+  for (size_t i = 0; i < number_of_points; ++i) {
+    (*primitive_data)[unrecovered_points[i]] = gathered_primitive_data[i];
+  }
+}
+}  // namespace
 
 template <typename OrderedListOfPrimitiveRecoverySchemes, bool ErrorOnFailure>
 template <size_t ThermodynamicDim>
@@ -106,20 +176,40 @@ bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
   // This may need bounds
   // limit Ye to table bounds once that is implemented
 
-  for (size_t s = 0; s < total_energy_density.size(); ++s) {
+  for (size_t s = 0; s < size; ++s) {
     get(*electron_fraction)[s] =
         std::min(0.5, std::max(get(tilde_ye)[s] / get(tilde_d)[s], 0.));
+  }
 
-    std::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>
-        primitive_data = std::nullopt;
-    tmpl::for_each<OrderedListOfPrimitiveRecoverySchemes>(
-        [&pressure, &primitive_data, &total_energy_density,
-         &momentum_density_squared, &momentum_density_dot_magnetic_field,
-         &magnetic_field_squared, &rest_mass_density_times_lorentz_factor,
-         &equation_of_state, &s, &electron_fraction](auto scheme) {
-          using primitive_recovery_scheme = tmpl::type_from<decltype(scheme)>;
-          if (not primitive_data.has_value()) {
-            primitive_data =
+  // Each scheme is only tried at the points where all previous schemes failed.
+  // Only schemes that support batched recovery (currently only NewmanHamlin)
+  // are called once for all these points, the others are called pointwise.
+  std::vector<std::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>>
+      primitive_data(size);
+  std::vector<size_t> unrecovered_points(size);
+  std::iota(unrecovered_points.begin(), unrecovered_points.end(), 0_st);
+  tmpl::for_each<OrderedListOfPrimitiveRecoverySchemes>(
+      [&pressure, &primitive_data, &unrecovered_points, &total_energy_density,
+       &momentum_density_squared, &momentum_density_dot_magnetic_field,
+       &magnetic_field_squared, &rest_mass_density_times_lorentz_factor,
+       &equation_of_state, &electron_fraction](auto scheme) {
+        using primitive_recovery_scheme = tmpl::type_from<decltype(scheme)>;
+        if (unrecovered_points.empty()) {
+          return;
+        }
+        if constexpr (use_batched_recovery<primitive_recovery_scheme>()) {
+          batched_recovery<primitive_recovery_scheme>(
+              make_not_null(&primitive_data), unrecovered_points,
+              {{&get(*pressure), &total_energy_density,
+                &get(momentum_density_squared),
+                &get(momentum_density_dot_magnetic_field),
+                &get(magnetic_field_squared),
+                &rest_mass_density_times_lorentz_factor,
+                &get(*electron_fraction)}},
+              equation_of_state);
+        } else {
+          for (const size_t s : unrecovered_points) {
+            primitive_data[s] =
                 primitive_recovery_scheme::template apply<ThermodynamicDim>(
                     get(*pressure)[s], total_energy_density[s],
                     get(momentum_density_squared)[s],
@@ -128,26 +218,36 @@ bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
                     rest_mass_density_times_lorentz_factor[s],
                     get(*electron_fraction)[s], equation_of_state);
           }
-        });
+        }
+        unrecovered_points.erase(
+            std::remove_if(unrecovered_points.begin(),
+                           unrecovered_points.end(),
+                           [&primitive_data](const size_t s) {
+                             return primitive_data[s].has_value();
+                           }),
+            unrecovered_points.end());
+      });
 
-    if (primitive_data.has_value()) {
-      get(*rest_mass_density)[s] = primitive_data.value().rest_mass_density;
+  for (size_t s = 0; s < size; ++s) {
+    if (primitive_data[s].has_value()) {
+      get(*rest_mass_density)[s] =
+          primitive_data[s].value().rest_mass_density;
       const double coefficient_of_b =
           get(momentum_density_dot_magnetic_field)[s] /
-          (primitive_data.value().rho_h_w_squared *
-           (primitive_data.value().rho_h_w_squared +
+          (primitive_data[s].value().rho_h_w_squared *
+           (primitive_data[s].value().rho_h_w_squared +
             get(magnetic_field_squared)[s]));
       const double coefficient_of_s =
           1.0 / (get(sqrt_det_spatial_metric)[s] *
-                 (primitive_data.value().rho_h_w_squared +
+                 (primitive_data[s].value().rho_h_w_squared +
                   get(magnetic_field_squared)[s]));
       for (size_t i = 0; i < 3; ++i) {
         spatial_velocity->get(i)[s] =
             coefficient_of_b * magnetic_field->get(i)[s] +
             coefficient_of_s * tilde_s_upper.get(i)[s];
       }
-      get(*lorentz_factor)[s] = primitive_data.value().lorentz_factor;
-      get(*pressure)[s] = primitive_data.value().pressure;
+      get(*lorentz_factor)[s] = primitive_data[s].value().lorentz_factor;
+      get(*pressure)[s] = primitive_data[s].value().pressure;
     } else {
       if constexpr (ErrorOnFailure) {
         ERROR("All primitive inversion schemes failed at s = "
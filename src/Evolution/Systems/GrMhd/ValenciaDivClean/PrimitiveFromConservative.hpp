@@ -41,6 +41,14 @@ namespace ValenciaDivClean {
  * (http://iopscience.iop.org/article/10.3847/1538-4357/aabcc5/meta)
  * compares several inversion methods.
  *
+ * The schemes in `OrderedListOfPrimitiveRecoverySchemes` are tried in order,
+ * each one only at the points where all previous schemes failed. Schemes that
+ * declare `static constexpr bool supports_batched_recovery = true` are called
+ * once with all of these points. Currently only
+ * `PrimitiveRecoverySchemes::NewmanHamlin` does. All other schemes, such as
+ * `PrimitiveRecoverySchemes::KastaunEtAl` and
+ * `PrimitiveRecoverySchemes::PalenzuelaEtAl`, are still called point by point.
+ *
  * If `ErrorOnFailure` is `false` then the returned `bool` will be `false` if
  * recovery failed and `true` if it succeeded.
  */
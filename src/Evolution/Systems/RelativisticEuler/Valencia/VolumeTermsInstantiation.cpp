@@ -47,6 +47,7 @@ namespace evolution::dg::Actions::detail {
       const std::optional<tnsr::I<DataVector, DIM(data), Frame::Inertial>>&    \
           mesh_velocity,                                                       \
       const std::optional<Scalar<DataVector>>& div_mesh_velocity,              \
+      const VolumeTermsPhase phase,                                            \
       const Scalar<DataVector>& tilde_d, const Scalar<DataVector>& tilde_tau,  \
       const tnsr::i<DataVector, DIM(data), Frame::Inertial>& tilde_s,          \
       const Scalar<DataVector>& lapse,                                         \
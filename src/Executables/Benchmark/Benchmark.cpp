@@ -5,12 +5,28 @@
 #pragma GCC diagnostic ignored "-Wredundant-decls"
 #include <benchmark/benchmark.h>
 #pragma GCC diagnostic pop
+#include <array>
 #include <charm++.h>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <optional>
+#include <random>
 #include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/ComplexModalVector.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "DataStructures/SpinWeighted.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/CoordinateMaps/Affine.hpp"
@@ -18,59 +34,60 @@
 #include "Domain/CoordinateMaps/CoordinateMap.tpp"
 #include "Domain/CoordinateMaps/ProductMaps.hpp"
 #include "Domain/CoordinateMaps/ProductMaps.tpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
 #include "Domain/Structure/Element.hpp"
+#include "Evolution/Systems/Cce/LinearSolve.hpp"
+#include "Evolution/Systems/Cce/Tags.hpp"
+#include "Evolution/Systems/Ccz4/TimeDerivative.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/ConstraintDamping/Tags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Harmonic.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/Tags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/TimeDerivative.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/BoundaryCorrections/Rusanov.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/NewmanHamlin.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/TimeDerivativeTerms.hpp"
+#include "NumericalAlgorithms/FiniteDifference/AoWeno.hpp"
+#include "NumericalAlgorithms/FiniteDifference/MonotonisedCentral.hpp"
+#include "NumericalAlgorithms/FiniteDifference/PositivityPreservingAdaptiveOrder.hpp"
+#include "NumericalAlgorithms/FiniteDifference/Wcns5z.hpp"
+#include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Projection.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "NumericalAlgorithms/Spectral/SwshCollocation.hpp"
+#include "NumericalAlgorithms/Spectral/SwshTransform.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/IdealFluid.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/Tabulated3d.hpp"
 #include "PointwiseFunctions/MathFunctions/PowX.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/ThreadPool.hpp"
+#include "Utilities/TypeTraits/IsA.hpp"
 
 // Charm looks for this function but since we build without a main function or
 // main module we just have it be empty
 extern "C" void CkRegisterMainModule(void) {}
 
-// This file is an example of how to do microbenchmark with Google Benchmark
-// https://github.com/google/benchmark
-// For two examples in different anonymous namespaces
+// This file holds microbenchmarks of the hot kernels of our evolutions, using
+// Google Benchmark (https://github.com/google/benchmark). Each anonymous
+// namespace groups the benchmarks of one kernel. Most benchmarks take the
+// number of grid points of an element, or per dimension of an element, as
+// argument so the cost can be compared across resolutions.
+//
+// Run the benchmarks with
+// `--benchmark_out=<file> --benchmark_out_format=json` to write the results to
+// a JSON file, and compare them to a baseline with
+// `spectre compare-benchmarks <baseline> <file>` to find regressions.
 
 namespace {
-// Benchmark of push_back() in std::vector, following Chandler Carruth's talk
-// at CppCon in 2015,
-// https://www.youtube.com/watch?v=nXaxk27zwlk
-
-// void bench_create(benchmark::State &state) {
-//  while (state.KeepRunning()) {
-//    std::vector<int> v;
-//    benchmark::DoNotOptimize(&v);
-//    static_cast<void>(v);
-//  }
-// }
-// BENCHMARK(bench_create);
-
-// void bench_reserve(benchmark::State &state) {
-//  while (state.KeepRunning()) {
-//    std::vector<int> v;
-//    v.reserve(1);
-//    benchmark::DoNotOptimize(v.data());
-//  }
-// }
-// BENCHMARK(bench_reserve);
-
-// void bench_push_back(benchmark::State &state) {
-//  while (state.KeepRunning()) {
-//    std::vector<int> v;
-//    v.reserve(1);
-//    benchmark::DoNotOptimize(v.data());
-//    v.push_back(42);
-//    benchmark::ClobberMemory();
-//  }
-// }
-// BENCHMARK(bench_push_back);
-}  // namespace
-
-namespace {
-// In this anonymous namespace is an example of microbenchmarking the
-// all_gradient routine for the GH system
+// In this anonymous namespace is a microbenchmark of the partial derivatives of
+// the GH variables. The argument is the number of grid points per dimension.
 
 template <size_t Dim>
 struct Kappa : db::SimpleTag {
@@ -83,9 +100,9 @@ struct Psi : db::SimpleTag {
 
 // clang-tidy: don't pass be non-const reference
 void bench_all_gradient(benchmark::State& state) {  // NOLINT
-  constexpr const size_t pts_1d = 4;
   constexpr const size_t Dim = 3;
-  const Mesh<Dim> mesh{pts_1d, Spectral::Basis::Legendre,
+  const Mesh<Dim> mesh{static_cast<size_t>(state.range(0)),
+                       Spectral::Basis::Legendre,
                        Spectral::Quadrature::GaussLobatto};
   domain::CoordinateMaps::Affine map1d(-1.0, 1.0, -1.0, 1.0);
   using Map3d =
@@ -105,7 +122,819 @@ void bench_all_gradient(benchmark::State& state) {  // NOLINT
     benchmark::DoNotOptimize(partial_derivatives<VarTags>(vars, mesh, inv_jac));
   }
 }
-BENCHMARK(bench_all_gradient);  // NOLINT
+BENCHMARK(bench_all_gradient)->Arg(4)->Arg(6)->Arg(8)->Arg(10);  // NOLINT
+}  // namespace
+
+namespace {
+// In this anonymous namespace are microbenchmarks of applying matrices to the
+// GH variables on an element: the projection to a child element used by
+// h-refinement, and the interpolation to scattered points used by the
+// interpolation framework. The argument is the number of grid points per
+// dimension.
+using GhGridVars = Variables<tmpl::list<Kappa<3>, Psi<3>>>;
+
+Mesh<3> benchmark_mesh(const size_t points_per_dimension) {
+  return {points_per_dimension, Spectral::Basis::Legendre,
+          Spectral::Quadrature::GaussLobatto};
+}
+
+GhGridVars random_gh_grid_vars(const size_t number_of_points) {
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<> distribution(-1.0, 1.0);
+  GhGridVars vars(number_of_points);
+  for (size_t i = 0; i < vars.size(); ++i) {
+    vars.data()[i] = distribution(generator);
+  }
+  return vars;
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_apply_matrices(benchmark::State& state) {  // NOLINT
+  const Mesh<3> mesh = benchmark_mesh(static_cast<size_t>(state.range(0)));
+  const Matrix& projection_matrix = Spectral::projection_matrix_parent_to_child(
+      mesh.slice_through(0), mesh.slice_through(0),
+      Spectral::ChildSize::LowerHalf);
+  const std::array<Matrix, 3> matrices{
+      {projection_matrix, projection_matrix, projection_matrix}};
+  const auto vars = random_gh_grid_vars(mesh.number_of_grid_points());
+  GhGridVars result(mesh.number_of_grid_points());
+
+  while (state.KeepRunning()) {
+    apply_matrices(make_not_null(&result), matrices, vars, mesh.extents());
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(bench_apply_matrices)->Arg(4)->Arg(6)->Arg(8)->Arg(10);  // NOLINT
+
+// clang-tidy: don't pass be non-const reference
+void bench_irregular_interpolation(benchmark::State& state) {  // NOLINT
+  const Mesh<3> mesh = benchmark_mesh(static_cast<size_t>(state.range(0)));
+  const size_t number_of_target_points = 100;
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<> distribution(-1.0, 1.0);
+  tnsr::I<DataVector, 3, Frame::ElementLogical> target_points{
+      number_of_target_points};
+  for (auto& component : target_points) {
+    for (auto& value : component) {
+      value = distribution(generator);
+    }
+  }
+  const intrp::Irregular<3> interpolant(mesh, target_points);
+  const auto vars = random_gh_grid_vars(mesh.number_of_grid_points());
+  GhGridVars result(number_of_target_points);
+
+  while (state.KeepRunning()) {
+    interpolant.interpolate(make_not_null(&result), vars);
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(bench_irregular_interpolation)  // NOLINT
+    ->Arg(4)
+    ->Arg(6)
+    ->Arg(8)
+    ->Arg(10);
+}  // namespace
+
+namespace {
+// In this anonymous namespace is a microbenchmark of the NewmanHamlin primitive
+// recovery for the GRMHD ValenciaDivClean system, comparing the batched
+// recovery of all points of an element with the pointwise recovery. It is the
+// only scheme that supports batched recovery. The data is a radial
+// profile loosely modeled on the collapsing core of a supernova: the density
+// falls off over six orders of magnitude, the fluid falls inward, the field is
+// weak compared to the fluid pressure, and the initial guess for the pressure
+// is the pressure of the previous time step.
+struct RecoveryInput {
+  explicit RecoveryInput(const size_t number_of_points)
+      : initial_guess_for_pressure(number_of_points),
+        total_energy_density(number_of_points),
+        momentum_density_squared(number_of_points),
+        momentum_density_dot_magnetic_field(number_of_points),
+        magnetic_field_squared(number_of_points),
+        rest_mass_density_times_lorentz_factor(number_of_points),
+        electron_fraction(number_of_points) {}
+
+  DataVector initial_guess_for_pressure;
+  DataVector total_energy_density;
+  DataVector momentum_density_squared;
+  DataVector momentum_density_dot_magnetic_field;
+  DataVector magnetic_field_squared;
+  DataVector rest_mass_density_times_lorentz_factor;
+  DataVector electron_fraction;
+};
+
+RecoveryInput collapsing_core_profile(
+    const size_t number_of_points,
+    const EquationsOfState::IdealFluid<true>& equation_of_state) {
+  RecoveryInput input(number_of_points);
+  for (size_t s = 0; s < number_of_points; ++s) {
+    const double radius =
+        1.0 + 99.0 * static_cast<double>(s) /
+                  static_cast<double>(number_of_points - 1);
+    const double rest_mass_density = 1.e-3 / cube(radius);
+    const double specific_internal_energy = 0.05 / radius;
+    const double pressure =
+        get(equation_of_state.pressure_from_density_and_energy(
+            Scalar<double>(rest_mass_density),
+            Scalar<double>(specific_internal_energy)));
+    const double specific_enthalpy =
+        1.0 + specific_internal_energy + pressure / rest_mass_density;
+    // Infall velocity along x, magnetic field at an angle to it
+    const double infall_speed = 0.2 / sqrt(radius);
+    const double lorentz_factor = 1.0 / sqrt(1.0 - square(infall_speed));
+    const double magnetic_field_squared = 1.e-2 * pressure;
+    const double magnetic_field_dot_velocity =
+        -infall_speed * sqrt(magnetic_field_squared) * cos(M_PI / 6.0);
+    const double rho_h_w_squared =
+        rest_mass_density * specific_enthalpy * square(lorentz_factor);
+    // Flat space, so the conserved variables in the notation of
+    // `NewmanHamlin` follow directly from the primitive variables
+    input.initial_guess_for_pressure[s] = 1.001 * pressure;
+    input.total_energy_density[s] =
+        rho_h_w_squared - pressure + magnetic_field_squared -
+        0.5 * (square(magnetic_field_dot_velocity) +
+               magnetic_field_squared / square(lorentz_factor));
+    // S_i = (rho h W^2 + B^2) v_i - (B^j v_j) B_i
+    const double s_parallel =
+        (rho_h_w_squared + magnetic_field_squared) * infall_speed -
+        magnetic_field_dot_velocity *
+            (magnetic_field_dot_velocity / infall_speed);
+    const double s_perpendicular = -magnetic_field_dot_velocity *
+                                   sqrt(magnetic_field_squared) *
+                                   sin(M_PI / 6.0);
+    input.momentum_density_squared[s] =
+        square(s_parallel) + square(s_perpendicular);
+    input.momentum_density_dot_magnetic_field[s] =
+        rho_h_w_squared * magnetic_field_dot_velocity;
+    input.magnetic_field_squared[s] = magnetic_field_squared;
+    input.rest_mass_density_times_lorentz_factor[s] =
+        rest_mass_density * lorentz_factor;
+    input.electron_fraction[s] = 0.5 - 0.2 / radius;
+  }
+  return input;
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_batched_primitive_recovery(benchmark::State& state) {  // NOLINT
+  const EquationsOfState::IdealFluid<true> equation_of_state(4.0 / 3.0);
+  const auto number_of_points = static_cast<size_t>(state.range(0));
+  const RecoveryInput input =
+      collapsing_core_profile(number_of_points, equation_of_state);
+  std::vector<std::optional<
+      grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PrimitiveRecoveryData>>
+      primitive_data(number_of_points);
+
+  while (state.KeepRunning()) {
+    grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin::apply(
+        make_not_null(&primitive_data), input.initial_guess_for_pressure,
+        input.total_energy_density, input.momentum_density_squared,
+        input.momentum_density_dot_magnetic_field,
+        input.magnetic_field_squared,
+        input.rest_mass_density_times_lorentz_factor, input.electron_fraction,
+        equation_of_state);
+    benchmark::DoNotOptimize(primitive_data.data());
+  }
+}
+BENCHMARK(bench_batched_primitive_recovery)  // NOLINT
+    ->Arg(64)
+    ->Arg(512)
+    ->Arg(4096);
+
+// clang-tidy: don't pass be non-const reference
+void bench_pointwise_primitive_recovery(benchmark::State& state) {  // NOLINT
+  const EquationsOfState::IdealFluid<true> equation_of_state(4.0 / 3.0);
+  const auto number_of_points = static_cast<size_t>(state.range(0));
+  const RecoveryInput input =
+      collapsing_core_profile(number_of_points, equation_of_state);
+  std::vector<std::optional<
+      grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PrimitiveRecoveryData>>
+      primitive_data(number_of_points);
+
+  while (state.KeepRunning()) {
+    for (size_t s = 0; s < number_of_points; ++s) {
+      primitive_data[s] = grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::
+          NewmanHamlin::apply<2>(
+              input.initial_guess_for_pressure[s],
+              input.total_energy_density[s], input.momentum_density_squared[s],
+              input.momentum_density_dot_magnetic_field[s],
+              input.magnetic_field_squared[s],
+              input.rest_mass_density_times_lorentz_factor[s],
+              input.electron_fraction[s], equation_of_state);
+    }
+    benchmark::DoNotOptimize(primitive_data.data());
+  }
+}
+BENCHMARK(bench_pointwise_primitive_recovery)  // NOLINT
+    ->Arg(64)
+    ->Arg(512)
+    ->Arg(4096);
+}  // namespace
+
+namespace {
+// In this anonymous namespace is a microbenchmark of the tabulated nuclear
+// equation of state. The table has the size of a typical nuclear table and
+// holds a simple analytic equation of state. The points are scattered randomly
+// through the table, so most of them miss the cache as they would in a
+// simulation with many elements per core.
+using TabulatedEos = EquationsOfState::Tabulated3D<true>;
+
+TabulatedEos benchmark_tabulated_eos() {
+  const size_t number_of_temperatures = 64;
+  const size_t number_of_densities = 256;
+  const size_t number_of_electron_fractions = 64;
+  const auto uniform_nodes = [](const double lower, const double upper,
+                                const size_t number_of_nodes) {
+    std::vector<double> nodes(number_of_nodes);
+    for (size_t i = 0; i < number_of_nodes; ++i) {
+      nodes[i] = lower + (upper - lower) * static_cast<double>(i) /
+                             static_cast<double>(number_of_nodes - 1);
+    }
+    return nodes;
+  };
+  std::vector<double> log_temperature =
+      uniform_nodes(log(0.01), log(100.0), number_of_temperatures);
+  std::vector<double> log_density =
+      uniform_nodes(log(1.e-12), log(1.e-3), number_of_densities);
+  std::vector<double> electron_fraction =
+      uniform_nodes(0.01, 0.6, number_of_electron_fractions);
+
+  std::vector<double> table_data(TabulatedEos::NumberOfVars *
+                                 number_of_temperatures * number_of_densities *
+                                 number_of_electron_fractions);
+  for (size_t k = 0; k < number_of_electron_fractions; ++k) {
+    for (size_t j = 0; j < number_of_densities; ++j) {
+      for (size_t i = 0; i < number_of_temperatures; ++i) {
+        double* const node =
+            &table_data[TabulatedEos::NumberOfVars *
+                        (i + number_of_temperatures *
+                                 (j + number_of_densities * k))];
+        // Ideal gas with a temperature in MeV and an electron contribution
+        node[TabulatedEos::Epsilon] =
+            log(1.e-3 * exp(log_temperature[i]) * (1.0 + electron_fraction[k]));
+        node[TabulatedEos::Pressure] = log_density[j] +
+                                       node[TabulatedEos::Epsilon] +
+                                       log(2.0 / 3.0);
+        node[TabulatedEos::CsSquared] = 0.1;
+        node[TabulatedEos::DeltaMu] = electron_fraction[k] - 0.3;
+      }
+    }
+  }
+  return TabulatedEos(std::move(electron_fraction), std::move(log_density),
+                      std::move(log_temperature), std::move(table_data), 0.0,
+                      1.0);
+}
+
+// Random points within the table
+std::array<Scalar<DataVector>, 3> random_density_temperature_and_ye(
+    const size_t number_of_points) {
+  std::mt19937 generator(2023);
+  std::uniform_real_distribution<> log_density(log(1.e-12), log(1.e-3));
+  std::uniform_real_distribution<> log_temperature(log(0.01), log(100.0));
+  std::uniform_real_distribution<> electron_fraction(0.01, 0.6);
+  std::array<Scalar<DataVector>, 3> points{};
+  for (auto& component : points) {
+    get(component) = DataVector(number_of_points);
+  }
+  for (size_t s = 0; s < number_of_points; ++s) {
+    get(points[0])[s] = exp(log_density(generator));
+    get(points[1])[s] = exp(log_temperature(generator));
+    get(points[2])[s] = electron_fraction(generator);
+  }
+  return points;
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_tabulated_pressure(benchmark::State& state) {  // NOLINT
+  const TabulatedEos equation_of_state = benchmark_tabulated_eos();
+  const auto [rest_mass_density, temperature, electron_fraction] =
+      random_density_temperature_and_ye(static_cast<size_t>(state.range(0)));
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        equation_of_state.pressure_from_density_and_temperature(
+            rest_mass_density, temperature, electron_fraction));
+  }
+}
+BENCHMARK(bench_tabulated_pressure)->Arg(512)->Arg(32768);  // NOLINT
+
+// clang-tidy: don't pass be non-const reference
+void bench_tabulated_temperature(benchmark::State& state) {  // NOLINT
+  const TabulatedEos equation_of_state = benchmark_tabulated_eos();
+  const auto [rest_mass_density, temperature, electron_fraction] =
+      random_density_temperature_and_ye(static_cast<size_t>(state.range(0)));
+  const Scalar<DataVector> specific_internal_energy =
+      equation_of_state.specific_internal_energy_from_density_and_temperature(
+          rest_mass_density, temperature, electron_fraction);
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        equation_of_state.temperature_from_density_and_energy(
+            rest_mass_density, specific_internal_energy, electron_fraction));
+  }
+}
+BENCHMARK(bench_tabulated_temperature)->Arg(512)->Arg(32768);  // NOLINT
+}  // namespace
+
+namespace {
+// In this anonymous namespace is a microbenchmark of evaluating tensor
+// expressions one LHS component at a time (`tenex::evaluate`) compared to
+// computing all LHS components in a single pass over the grid points
+// (`tenex::evaluate_fused`). The expressions are terms of the right-hand sides
+// of the GH and CCZ4 systems. The argument is the number of grid points of an
+// element.
+template <typename T>
+T random_tensor(const size_t number_of_points) {
+  std::mt19937 generator(2023);
+  std::uniform_real_distribution<> distribution(0.1, 1.0);
+  T tensor{};
+  for (auto& component : tensor) {
+    component = DataVector(number_of_points);
+    for (size_t s = 0; s < number_of_points; ++s) {
+      component[s] = distribution(generator);
+    }
+  }
+  return tensor;
+}
+
+// The quadratic term in the GH evolution equation for Pi:
+// 2 alpha g^{cd} (g^{ij} Phi_{ica} Phi_{jdb} - Pi_{ca} Pi_{db})
+template <bool Fused>
+void bench_gh_quadratic_term(benchmark::State& state) {  // NOLINT
+  const auto number_of_points = static_cast<size_t>(state.range(0));
+  const auto lapse = random_tensor<Scalar<DataVector>>(number_of_points);
+  const auto pi =
+      random_tensor<tnsr::aa<DataVector, 3, Frame::Inertial>>(number_of_points);
+  const auto phi = random_tensor<tnsr::iaa<DataVector, 3, Frame::Inertial>>(
+      number_of_points);
+  const auto inverse_spacetime_metric =
+      random_tensor<tnsr::AA<DataVector, 3, Frame::Inertial>>(
+          number_of_points);
+  const auto inverse_spatial_metric =
+      random_tensor<tnsr::II<DataVector, 3, Frame::Inertial>>(
+          number_of_points);
+  tnsr::aa<DataVector, 3, Frame::Inertial> result{};
+
+  while (state.KeepRunning()) {
+    if constexpr (Fused) {
+      tenex::evaluate_fused<ti::a, ti::b>(
+          make_not_null(&result),
+          2.0 * lapse() * inverse_spacetime_metric(ti::C, ti::D) *
+              (inverse_spatial_metric(ti::I, ti::J) * phi(ti::i, ti::c, ti::a) *
+                   phi(ti::j, ti::d, ti::b) -
+               pi(ti::c, ti::a) * pi(ti::d, ti::b)));
+    } else {
+      tenex::evaluate<ti::a, ti::b>(
+          make_not_null(&result),
+          2.0 * lapse() * inverse_spacetime_metric(ti::C, ti::D) *
+              (inverse_spatial_metric(ti::I, ti::J) * phi(ti::i, ti::c, ti::a) *
+                   phi(ti::j, ti::d, ti::b) -
+               pi(ti::c, ti::a) * pi(ti::d, ti::b)));
+    }
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK_TEMPLATE(bench_gh_quadratic_term, false)  // NOLINT
+    ->Arg(125)
+    ->Arg(1000);
+BENCHMARK_TEMPLATE(bench_gh_quadratic_term, true)  // NOLINT
+    ->Arg(125)
+    ->Arg(1000);
+
+// Raising the indices of the CCZ4 auxiliary variable D (eq. 14 of
+// \cite Dumbser2017okk): D_k^{ij} = g^{in} g^{mj} D_{knm}
+template <bool Fused>
+void bench_ccz4_field_d_up(benchmark::State& state) {  // NOLINT
+  const auto number_of_points = static_cast<size_t>(state.range(0));
+  const auto inverse_conformal_spatial_metric =
+      random_tensor<tnsr::II<DataVector, 3, Frame::Inertial>>(
+          number_of_points);
+  const auto field_d = random_tensor<tnsr::ijj<DataVector, 3, Frame::Inertial>>(
+      number_of_points);
+  tnsr::iJJ<DataVector, 3, Frame::Inertial> result{};
+
+  while (state.KeepRunning()) {
+    if constexpr (Fused) {
+      tenex::evaluate_fused<ti::k, ti::I, ti::J>(
+          make_not_null(&result),
+          inverse_conformal_spatial_metric(ti::I, ti::N) *
+              inverse_conformal_spatial_metric(ti::M, ti::J) *
+              field_d(ti::k, ti::n, ti::m));
+    } else {
+      tenex::evaluate<ti::k, ti::I, ti::J>(
+          make_not_null(&result),
+          inverse_conformal_spatial_metric(ti::I, ti::N) *
+              inverse_conformal_spatial_metric(ti::M, ti::J) *
+              field_d(ti::k, ti::n, ti::m));
+    }
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK_TEMPLATE(bench_ccz4_field_d_up, false)  // NOLINT
+    ->Arg(125)
+    ->Arg(1000);
+BENCHMARK_TEMPLATE(bench_ccz4_field_d_up, true)  // NOLINT
+    ->Arg(125)
+    ->Arg(1000);
+}  // namespace
+
+namespace {
+// In this anonymous namespace are microbenchmarks of the parts of the
+// characteristic evolution in CCE that are split across the `thread_pool`. The
+// resolution matches the `CharacteristicExtract` input file and the data is
+// random, so only the timing is meaningful. The argument is the number of
+// threads.
+constexpr size_t cce_l_max = 20;
+constexpr size_t cce_number_of_radial_points = 12;
+
+ComplexDataVector random_cce_volume_data(const gsl::not_null<std::mt19937*> gen,
+                                         const double scale) {
+  std::uniform_real_distribution<> dist(-scale, scale);
+  ComplexDataVector result{
+      Spectral::Swsh::number_of_swsh_collocation_points(cce_l_max) *
+      cce_number_of_radial_points};
+  for (auto& value : result) {
+    value = std::complex<double>(dist(*gen), dist(*gen));
+  }
+  return result;
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_cce_bondi_h_integration(benchmark::State& state) {  // NOLINT
+  thread_pool::set_number_of_threads(static_cast<size_t>(state.range(0)));
+  const size_t number_of_angular_points =
+      Spectral::Swsh::number_of_swsh_collocation_points(cce_l_max);
+  std::mt19937 gen(1);
+  const Scalar<SpinWeighted<ComplexDataVector, 2>> pole_of_integrand{
+      random_cce_volume_data(make_not_null(&gen), 1.0)};
+  const Scalar<SpinWeighted<ComplexDataVector, 2>> regular_integrand{
+      random_cce_volume_data(make_not_null(&gen), 1.0)};
+  // Small linear factors keep the linear systems well conditioned
+  const Scalar<SpinWeighted<ComplexDataVector, 0>> linear_factor{
+      random_cce_volume_data(make_not_null(&gen), 0.1)};
+  const Scalar<SpinWeighted<ComplexDataVector, 4>> linear_factor_of_conjugate{
+      random_cce_volume_data(make_not_null(&gen), 0.1)};
+  Scalar<SpinWeighted<ComplexDataVector, 2>> boundary{
+      number_of_angular_points};
+  get(boundary).data() = ComplexDataVector{
+      get(pole_of_integrand).data().data(), number_of_angular_points};
+  const Scalar<SpinWeighted<ComplexDataVector, 0>> one_minus_y{outer_product(
+      ComplexDataVector{number_of_angular_points, 1.0},
+      std::complex<double>(1.0, 0.0) *
+          (1.0 - Spectral::collocation_points<
+                     Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto>(
+                     cce_number_of_radial_points)))};
+  Scalar<SpinWeighted<ComplexDataVector, 2>> bondi_h{
+      number_of_angular_points * cce_number_of_radial_points};
+
+  while (state.KeepRunning()) {
+    Cce::RadialIntegrateBondi<Cce::Tags::BoundaryValue, Cce::Tags::BondiH>::
+        apply(make_not_null(&bondi_h), pole_of_integrand, regular_integrand,
+              linear_factor, linear_factor_of_conjugate, boundary, one_minus_y,
+              cce_l_max, cce_number_of_radial_points);
+    benchmark::DoNotOptimize(get(bondi_h).data().data());
+  }
+  thread_pool::set_number_of_threads(1);
+}
+BENCHMARK(bench_cce_bondi_h_integration)  // NOLINT
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->UseRealTime();
+
+// clang-tidy: don't pass be non-const reference
+void bench_cce_swsh_transform(benchmark::State& state) {  // NOLINT
+  thread_pool::set_number_of_threads(static_cast<size_t>(state.range(0)));
+  std::mt19937 gen(1);
+  const SpinWeighted<ComplexDataVector, 2> collocation{
+      random_cce_volume_data(make_not_null(&gen), 1.0)};
+  SpinWeighted<ComplexModalVector, 2> modes{};
+
+  while (state.KeepRunning()) {
+    Spectral::Swsh::swsh_transform(cce_l_max, cce_number_of_radial_points,
+                                   make_not_null(&modes), collocation);
+    benchmark::DoNotOptimize(modes.data().data());
+  }
+  thread_pool::set_number_of_threads(1);
+}
+BENCHMARK(bench_cce_swsh_transform)  // NOLINT
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->UseRealTime();
+}  // namespace
+
+namespace {
+// In this anonymous namespace are microbenchmarks of the finite-difference
+// reconstruction schemes used by the subcell solvers, for the number of
+// variables reconstructed by ValenciaDivClean. The argument is the number of
+// subcell points per dimension.
+constexpr size_t fd_number_of_variables = 10;
+
+struct BenchMonotonisedCentral {
+  static constexpr size_t ghost_points = 2;
+  template <size_t Dim, typename... Args>
+  static void apply(const Args&... args) {
+    fd::reconstruction::monotonised_central<Dim>(args...);
+  }
+};
+
+struct BenchWcns5z {
+  static constexpr size_t ghost_points = 3;
+  template <size_t Dim, typename... Args>
+  static void apply(const Args&... args) {
+    fd::reconstruction::wcns5z<
+        2, fd::reconstruction::detail::MonotonisedCentralReconstructor, Dim>(
+        args..., 2.0e-16, 0);
+  }
+};
+
+struct BenchAoWeno53 {
+  static constexpr size_t ghost_points = 3;
+  template <size_t Dim, typename... Args>
+  static void apply(const Args&... args) {
+    fd::reconstruction::aoweno_53<2, Dim>(args..., 0.85, 0.999, 1.0e-12);
+  }
+};
+
+struct BenchPositivityPreservingAdaptiveOrder {
+  static constexpr size_t ghost_points = 3;
+  template <size_t Dim, typename... Args>
+  static void apply(const Args&... args) {
+    fd::reconstruction::positivity_preserving_adaptive_order<
+        fd::reconstruction::detail::MonotonisedCentralReconstructor, true,
+        false, false, Dim>(args..., 4.0, 6.0, 8.0);
+  }
+};
+
+// clang-tidy: don't pass be non-const reference
+template <typename Scheme, size_t Dim>
+void bench_fd_reconstruction(benchmark::State& state) {  // NOLINT
+  const Index<Dim> volume_extents{static_cast<size_t>(state.range(0))};
+  const size_t number_of_faces_per_dimension =
+      (volume_extents[0] + 1) * volume_extents.slice_away(0).product();
+  std::mt19937 gen(1);
+  // Positive values so the positivity-preserving schemes don't fall back
+  std::uniform_real_distribution<> dist(1.0, 2.0);
+  const auto random_vector = [&gen, &dist](const size_t size) {
+    std::vector<double> result(size);
+    for (auto& value : result) {
+      value = dist(gen);
+    }
+    return result;
+  };
+
+  const auto volume_vars =
+      random_vector(volume_extents.product() * fd_number_of_variables);
+  DirectionMap<Dim, std::vector<double>> ghost_data{};
+  DirectionMap<Dim, gsl::span<const double>> ghost_cell_vars{};
+  for (const auto& direction : Direction<Dim>::all_directions()) {
+    ghost_data[direction] = random_vector(
+        Scheme::ghost_points *
+        volume_extents.slice_away(direction.dimension()).product() *
+        fd_number_of_variables);
+    ghost_cell_vars[direction] = gsl::make_span(
+        ghost_data.at(direction).data(), ghost_data.at(direction).size());
+  }
+  std::array<std::vector<double>, Dim> upper_data{};
+  std::array<std::vector<double>, Dim> lower_data{};
+  std::array<gsl::span<double>, Dim> reconstructed_upper_side_of_face_vars{};
+  std::array<gsl::span<double>, Dim> reconstructed_lower_side_of_face_vars{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(upper_data, d).resize(number_of_faces_per_dimension *
+                                  fd_number_of_variables);
+    gsl::at(lower_data, d).resize(number_of_faces_per_dimension *
+                                  fd_number_of_variables);
+    gsl::at(reconstructed_upper_side_of_face_vars, d) = gsl::make_span(
+        gsl::at(upper_data, d).data(), gsl::at(upper_data, d).size());
+    gsl::at(reconstructed_lower_side_of_face_vars, d) = gsl::make_span(
+        gsl::at(lower_data, d).data(), gsl::at(lower_data, d).size());
+  }
+
+  while (state.KeepRunning()) {
+    Scheme::template apply<Dim>(
+        make_not_null(&reconstructed_upper_side_of_face_vars),
+        make_not_null(&reconstructed_lower_side_of_face_vars),
+        gsl::make_span(volume_vars.data(), volume_vars.size()),
+        ghost_cell_vars, volume_extents, fd_number_of_variables);
+    benchmark::DoNotOptimize(upper_data[0].data());
+    benchmark::DoNotOptimize(lower_data[0].data());
+  }
+}
+// NOLINTNEXTLINE
+#define BENCH_FD_RECONSTRUCTION(SCHEME)                            \
+  BENCHMARK_TEMPLATE(bench_fd_reconstruction, SCHEME, 1)->Arg(11); \
+  BENCHMARK_TEMPLATE(bench_fd_reconstruction, SCHEME, 2)           \
+      ->Arg(6)                                                     \
+      ->Arg(11);                                                   \
+  BENCHMARK_TEMPLATE(bench_fd_reconstruction, SCHEME, 3)           \
+      ->Arg(6)                                                     \
+      ->Arg(11)
+BENCH_FD_RECONSTRUCTION(BenchMonotonisedCentral);                 // NOLINT
+BENCH_FD_RECONSTRUCTION(BenchWcns5z);                             // NOLINT
+BENCH_FD_RECONSTRUCTION(BenchAoWeno53);                           // NOLINT
+BENCH_FD_RECONSTRUCTION(BenchPositivityPreservingAdaptiveOrder);  // NOLINT
+#undef BENCH_FD_RECONSTRUCTION
+}  // namespace
+
+namespace {
+// In this anonymous namespace are microbenchmarks of the volume time
+// derivatives of the GH, CCZ4 and ValenciaDivClean systems, and of the Rusanov
+// boundary correction of ValenciaDivClean. The data is a small random
+// perturbation of flat space: scalars and the diagonals of square rank-2
+// tensors are close to one and all other components are close to zero. The
+// argument is the number of grid points per dimension of an element, or of a
+// face for the boundary correction.
+
+// How to store an argument of a kernel and pass it to the kernel
+template <typename T>
+struct KernelArgument {
+  using type = std::decay_t<T>;
+  static const type& pass(const type& argument) { return argument; }
+};
+
+template <typename T>
+struct KernelArgument<gsl::not_null<T*>> {
+  using type = T;
+  static gsl::not_null<T*> pass(T& argument) {
+    return make_not_null(&argument);
+  }
+};
+
+template <typename T>
+void initialize_kernel_argument(const gsl::not_null<T*> argument,
+                                const size_t number_of_points,
+                                const gsl::not_null<std::mt19937*> generator) {
+  if constexpr (tt::is_a_v<Tensor, T>) {
+    std::uniform_real_distribution<> distribution(-0.01, 0.01);
+    for (auto& component : *argument) {
+      component = DataVector(number_of_points);
+      for (auto& value : component) {
+        value = distribution(*generator);
+      }
+    }
+    if constexpr (T::rank() == 0) {
+      get(*argument) += 1.0;
+    } else if constexpr (T::rank() == 2) {
+      if constexpr (T::index_dim(0) == T::index_dim(1)) {
+        for (size_t i = 0; i < T::index_dim(0); ++i) {
+          argument->get(i, i) += 1.0;
+        }
+      }
+    }
+  } else if constexpr (std::is_same_v<T, double>) {
+    *argument = 0.1;
+  }
+  // Enums and `std::optional`s keep their default values
+}
+
+template <typename Result, typename... Args, size_t... Is>
+void call_kernel(
+    Result (*kernel)(Args...),
+    const gsl::not_null<std::tuple<typename KernelArgument<Args>::type...>*>
+        arguments,
+    std::index_sequence<Is...> /*meta*/) {
+  kernel(KernelArgument<Args>::pass(std::get<Is>(*arguments))...);
+}
+
+// Benchmark a kernel whose arguments are tensors, doubles, enums or
+// `std::optional`s, and whose first argument is an output
+template <typename Result, typename... Args>
+void bench_kernel(benchmark::State& state,  // NOLINT
+                  Result (*kernel)(Args...), const size_t number_of_points) {
+  std::tuple<typename KernelArgument<Args>::type...> arguments{};
+  std::mt19937 generator(1);
+  std::apply(
+      [&number_of_points, &generator](auto&... args) {
+        (initialize_kernel_argument(make_not_null(&args), number_of_points,
+                                    make_not_null(&generator)),
+         ...);
+      },
+      arguments);
+
+  while (state.KeepRunning()) {
+    call_kernel(kernel, make_not_null(&arguments),
+                std::make_index_sequence<sizeof...(Args)>{});
+    benchmark::DoNotOptimize(std::get<0>(arguments));
+  }
+}
+
+template <typename... OutputTags, typename... InputTags, typename... Args>
+void gh_time_derivative(
+    const gsl::not_null<Variables<tmpl::list<OutputTags...>>*> outputs,
+    const Variables<tmpl::list<InputTags...>>& inputs, const Args&... args) {
+  GeneralizedHarmonic::TimeDerivative<3>::apply(
+      make_not_null(&get<OutputTags>(*outputs))..., get<InputTags>(inputs)...,
+      args...);
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_gh_time_derivative(benchmark::State& state) {  // NOLINT
+  const Mesh<3> mesh = benchmark_mesh(static_cast<size_t>(state.range(0)));
+  const size_t number_of_points = mesh.number_of_grid_points();
+  Variables<tmpl::append<
+      tmpl::list<::Tags::dt<gr::Tags::SpacetimeMetric<3>>,
+                 ::Tags::dt<GeneralizedHarmonic::Tags::Pi<3>>,
+                 ::Tags::dt<GeneralizedHarmonic::Tags::Phi<3>>>,
+      typename GeneralizedHarmonic::TimeDerivative<3>::temporary_tags>>
+      outputs(number_of_points);
+  Variables<tmpl::list<
+      ::Tags::deriv<gr::Tags::SpacetimeMetric<3>, tmpl::size_t<3>,
+                    Frame::Inertial>,
+      ::Tags::deriv<GeneralizedHarmonic::Tags::Pi<3>, tmpl::size_t<3>,
+                    Frame::Inertial>,
+      ::Tags::deriv<GeneralizedHarmonic::Tags::Phi<3>, tmpl::size_t<3>,
+                    Frame::Inertial>,
+      gr::Tags::SpacetimeMetric<3>, GeneralizedHarmonic::Tags::Pi<3>,
+      GeneralizedHarmonic::Tags::Phi<3>,
+      GeneralizedHarmonic::ConstraintDamping::Tags::ConstraintGamma0,
+      GeneralizedHarmonic::ConstraintDamping::Tags::ConstraintGamma1,
+      GeneralizedHarmonic::ConstraintDamping::Tags::ConstraintGamma2>>
+      inputs(number_of_points);
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<> distribution(-0.01, 0.01);
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    inputs.data()[i] = distribution(generator);
+  }
+  auto& spacetime_metric = get<gr::Tags::SpacetimeMetric<3>>(inputs);
+  get<0, 0>(spacetime_metric) -= 1.0;
+  for (size_t i = 1; i < 4; ++i) {
+    spacetime_metric.get(i, i) += 1.0;
+  }
+  get(get<GeneralizedHarmonic::ConstraintDamping::Tags::ConstraintGamma0>(
+      inputs)) = 1.0;
+  get(get<GeneralizedHarmonic::ConstraintDamping::Tags::ConstraintGamma1>(
+      inputs)) = -1.0;
+  get(get<GeneralizedHarmonic::ConstraintDamping::Tags::ConstraintGamma2>(
+      inputs)) = 1.0;
+  const auto logical_coords = logical_coordinates(mesh);
+  tnsr::I<DataVector, 3, Frame::Inertial> inertial_coords{};
+  InverseJacobian<DataVector, 3, Frame::ElementLogical, Frame::Inertial>
+      inverse_jacobian(number_of_points, 0.0);
+  for (size_t d = 0; d < 3; ++d) {
+    inertial_coords.get(d) = logical_coords.get(d);
+    inverse_jacobian.get(d, d) = 1.0;
+  }
+  const GeneralizedHarmonic::gauges::Harmonic gauge_condition{};
+  const std::optional<tnsr::I<DataVector, 3, Frame::Inertial>> mesh_velocity{};
+
+  while (state.KeepRunning()) {
+    gh_time_derivative(make_not_null(&outputs), inputs, gauge_condition, mesh,
+                       0.0, inertial_coords, inverse_jacobian, mesh_velocity);
+    benchmark::DoNotOptimize(outputs.data());
+  }
+}
+BENCHMARK(bench_gh_time_derivative)->Arg(4)->Arg(6)->Arg(8)->Arg(10);  // NOLINT
+
+// clang-tidy: don't pass be non-const reference
+void bench_ccz4_time_derivative(benchmark::State& state) {  // NOLINT
+  bench_kernel(state, &Ccz4::TimeDerivative<3>::apply,
+               cube(static_cast<size_t>(state.range(0))));
+}
+BENCHMARK(bench_ccz4_time_derivative)  // NOLINT
+    ->Arg(4)
+    ->Arg(6)
+    ->Arg(8)
+    ->Arg(10);
+
+// clang-tidy: don't pass be non-const reference
+void bench_valencia_time_derivative(benchmark::State& state) {  // NOLINT
+  bench_kernel(state, &grmhd::ValenciaDivClean::TimeDerivativeTerms::apply,
+               cube(static_cast<size_t>(state.range(0))));
+}
+BENCHMARK(bench_valencia_time_derivative)  // NOLINT
+    ->Arg(4)
+    ->Arg(6)
+    ->Arg(8)
+    ->Arg(10);
+
+// clang-tidy: don't pass be non-const reference
+void bench_valencia_rusanov_package_data(benchmark::State& state) {  // NOLINT
+  bench_kernel(
+      state,
+      &grmhd::ValenciaDivClean::BoundaryCorrections::Rusanov::dg_package_data,
+      square(static_cast<size_t>(state.range(0))));
+}
+BENCHMARK(bench_valencia_rusanov_package_data)  // NOLINT
+    ->Arg(4)
+    ->Arg(6)
+    ->Arg(8)
+    ->Arg(10);
+
+// clang-tidy: don't pass be non-const reference
+void bench_valencia_rusanov_boundary_terms(benchmark::State& state) {  // NOLINT
+  bench_kernel(
+      state,
+      &grmhd::ValenciaDivClean::BoundaryCorrections::Rusanov::dg_boundary_terms,
+      square(static_cast<size_t>(state.range(0))));
+}
+BENCHMARK(bench_valencia_rusanov_boundary_terms)  // NOLINT
+    ->Arg(4)
+    ->Arg(6)
+    ->Arg(8)
+    ->Arg(10);
 }  // namespace
 
 // Ignore the warning about an extra ';' because some versions of benchmark
@@ -0,0 +1,220 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <boost/program_options.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+
+#include "Domain/Creators/DomainCreator.hpp"
+#include "Domain/Creators/Factory1D.hpp"
+#include "Domain/Creators/Factory2D.hpp"
+#include "Domain/Creators/Factory3D.hpp"
+#include "Domain/Creators/OptionTags.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/ElementDistribution.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Options/ParseOptions.hpp"
+#include "Options/Protocols/FactoryCreation.hpp"
+#include "Parallel/Printf.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+
+// Charm looks for this function but since we build without a main function or
+// main module we just have it be empty
+extern "C" void CkRegisterMainModule(void) {}
+
+namespace {
+template <size_t Dim>
+struct Metavariables {
+  struct factory_creation
+      : tt::ConformsTo<Options::protocols::FactoryCreation> {
+    using factory_classes =
+        tmpl::map<tmpl::pair<DomainCreator<Dim>, domain_creators<Dim>>>;
+  };
+};
+
+// Extracts the `DomainCreator` option from an input file, so the tool can be
+// run on the input file of any executable
+std::string domain_creator_options(const std::string& input_file) {
+  const YAML::Node input = YAML::LoadFile(input_file);
+  if (not input["DomainCreator"]) {
+    ERROR_NO_TRACE("The input file " << input_file
+                                     << " has no 'DomainCreator' option.");
+  }
+  YAML::Node options{};
+  options["DomainCreator"] = input["DomainCreator"];
+  return YAML::Dump(options);
+}
+
+domain::ElementWeight parse_element_weight(const std::string& element_weight) {
+  if (element_weight == "Uniform") {
+    return domain::ElementWeight::Uniform;
+  } else if (element_weight == "NumGridPoints") {
+    return domain::ElementWeight::NumGridPoints;
+  } else if (element_weight == "NumGridPointsAndGridSpacing") {
+    return domain::ElementWeight::NumGridPointsAndGridSpacing;
+  }
+  ERROR_NO_TRACE("Unknown element weight '"
+                 << element_weight
+                 << "'. Must be one of Uniform, NumGridPoints, or "
+                    "NumGridPointsAndGridSpacing.");
+}
+
+void print_statistics(
+    const domain::ElementDistributionStrategy strategy,
+    const domain::ElementDistributionStatistics& statistics) {
+  Parallel::printf("%-14s%10zu%10zu%12zu%12zu%12zu%12.3f%12.3f%12.3f\n",
+                   get_output(strategy), statistics.number_of_elements,
+                   statistics.number_of_procs_with_elements,
+                   statistics.number_of_internal_faces,
+                   statistics.number_of_cross_proc_faces,
+                   statistics.number_of_cross_node_faces,
+                   statistics.max_surface_to_volume,
+                   statistics.average_surface_to_volume,
+                   statistics.load_imbalance);
+}
+
+template <size_t Dim>
+void compare_distributions(const std::string& input_file,
+                           const size_t number_of_nodes,
+                           const size_t procs_per_node,
+                           const domain::ElementWeight element_weight) {
+  using domain_creator_tag = domain::OptionTags::DomainCreator<Dim>;
+  Options::Parser<tmpl::list<domain_creator_tag>> option_parser(
+      "The domain for which to compare element distributions");
+  option_parser.parse(domain_creator_options(input_file));
+  const std::unique_ptr<DomainCreator<Dim>> domain_creator =
+      option_parser.template get<domain_creator_tag, Metavariables<Dim>>();
+
+  const auto domain = domain_creator->create_domain();
+  const auto& blocks = domain.blocks();
+  const auto initial_refinement_levels =
+      domain_creator->initial_refinement_levels();
+  const auto initial_extents = domain_creator->initial_extents();
+  const std::unordered_map<ElementId<Dim>, double> element_costs =
+      domain::get_element_costs(blocks, initial_refinement_levels,
+                                initial_extents, element_weight,
+                                Spectral::Quadrature::GaussLobatto);
+  const std::vector<size_t> procs_per_node_list(number_of_nodes,
+                                                procs_per_node);
+
+  Parallel::printf(
+      "Distributing %zu blocks on %zu nodes with %zu procs each.\n"
+      "Faces are pairs of neighboring elements. The surface-to-volume ratio "
+      "of a proc is its number of faces to other procs per element.\n\n",
+      blocks.size(), number_of_nodes, procs_per_node);
+  Parallel::printf("%-14s%10s%10s%12s%12s%12s%12s%12s%12s\n", "Strategy",
+                   "Elements", "Procs", "Faces", "ProcFaces", "NodeFaces",
+                   "MaxS/V", "AvgS/V", "Imbalance");
+
+  const domain::BlockZCurveProcDistribution<Dim> z_curve_distribution(
+      element_costs, number_of_nodes * procs_per_node, blocks,
+      initial_refinement_levels, initial_extents);
+  print_statistics(
+      domain::ElementDistributionStrategy::ZCurve,
+      domain::element_distribution_statistics<Dim>(
+          blocks, initial_refinement_levels, element_costs,
+          procs_per_node_list, [&z_curve_distribution](const auto& id) {
+            return z_curve_distribution.get_proc_for_element(id);
+          }));
+
+  const domain::HilbertCurveNodeProcDistribution<Dim>
+      hilbert_curve_distribution(element_costs, procs_per_node_list, blocks,
+                                 initial_refinement_levels);
+  print_statistics(
+      domain::ElementDistributionStrategy::HilbertCurve,
+      domain::element_distribution_statistics<Dim>(
+          blocks, initial_refinement_levels, element_costs,
+          procs_per_node_list, [&hilbert_curve_distribution](const auto& id) {
+            return hilbert_curve_distribution.get_proc_for_element(id);
+          }));
+}
+}  // namespace
+
+/*
+ * This executable reports the communication cost of the element distribution
+ * strategies for the domain of an input file, so they can be compared before
+ * submitting a job.
+ */
+int main(int argc, char** argv) {
+  namespace bpo = boost::program_options;
+  try {
+    bpo::options_description command_line_options;
+
+    // clang-format off
+    command_line_options.add_options()
+        ("help,h", "Describe program options.\nThis executable reports the "
+         "number of faces between elements on different procs and nodes, the "
+         "surface-to-volume ratio of the procs, and the load imbalance for "
+         "each element distribution strategy. The domain is read from the "
+         "'DomainCreator' option of the input file, which can be the input "
+         "file of any executable. Domain creators with boundary conditions "
+         "are not supported, so use a version of the domain without boundary "
+         "conditions.")
+        ("input-file", bpo::value<std::string>(),
+         "The input file containing the 'DomainCreator' option.")
+        ("dim", bpo::value<size_t>()->default_value(3),
+         "The dimension of the domain.")
+        ("nodes", bpo::value<size_t>(), "The number of nodes.")
+        ("procs-per-node", bpo::value<size_t>(),
+         "The number of procs on each node that have elements.")
+        ("element-weight",
+         bpo::value<std::string>()->default_value("NumGridPoints"),
+         "The cost of each element. One of Uniform, NumGridPoints, or "
+         "NumGridPointsAndGridSpacing (with GaussLobatto quadrature).")
+        ;
+    // clang-format on
+
+    bpo::command_line_parser command_line_parser(argc, argv);
+    command_line_parser.options(command_line_options);
+
+    bpo::variables_map parsed_command_line_options;
+    bpo::store(command_line_parser.run(), parsed_command_line_options);
+    bpo::notify(parsed_command_line_options);
+
+    if (parsed_command_line_options.count("help") != 0 or
+        parsed_command_line_options.count("input-file") == 0 or
+        parsed_command_line_options.count("nodes") == 0 or
+        parsed_command_line_options.count("procs-per-node") == 0) {
+      Parallel::printf("%s\n", command_line_options);
+      return 1;
+    }
+    const auto input_file =
+        parsed_command_line_options.at("input-file").as<std::string>();
+    const auto number_of_nodes =
+        parsed_command_line_options.at("nodes").as<size_t>();
+    const auto procs_per_node =
+        parsed_command_line_options.at("procs-per-node").as<size_t>();
+    const auto element_weight = parse_element_weight(
+        parsed_command_line_options.at("element-weight").as<std::string>());
+    if (number_of_nodes == 0 or procs_per_node == 0) {
+      ERROR_NO_TRACE("Need at least one node and one proc per node.");
+    }
+    switch (parsed_command_line_options.at("dim").as<size_t>()) {
+      case 1:
+        compare_distributions<1>(input_file, number_of_nodes, procs_per_node,
+                                 element_weight);
+        break;
+      case 2:
+        compare_distributions<2>(input_file, number_of_nodes, procs_per_node,
+                                 element_weight);
+        break;
+      case 3:
+        compare_distributions<3>(input_file, number_of_nodes, procs_per_node,
+                                 element_weight);
+        break;
+      default:
+        ERROR_NO_TRACE("The dimension must be 1, 2, or 3.");
+    }
+  } catch (const bpo::error& e) {
+    ERROR(e.what());
+  }
+  return 0;
+}
@@ -0,0 +1,152 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/H5/CombineH5.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/CheckH5PropertiesMatch.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/TensorData.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/StdHelpers.hpp"
+
+namespace h5 {
+void combine_h5_vol(
+    const std::vector<std::string>& file_names,
+    const std::string& subfile_name, const std::string& output,
+    const std::optional<double> start_value,
+    const std::optional<double> stop_value,
+    const std::optional<std::vector<std::string>>& components) {
+  if (file_names.empty()) {
+    ERROR_NO_TRACE("No files to combine.");
+  }
+  // Checks that volume data was generated with identical versions of SpECTRE
+  if (not h5::check_src_files_match(file_names)) {
+    ERROR_NO_TRACE(
+        "One or more of your files were found to have differing src.tar.gz "
+        "files, meaning that they may be from differing versions of SpECTRE.");
+  }
+  // Checks that volume data files contain the same observation ids
+  if (not h5::check_observation_ids_match(file_names, subfile_name)) {
+    ERROR_NO_TRACE(
+        "One or more of your files were found to have differing observation "
+        "ids, meaning they may be from different runs of your SpECTRE "
+        "executable or were corrupted.");
+  }
+
+  // The input files are kept open so their metadata is only read once
+  std::vector<std::unique_ptr<h5::H5File<h5::AccessType::ReadOnly>>>
+      input_files{};
+  std::vector<const h5::VolumeData*> input_volume_files{};
+  input_files.reserve(file_names.size());
+  input_volume_files.reserve(file_names.size());
+  for (const std::string& file_name : file_names) {
+    input_files.push_back(
+        std::make_unique<h5::H5File<h5::AccessType::ReadOnly>>(file_name,
+                                                               false));
+    input_volume_files.push_back(
+        &input_files.back()->get<h5::VolumeData>("/" + subfile_name));
+  }
+  const h5::VolumeData& first_volume_file = *input_volume_files.front();
+
+  h5::H5File<h5::AccessType::ReadWrite> output_file(output, true);
+  auto& output_volume_file = output_file.insert<h5::VolumeData>(
+      "/" + subfile_name, first_volume_file.get_version());
+
+  for (const size_t observation_id :
+       first_volume_file.list_observation_ids()) {
+    const double observation_value =
+        first_volume_file.get_observation_value(observation_id);
+    if (observation_value <
+            start_value.value_or(std::numeric_limits<double>::lowest()) or
+        observation_value >
+            stop_value.value_or(std::numeric_limits<double>::max())) {
+      continue;
+    }
+
+    // Write the grids of all files first, then fill in the tensor components
+    // one by one
+    std::vector<ElementVolumeData> grids{};
+    size_t number_of_points = 0;
+    for (const h5::VolumeData* volume_file : input_volume_files) {
+      const std::vector<std::string> grid_names =
+          volume_file->get_grid_names(observation_id);
+      const std::vector<std::vector<size_t>> extents =
+          volume_file->get_extents(observation_id);
+      const auto bases = volume_file->get_bases(observation_id);
+      const auto quadratures = volume_file->get_quadratures(observation_id);
+      for (size_t i = 0; i < grid_names.size(); ++i) {
+        grids.emplace_back(grid_names[i], std::vector<TensorComponent>{},
+                           extents[i], bases[i], quadratures[i]);
+        number_of_points += std::accumulate(extents[i].begin(),
+                                            extents[i].end(), 1_st,
+                                            std::multiplies<>{});
+      }
+    }
+    output_volume_file.write_volume_data(
+        observation_id, observation_value, grids,
+        first_volume_file.get_domain(observation_id),
+        first_volume_file.get_functions_of_time(observation_id));
+    grids.clear();
+
+    const std::vector<std::string> available_components =
+        first_volume_file.list_tensor_components(observation_id);
+    for (const std::string& component_name :
+         components.value_or(available_components)) {
+      if (not alg::found(available_components, component_name)) {
+        ERROR_NO_TRACE("The tensor component '"
+                       << component_name << "' is not in the subfile '"
+                       << subfile_name << "' at observation id "
+                       << observation_id << ". Available components are: "
+                       << available_components);
+      }
+      std::visit(
+          [&component_name, &file_names, &input_volume_files,
+           number_of_points, observation_id,
+           &output_volume_file](const auto& first_data) {
+            using data_type = std::decay_t<decltype(first_data)>;
+            std::vector<typename data_type::value_type> combined_data{};
+            combined_data.reserve(number_of_points);
+            combined_data.insert(combined_data.end(), first_data.begin(),
+                                 first_data.end());
+            for (size_t i = 1; i < input_volume_files.size(); ++i) {
+              const TensorComponent tensor_component =
+                  input_volume_files[i]->get_tensor_component(observation_id,
+                                                              component_name);
+              if (not std::holds_alternative<data_type>(
+                      tensor_component.data)) {
+                ERROR_NO_TRACE("The tensor component '"
+                               << component_name << "' in file "
+                               << file_names[i]
+                               << " is stored with a different precision "
+                                  "than in file "
+                               << file_names[0] << ".");
+              }
+              const auto& data = std::get<data_type>(tensor_component.data);
+              combined_data.insert(combined_data.end(), data.begin(),
+                                   data.end());
+            }
+            output_volume_file.write_tensor_component(
+                observation_id, component_name, combined_data);
+          },
+          first_volume_file.get_tensor_component(observation_id, component_name)
+              .data);
+    }
+  }
+}
+}  // namespace h5
@@ -0,0 +1,34 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace h5 {
+/*!
+ * \ingroup HDF5Group
+ * \brief Combine the volume subfile `subfile_name` of all `file_names` into a
+ * single volume subfile in the file `output`.
+ *
+ * \details The data is combined one observation at a time, and within an
+ * observation one tensor component at a time, so at most a single tensor
+ * component of a single observation is held in memory. The input files are
+ * opened once and kept open while combining. Only observations with a value
+ * in the closed interval [`start_value`, `stop_value`] are combined, and
+ * only the `components` if specified (all tensor components otherwise). The
+ * combined tensor components are written compressed, and retain the precision
+ * of the input data.
+ *
+ * All input files must have been written by the same version of SpECTRE and
+ * must contain the same observations.
+ */
+void combine_h5_vol(
+    const std::vector<std::string>& file_names,
+    const std::string& subfile_name, const std::string& output,
+    std::optional<double> start_value = std::nullopt,
+    std::optional<double> stop_value = std::nullopt,
+    const std::optional<std::vector<std::string>>& components = std::nullopt);
+}  // namespace h5
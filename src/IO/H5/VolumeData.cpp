@@ -9,15 +9,19 @@
 #include <boost/iterator/transform_iterator.hpp>
 #include <cstddef>
 #include <hdf5.h>
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <ostream>
 #include <string>
+#include <utility>
+#include <variant>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "IO/Connectivity.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/CheckH5.hpp"
 #include "IO/H5/Header.hpp"
 #include "IO/H5/Helpers.hpp"
 #include "IO/H5/SpectralIo.hpp"
@@ -159,6 +163,48 @@ void append_element_extents_and_connectivity(
     }
   }
 }
+
+// Compute the bounding box of the grid points of every element from the
+// inertial coordinates, if they are among the tensor components. The bounding
+// boxes are stored contiguously as (lower_x, upper_x, lower_y, upper_y, ...)
+// for every element.
+std::vector<double> bounding_boxes(
+    const std::vector<ElementVolumeData>& elements,
+    const std::vector<std::string>& component_names,
+    const gsl::not_null<size_t*> coordinate_dim) {
+  std::vector<size_t> coordinate_indices{};
+  for (const std::string& suffix : {"_x", "_y", "_z"}) {
+    const auto found_component =
+        alg::find(component_names, "InertialCoordinates" + suffix);
+    if (found_component == component_names.end()) {
+      break;
+    }
+    coordinate_indices.push_back(static_cast<size_t>(
+        std::distance(component_names.begin(), found_component)));
+  }
+  *coordinate_dim = coordinate_indices.size();
+  std::vector<double> result{};
+  if (coordinate_indices.empty()) {
+    return result;
+  }
+  result.reserve(2 * coordinate_indices.size() * elements.size());
+  for (const auto& element : elements) {
+    for (const size_t component_index : coordinate_indices) {
+      std::visit(
+          [&result](const auto& data) {
+            if (data.size() == 0) {
+              ERROR("Can't compute the bounding box of an empty grid.");
+            }
+            const auto [min, max] =
+                std::minmax_element(data.begin(), data.end());
+            result.push_back(static_cast<double>(*min));
+            result.push_back(static_cast<double>(*max));
+          },
+          element.tensor_components[component_index].data);
+    }
+  }
+  return result;
+}
 }  // namespace
 
 VolumeData::VolumeData(const bool subfile_exists, detail::OpenGroup&& group,
@@ -239,7 +285,10 @@ void VolumeData::write_volume_data(
   }
   const auto dim =
       h5::read_value_attribute<size_t>(volume_data_group_.id(), "dimension");
-  // Extract Tensor Data one component at a time
+  // Collect the grid names, bases, quadratures, extents, and connectivity of
+  // all elements. These don't depend on the tensor components, so elements
+  // without tensor components can be written to add the grids before the
+  // components are written one at a time with `write_tensor_component`.
   std::vector<size_t> total_extents;
   std::string grid_names;
   std::vector<int> total_connectivity;
@@ -249,7 +298,23 @@ void VolumeData::write_volume_data(
   // Keep a running count of the number of points so far to use as a global
   // index for the connectivity
   int total_points_so_far = 0;
-  // Loop over tensor components
+  for (const auto& element : elements) {
+    grid_names += element.element_name + h5::VolumeData::separator();
+    // append element basis
+    alg::transform(element.basis, std::back_inserter(bases),
+                   [](const Spectral::Basis t) { return static_cast<int>(t); });
+    // append element quadraature
+    alg::transform(
+        element.quadrature, std::back_inserter(quadratures),
+        [](const Spectral::Quadrature t) { return static_cast<int>(t); });
+
+    append_element_extents_and_connectivity(
+        &total_extents, &total_connectivity, &pole_connectivity,
+        &total_points_so_far, dim, element);
+  }
+  grid_names.pop_back();
+
+  // Extract Tensor Data one component at a time
   for (size_t i = 0; i < component_names.size(); i++) {
     std::string component_name = component_names[i];
     // Write the data for the tensor component
@@ -262,29 +327,9 @@ void VolumeData::write_volume_data(
     }
 
     const auto fill_and_write_contiguous_tensor_data =
-        [&bases, &component_name, &dim, &elements, &grid_names, i,
-         &observation_group, &quadratures, &total_connectivity,
-         &pole_connectivity, &total_extents,
-         &total_points_so_far](const auto contiguous_tensor_data_ptr) {
+        [&component_name, &elements, i,
+         &observation_group](const auto contiguous_tensor_data_ptr) {
           for (const auto& element : elements) {
-            if (UNLIKELY(i == 0)) {
-              // True if first tensor component being accessed
-              grid_names += element.element_name + h5::VolumeData::separator();
-              // append element basis
-              alg::transform(
-                  element.basis, std::back_inserter(bases),
-                  [](const Spectral::Basis t) { return static_cast<int>(t); });
-              // append element quadraature
-              alg::transform(element.quadrature,
-                             std::back_inserter(quadratures),
-                             [](const Spectral::Quadrature t) {
-                               return static_cast<int>(t);
-                             });
-
-              append_element_extents_and_connectivity(
-                  &total_extents, &total_connectivity, &pole_connectivity,
-                  &total_points_so_far, dim, element);
-            }
             using type_from_variant = tmpl::conditional_t<
                 std::is_same_v<
                     std::decay_t<decltype(*contiguous_tensor_data_ptr)>,
@@ -315,7 +360,6 @@ void VolumeData::write_volume_data(
             << ") in std::variant of tensor component.");
     }
   }  // for each component
-  grid_names.pop_back();
 
   // Write the grid extents contiguously, the first `dim` belong to the
   // First grid, the second `dim` belong to the second grid, and so on,
@@ -355,6 +399,17 @@ void VolumeData::write_volume_data(
     h5::write_data(observation_group.id(), pole_connectivity,
                    {pole_connectivity.size()}, "pole_connectivity");
   }
+  // Write the bounding boxes of the grids so readers can find the grids that
+  // overlap with a region without reading the tensor data
+  size_t coordinate_dim = 0;
+  const std::vector<double> grid_bounding_boxes =
+      bounding_boxes(elements, component_names, make_not_null(&coordinate_dim));
+  if (not grid_bounding_boxes.empty()) {
+    h5::write_data(observation_group.id(), grid_bounding_boxes,
+                   {grid_bounding_boxes.size()}, "bounding_boxes");
+    h5::write_to_attribute(observation_group.id(), "bounding_box_dimension",
+                           coordinate_dim);
+  }
   // Write the serialized domain
   if (serialized_domain.has_value()) {
     h5::write_data(observation_group.id(), *serialized_domain,
@@ -377,6 +432,16 @@ void VolumeData::write_tensor_component(
                  component_name);
 }
 
+void VolumeData::write_tensor_component(
+    const size_t observation_id, const std::string& component_name,
+    const std::vector<double>& contiguous_tensor_data) {
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+                                      AccessType::ReadWrite);
+  h5::write_data(observation_group.id(), contiguous_tensor_data,
+                 {contiguous_tensor_data.size()}, component_name);
+}
+
 void VolumeData::write_tensor_component(
     const size_t observation_id, const std::string& component_name,
     const std::vector<float>& contiguous_tensor_data) {
@@ -418,7 +483,7 @@ std::vector<std::string> VolumeData::list_tensor_components(
   const std::unordered_set<std::string> non_tensor_components{
       "connectivity", "pole_connectivity", "total_extents",
       "grid_names",   "quadratures",       "bases",
-      "domain",       "functions_of_time"};
+      "domain",       "functions_of_time", "bounding_boxes"};
   tensor_components.erase(
       alg::remove_if(tensor_components,
                      [&non_tensor_components](const std::string& name) {
@@ -484,6 +549,79 @@ TensorComponent VolumeData::get_tensor_component(
   }
 }
 
+TensorComponent VolumeData::get_tensor_component(
+    const size_t observation_id, const std::string& tensor_component,
+    const std::vector<std::pair<size_t, size_t>>& offsets_and_lengths) const {
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+                                      AccessType::ReadOnly);
+
+  const hid_t dataset_id =
+      h5::open_dataset(observation_group.id(), tensor_component);
+  const hid_t dataspace_id = h5::open_dataspace(dataset_id);
+  if (H5Sget_simple_extent_ndims(dataspace_id) != 1) {
+    ERROR("Can only read parts of rank 1 tensor components, but '"
+          << tensor_component << "' has rank "
+          << H5Sget_simple_extent_ndims(dataspace_id) << ".");
+  }
+  // Select the intervals in the file. HDF5 reads the selection in the order of
+  // the file, so the intervals must be sorted.
+  CHECK_H5(H5Sselect_none(dataspace_id),
+           "Failed to select none of the dataspace");
+  size_t total_length = 0;
+  for (size_t i = 0; i < offsets_and_lengths.size(); ++i) {
+    const auto& [offset, length] = offsets_and_lengths[i];
+    ASSERT(i == 0 or offsets_and_lengths[i - 1].first +
+                             offsets_and_lengths[i - 1].second <=
+                         offset,
+           "The intervals must be sorted by their offset and must not overlap, "
+           "but interval "
+               << i << " starts at " << offset << " and interval " << i - 1
+               << " ends at "
+               << offsets_and_lengths[i - 1].first +
+                      offsets_and_lengths[i - 1].second);
+    if (length == 0) {
+      continue;
+    }
+    const std::array<hsize_t, 1> start{{offset}};
+    const std::array<hsize_t, 1> stride{{1}};
+    const std::array<hsize_t, 1> count{{1}};
+    const std::array<hsize_t, 1> block{{length}};
+    CHECK_H5(H5Sselect_hyperslab(dataspace_id, H5S_SELECT_OR, start.data(),
+                                 stride.data(), count.data(), block.data()),
+             "Failed to select interval starting at " << offset);
+    total_length += length;
+  }
+  const std::array<hsize_t, 1> memspace_size{{total_length}};
+  const hid_t memspace_id =
+      H5Screate_simple(1, memspace_size.data(), memspace_size.data());
+  CHECK_H5(memspace_id, "Failed to create memory space");
+
+  const auto read_selection = [&dataset_id, &dataspace_id, &memspace_id,
+                               &tensor_component](auto data) {
+    using value_type = typename decltype(data)::value_type;
+    if (data.size() > 0) {
+      CHECK_H5(H5Dread(dataset_id, h5::h5_type<value_type>(), memspace_id,
+                       dataspace_id, h5::h5p_default(), data.data()),
+               "Failed to read parts of tensor component '" << tensor_component
+                                                             << "'");
+    }
+    return data;
+  };
+  const bool use_float =
+      h5::types_equal(H5Dget_type(dataset_id), h5::h5_type<float>());
+  TensorComponent result =
+      use_float ? TensorComponent{tensor_component,
+                                  read_selection(
+                                      std::vector<float>(total_length))}
+                : TensorComponent{tensor_component,
+                                  read_selection(DataVector(total_length))};
+  CHECK_H5(H5Sclose(memspace_id), "Failed to close memory space");
+  h5::close_dataspace(dataspace_id);
+  h5::close_dataset(dataset_id);
+  return result;
+}
+
 std::vector<std::vector<size_t>> VolumeData::get_extents(
     const size_t observation_id) const {
   const std::string path = "ObservationId" + std::to_string(observation_id);
@@ -685,6 +823,35 @@ std::vector<std::vector<Spectral::Quadrature>> VolumeData::get_quadratures(
   return element_quadratures;
 }
 
+std::optional<std::vector<std::vector<std::pair<double, double>>>>
+VolumeData::get_bounding_boxes(const size_t observation_id) const {
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+                                      AccessType::ReadOnly);
+  if (not contains_dataset_or_group(observation_group.id(), "",
+                                    "bounding_boxes")) {
+    return std::nullopt;
+  }
+  const auto coordinate_dim = h5::read_value_attribute<size_t>(
+      observation_group.id(), "bounding_box_dimension");
+  const auto flat_bounding_boxes = h5::read_data<1, std::vector<double>>(
+      observation_group.id(), "bounding_boxes");
+  ASSERT(flat_bounding_boxes.size() % (2 * coordinate_dim) == 0,
+         "The bounding boxes hold " << flat_bounding_boxes.size()
+                                    << " values, which isn't a multiple of "
+                                    << 2 * coordinate_dim);
+  std::vector<std::vector<std::pair<double, double>>> result(
+      flat_bounding_boxes.size() / (2 * coordinate_dim),
+      std::vector<std::pair<double, double>>(coordinate_dim));
+  for (size_t i = 0; i < result.size(); ++i) {
+    for (size_t d = 0; d < coordinate_dim; ++d) {
+      result[i][d] = {flat_bounding_boxes[2 * (i * coordinate_dim + d)],
+                      flat_bounding_boxes[2 * (i * coordinate_dim + d) + 1]};
+    }
+  }
+  return result;
+}
+
 std::optional<std::vector<char>> VolumeData::get_domain(
     const size_t observation_id) const {
   const std::string path = "ObservationId" + std::to_string(observation_id);
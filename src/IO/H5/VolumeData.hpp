@@ -11,6 +11,7 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "IO/H5/Object.hpp"
@@ -62,7 +63,16 @@ namespace h5 {
  * `{2, 2, 2}`, it was responsible for contributing the first 2*2*2 = 8 grid
  * points worth of data in each tensor dataset. Use the
  * `h5::offset_and_length_for_grid` function to compute the offset into the
- * contiguous dataset that corresponds to a particular grid.
+ * contiguous dataset that corresponds to a particular grid. To read the data of
+ * only a few grids, pass their offsets and lengths to
+ * `get_tensor_component()`, which reads only those parts of the dataset.
+ *
+ * \par Bounding boxes
+ * If the inertial coordinates (the tensor components `InertialCoordinates_x`,
+ * `InertialCoordinates_y`, ...) are passed to `write_volume_data()`, the
+ * bounding box of the grid points of each grid is written alongside the data.
+ * Readers can use them to find the grids that may overlap with a region
+ * without reading any tensor data (see `get_bounding_boxes()`).
  *
  * \par Domain and FunctionsOfTime
  * A serialized representation of the domain and the functions of time can be
@@ -108,6 +118,11 @@ class VolumeData : public h5::Object {
   /// Insert tensor components at `observation_id` with floating point value
   /// `observation_value`. Optionally write a serialized representation of the
   /// domain and the functions of time into the subfile as well.
+  ///
+  /// The `elements` may hold no tensor components, in which case only the
+  /// grids are written. The tensor components can then be written one at a
+  /// time with `write_tensor_component()`, which avoids holding all of them
+  /// in memory at once.
   void write_volume_data(
       size_t observation_id, double observation_value,
       const std::vector<ElementVolumeData>& elements,
@@ -119,6 +134,10 @@ class VolumeData : public h5::Object {
                               const std::string& component_name,
                               const DataVector& contiguous_tensor_data);
 
+  void write_tensor_component(
+      const size_t observation_id, const std::string& component_name,
+      const std::vector<double>& contiguous_tensor_data);
+
   void write_tensor_component(const size_t observation_id,
                               const std::string& component_name,
                               const std::vector<float>& contiguous_tensor_data);
@@ -155,6 +174,16 @@ class VolumeData : public h5::Object {
   TensorComponent get_tensor_component(
       size_t observation_id, const std::string& tensor_component) const;
 
+  /// Read a tensor component with name `tensor_component` at observation id
+  /// `observation_id` only in the intervals `offsets_and_lengths` of the
+  /// contiguous dataset, e.g. the intervals of a few grids as returned by
+  /// `h5::offset_and_length_for_grid`. The data of the intervals is returned
+  /// contiguously. The intervals must be sorted by their offset and must not
+  /// overlap.
+  TensorComponent get_tensor_component(
+      size_t observation_id, const std::string& tensor_component,
+      const std::vector<std::pair<size_t, size_t>>& offsets_and_lengths) const;
+
   /// Read the extents of all the grids stored in the file at the observation id
   /// `observation_id`
   std::vector<std::vector<size_t>> get_extents(size_t observation_id) const;
@@ -197,6 +226,15 @@ class VolumeData : public h5::Object {
   std::vector<std::vector<Spectral::Quadrature>> get_quadratures(
       size_t observation_id) const;
 
+  /// The bounding boxes of the grid points of all grids at observation id
+  /// `observation_id` in the inertial frame, in the order of
+  /// `get_grid_names()`. For each grid the bounding box holds the lower and
+  /// upper bound in every dimension. Returns `std::nullopt` if no bounding
+  /// boxes were written, i.e., if the inertial coordinates weren't written
+  /// with `write_volume_data()`.
+  std::optional<std::vector<std::vector<std::pair<double, double>>>>
+  get_bounding_boxes(size_t observation_id) const;
+
   /// Get the serialized domain in the subfile at this observation ID, or
   /// `std::nullopt` if no domain was written.
   std::optional<std::vector<char>> get_domain(size_t observation_id) const;
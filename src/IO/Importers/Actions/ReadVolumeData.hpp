@@ -3,10 +3,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <limits>
+#include <map>
 #include <optional>
 #include <string>
 #include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -14,10 +21,13 @@
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/IdPair.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/BlockLogicalCoordinates.hpp"
+#include "Domain/BlockSearchTree.hpp"
 #include "Domain/Domain.hpp"
 #include "Domain/ElementLogicalCoordinates.hpp"
+#include "Domain/Structure/BlockId.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "IO/H5/AccessType.hpp"
 #include "IO/H5/File.hpp"
@@ -32,6 +42,7 @@
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/Serialize.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -76,46 +87,142 @@ struct Selected : db::SimpleTag {
 namespace detail {
 
 // Read the single `tensor_name` from the `volume_file`, taking care of suffixes
-// like "_x" etc for its components.
+// like "_x" etc for its components. Only the intervals `offsets_and_lengths`
+// of the contiguous datasets are read, and they are stored contiguously in the
+// `tensor_data`.
 template <typename TensorType>
-void read_tensor_data(const gsl::not_null<TensorType*> tensor_data,
-                      const std::string& tensor_name,
-                      const h5::VolumeData& volume_file,
-                      const size_t observation_id) {
+void read_tensor_data(
+    const gsl::not_null<TensorType*> tensor_data,
+    const std::string& tensor_name, const h5::VolumeData& volume_file,
+    const size_t observation_id,
+    const std::vector<std::pair<size_t, size_t>>& offsets_and_lengths) {
   for (size_t i = 0; i < tensor_data->size(); ++i) {
     (*tensor_data)[i] = std::get<DataVector>(
         volume_file
             .get_tensor_component(
                 observation_id,
                 tensor_name + tensor_data->component_suffix(
-                                  tensor_data->get_tensor_index(i)))
+                                  tensor_data->get_tensor_index(i)),
+                offsets_and_lengths)
             .data);
   }
 }
 
-// Read the `selected_fields` from the `volume_file`. Reads the data
-// for all elements in the `volume_file` at once. Invoked lazily when data
-// for an element in the volume file is needed.
+// Read the `selected_fields` from the `volume_file`. Reads only the intervals
+// `offsets_and_lengths` of the contiguous datasets, i.e. the data of the grids
+// that are needed on this node, and stores them contiguously.
 template <typename FieldTagsList>
 tuples::tagged_tuple_from_typelist<FieldTagsList> read_tensor_data(
     const h5::VolumeData& volume_file, const size_t observation_id,
     const tuples::tagged_tuple_from_typelist<
-        db::wrap_tags_in<Tags::Selected, FieldTagsList>>& selected_fields) {
+        db::wrap_tags_in<Tags::Selected, FieldTagsList>>& selected_fields,
+    const std::vector<std::pair<size_t, size_t>>& offsets_and_lengths) {
   tuples::tagged_tuple_from_typelist<FieldTagsList> all_tensor_data{};
   tmpl::for_each<FieldTagsList>([&all_tensor_data, &volume_file,
-                                 &observation_id,
-                                 &selected_fields](auto field_tag_v) {
+                                 &observation_id, &selected_fields,
+                                 &offsets_and_lengths](auto field_tag_v) {
     using field_tag = tmpl::type_from<decltype(field_tag_v)>;
     const auto& selection = get<Tags::Selected<field_tag>>(selected_fields);
     if (not selection.has_value()) {
       return;
     }
     read_tensor_data(make_not_null(&get<field_tag>(all_tensor_data)),
-                     selection.value(), volume_file, observation_id);
+                     selection.value(), volume_file, observation_id,
+                     offsets_and_lengths);
   });
   return all_tensor_data;
 }
 
+// Widen the bounding boxes of the source grid points so they most likely
+// contain the source elements. The grid points don't necessarily extend to the
+// element boundaries (e.g. for Gauss quadrature), and curved elements can bulge
+// out between the grid points, so we widen each box generously by half its
+// largest extent. This is only a heuristic, so points outside the widened boxes
+// are still searched for (see
+// `element_logical_coordinates_in_bounding_boxes`). Boxes of a single point
+// can't be widened that way, so they are made infinite.
+inline void widen_bounding_boxes(
+    const gsl::not_null<std::vector<std::vector<std::pair<double, double>>>*>
+        bounding_boxes) {
+  for (auto& bounding_box : *bounding_boxes) {
+    double max_extent = 0.;
+    for (const auto& [lower, upper] : bounding_box) {
+      max_extent = std::max(max_extent, upper - lower);
+    }
+    const double padding = max_extent > 0.
+                               ? 0.5 * max_extent
+                               : std::numeric_limits<double>::infinity();
+    for (auto& [lower, upper] : bounding_box) {
+      lower -= padding;
+      upper += padding;
+    }
+  }
+}
+
+// Check if the bounding box of the `target_points` overlaps with the
+// `source_bounding_box`
+template <size_t Dim>
+bool overlaps_bounding_box(
+    const std::vector<std::pair<double, double>>& source_bounding_box,
+    const tnsr::I<DataVector, Dim, Frame::Inertial>& target_points) {
+  for (size_t d = 0; d < Dim; ++d) {
+    const auto [target_lower, target_upper] =
+        std::minmax_element(target_points[d].begin(), target_points[d].end());
+    if (*target_upper < source_bounding_box[d].first or
+        *target_lower > source_bounding_box[d].second) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Find the target points in the source elements. Source elements whose
+// (widened) bounding box overlaps with the target points are searched first.
+// The widened bounding boxes aren't guaranteed to contain their elements, so
+// target points that aren't found in these candidates are searched for in all
+// other source elements, like they would be without bounding boxes.
+template <size_t Dim>
+std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>>
+element_logical_coordinates_in_bounding_boxes(
+    const std::vector<ElementId<Dim>>& source_element_ids,
+    const std::vector<std::vector<std::pair<double, double>>>&
+        source_bounding_boxes,
+    const tnsr::I<DataVector, Dim, Frame::Inertial>& target_points,
+    std::vector<std::optional<
+        IdPair<domain::BlockId, tnsr::I<double, Dim, Frame::BlockLogical>>>>
+        block_logical_coords) {
+  std::vector<ElementId<Dim>> candidate_source_element_ids{};
+  std::vector<ElementId<Dim>> other_source_element_ids{};
+  for (size_t i = 0; i < source_element_ids.size(); ++i) {
+    if (overlaps_bounding_box(source_bounding_boxes[i], target_points)) {
+      candidate_source_element_ids.push_back(source_element_ids[i]);
+    } else {
+      other_source_element_ids.push_back(source_element_ids[i]);
+    }
+  }
+  auto result = element_logical_coordinates(candidate_source_element_ids,
+                                            block_logical_coords);
+  if (other_source_element_ids.empty()) {
+    return result;
+  }
+  // Only search for the points that weren't found yet. The offsets returned
+  // by `element_logical_coordinates` still refer to all target points.
+  for (const auto& source_element_id_and_coords : result) {
+    for (const size_t offset : source_element_id_and_coords.second.offsets) {
+      block_logical_coords[offset].reset();
+    }
+  }
+  if (alg::none_of(block_logical_coords, [](const auto& block_logical_coord) {
+        return block_logical_coord.has_value();
+      })) {
+    return result;
+  }
+  auto remaining_result = element_logical_coordinates(other_source_element_ids,
+                                                      block_logical_coords);
+  result.merge(remaining_result);
+  return result;
+}
+
 // Extract this element's data from the read-in dataset
 template <typename FieldTagsList>
 tuples::tagged_tuple_from_typelist<FieldTagsList> extract_element_data(
@@ -179,8 +286,7 @@ void verify_inertial_coordinates(
         ERROR_NO_TRACE(
             "The source and target coordinates don't match on grid "
             << grid_name << " in dimension " << d << " at point " << j
-            << " (plus offset " << source_element_data_offset_and_length.first
-            << " in the data file). Source coordinate: "
+            << ". Source coordinate: "
             << source_coord[source_element_data_offset_and_length.first + j]
             << ", target coordinate: " << target_coord[j]
             << ". Set 'Interpolate: True' to enable interpolation between the "
@@ -333,16 +439,33 @@ struct ReadVolumeData {
  * that was encoded into the `observers::ArrayComponentId` used to register the
  * elements.
  *
+ * \par Partial reads
+ * Each node reads only the data of the source grids that overlap with its
+ * target elements. First, all target elements on the node are matched to the
+ * source grids in a volume data file. Then, only the parts of the datasets
+ * that hold the data of these source grids are read from the file, and finally
+ * the data is interpolated and distributed to the target elements. If the
+ * volume data file holds the bounding boxes of its grids (see
+ * `h5::VolumeData`), the target points of an element are first searched for in
+ * the source grids whose (widened) bounding box overlaps with them. Only the
+ * target points that aren't found there are searched for in the other source
+ * grids, because the widened bounding boxes aren't guaranteed to contain the
+ * elements. Files that don't overlap with any target element on the node
+ * aren't read at all.
+ *
  * \par Memory consumption
  * This action runs once on every node. It reads all volume data files on the
  * node, but doesn't keep them all in memory at once. The following items
  * contribute primarily to memory consumption and can be reconsidered if we run
  * into memory issues:
  *
- * - `all_tensor_data`: All requested tensor components in the volume data file
- *   at the specified observation ID. Only data from one volume data file is
- *   held in memory at any time. Only data from files that overlap with target
- *   elements on this node are read in.
+ * - `all_tensor_data`: The requested tensor components of the source grids in
+ *   one volume data file that overlap with target elements on this node, at
+ *   the specified observation ID. Only data from one volume data file is held
+ *   in memory at any time.
+ * - `all_source_element_logical_coords`: The logical coordinates of the target
+ *   points of all target elements on this node in the source grids of one
+ *   volume data file.
  * - `target_element_data_buffer`: Holds incomplete interpolated data for each
  *   (target) element that resides on this node. In the worst case, when all
  *   target elements need data from the last source element in the last volume
@@ -443,6 +566,11 @@ struct ReadAllVolumeDataAndDistribute {
     std::unordered_map<std::string,
                        std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>
         source_domain_functions_of_time{};
+    // Search tree of the blocks of a time-dependent source domain at the
+    // observation value, which is the same for all files. Time-independent
+    // domains cache their search tree.
+    std::optional<domain::BlockSearchTree<Dim, Frame::Inertial>>
+        source_search_tree{};
     for (const std::string& file_name : file_paths) {
       // Open the volume data file
       h5::H5File<h5::AccessType::ReadOnly> h5file(file_name);
@@ -480,15 +608,6 @@ struct ReadAllVolumeDataAndDistribute {
       prev_observation_id = observation_id;
       observation_value = volume_file.get_observation_value(observation_id);
 
-      // Memory buffer for the tensor data stored in this file. The data is
-      // loaded lazily when it is needed. We may find that we can skip loading
-      // some files because none of their data is needed to fill the elements on
-      // this node.
-      std::optional<tuples::tagged_tuple_from_typelist<FieldTagsList>>
-          all_tensor_data{};
-      std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>
-          source_inertial_coords{};
-
       // Retrieve the information needed to reconstruct which element the data
       // belongs to
       const auto source_grid_names = volume_file.get_grid_names(observation_id);
@@ -546,37 +665,77 @@ struct ReadAllVolumeDataAndDistribute {
               std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>>(
               serialized_functions_of_time->data());
         }
+        if (source_domain->is_time_dependent() and
+            not source_search_tree.has_value()) {
+          source_search_tree.emplace(*source_domain, observation_value,
+                                     source_domain_functions_of_time);
+        }
       }
 
-      // Distribute the tensor data to the registered (target) elements. We
-      // erase target elements when they are complete. This allows us to search
-      // only for incomplete elements in subsequent volume files, and to stop
-      // early when all registered elements are complete.
-      std::unordered_set<ElementId<Dim>> completed_target_elements{};
+      // Bounding boxes of the source grids, if they were written to the file.
+      // They allow skipping source grids that can't overlap with a target
+      // element without transforming the target points into them.
+      std::optional<std::vector<std::vector<std::pair<double, double>>>>
+          source_bounding_boxes{};
+      if (enable_interpolation) {
+        source_bounding_boxes = volume_file.get_bounding_boxes(observation_id);
+        if (source_bounding_boxes.has_value()) {
+          if (source_bounding_boxes->size() != source_grid_names.size() or
+              source_bounding_boxes->empty() or
+              source_bounding_boxes->front().size() != Dim) {
+            // Can't use bounding boxes of the wrong dimension, e.g. of data
+            // that was written on a surface
+            source_bounding_boxes = std::nullopt;
+          } else {
+            detail::widen_bounding_boxes(
+                make_not_null(&*source_bounding_boxes));
+          }
+        }
+      }
+
+      // Find the source grids in this file that overlap with the registered
+      // (target) elements. We read only the data of these grids from the file
+      // once we have found them for all target elements. It's possible that
+      // the volume file only contains data for a subset of elements, e.g.,
+      // when each node of a simulation wrote volume data for its elements to a
+      // separate file.
+      std::unordered_map<ElementId<Dim>, std::vector<ElementId<Dim>>>
+          all_overlapping_source_element_ids{};
+      std::unordered_map<
+          ElementId<Dim>,
+          std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>>>
+          all_source_element_logical_coords{};
+      // Offsets and lengths of the overlapping source grids in the contiguous
+      // datasets, sorted by their offset
+      std::map<size_t, size_t> source_offsets_and_lengths{};
       for (const auto& target_element_id : target_element_ids) {
         const auto& target_points = get<Tags::RegisteredElements<Dim>>(box).at(
             observers::ArrayComponentId(
                 std::add_pointer_t<ReceiveComponent>{nullptr},
                 Parallel::ArrayIndex<ElementId<Dim>>(target_element_id)));
-        const auto target_grid_name = get_output(target_element_id);
-
-        // Proceed with the registered element only if it overlaps with the
-        // volume file. It's possible that the volume file only contains data
-        // for a subset of elements, e.g., when each node of a simulation wrote
-        // volume data for its elements to a separate file.
         std::vector<ElementId<Dim>> overlapping_source_element_ids{};
-        std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>>
-            source_element_logical_coords{};
         if (enable_interpolation) {
           // Transform the target points to block logical coords in the source
           // domain
-          const auto source_block_logical_coords = block_logical_coordinates(
-              *source_domain, target_points, observation_value,
-              source_domain_functions_of_time);
+          auto source_block_logical_coords =
+              source_search_tree.has_value()
+                  ? block_logical_coordinates(
+                        *source_domain, target_points, *source_search_tree,
+                        observation_value, source_domain_functions_of_time)
+                  : block_logical_coordinates(*source_domain, target_points);
           // Find the target points in the subset of source elements contained
-          // in this volume file
-          source_element_logical_coords = element_logical_coordinates(
-              source_element_ids, source_block_logical_coords);
+          // in this volume file, starting with the source grids whose
+          // bounding box overlaps with the target points
+          auto source_element_logical_coords =
+              source_bounding_boxes.has_value()
+                  ? detail::element_logical_coordinates_in_bounding_boxes(
+                        source_element_ids, *source_bounding_boxes,
+                        target_points, std::move(source_block_logical_coords))
+                  : element_logical_coordinates(source_element_ids,
+                                                source_block_logical_coords);
+          if (source_element_logical_coords.empty()) {
+            continue;
+          }
           overlapping_source_element_ids.reserve(
               source_element_logical_coords.size());
           for (const auto& source_element_id_and_coords :
@@ -584,35 +743,92 @@ struct ReadAllVolumeDataAndDistribute {
             overlapping_source_element_ids.push_back(
                 source_element_id_and_coords.first);
           }
+          all_source_element_logical_coords[target_element_id] =
+              std::move(source_element_logical_coords);
         } else {
           // When interpolation is disabled we process only volume files that
           // contain the exact element
           if (std::find(source_grid_names.begin(), source_grid_names.end(),
-                        target_grid_name) == source_grid_names.end()) {
+                        get_output(target_element_id)) ==
+              source_grid_names.end()) {
             continue;
           }
           overlapping_source_element_ids.push_back(target_element_id);
         }
+        for (const auto& source_element_id : overlapping_source_element_ids) {
+          source_offsets_and_lengths.insert(h5::offset_and_length_for_grid(
+              get_output(source_element_id), source_grid_names,
+              source_extents));
+        }
+        all_overlapping_source_element_ids[target_element_id] =
+            std::move(overlapping_source_element_ids);
+      }
+      // Skip files that don't overlap with any target element on this node
+      if (all_overlapping_source_element_ids.empty()) {
+        continue;
+      }
 
-        // Lazily load the tensor data from the file if needed
-        if (not overlapping_source_element_ids.empty() and
-            not all_tensor_data.has_value()) {
-          all_tensor_data = detail::read_tensor_data<FieldTagsList>(
-              volume_file, observation_id, selected_fields);
+      // Read the data of the overlapping source grids. Adjacent grids are
+      // coalesced into a single interval so they are read in one piece. We
+      // also keep track of where the data of each source grid ends up in the
+      // read-in data.
+      std::vector<std::pair<size_t, size_t>> intervals_to_read{};
+      std::unordered_map<size_t, size_t> read_offsets{};
+      size_t read_offset = 0;
+      for (const auto& [offset, length] : source_offsets_and_lengths) {
+        if (not intervals_to_read.empty() and
+            intervals_to_read.back().first + intervals_to_read.back().second ==
+                offset) {
+          intervals_to_read.back().second += length;
+        } else {
+          intervals_to_read.emplace_back(offset, length);
         }
+        read_offsets[offset] = read_offset;
+        read_offset += length;
+      }
+      const auto all_tensor_data = detail::read_tensor_data<FieldTagsList>(
+          volume_file, observation_id, selected_fields, intervals_to_read);
+      std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>
+          source_inertial_coords{};
+      if (not enable_interpolation) {
+        // Verify that the inertial coordinates of the source and target
+        // elements match. To do so we retrieve the inertial coordinates that
+        // are written alongside the tensor data in the file. This is an
+        // important check. It avoids nasty bugs where tensor data is read in
+        // to points that don't exactly match the input. Therefore we DON'T
+        // restrict this check to Debug mode.
+        source_inertial_coords.emplace();
+        detail::read_tensor_data(make_not_null(&*source_inertial_coords),
+                                 "InertialCoordinates", volume_file,
+                                 observation_id, intervals_to_read);
+      }
+
+      // Distribute the tensor data to the registered (target) elements. We
+      // erase target elements when they are complete. This allows us to search
+      // only for incomplete elements in subsequent volume files, and to stop
+      // early when all registered elements are complete.
+      std::unordered_set<ElementId<Dim>> completed_target_elements{};
+      for (const auto& [target_element_id, overlapping_source_element_ids] :
+           all_overlapping_source_element_ids) {
+        const auto& target_points = get<Tags::RegisteredElements<Dim>>(box).at(
+            observers::ArrayComponentId(
+                std::add_pointer_t<ReceiveComponent>{nullptr},
+                Parallel::ArrayIndex<ElementId<Dim>>(target_element_id)));
 
         // Iterate over the source elements in this volume file that overlap
         // with the target element
         for (const auto& source_element_id : overlapping_source_element_ids) {
           const auto source_grid_name = get_output(source_element_id);
-          // Find the data offset that corresponds to this element
-          const auto element_data_offset_and_length =
+          // Find the offset of this element's data in the read-in data
+          const auto [file_offset, num_points] =
               h5::offset_and_length_for_grid(source_grid_name,
                                              source_grid_names, source_extents);
+          const std::pair<size_t, size_t> element_data_offset_and_length{
+              read_offsets.at(file_offset), num_points};
           // Extract this element's data from the read-in dataset
           auto source_element_data =
               detail::extract_element_data<FieldTagsList>(
-                  element_data_offset_and_length, *all_tensor_data,
+                  element_data_offset_and_length, all_tensor_data,
                   selected_fields);
 
           if (enable_interpolation) {
@@ -639,7 +855,8 @@ struct ReadAllVolumeDataAndDistribute {
 
             // Interpolate!
             const auto& source_logical_coords_of_target_points =
-                source_element_logical_coords.at(source_element_id);
+                all_source_element_logical_coords.at(target_element_id)
+                    .at(source_element_id);
             detail::interpolate_selected_fields<FieldTagsList>(
                 make_not_null(&target_element_data), source_element_data,
                 source_mesh,
@@ -668,19 +885,6 @@ struct ReadAllVolumeDataAndDistribute {
               all_indices_of_filled_interp_points.erase(target_element_id);
             }
           } else {
-            // Verify that the inertial coordinates of the source and target
-            // elements match. To do so we retrieve the inertial coordinates
-            // that are written alongside the tensor data in the file. This is
-            // an important check. It avoids nasty bugs where tensor data is
-            // read in to points that don't exactly match the input. Therefore
-            // we DON'T restrict this check to Debug mode.
-            if (not source_inertial_coords.has_value()) {
-              tnsr::I<DataVector, Dim, Frame::Inertial> inertial_coords{};
-              detail::read_tensor_data(make_not_null(&inertial_coords),
-                                       "InertialCoordinates", volume_file,
-                                       observation_id);
-              source_inertial_coords = std::move(inertial_coords);
-            }
             detail::verify_inertial_coordinates(
                 element_data_offset_and_length, *source_inertial_coords,
                 target_points, source_grid_name);
@@ -0,0 +1,184 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Observer/BufferedReductionWriter.hpp"
+
+#include <cstddef>
+#include <future>
+#include <mutex>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+
+namespace observers {
+
+BufferedReductionWriter::BufferedReductionWriter(const size_t max_buffered_rows,
+                                                 const double flush_interval)
+    : max_buffered_rows_(max_buffered_rows), flush_interval_(flush_interval) {}
+
+void BufferedReductionWriter::append(
+    const std::string& file_name, const std::string& subfile_name,
+    const std::string& input_source, std::vector<std::string> legend,
+    std::vector<double> row,
+    const gsl::not_null<Parallel::NodeLock*> h5_file_lock) {
+  const std::lock_guard hold_lock(buffer_lock_);
+  buffer_row(file_name, subfile_name, input_source, std::move(legend),
+             std::move(row));
+  write_if_needed(h5_file_lock);
+}
+
+void BufferedReductionWriter::append(
+    const std::string& file_name, const std::vector<std::string>& subfile_names,
+    const std::string& input_source, const std::vector<std::string>& legend,
+    std::vector<std::vector<double>> rows,
+    const gsl::not_null<Parallel::NodeLock*> h5_file_lock) {
+  if (UNLIKELY(subfile_names.size() != rows.size())) {
+    ERROR("Got " << rows.size() << " rows for " << subfile_names.size()
+                 << " subfiles of the file '" << file_name << "'.");
+  }
+  if (rows.empty()) {
+    return;
+  }
+  const std::lock_guard hold_lock(buffer_lock_);
+  for (size_t i = 0; i < rows.size(); ++i) {
+    buffer_row(file_name, subfile_names[i], input_source, legend,
+               std::move(rows[i]));
+  }
+  write_if_needed(h5_file_lock);
+}
+
+void BufferedReductionWriter::buffer_row(const std::string& file_name,
+                                         const std::string& subfile_name,
+                                         const std::string& input_source,
+                                         std::vector<std::string> legend,
+                                         std::vector<double> row) {
+  auto& buffered_file = buffered_files_[file_name];
+  if (buffered_file.subfiles.empty()) {
+    buffered_file.input_source = input_source;
+  }
+  auto& buffered_subfile = buffered_file.subfiles[subfile_name];
+  if (buffered_subfile.rows.empty()) {
+    buffered_subfile.legend = std::move(legend);
+  } else if (UNLIKELY(buffered_subfile.legend != legend)) {
+    ERROR("The legend " << get_output(legend) << " of the subfile '"
+                        << subfile_name << "' in the file '" << file_name
+                        << "' doesn't match the legend "
+                        << get_output(buffered_subfile.legend)
+                        << " of the rows that are already buffered.");
+  }
+  buffered_subfile.rows.push_back(std::move(row));
+  if (number_of_buffered_rows_ == 0) {
+    oldest_row_time_ = sys::wall_time();
+  }
+  ++number_of_buffered_rows_;
+}
+
+void BufferedReductionWriter::write_if_needed(
+    const gsl::not_null<Parallel::NodeLock*> h5_file_lock) {
+  if (max_buffered_rows_ == 0) {
+    wait_for_pending_write();
+    write_on_this_thread(h5_file_lock);
+  } else if (number_of_buffered_rows_ >= max_buffered_rows_ or
+             sys::wall_time() - oldest_row_time_ >= flush_interval_) {
+    start_write(h5_file_lock);
+  }
+}
+
+void BufferedReductionWriter::flush(
+    const gsl::not_null<Parallel::NodeLock*> h5_file_lock) {
+  const std::lock_guard hold_lock(buffer_lock_);
+  wait_for_pending_write();
+  if (number_of_buffered_rows_ == 0) {
+    return;
+  }
+  write_on_this_thread(h5_file_lock);
+}
+
+void BufferedReductionWriter::wait_for_pending_write() {
+  if (pending_write_.valid()) {
+    // Rethrows errors from the background thread
+    pending_write_.get();
+  }
+}
+
+void BufferedReductionWriter::write_on_this_thread(
+    const gsl::not_null<Parallel::NodeLock*> h5_file_lock) {
+  const std::lock_guard hold_file_lock(*h5_file_lock);
+  write(buffered_files_);
+  buffered_files_.clear();
+  number_of_buffered_rows_ = 0;
+  ++number_of_writes_;
+}
+
+void BufferedReductionWriter::start_write(
+    const gsl::not_null<Parallel::NodeLock*> h5_file_lock) {
+  // Only one write is in flight at any time so the rows are written in order
+  wait_for_pending_write();
+  if constexpr (not Parallel::NodeLock::locks_all_threads) {
+    // Without SMP the `h5_file_lock` doesn't exclude other threads from the
+    // file, so write on this thread
+    write_on_this_thread(h5_file_lock);
+  } else {
+    pending_write_ = std::async(
+        std::launch::async,
+        [files = std::move(buffered_files_), h5_file_lock]() {
+          const std::lock_guard hold_file_lock(*h5_file_lock);
+          write(files);
+        });
+    buffered_files_.clear();
+    number_of_buffered_rows_ = 0;
+    ++number_of_writes_;
+  }
+}
+
+void BufferedReductionWriter::write(const BufferedFiles& files) {
+  for (const auto& [file_name, buffered_file] : files) {
+    h5::H5File<h5::AccessType::ReadWrite> h5file(file_name, true,
+                                                 buffered_file.input_source);
+    for (const auto& [subfile_name, buffered_subfile] :
+         buffered_file.subfiles) {
+      constexpr size_t version_number = 0;
+      auto& time_series_file = h5file.try_insert<h5::Dat>(
+          subfile_name, buffered_subfile.legend, version_number);
+      time_series_file.append(buffered_subfile.rows);
+      h5file.close_current_object();
+    }
+  }
+}
+
+void BufferedReductionWriter::BufferedSubfile::pup(PUP::er& p) {
+  p | legend;
+  p | rows;
+}
+
+void BufferedReductionWriter::BufferedFile::pup(PUP::er& p) {
+  p | input_source;
+  p | subfiles;
+}
+
+void BufferedReductionWriter::pup(PUP::er& p) {
+  if (p.isPacking() or p.isSizing()) {
+    // Don't serialize while a background write is in flight
+    const std::lock_guard hold_lock(buffer_lock_);
+    wait_for_pending_write();
+  }
+  p | max_buffered_rows_;
+  p | flush_interval_;
+  p | buffered_files_;
+  p | number_of_buffered_rows_;
+  p | oldest_row_time_;
+  p | number_of_writes_;
+}
+
+}  // namespace observers
@@ -0,0 +1,138 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <future>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace observers {
+/*!
+ * \ingroup ObserversGroup
+ * \brief Buffers rows of reduction data and appends them to `h5::Dat` subfiles
+ * in batches.
+ *
+ * \details Opening the reduction file and its `h5::Dat` subfile for every
+ * single row of reduction data is expensive, and since it happens on node 0
+ * while holding the `observers::Tags::H5FileLock` it serializes all threads
+ * that write data on that node. This class collects the rows in memory
+ * instead. The buffered rows are written once `max_buffered_rows` rows are
+ * buffered, or once the oldest buffered row is more than `flush_interval`
+ * seconds (wall time) old when the next row arrives. Each write opens every
+ * file only once and appends all buffered rows of a subfile in a single call.
+ * The writes run on a background thread that holds the H5 file lock, so the
+ * thread that appended a row can return to the scheduler right away. Writes
+ * happen in the order they were started. In non-SMP builds of Charm++ the H5
+ * file lock doesn't exclude other threads (see
+ * `Parallel::NodeLock::locks_all_threads`), so the writes run on the calling
+ * thread instead.
+ *
+ * With `max_buffered_rows` set to zero (the default) every row is written
+ * immediately on the calling thread.
+ *
+ * The files are closed between writes, so other code can still open them.
+ * Call `flush()` to write all buffered rows, e.g. before a checkpoint and
+ * before the executable exits. Buffered rows that have not been written are
+ * serialized along with the writer.
+ *
+ * \warning The H5 file lock that is passed to `append()` and `flush()` must not
+ * be held by the calling thread, since these functions may wait for a
+ * background write that needs the lock.
+ */
+class BufferedReductionWriter {
+ public:
+  BufferedReductionWriter() = default;
+  BufferedReductionWriter(size_t max_buffered_rows, double flush_interval);
+
+  BufferedReductionWriter(const BufferedReductionWriter&) = delete;
+  BufferedReductionWriter& operator=(const BufferedReductionWriter&) = delete;
+  BufferedReductionWriter(BufferedReductionWriter&& rhs) = default;
+  BufferedReductionWriter& operator=(BufferedReductionWriter&& rhs) = default;
+  ~BufferedReductionWriter() = default;
+
+  /// Append the `row` to the subfile `subfile_name` of the H5 file `file_name`
+  /// (including the extension). The `legend` and `input_source` are used to
+  /// create the subfile and the file if they don't exist yet.
+  void append(const std::string& file_name, const std::string& subfile_name,
+              const std::string& input_source, std::vector<std::string> legend,
+              std::vector<double> row,
+              gsl::not_null<Parallel::NodeLock*> h5_file_lock);
+
+  /// Append one row to each of the `subfile_names` of the H5 file
+  /// `file_name`. All subfiles share the `legend`. The rows are handled like
+  /// rows appended one by one, except that without buffering they are all
+  /// written at once, so the file is only opened once.
+  void append(const std::string& file_name,
+              const std::vector<std::string>& subfile_names,
+              const std::string& input_source,
+              const std::vector<std::string>& legend,
+              std::vector<std::vector<double>> rows,
+              gsl::not_null<Parallel::NodeLock*> h5_file_lock);
+
+  /// Write all buffered rows and wait for all writes to finish.
+  void flush(gsl::not_null<Parallel::NodeLock*> h5_file_lock);
+
+  size_t max_buffered_rows() const { return max_buffered_rows_; }
+  double flush_interval() const { return flush_interval_; }
+
+  /// The number of rows that have not been written yet
+  size_t number_of_buffered_rows() const { return number_of_buffered_rows_; }
+
+  /// The number of times the buffered rows were written to disk
+  size_t number_of_writes() const { return number_of_writes_; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  struct BufferedSubfile {
+    std::vector<std::string> legend{};
+    std::vector<std::vector<double>> rows{};
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p);
+  };
+  struct BufferedFile {
+    std::string input_source{};
+    // Ordered so the subfiles are always written in the same order
+    std::map<std::string, BufferedSubfile> subfiles{};
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p);
+  };
+  using BufferedFiles = std::map<std::string, BufferedFile>;
+
+  static void write(const BufferedFiles& files);
+
+  // Must be called while holding the `buffer_lock_`
+  void buffer_row(const std::string& file_name,
+                  const std::string& subfile_name,
+                  const std::string& input_source,
+                  std::vector<std::string> legend, std::vector<double> row);
+  void write_if_needed(gsl::not_null<Parallel::NodeLock*> h5_file_lock);
+  void wait_for_pending_write();
+  void write_on_this_thread(gsl::not_null<Parallel::NodeLock*> h5_file_lock);
+  void start_write(gsl::not_null<Parallel::NodeLock*> h5_file_lock);
+
+  size_t max_buffered_rows_{0};
+  double flush_interval_{0.0};
+  BufferedFiles buffered_files_{};
+  size_t number_of_buffered_rows_{0};
+  double oldest_row_time_{0.0};
+  size_t number_of_writes_{0};
+  Parallel::NodeLock buffer_lock_{};
+  std::future<void> pending_write_{};
+};
+}  // namespace observers
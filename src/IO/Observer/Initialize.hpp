@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <optional>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -12,14 +13,19 @@
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
 
 namespace observers {
 namespace Actions {
 namespace detail {
 template <class Tag>
 using reduction_data_to_reduction_names = typename Tag::names_tag;
+
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(max_buffered_reduction_rows)
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(reduction_flush_interval_seconds)
 }  // namespace detail
 /*!
  * \brief Initializes the DataBox on the observer parallel component
@@ -61,6 +67,14 @@ struct Initialize {
  * Uses:
  * - Metavariables:
  *   - `observed_reduction_data_tags` (see ContributeReductionData)
+ *   - `max_buffered_reduction_rows` (optional, a `static constexpr size_t`):
+ *     the number of rows of reduction data that are buffered before they are
+ *     written to disk. Defaults to zero, i.e. every row is written immediately.
+ *     See `observers::BufferedReductionWriter`.
+ *   - `reduction_flush_interval_seconds` (optional, a `static constexpr
+ *     size_t`): the wall time after which buffered rows of reduction data are
+ *     written to disk even if fewer than `max_buffered_reduction_rows` rows
+ *     are buffered. Defaults to 60 seconds.
  *
  */
 template <class Metavariables>
@@ -71,7 +85,8 @@ struct InitializeWriter {
                  Tags::ContributorsOfTensorData, Tags::VolumeDataLock,
                  Tags::TensorData, Tags::InterpolatorTensorData,
                  Tags::NodesExpectedToContributeReductions,
-                 Tags::NodesThatContributedReductions, Tags::H5FileLock>,
+                 Tags::NodesThatContributedReductions, Tags::H5FileLock,
+                 Tags::ReductionWriter>,
       typename Metavariables::observed_reduction_data_tags,
       tmpl::transform<
           typename Metavariables::observed_reduction_data_tags,
@@ -83,11 +98,25 @@ struct InitializeWriter {
   template <typename DbTagsList, typename... InboxTags, typename ArrayIndex,
             typename ActionList, typename ParallelComponent>
   static Parallel::iterable_action_return_t apply(
-      db::DataBox<DbTagsList>& /*box*/,
+      [[maybe_unused]] db::DataBox<DbTagsList>& box,
       const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
       const Parallel::GlobalCache<Metavariables>& /*cache*/,
       const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
       const ParallelComponent* const /*meta*/) {
+    constexpr size_t max_buffered_rows =
+        detail::get_max_buffered_reduction_rows_or_default_v<Metavariables,
+                                                             size_t{0}>;
+    if constexpr (max_buffered_rows > 0) {
+      constexpr size_t flush_interval =
+          detail::get_reduction_flush_interval_seconds_or_default_v<
+              Metavariables, size_t{60}>;
+      db::mutate<Tags::ReductionWriter>(
+          [](const gsl::not_null<BufferedReductionWriter*> writer) {
+            *writer = BufferedReductionWriter{
+                max_buffered_rows, static_cast<double>(flush_interval)};
+          },
+          make_not_null(&box));
+    }
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
 };
@@ -5,10 +5,13 @@
 
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/Initialize.hpp"
+#include "IO/Observer/ReductionActions.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "Parallel/Algorithms/AlgorithmGroup.hpp"
 #include "Parallel/Algorithms/AlgorithmNodegroup.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
@@ -46,6 +49,10 @@ struct Observer {
  * \ingroup ObserversGroup
  * \brief The nodegroup parallel component that is responsible for writing data
  * to disk.
+ *
+ * Reduction data that is buffered by the `observers::Tags::ReductionWriter` is
+ * written to disk at every phase change (in particular before a checkpoint is
+ * written) and before the executable exits.
  */
 template <class Metavariables>
 struct ObserverWriter {
@@ -62,7 +69,25 @@ struct ObserverWriter {
       Parallel::get_initialization_actions_list<phase_dependent_action_list>>;
 
   static void execute_next_phase(
-      const Parallel::Phase /*next_phase*/,
-      Parallel::CProxy_GlobalCache<Metavariables>& /*global_cache*/) {}
+      const Parallel::Phase next_phase,
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache) {
+    // The DataBox isn't set up before the initialization phase has run
+    if (next_phase != Parallel::Phase::Initialization) {
+      flush_reduction_data(global_cache);
+    }
+  }
+
+  static void prepare_for_exit(
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache) {
+    flush_reduction_data(global_cache);
+  }
+
+ private:
+  static void flush_reduction_data(
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache) {
+    auto& local_cache = *Parallel::local_branch(global_cache);
+    Parallel::threaded_action<ThreadedActions::FlushReductionData>(
+        Parallel::get_parallel_component<ObserverWriter>(local_cache));
+  }
 };
 }  // namespace observers
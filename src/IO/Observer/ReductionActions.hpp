@@ -17,6 +17,7 @@
 #include "IO/H5/Dat.hpp"
 #include "IO/H5/File.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
+#include "IO/Observer/BufferedReductionWriter.hpp"
 #include "IO/Observer/Helpers.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/Protocols/ReductionDataFormatter.hpp"
@@ -52,6 +53,7 @@ struct ObserverWriter;
 namespace ThreadedActions {
 /// \cond
 struct CollectReductionDataOnNode;
+struct FlushReductionData;
 struct WriteReductionData;
 /// \endcond
 }  // namespace ThreadedActions
@@ -225,11 +227,9 @@ void append_to_reduction_data(
     const std::vector<double>& t);
 
 template <typename... Ts, size_t... Is>
-void write_data(const std::string& subfile_name,
-                const std::string& input_source,
-                std::vector<std::string> legend, const std::tuple<Ts...>& data,
-                const std::string& file_prefix,
-                std::index_sequence<Is...> /*meta*/) {
+std::vector<double> make_row_of_data(const std::vector<std::string>& legend,
+                                     const std::tuple<Ts...>& data,
+                                     std::index_sequence<Is...> /*meta*/) {
   static_assert(sizeof...(Ts) > 0,
                 "Must be reducing at least one piece of data");
   std::vector<double> data_to_append{};
@@ -243,6 +243,17 @@ void write_data(const std::string& subfile_name,
         << "' but there are " << data_to_append.size()
         << " pieces of data being reduced");
   }
+  return data_to_append;
+}
+
+template <typename... Ts, size_t... Is>
+void write_data(const std::string& subfile_name,
+                const std::string& input_source,
+                std::vector<std::string> legend, const std::tuple<Ts...>& data,
+                const std::string& file_prefix,
+                std::index_sequence<Is...> meta) {
+  const std::vector<double> data_to_append =
+      make_row_of_data(legend, data, meta);
 
   h5::H5File<h5::AccessType::ReadWrite> h5file(file_prefix + ".h5", true,
                                                input_source);
@@ -251,6 +262,21 @@ void write_data(const std::string& subfile_name,
       subfile_name, std::move(legend), version_number);
   time_series_file.append(data_to_append);
 }
+
+// Same as `write_data`, but hands the row to the `writer`, which may buffer it.
+// The `h5_file_lock` must not be held by the caller.
+template <typename... Ts, size_t... Is>
+void write_data(const gsl::not_null<BufferedReductionWriter*> writer,
+                const gsl::not_null<Parallel::NodeLock*> h5_file_lock,
+                const std::string& subfile_name,
+                const std::string& input_source,
+                std::vector<std::string> legend, const std::tuple<Ts...>& data,
+                const std::string& file_prefix,
+                std::index_sequence<Is...> meta) {
+  std::vector<double> data_to_append = make_row_of_data(legend, data, meta);
+  writer->append(file_prefix + ".h5", subfile_name, input_source,
+                 std::move(legend), std::move(data_to_append), h5_file_lock);
+}
 }  // namespace ReductionActions_detail
 
 /*!
@@ -292,6 +318,7 @@ struct CollectReductionDataOnNode {
         reduction_observers_contributed = nullptr;
     Parallel::NodeLock* reduction_data_lock = nullptr;
     Parallel::NodeLock* reduction_file_lock = nullptr;
+    BufferedReductionWriter* reduction_writer = nullptr;
     size_t observations_registered_with_id = std::numeric_limits<size_t>::max();
 
     {
@@ -299,12 +326,12 @@ struct CollectReductionDataOnNode {
       db::mutate<Tags::ReductionData<ReductionDatums...>,
                  Tags::ReductionDataNames<ReductionDatums...>,
                  Tags::ContributorsOfReductionData, Tags::ReductionDataLock,
-                 Tags::H5FileLock>(
+                 Tags::H5FileLock, Tags::ReductionWriter>(
           make_not_null(&box),
           [&reduction_data, &reduction_names_map,
            &reduction_observers_contributed, &reduction_data_lock,
-           &reduction_file_lock, &observation_id, &observer_group_id,
-           &observations_registered_with_id](
+           &reduction_file_lock, &reduction_writer, &observation_id,
+           &observer_group_id, &observations_registered_with_id](
               const gsl::not_null<std::unordered_map<
                   observers::ObservationId,
                   Parallel::ReductionData<ReductionDatums...>>*>
@@ -318,6 +345,8 @@ struct CollectReductionDataOnNode {
                   reduction_observers_contributed_ptr,
               const gsl::not_null<Parallel::NodeLock*> reduction_data_lock_ptr,
               const gsl::not_null<Parallel::NodeLock*> reduction_file_lock_ptr,
+              const gsl::not_null<BufferedReductionWriter*>
+                  reduction_writer_ptr,
               const std::unordered_map<ObservationKey,
                                        std::unordered_set<ArrayComponentId>>&
                   observations_registered) {
@@ -336,6 +365,7 @@ struct CollectReductionDataOnNode {
                 &*reduction_observers_contributed_ptr;
             reduction_data_lock = &*reduction_data_lock_ptr;
             reduction_file_lock = &*reduction_file_lock_ptr;
+            reduction_writer = &*reduction_writer_ptr;
             observations_registered_with_id =
                 observations_registered.at(key).size();
           },
@@ -372,8 +402,9 @@ struct CollectReductionDataOnNode {
         auto reduction_names_this_core = reduction_names;
         auto& my_proxy =
             Parallel::get_parallel_component<ParallelComponent>(cache);
-        const std::lock_guard hold_file_lock(*reduction_file_lock);
         ReductionActions_detail::write_data(
+            make_not_null(reduction_writer),
+            make_not_null(reduction_file_lock),
             "/Core" + std::to_string(observe_with_core_id.value()) +
                 subfile_name,
             observers::input_source_from_cache(cache),
@@ -496,6 +527,7 @@ struct WriteReductionData {
         nodes_contributed = nullptr;
     Parallel::NodeLock* reduction_data_lock = nullptr;
     Parallel::NodeLock* reduction_file_lock = nullptr;
+    BufferedReductionWriter* reduction_writer = nullptr;
     size_t observations_registered_with_id = std::numeric_limits<size_t>::max();
 
     {
@@ -503,11 +535,12 @@ struct WriteReductionData {
       db::mutate<Tags::ReductionData<ReductionDatums...>,
                  Tags::ReductionDataNames<ReductionDatums...>,
                  Tags::NodesThatContributedReductions, Tags::ReductionDataLock,
-                 Tags::H5FileLock>(
+                 Tags::H5FileLock, Tags::ReductionWriter>(
           make_not_null(&box),
           [&nodes_contributed, &reduction_data, &reduction_names_map,
-           &reduction_data_lock, &reduction_file_lock, &observation_id,
-           &observations_registered_with_id, &sender_node_number](
+           &reduction_data_lock, &reduction_file_lock, &reduction_writer,
+           &observation_id, &observations_registered_with_id,
+           &sender_node_number](
               const gsl::not_null<
                   typename Tags::ReductionData<ReductionDatums...>::type*>
                   reduction_data_ptr,
@@ -519,6 +552,8 @@ struct WriteReductionData {
                   nodes_contributed_ptr,
               const gsl::not_null<Parallel::NodeLock*> reduction_data_lock_ptr,
               const gsl::not_null<Parallel::NodeLock*> reduction_file_lock_ptr,
+              const gsl::not_null<BufferedReductionWriter*>
+                  reduction_writer_ptr,
               const std::unordered_map<ObservationKey, std::set<size_t>>&
                   nodes_registered_for_reductions) {
             const ObservationKey& key{observation_id.observation_key()};
@@ -541,6 +576,7 @@ struct WriteReductionData {
             nodes_contributed = &*nodes_contributed_ptr;
             reduction_data_lock = &*reduction_data_lock_ptr;
             reduction_file_lock = &*reduction_file_lock_ptr;
+            reduction_writer = &*reduction_writer_ptr;
             observations_registered_with_id =
                 nodes_registered_for_reductions.at(key).size();
           },
@@ -615,7 +651,6 @@ struct WriteReductionData {
     }
 
     if (write_to_disk) {
-      const std::lock_guard hold_lock(*reduction_file_lock);
       // NOLINTNEXTLINE(bugprone-use-after-move)
       received_reduction_data.finalize();
       if constexpr (not std::is_same_v<Formatter, NoFormatter>) {
@@ -625,6 +660,7 @@ struct WriteReductionData {
         }
       }
       ReductionActions_detail::write_data(
+          make_not_null(reduction_writer), make_not_null(reduction_file_lock),
           subfile_name, observers::input_source_from_cache(cache),
           // NOLINTNEXTLINE(bugprone-use-after-move)
           std::move(reduction_names), std::move(received_reduction_data.data()),
@@ -667,8 +703,10 @@ struct WriteReductionDataRow {
                     std::tuple<Ts...>&& reduction_data) {
     auto& reduction_file_lock =
         db::get_mutable_reference<Tags::H5FileLock>(make_not_null(&box));
-    const std::lock_guard hold_lock(reduction_file_lock);
+    auto& reduction_writer =
+        db::get_mutable_reference<Tags::ReductionWriter>(make_not_null(&box));
     ThreadedActions::ReductionActions_detail::write_data(
+        make_not_null(&reduction_writer), make_not_null(&reduction_file_lock),
         subfile_name, observers::input_source_from_cache(cache),
         std::move(legend), std::move(reduction_data),
         Parallel::get<Tags::ReductionFileName>(cache),
@@ -676,5 +714,82 @@ struct WriteReductionDataRow {
   }
 };
 
+/*!
+ * \brief Write one row of data to each of several subfiles of the reductions
+ * file with a single message.
+ *
+ * This is the batched version of `observers::ThreadedActions::
+ * WriteReductionDataRow` for data that is written to many subfiles at once,
+ * e.g. one subfile per timer. Unless the `observers::Tags::ReductionWriter`
+ * buffers rows, the file is opened only once for all rows. Pass the following
+ * arguments when invoking this action:
+ *
+ * - `subfile_names`: the names of the `h5::Dat` subfiles in the HDF5 file,
+ *   each including a leading slash.
+ * - `legend`: the column labels, shared by all subfiles.
+ * - `rows`: one row of data per subfile, in the same order as the
+ *   `subfile_names`. Each row must have the length of the `legend`.
+ */
+struct WriteReductionDataRows {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> /*node_lock*/,
+                    const std::vector<std::string>& subfile_names,
+                    const std::vector<std::string>& legend,
+                    std::vector<std::vector<double>>&& rows) {
+    for (const auto& row : rows) {
+      if (UNLIKELY(row.size() != legend.size())) {
+        ERROR("There must be one name provided for each piece of data. You "
+              "provided "
+              << legend.size() << " names: '" << get_output(legend)
+              << "' but a row has " << row.size() << " pieces of data");
+      }
+    }
+    auto& reduction_file_lock =
+        db::get_mutable_reference<Tags::H5FileLock>(make_not_null(&box));
+    auto& reduction_writer =
+        db::get_mutable_reference<Tags::ReductionWriter>(make_not_null(&box));
+    reduction_writer.append(
+        Parallel::get<Tags::ReductionFileName>(cache) + ".h5", subfile_names,
+        observers::input_source_from_cache(cache), legend, std::move(rows),
+        make_not_null(&reduction_file_lock));
+  }
+};
+
+/*!
+ * \brief Write all reduction data that the `observers::Tags::ReductionWriter`
+ * on this node has buffered to disk.
+ *
+ * The `observers::ObserverWriter` invokes this action on all nodes at every
+ * phase change and before the executable exits, so buffered reduction data is
+ * on disk before checkpoints are written and when the run ends.
+ */
+struct FlushReductionData {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock) {
+    Parallel::NodeLock* reduction_file_lock = nullptr;
+    BufferedReductionWriter* reduction_writer = nullptr;
+    {
+      const std::lock_guard hold_lock(*node_lock);
+      db::mutate<Tags::H5FileLock, Tags::ReductionWriter>(
+          make_not_null(&box),
+          [&reduction_file_lock, &reduction_writer](
+              const gsl::not_null<Parallel::NodeLock*> reduction_file_lock_ptr,
+              const gsl::not_null<BufferedReductionWriter*>
+                  reduction_writer_ptr) {
+            reduction_file_lock = &*reduction_file_lock_ptr;
+            reduction_writer = &*reduction_writer_ptr;
+          });
+    }
+    reduction_writer->flush(reduction_file_lock);
+  }
+};
 }  // namespace ThreadedActions
 }  // namespace observers
@@ -17,6 +17,7 @@
 #include "DataStructures/DataVector.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
+#include "IO/Observer/BufferedReductionWriter.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "Options/Options.hpp"
 #include "Parallel/NodeLock.hpp"
@@ -148,6 +149,12 @@ struct H5FileLock : db::SimpleTag {
   using type = Parallel::NodeLock;
 };
 
+/// The writer that buffers rows of reduction data before appending them to the
+/// H5 files on disk. See `observers::BufferedReductionWriter`.
+struct ReductionWriter : db::SimpleTag {
+  using type = BufferedReductionWriter;
+};
+
 /*!
  * \brief A string identifying observations related to the `Tag`.
  *
@@ -68,10 +68,14 @@ namespace fd {
  *   \f$u_{i-1}\f$ is at `u[-stride]`. The returned values are the
  *   reconstructed solution on the lower and upper side of the cell.
  *
- * \note Currently the stride is always one because we transpose the data before
- * reconstruction. However, it may be faster to have a non-unit stride without
- * the transpose. We have the `stride` parameter in the reconstruction schemes
- * to make testing performance easier in the future.
+ * \note The data is transposed so that each stripe being reconstructed is
+ * contiguous in memory. Blocks of adjacent stripes are then interleaved point
+ * by point and reconstructed together, so `pointwise` is called with a stride
+ * equal to the number of stripes in a block and the loop over the stripes of
+ * a block can be vectorized by the compiler. The stripes left over after
+ * filling whole blocks are reconstructed one at a time with unit stride.
+ * `pointwise` must therefore work for any stride, and should avoid branches
+ * where possible so the loop over stripes stays vectorizable.
  *
  * Here is an ASCII illustration of the names of various quantities and where in
  * the cells they are:
@@ -5,7 +5,11 @@
 
 #include "NumericalAlgorithms/FiniteDifference/Reconstruct.hpp"
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
@@ -76,6 +80,106 @@ auto u_to_reconstruct_impl(const DataVector& volume_data,
   }
 }
 
+// The number of adjacent stripes that are reconstructed together by
+// `reconstruct_stripe_block`. Eight doubles fill one AVX-512 or two AVX2
+// registers.
+constexpr size_t stripe_block_width = 8;
+
+// Reconstructs the `stripe_block_width` adjacent stripes that start at
+// `first_stripe`.
+//
+// The stripes, including their ghost cells, are transposed into
+// `block_buffer` so that the values of all stripes of the block at a cell are
+// adjacent in memory. Each cell is then reconstructed for all stripes of the
+// block in a loop with unit stride over the stripes, calling the
+// `Reconstructor` with a stride of `stripe_block_width`. The compiler can
+// vectorize this loop across stripes, which it can't do along a single stripe
+// because neighboring cells share stencil points. The face values are
+// transposed back into `recons_upper` and `recons_lower`.
+//
+// The `block_buffer` must hold `(points_per_stripe + 2 * (ghost zone + 1) + 2
+// * (points_per_stripe + 2)) * stripe_block_width` doubles.
+template <bool ReturnReconstructionOrder, typename Reconstructor,
+          typename... ArgsForReconstructor>
+void reconstruct_stripe_block(
+    const gsl::not_null<gsl::span<double>*> recons_upper,
+    const gsl::not_null<gsl::span<double>*> recons_lower,
+    [[maybe_unused]] const gsl::not_null<gsl::span<std::uint8_t>*>
+        reconstruction_order,
+    const gsl::not_null<double*> block_buffer,
+    const gsl::span<const double>& volume_vars,
+    const gsl::span<const double>& lower_ghost_data,
+    const gsl::span<const double>& upper_ghost_data,
+    const size_t first_stripe, const size_t points_per_stripe,
+    [[maybe_unused]] const size_t number_of_stripes_per_variable,
+    const ArgsForReconstructor&... args_for_reconstructor) {
+  using std::get;
+  using std::min;
+  constexpr size_t width = stripe_block_width;
+  constexpr int stride = static_cast<int>(width);
+  constexpr size_t ghost_zone_for_stencil =
+      (Reconstructor::stencil_width() - 1) / 2;
+  constexpr size_t ghost_pts_in_neighbor_data = ghost_zone_for_stencil + 1;
+  // Cells -1 and `points_per_stripe` are the ghost cells adjacent to the
+  // element, which we reconstruct to get the neighbors' face values.
+  const size_t number_of_cells_to_reconstruct = points_per_stripe + 2;
+  double* const u = block_buffer.get();
+  double* const upper =
+      u + (points_per_stripe + 2 * ghost_pts_in_neighbor_data) * width;
+  double* const lower = upper + number_of_cells_to_reconstruct * width;
+
+  for (size_t lane = 0; lane < width; ++lane) {
+    const size_t stripe = first_stripe + lane;
+    for (size_t j = 0; j < ghost_pts_in_neighbor_data; ++j) {
+      u[j * width + lane] =
+          lower_ghost_data[stripe * ghost_pts_in_neighbor_data + j];
+      u[(ghost_pts_in_neighbor_data + points_per_stripe + j) * width + lane] =
+          upper_ghost_data[stripe * ghost_pts_in_neighbor_data + j];
+    }
+    for (size_t i = 0; i < points_per_stripe; ++i) {
+      u[(ghost_pts_in_neighbor_data + i) * width + lane] =
+          volume_vars[stripe * points_per_stripe + i];
+    }
+  }
+
+  // `cell` is offset by one so that the lower ghost cell is `cell == 0`. Its
+  // reconstructed value on the upper side of the lower face, and that of the
+  // upper ghost cell on the lower side of the upper face, are not needed but
+  // computing them keeps the loop over the stripes free of branches.
+  for (size_t cell = 0; cell < number_of_cells_to_reconstruct; ++cell) {
+    const double* const u_cell = u + (cell + ghost_zone_for_stencil) * width;
+    for (size_t lane = 0; lane < width; ++lane) {
+      const auto upper_lower_and_order =
+          Reconstructor::pointwise(u_cell + lane, stride,
+                                   args_for_reconstructor...);
+      upper[cell * width + lane] = get<0>(upper_lower_and_order);
+      lower[cell * width + lane] = get<1>(upper_lower_and_order);
+      if constexpr (ReturnReconstructionOrder and
+                    std::tuple_size<std::decay_t<
+                            decltype(upper_lower_and_order)>>::value > 2) {
+        std::uint8_t& order =
+            (*reconstruction_order)[((first_stripe + lane) %
+                                     number_of_stripes_per_variable) *
+                                        number_of_cells_to_reconstruct +
+                                    cell];
+        order =
+            min(static_cast<std::uint8_t>(get<2>(upper_lower_and_order)),
+                order);
+      }
+    }
+  }
+
+  for (size_t lane = 0; lane < width; ++lane) {
+    const size_t recons_stripe_offset =
+        (first_stripe + lane) * (points_per_stripe + 1);
+    for (size_t face = 0; face < points_per_stripe + 1; ++face) {
+      (*recons_upper)[recons_stripe_offset + face] =
+          upper[(face + 1) * width + lane];
+      (*recons_lower)[recons_stripe_offset + face] = lower[face * width + lane];
+    }
+  }
+}
+
 template <bool ReturnReconstructionOrder, typename Reconstructor, size_t Dim,
           typename... ArgsForReconstructor>
 void reconstruct_impl(
@@ -103,7 +207,6 @@ void reconstruct_impl(
       volume_extents.slice_away(0).product();
   const size_t number_of_stripes =
       number_of_stripes_per_variable * number_of_variables;
-  [[maybe_unused]] size_t recons_order_slice_offset = 0;
   if constexpr (ReturnReconstructionOrder) {
     ASSERT(reconstruction_order->size() ==
                (number_of_stripes_per_variable * (volume_extents[0] + 2)),
@@ -113,8 +216,34 @@ void reconstruct_impl(
                << reconstruction_order->size());
   }
 
+  ASSERT(volume_extents[0] >= stencil_width - 1,
+         " Subcell volume extent (current value: "
+             << volume_extents[0]
+             << ") must be not smaller than the stencil width (current value: "
+             << stencil_width << ") minus 1");
+
+  // Full blocks of adjacent stripes are reconstructed together so the
+  // compiler can vectorize across stripes. The remaining stripes are
+  // reconstructed one at a time below.
+  const size_t number_of_blocked_stripes =
+      number_of_stripes - number_of_stripes % stripe_block_width;
+  if (number_of_blocked_stripes > 0) {
+    DataVector block_buffer{
+        (3 * volume_extents[0] + 2 * ghost_pts_in_neighbor_data + 4) *
+        stripe_block_width};
+    for (size_t first_stripe = 0; first_stripe < number_of_blocked_stripes;
+         first_stripe += stripe_block_width) {
+      reconstruct_stripe_block<ReturnReconstructionOrder, Reconstructor>(
+          recons_upper, recons_lower, reconstruction_order,
+          make_not_null(block_buffer.data()), volume_vars, lower_ghost_data,
+          upper_ghost_data, first_stripe, volume_extents[0],
+          number_of_stripes_per_variable, args_for_reconstructor...);
+    }
+  }
+
   std::array<double, stencil_width> q{};
-  for (size_t slice = 0; slice < number_of_stripes; ++slice) {
+  for (size_t slice = number_of_blocked_stripes; slice < number_of_stripes;
+       ++slice) {
     const size_t vars_slice_offset = slice * volume_extents[0];
     const size_t vars_neighbor_slice_offset =
         slice * ghost_pts_in_neighbor_data;
@@ -122,10 +251,8 @@ void reconstruct_impl(
     // We use volume_extents + 2 because we need the order of the left and
     // right cells for adjusting the correction at the interface. This means
     // we include one neighbor on the upper and lower side.
-    recons_order_slice_offset =
-        slice % number_of_stripes_per_variable == 0
-            ? 0
-            : (recons_order_slice_offset + volume_extents[0] + 2);
+    [[maybe_unused]] const size_t recons_order_slice_offset =
+        (slice % number_of_stripes_per_variable) * (volume_extents[0] + 2);
     [[maybe_unused]] size_t recons_order_index = 0;
     const auto set_recons_order = [&reconstruction_order, &recons_order_index,
                                    recons_order_slice_offset](
@@ -217,13 +344,6 @@ void reconstruct_impl(
       //         c c c c | c
       //  c = points used for reconstruction
 
-      ASSERT(
-          volume_extents[0] >= stencil_width - 1,
-          " Subcell volume extent (current value: "
-              << volume_extents[0]
-              << ") must be not smaller than the stencil width (current value: "
-              << stencil_width << ") minus 1");
-
       size_t j = 0;
       for (size_t k =
                vars_slice_offset + volume_extents[0] - (stencil_width - 1 - i);
@@ -0,0 +1,400 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <pup.h>
+#include <pup_stl.h>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace intrp {
+
+/*!
+ * \brief Trilinear interpolation in a table with uniform spacing, optimized for
+ * large tables such as nuclear equations of state.
+ *
+ * \details The table owns its data. All `NumberOfVariables` tabulated
+ * variables of a node are stored next to each other, and the first coordinate
+ * varies fastest among the nodes. The value of variable `v` at node
+ * \f$(i, j, k)\f$ is therefore stored at index
+ * `v + NumberOfVariables * (i + n_0 * (j + n_1 * k))`, which is the same
+ * layout as `MultiLinearSpanInterpolation`. With this layout an interpolation
+ * reads all variables it needs from the eight nodes of a cell at once, instead
+ * of collecting the nodes again for every variable. Since the spacing is
+ * uniform (typically in the logarithm of the physical coordinates), the cell
+ * containing a point is computed directly from its coordinates without a
+ * search. Points are not checked against the table bounds. Points slightly
+ * outside the table (e.g. due to roundoff) are linearly extrapolated from the
+ * boundary cell.
+ *
+ * The table also inverts one variable, `inverted_variable`, with respect to
+ * the first coordinate, e.g. to compute the temperature from the specific
+ * internal energy at given density and electron fraction. The inverted variable
+ * must increase monotonically with the first coordinate. The trilinear
+ * interpolant is piecewise linear in the first coordinate, so the inversion is
+ * exact once the two nodes bracketing the value are known. To find them without
+ * a root find or a search, the table precomputes an inverse table for every
+ * column of nodes with fixed second and third coordinates: the values of the
+ * inverted variable in the column are binned uniformly, and each bin stores
+ * the node below its lower edge. The bracketing nodes of a point then follow
+ * from the bins of the four columns surrounding the point, usually after no
+ * more than a step or two along the column.
+ */
+template <size_t NumberOfVariables>
+class UniformTable3D {
+ public:
+  /// The cell containing a point, identified by the index of its lower node,
+  /// and the position of the point within the cell, normalized to \f$[0,1]\f$
+  /// in each dimension
+  struct Location {
+    size_t lower_node{};
+    std::array<double, 3> fraction{};
+  };
+
+  UniformTable3D() = default;
+
+  /// `lower_bounds` and `upper_bounds` are the coordinates of the first and
+  /// last nodes in each dimension, and `table_data` holds the variables in the
+  /// layout described above.
+  UniformTable3D(const std::array<double, 3>& lower_bounds,
+                 const std::array<double, 3>& upper_bounds,
+                 const Index<3>& extents, std::vector<double> table_data,
+                 size_t inverted_variable);
+
+  const Index<3>& extents() const { return extents_; }
+
+  double lower_bound(const size_t dimension) const {
+    return gsl::at(lower_bounds_, dimension);
+  }
+
+  double upper_bound(const size_t dimension) const {
+    return gsl::at(upper_bounds_, dimension);
+  }
+
+  const std::vector<double>& data() const { return data_; }
+
+  /// The cell containing the point with coordinates `x0`, `x1`, and `x2`
+  Location locate(double x0, double x1, double x2) const;
+
+  /// Interpolates the `Variables` to the `location`
+  template <size_t... Variables>
+  std::array<double, sizeof...(Variables)> interpolate(
+      const Location& location) const {
+    return {{interpolate_variable<Variables>(location)...}};
+  }
+
+  /// Interpolates the `Variable` to all points with coordinates `x0`, `x1`,
+  /// and `x2`
+  template <size_t Variable>
+  void interpolate(gsl::not_null<DataVector*> result, const DataVector& x0,
+                   const DataVector& x1, const DataVector& x2) const;
+
+  /// @{
+  /// The first coordinate at which the interpolated `inverted_variable` takes
+  /// the `value`, given the second and third coordinates. Values outside the
+  /// range of the column are clamped to its boundary.
+  double invert_first_coordinate(double value, double x1, double x2) const;
+
+  void invert_first_coordinate(gsl::not_null<DataVector*> result,
+                               const DataVector& value, const DataVector& x1,
+                               const DataVector& x2) const;
+  /// @}
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  template <size_t LocalNumberOfVariables>
+  // NOLINTNEXTLINE(readability-redundant-declaration)
+  friend bool operator==(const UniformTable3D<LocalNumberOfVariables>& lhs,
+                         const UniformTable3D<LocalNumberOfVariables>& rhs);
+
+  template <size_t Variable>
+  double interpolate_variable(const Location& location) const;
+
+  double inverted_variable_at(const size_t column, const size_t node) const {
+    return data_[inverted_variable_ +
+                 NumberOfVariables * (node + extents_[0] * column)];
+  }
+
+  // The largest node `i < n_0 - 1` in the `column` at which the inverted
+  // variable does not exceed the `value`, or zero if there is none
+  size_t bracketing_node(size_t column, double value) const;
+
+  void compute_derived_quantities();
+
+  std::array<double, 3> lower_bounds_{};
+  std::array<double, 3> upper_bounds_{};
+  Index<3> extents_{};
+  std::vector<double> data_{};
+  size_t inverted_variable_{0};
+
+  // Quantities derived from the above, recomputed when unpacking
+  std::array<double, 3> spacing_{};
+  std::array<double, 3> inverse_spacing_{};
+  // The inverse table. For each column it holds the lowest value of the
+  // inverted variable and the inverse width of the bins, and for each of the
+  // `n_0 - 1` bins of the column the node below the lower edge of the bin.
+  std::vector<double> column_lower_value_{};
+  std::vector<double> column_inverse_bin_width_{};
+  std::vector<size_t> bin_lower_node_{};
+};
+
+template <size_t NumberOfVariables>
+bool operator==(const UniformTable3D<NumberOfVariables>& lhs,
+                const UniformTable3D<NumberOfVariables>& rhs) {
+  return lhs.lower_bounds_ == rhs.lower_bounds_ and
+         lhs.upper_bounds_ == rhs.upper_bounds_ and
+         lhs.extents_ == rhs.extents_ and lhs.data_ == rhs.data_ and
+         lhs.inverted_variable_ == rhs.inverted_variable_;
+}
+
+template <size_t NumberOfVariables>
+bool operator!=(const UniformTable3D<NumberOfVariables>& lhs,
+                const UniformTable3D<NumberOfVariables>& rhs) {
+  return not(lhs == rhs);
+}
+
+template <size_t NumberOfVariables>
+UniformTable3D<NumberOfVariables>::UniformTable3D(
+    const std::array<double, 3>& lower_bounds,
+    const std::array<double, 3>& upper_bounds, const Index<3>& extents,
+    std::vector<double> table_data, const size_t inverted_variable)
+    : lower_bounds_(lower_bounds),
+      upper_bounds_(upper_bounds),
+      extents_(extents),
+      data_(std::move(table_data)),
+      inverted_variable_(inverted_variable) {
+  ASSERT(data_.size() == NumberOfVariables * extents_.product(),
+         "Expected " << NumberOfVariables * extents_.product()
+                     << " table entries but got " << data_.size());
+  ASSERT(inverted_variable_ < NumberOfVariables,
+         "Can't invert variable " << inverted_variable_ << " of a table with "
+                                  << NumberOfVariables << " variables.");
+  compute_derived_quantities();
+}
+
+template <size_t NumberOfVariables>
+void UniformTable3D<NumberOfVariables>::compute_derived_quantities() {
+  for (size_t d = 0; d < 3; ++d) {
+    ASSERT(extents_[d] > 1 and gsl::at(upper_bounds_, d) >
+                                   gsl::at(lower_bounds_, d),
+           "The table needs at least two nodes and increasing coordinates in "
+           "every dimension, but dimension "
+               << d << " has " << extents_[d] << " nodes between "
+               << gsl::at(lower_bounds_, d) << " and "
+               << gsl::at(upper_bounds_, d));
+    gsl::at(spacing_, d) =
+        (gsl::at(upper_bounds_, d) - gsl::at(lower_bounds_, d)) /
+        static_cast<double>(extents_[d] - 1);
+    gsl::at(inverse_spacing_, d) = 1.0 / gsl::at(spacing_, d);
+  }
+
+  const size_t number_of_columns = extents_[1] * extents_[2];
+  const size_t number_of_bins = extents_[0] - 1;
+  column_lower_value_.resize(number_of_columns);
+  column_inverse_bin_width_.resize(number_of_columns);
+  bin_lower_node_.resize(number_of_columns * number_of_bins);
+  for (size_t column = 0; column < number_of_columns; ++column) {
+    const double lower_value = inverted_variable_at(column, 0);
+    const double upper_value = inverted_variable_at(column, extents_[0] - 1);
+    column_lower_value_[column] = lower_value;
+    if (not(upper_value > lower_value)) {
+      // Not monotonic, so every lookup walks the column from the first node
+      column_inverse_bin_width_[column] = 0.0;
+      std::fill(bin_lower_node_.begin() +
+                    static_cast<std::ptrdiff_t>(column * number_of_bins),
+                bin_lower_node_.begin() +
+                    static_cast<std::ptrdiff_t>((column + 1) * number_of_bins),
+                size_t{0});
+      continue;
+    }
+    const double bin_width =
+        (upper_value - lower_value) / static_cast<double>(number_of_bins);
+    column_inverse_bin_width_[column] = 1.0 / bin_width;
+    size_t node = 0;
+    for (size_t bin = 0; bin < number_of_bins; ++bin) {
+      const double bin_lower_edge =
+          lower_value + static_cast<double>(bin) * bin_width;
+      while (node + 2 < extents_[0] and
+             inverted_variable_at(column, node + 1) <= bin_lower_edge) {
+        ++node;
+      }
+      bin_lower_node_[column * number_of_bins + bin] = node;
+    }
+  }
+}
+
+template <size_t NumberOfVariables>
+auto UniformTable3D<NumberOfVariables>::locate(const double x0,
+                                               const double x1,
+                                               const double x2) const
+    -> Location {
+  const std::array<double, 3> x{{x0, x1, x2}};
+  std::array<size_t, 3> lower_index{};
+  Location location{};
+  for (size_t d = 0; d < 3; ++d) {
+    const double relative_coordinate =
+        (gsl::at(x, d) - gsl::at(lower_bounds_, d)) *
+        gsl::at(inverse_spacing_, d);
+    // Clamp to the boundary cells. Comparing before converting also handles
+    // points below the table.
+    gsl::at(lower_index, d) =
+        relative_coordinate <= 0.0
+            ? 0
+            : std::min(static_cast<size_t>(relative_coordinate),
+                       extents_[d] - 2);
+    gsl::at(location.fraction, d) =
+        relative_coordinate - static_cast<double>(gsl::at(lower_index, d));
+  }
+  location.lower_node =
+      lower_index[0] +
+      extents_[0] * (lower_index[1] + extents_[1] * lower_index[2]);
+  return location;
+}
+
+template <size_t NumberOfVariables>
+template <size_t Variable>
+double UniformTable3D<NumberOfVariables>::interpolate_variable(
+    const Location& location) const {
+  static_assert(Variable < NumberOfVariables,
+                "Trying to interpolate a variable the table doesn't hold.");
+  const size_t stride_1 = NumberOfVariables * extents_[0];
+  const size_t stride_2 = stride_1 * extents_[1];
+  const double* const node_000 =
+      data_.data() + NumberOfVariables * location.lower_node + Variable;
+  const double* const node_010 = node_000 + stride_1;
+  const double* const node_001 = node_000 + stride_2;
+  const double* const node_011 = node_001 + stride_1;
+  const auto& [f0, f1, f2] = location.fraction;
+  // Interpolate along the first, then the second, then the third dimension
+  const double value_00 =
+      node_000[0] + f0 * (node_000[NumberOfVariables] - node_000[0]);
+  const double value_10 =
+      node_010[0] + f0 * (node_010[NumberOfVariables] - node_010[0]);
+  const double value_01 =
+      node_001[0] + f0 * (node_001[NumberOfVariables] - node_001[0]);
+  const double value_11 =
+      node_011[0] + f0 * (node_011[NumberOfVariables] - node_011[0]);
+  const double value_0 = value_00 + f1 * (value_10 - value_00);
+  const double value_1 = value_01 + f1 * (value_11 - value_01);
+  return value_0 + f2 * (value_1 - value_0);
+}
+
+template <size_t NumberOfVariables>
+template <size_t Variable>
+void UniformTable3D<NumberOfVariables>::interpolate(
+    const gsl::not_null<DataVector*> result, const DataVector& x0,
+    const DataVector& x1, const DataVector& x2) const {
+  ASSERT(x1.size() == x0.size() and x2.size() == x0.size(),
+         "The coordinates must have the same number of points.");
+  result->destructive_resize(x0.size());
+  for (size_t s = 0; s < x0.size(); ++s) {
+    (*result)[s] = interpolate_variable<Variable>(locate(x0[s], x1[s], x2[s]));
+  }
+}
+
+template <size_t NumberOfVariables>
+size_t UniformTable3D<NumberOfVariables>::bracketing_node(
+    const size_t column, const double value) const {
+  const size_t number_of_bins = extents_[0] - 1;
+  const double relative_value =
+      (value - column_lower_value_[column]) * column_inverse_bin_width_[column];
+  const size_t bin =
+      relative_value <= 0.0
+          ? 0
+          : std::min(static_cast<size_t>(relative_value), number_of_bins - 1);
+  size_t node = bin_lower_node_[column * number_of_bins + bin];
+  while (node + 2 < extents_[0] and
+         inverted_variable_at(column, node + 1) <= value) {
+    ++node;
+  }
+  return node;
+}
+
+template <size_t NumberOfVariables>
+double UniformTable3D<NumberOfVariables>::invert_first_coordinate(
+    const double value, const double x1, const double x2) const {
+  const Location location = locate(lower_bounds_[0], x1, x2);
+  const size_t column_00 = location.lower_node / extents_[0];
+  const size_t column_10 = column_00 + 1;
+  const size_t column_01 = column_00 + extents_[1];
+  const size_t column_11 = column_01 + 1;
+  const double f1 = location.fraction[1];
+  const double f2 = location.fraction[2];
+  // The interpolated inverted variable at a node along the first dimension
+  const auto interpolated_value = [this, column_00, column_10, column_01,
+                                   column_11, f1, f2](const size_t node) {
+    const double value_0 =
+        inverted_variable_at(column_00, node) +
+        f1 * (inverted_variable_at(column_10, node) -
+              inverted_variable_at(column_00, node));
+    const double value_1 =
+        inverted_variable_at(column_01, node) +
+        f1 * (inverted_variable_at(column_11, node) -
+              inverted_variable_at(column_01, node));
+    return value_0 + f2 * (value_1 - value_0);
+  };
+
+  // The interpolated value is a weighted average of the values in the four
+  // columns, so for a monotonic variable the bracketing node can't be below
+  // the lowest bracketing node of the columns. Stepping down as well guards
+  // against roundoff in the bin lookup.
+  size_t node = std::min(
+      {bracketing_node(column_00, value), bracketing_node(column_10, value),
+       bracketing_node(column_01, value), bracketing_node(column_11, value)});
+  double lower_value = interpolated_value(node);
+  double upper_value = interpolated_value(node + 1);
+  while (node + 2 < extents_[0] and upper_value <= value) {
+    ++node;
+    lower_value = upper_value;
+    upper_value = interpolated_value(node + 1);
+  }
+  while (node > 0 and lower_value > value) {
+    --node;
+    upper_value = lower_value;
+    lower_value = interpolated_value(node);
+  }
+  const double fraction =
+      upper_value > lower_value
+          ? std::clamp((value - lower_value) / (upper_value - lower_value),
+                       0.0, 1.0)
+          : 0.0;
+  return lower_bounds_[0] +
+         (static_cast<double>(node) + fraction) * spacing_[0];
+}
+
+template <size_t NumberOfVariables>
+void UniformTable3D<NumberOfVariables>::invert_first_coordinate(
+    const gsl::not_null<DataVector*> result, const DataVector& value,
+    const DataVector& x1, const DataVector& x2) const {
+  ASSERT(x1.size() == value.size() and x2.size() == value.size(),
+         "The values and coordinates must have the same number of points.");
+  result->destructive_resize(value.size());
+  for (size_t s = 0; s < value.size(); ++s) {
+    (*result)[s] = invert_first_coordinate(value[s], x1[s], x2[s]);
+  }
+}
+
+template <size_t NumberOfVariables>
+void UniformTable3D<NumberOfVariables>::pup(PUP::er& p) {
+  p | lower_bounds_;
+  p | upper_bounds_;
+  p | extents_;
+  p | data_;
+  p | inverted_variable_;
+  if (p.isUnpacking() and not data_.empty()) {
+    compute_derived_quantities();
+  }
+}
+}  // namespace intrp
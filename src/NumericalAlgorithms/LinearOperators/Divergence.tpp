@@ -9,6 +9,7 @@
 #include "DataStructures/Variables.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/MemoryPool.hpp"
 #include "Utilities/StdArrayHelpers.hpp"
 
 template <typename FluxTags, size_t Dim, typename DerivativeFrame>
@@ -38,8 +39,9 @@ void divergence(
   const size_t vars_size =
       Variables<DerivativeTags>::number_of_independent_components *
       F.number_of_grid_points();
-  const auto logical_derivs_data = cpp20::make_unique_for_overwrite<double[]>(
-      (Dim > 1 ? (Dim + 2) : Dim) * vars_size);
+  const auto logical_derivs_data =
+      memory_pool::make_unique_for_overwrite<double>(
+          (Dim > 1 ? (Dim + 2) : Dim) * vars_size);
   std::array<double*, Dim> logical_derivs{};
   std::array<Variables<DerivativeTags>, Dim> logical_partial_derivatives_of_F{};
   for (size_t i = 0; i < Dim; ++i) {
@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <functional>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
@@ -40,6 +41,120 @@ void apply_matrix_in_first_dim(double* result, const double* const input,
 }
 }  // namespace
 
+namespace partial_derivatives_detail {
+namespace {
+// The kernels are instantiated for every extent a spectral mesh can have.
+// Meshes with more points per dimension, e.g. finite-difference meshes, fall
+// back to the BLAS-based implementation.
+constexpr size_t fixed_extent_min_points = 1;
+constexpr size_t fixed_extent_max_points =
+    Spectral::maximum_number_of_points<Spectral::Basis::Legendre>;
+
+using FixedExtentKernel = void (*)(double*, const double*, const Matrix&,
+                                   size_t, size_t);
+
+// Applies the `Extent x Extent` `matrix` along the dimension of `input` whose
+// grid points are `stride` apart, i.e. `stride` is the product of the extents
+// of all faster-varying dimensions. `number_of_blocks` is the number of
+// contiguous blocks of `Extent * stride` values, i.e. the product of the
+// extents of all slower-varying dimensions and the number of components.
+template <size_t Extent>
+void apply_fixed_extent_matrix(double* const result, const double* const input,
+                               const Matrix& matrix, const size_t stride,
+                               const size_t number_of_blocks) {
+  // Copy the matrix into a row-major array of compile-time size so the
+  // contractions below can be fully unrolled with the matrix in registers.
+  std::array<double, Extent * Extent> m{};
+  for (size_t i = 0; i < Extent; ++i) {
+    for (size_t j = 0; j < Extent; ++j) {
+      gsl::at(m, i * Extent + j) = matrix(i, j);
+    }
+  }
+  if (stride == 1) {
+    for (size_t block = 0; block < number_of_blocks; ++block) {
+      const double* const in = input + block * Extent;  // NOLINT
+      double* const out = result + block * Extent;  // NOLINT
+      for (size_t i = 0; i < Extent; ++i) {
+        double sum = gsl::at(m, i * Extent) * in[0];  // NOLINT
+        for (size_t j = 1; j < Extent; ++j) {
+          sum += gsl::at(m, i * Extent + j) * in[j];  // NOLINT
+        }
+        out[i] = sum;  // NOLINT
+      }
+    }
+    return;
+  }
+  // For the slower-varying dimensions each of the `stride` points in a line is
+  // independent, so we sweep over contiguous lines of `stride` points. This
+  // keeps the innermost loop unit-stride so it vectorizes, and avoids the
+  // transposes needed to apply the matrix with a single BLAS call.
+  const size_t block_size = Extent * stride;
+  for (size_t block = 0; block < number_of_blocks; ++block) {
+    const double* const in = input + block * block_size;  // NOLINT
+    double* const out = result + block * block_size;  // NOLINT
+    for (size_t i = 0; i < Extent; ++i) {
+      double* const out_line = out + i * stride;  // NOLINT
+      const double m_i0 = gsl::at(m, i * Extent);
+      for (size_t k = 0; k < stride; ++k) {
+        out_line[k] = m_i0 * in[k];  // NOLINT
+      }
+      for (size_t j = 1; j < Extent; ++j) {
+        const double m_ij = gsl::at(m, i * Extent + j);
+        const double* const in_line = in + j * stride;  // NOLINT
+        for (size_t k = 0; k < stride; ++k) {
+          out_line[k] += m_ij * in_line[k];  // NOLINT
+        }
+      }
+    }
+  }
+}
+
+template <size_t... Is>
+constexpr std::array<FixedExtentKernel, sizeof...(Is)>
+make_fixed_extent_kernels(std::index_sequence<Is...> /*meta*/) {
+  return {{&apply_fixed_extent_matrix<Is + fixed_extent_min_points>...}};
+}
+
+constexpr std::array fixed_extent_kernels = make_fixed_extent_kernels(
+    std::make_index_sequence<fixed_extent_max_points -
+                             fixed_extent_min_points + 1>{});
+}  // namespace
+
+template <size_t Dim>
+bool fixed_extent_logical_partial_derivatives(
+    const gsl::not_null<std::array<double*, Dim>*> logical_du,
+    const double* const u, const size_t number_of_components,
+    const Mesh<Dim>& mesh) {
+  for (size_t d = 0; d < Dim; ++d) {
+    if (mesh.extents(d) < fixed_extent_min_points or
+        mesh.extents(d) > fixed_extent_max_points) {
+      return false;
+    }
+  }
+  const size_t total_size = number_of_components * mesh.number_of_grid_points();
+  size_t stride = 1;
+  for (size_t d = 0; d < Dim; ++d) {
+    const size_t extent = mesh.extents(d);
+    gsl::at(fixed_extent_kernels, extent - fixed_extent_min_points)(
+        gsl::at(*logical_du, d), u,
+        Spectral::differentiation_matrix(mesh.slice_through(d)), stride,
+        total_size / (extent * stride));
+    stride *= extent;
+  }
+  return true;
+}
+
+template bool fixed_extent_logical_partial_derivatives(
+    gsl::not_null<std::array<double*, 1>*> logical_du, const double* u,
+    size_t number_of_components, const Mesh<1>& mesh);
+template bool fixed_extent_logical_partial_derivatives(
+    gsl::not_null<std::array<double*, 2>*> logical_du, const double* u,
+    size_t number_of_components, const Mesh<2>& mesh);
+template bool fixed_extent_logical_partial_derivatives(
+    gsl::not_null<std::array<double*, 3>*> logical_du, const double* u,
+    size_t number_of_components, const Mesh<3>& mesh);
+}  // namespace partial_derivatives_detail
+
 template <typename SymmList, typename IndexList, size_t Dim>
 void logical_partial_derivative(
     const gsl::not_null<TensorMetafunctions::prepend_spatial_index<
@@ -71,6 +186,16 @@ void logical_partial_derivative(
   // would also need to be the size of all components.
   for (size_t storage_index = 0; storage_index < u.size(); ++storage_index) {
     const auto u_tensor_index = u.get_tensor_index(storage_index);
+    std::array<double*, Dim> deriv_pointers{};
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(deriv_pointers, d) =
+          logical_derivative_of_u->get(prepend(u_tensor_index, d)).data();
+    }
+    if (partial_derivatives_detail::fixed_extent_logical_partial_derivatives(
+            make_not_null(&deriv_pointers), u[storage_index].data(), 1,
+            mesh)) {
+      continue;
+    }
     const auto xi_deriv_tensor_index = prepend(u_tensor_index, 0_st);
     apply_matrix_in_first_dim(
         logical_derivative_of_u->get(xi_deriv_tensor_index).data(),
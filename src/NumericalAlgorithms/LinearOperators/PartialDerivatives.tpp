@@ -25,6 +25,19 @@ namespace partial_derivatives_detail {
 template <size_t Dim, typename VariableTags, typename DerivativeTags>
 struct LogicalImpl;
 
+// Computes the logical derivatives of the `number_of_components` components
+// stored contiguously at `u` using sum-factorized kernels that are specialized
+// on the number of grid points in each dimension. The derivative along each
+// dimension is applied directly to the strided data so no transposes are
+// needed, and the innermost loops run over contiguous grid points so they
+// vectorize. Returns `false` without touching `logical_du` if no kernel is
+// instantiated for the extents of `mesh`, in which case the caller must fall
+// back to the BLAS-based implementation.
+template <size_t Dim>
+bool fixed_extent_logical_partial_derivatives(
+    gsl::not_null<std::array<double*, Dim>*> logical_du, const double* u,
+    size_t number_of_components, const Mesh<Dim>& mesh);
+
 // This routine has been optimized to perform really well. The following
 // describes what optimizations were made.
 //
@@ -255,6 +268,12 @@ struct LogicalImpl<1, VariableTags, DerivativeTags> {
                     Variables<T>* /*unused_in_1d*/,
                     Variables<DerivativeTags>* const /*unused_in_1d*/,
                     const Variables<VariableTags>& u, const Mesh<Dim>& mesh) {
+    if (fixed_extent_logical_partial_derivatives(
+            logical_du, u.data(),
+            Variables<DerivativeTags>::number_of_independent_components,
+            mesh)) {
+      return;
+    }
     auto& logical_partial_derivatives_of_u = *logical_du;
     const size_t deriv_size =
         Variables<DerivativeTags>::number_of_independent_components *
@@ -280,6 +299,12 @@ struct LogicalImpl<2, VariableTags, DerivativeTags> {
         Variables<DerivativeTags>::number_of_independent_components <=
             Variables<T>::number_of_independent_components,
         "Temporary buffer in logical partial derivatives is too small");
+    if (fixed_extent_logical_partial_derivatives(
+            logical_du, u.data(),
+            Variables<DerivativeTags>::number_of_independent_components,
+            mesh)) {
+      return;
+    }
     auto& logical_partial_derivatives_of_u = *logical_du;
     const size_t deriv_size =
         Variables<DerivativeTags>::number_of_independent_components *
@@ -321,6 +346,12 @@ struct LogicalImpl<3, VariableTags, DerivativeTags> {
         Variables<DerivativeTags>::number_of_independent_components <=
             Variables<T>::number_of_independent_components,
         "Temporary buffer in logical partial derivatives is too small");
+    if (fixed_extent_logical_partial_derivatives(
+            logical_du, u.data(),
+            Variables<DerivativeTags>::number_of_independent_components,
+            mesh)) {
+      return;
+    }
     auto& logical_partial_derivatives_of_u = *logical_du;
     const Matrix& differentiation_matrix_xi =
         Spectral::differentiation_matrix(mesh.slice_through(0));
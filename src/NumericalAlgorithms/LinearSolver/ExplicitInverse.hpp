@@ -15,6 +15,7 @@
 #include "NumericalAlgorithms/LinearSolver/LinearSolver.hpp"
 #include "Options/Options.hpp"
 #include "Parallel/CharmPupable.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
@@ -65,6 +66,18 @@ using ExplicitInverse = Registration::Registrar<Serial::ExplicitInverse>;
  *   operator only changes "a little". In that case the preconditioner solves
  *   subdomain problems only approximately, but possibly still sufficiently to
  *   provide effective preconditioning.
+ * - When this solver is used as a preconditioner, e.g. to solve the subdomain
+ *   problems of a Schwarz preconditioner, consider enabling the
+ *   `SinglePrecision` option. The matrix is then built and inverted in double
+ *   precision but stored and applied in single precision. The double-precision
+ *   matrix only exists while the inverse is built and is released once it is
+ *   rounded to single precision. This halves the memory needed to store the
+ *   matrix and the memory traffic of each solve, which dominates the cost of
+ *   applying it. The result of each solve is only accurate to single
+ *   precision, so only use this option when the solver preconditions a solver
+ *   that works in double precision (such as the elliptic Krylov and
+ *   Newton-Raphson solvers), so the precision of the converged solution is
+ *   unaffected.
  */
 template <typename LinearSolverRegistrars =
               tmpl::list<Registrars::ExplicitInverse>>
@@ -73,12 +86,31 @@ class ExplicitInverse : public LinearSolver<LinearSolverRegistrars> {
   using Base = LinearSolver<LinearSolverRegistrars>;
 
  public:
-  using options = tmpl::list<>;
+  /// Store and apply the inverse in single precision.
+  ///
+  /// \note Single precision is only available for this solver. Other parts of
+  /// the preconditioner, such as multigrid smoothers, the Schwarz subdomain
+  /// operator and the other subdomain solvers, still work in double precision.
+  struct SinglePrecision {
+    using type = bool;
+    static constexpr Options::String help =
+        "Store and apply the inverse in single precision. This halves the "
+        "memory and memory bandwidth the solver needs, but solves are only "
+        "accurate to single precision. Only enable when this solver is used "
+        "as a preconditioner. Only the stored inverse of this solver is "
+        "affected, the inverse is still built in double precision. Multigrid "
+        "smoothers and other subdomain solvers stay in double precision.";
+  };
+
+  using options = tmpl::list<SinglePrecision>;
   static constexpr Options::String help =
       "Build a matrix representation of the linear operator and invert it "
       "directly. This means that the first solve has a large initialization "
       "cost, but all subsequent solves converge immediately.";
 
+  explicit ExplicitInverse(bool single_precision)
+      : single_precision_(single_precision) {}
+
   ExplicitInverse() = default;
   ExplicitInverse(const ExplicitInverse& /*rhs*/) = default;
   ExplicitInverse& operator=(const ExplicitInverse& /*rhs*/) = default;
@@ -114,27 +146,52 @@ class ExplicitInverse : public LinearSolver<LinearSolverRegistrars> {
       const SourceType& source,
       const std::tuple<OperatorArgs...>& operator_args = std::tuple{}) const;
 
-  /// Flags the operator to require re-initialization. No memory is released.
-  /// Call this function to rebuild the solver when the operator changed.
+  /// Flags the operator to require re-initialization. No memory is released
+  /// until the solver is rebuilt. Call this function to rebuild the solver when
+  /// the operator changed.
   void reset() override { size_ = std::numeric_limits<size_t>::max(); }
 
   /// Size of the operator. The stored matrix will have `size^2` entries.
   size_t size() const { return size_; }
 
+  /// Whether the inverse is stored and applied in single precision
+  bool single_precision() const { return single_precision_; }
+
   /// The matrix representation of the solver. This matrix approximates the
-  /// inverse of the subdomain operator.
+  /// inverse of the subdomain operator. Only available if the solver is not
+  /// in `single_precision()` mode.
   const blaze::DynamicMatrix<double, blaze::columnMajor>&
   matrix_representation() const {
+    ASSERT(not single_precision_,
+           "The double-precision matrix representation is not stored when the "
+           "solver is in single-precision mode. Use "
+           "'single_precision_matrix_representation()' instead.");
     return inverse_;
   }
 
+  /// The matrix representation of the solver in `single_precision()` mode
+  const blaze::DynamicMatrix<float, blaze::columnMajor>&
+  single_precision_matrix_representation() const {
+    ASSERT(single_precision_,
+           "The single-precision matrix representation is only stored when "
+           "the solver is in single-precision mode.");
+    return single_precision_inverse_;
+  }
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) override {
+    p | single_precision_;
     p | size_;
     p | inverse_;
+    p | single_precision_inverse_;
     if (p.isUnpacking() and size_ != std::numeric_limits<size_t>::max()) {
-      source_workspace_.resize(size_);
-      solution_workspace_.resize(size_);
+      if (single_precision_) {
+        single_precision_source_workspace_.resize(size_);
+        single_precision_solution_workspace_.resize(size_);
+      } else {
+        source_workspace_.resize(size_);
+        solution_workspace_.resize(size_);
+      }
     }
   }
 
@@ -143,19 +200,28 @@ class ExplicitInverse : public LinearSolver<LinearSolverRegistrars> {
   }
 
  private:
+  bool single_precision_ = false;
   // Caches for successive solves of the same operator
   // NOLINTNEXTLINE(spectre-mutable)
   mutable size_t size_ = std::numeric_limits<size_t>::max();
   // We currently store the matrix representation in a dense matrix because
-  // Blaze doesn't support the inversion of sparse matrices (yet).
+  // Blaze doesn't support the inversion of sparse matrices (yet). Only one of
+  // these is non-empty, depending on `single_precision_`.
   // NOLINTNEXTLINE(spectre-mutable)
   mutable blaze::DynamicMatrix<double, blaze::columnMajor> inverse_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable blaze::DynamicMatrix<float, blaze::columnMajor>
+      single_precision_inverse_{};
 
   // Buffers to avoid re-allocating memory for applying the operator
   // NOLINTNEXTLINE(spectre-mutable)
   mutable blaze::DynamicVector<double> source_workspace_{};
   // NOLINTNEXTLINE(spectre-mutable)
   mutable blaze::DynamicVector<double> solution_workspace_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable blaze::DynamicVector<float> single_precision_source_workspace_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable blaze::DynamicVector<float> single_precision_solution_workspace_{};
 };
 
 template <typename LinearSolverRegistrars>
@@ -168,8 +234,12 @@ Convergence::HasConverged ExplicitInverse<LinearSolverRegistrars>::solve(
   if (UNLIKELY(size_ == std::numeric_limits<size_t>::max())) {
     const auto& used_for_size = source;
     size_ = used_for_size.size();
-    source_workspace_.resize(size_);
-    solution_workspace_.resize(size_);
+    if (single_precision_) {
+      // Release the single-precision inverse of a previous operator before
+      // building the double-precision matrix, so they don't coexist
+      single_precision_inverse_ =
+          blaze::DynamicMatrix<float, blaze::columnMajor>{};
+    }
     inverse_.resize(size_, size_);
     // Construct explicit matrix representation by "sniffing out" the operator,
     // i.e. feeding it unit vectors
@@ -184,11 +254,32 @@ Convergence::HasConverged ExplicitInverse<LinearSolverRegistrars>::solve(
       ERROR("Could not invert subdomain matrix (size " << size_
                                                        << "): " << e.what());
     }
+    if (single_precision_) {
+      // Round the inverse to single precision and release the memory of the
+      // double-precision matrix
+      single_precision_inverse_ = inverse_;
+      inverse_ = blaze::DynamicMatrix<double, blaze::columnMajor>{};
+      single_precision_source_workspace_.resize(size_);
+      single_precision_solution_workspace_.resize(size_);
+    } else {
+      source_workspace_.resize(size_);
+      solution_workspace_.resize(size_);
+    }
   }
   // Copy source into contiguous workspace. In cases where the source and
   // solution data are already stored contiguously we might avoid the copy and
   // the associated workspace memory. However, compared to the cost of building
   // and storing the matrix this is likely insignificant.
+  if (single_precision_) {
+    // The copies convert between double and single precision
+    std::copy(source.begin(), source.end(),
+              single_precision_source_workspace_.begin());
+    single_precision_solution_workspace_ =
+        single_precision_inverse_ * single_precision_source_workspace_;
+    std::copy(single_precision_solution_workspace_.begin(),
+              single_precision_solution_workspace_.end(), solution->begin());
+    return {0, 0};
+  }
   std::copy(source.begin(), source.end(), source_workspace_.begin());
   // Apply inverse
   solution_workspace_ = inverse_ * source_workspace_;
@@ -0,0 +1,57 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "NumericalAlgorithms/LinearSolver/Orthogonalization.hpp"
+
+#include <ostream>
+#include <string>
+
+#include "Options/Options.hpp"
+#include "Options/ParseOptions.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/GetOutput.hpp"
+
+namespace LinearSolver {
+
+std::ostream& operator<<(std::ostream& os,
+                         const Orthogonalization& orthogonalization) {
+  switch (orthogonalization) {
+    case Orthogonalization::ModifiedGramSchmidt:
+      return os << "ModifiedGramSchmidt";
+    case Orthogonalization::ClassicalGramSchmidt:
+      return os << "ClassicalGramSchmidt";
+    case Orthogonalization::Pipelined:
+      return os << "Pipelined";
+    default:
+      ERROR("Unknown orthogonalization scheme");
+  }
+}
+
+}  // namespace LinearSolver
+
+template <>
+LinearSolver::Orthogonalization
+Options::create_from_yaml<LinearSolver::Orthogonalization>::create<void>(
+    const Options::Option& options) {
+  const auto type_read = options.parse_as<std::string>();
+  for (const auto orthogonalization :
+       {LinearSolver::Orthogonalization::ModifiedGramSchmidt,
+        LinearSolver::Orthogonalization::ClassicalGramSchmidt,
+        LinearSolver::Orthogonalization::Pipelined}) {
+    if (type_read == get_output(orthogonalization)) {
+      return orthogonalization;
+    }
+  }
+  PARSE_ERROR(options.context(),
+              "Failed to convert \""
+                  << type_read
+                  << "\" to LinearSolver::Orthogonalization. Must be one of '"
+                  << get_output(
+                         LinearSolver::Orthogonalization::ModifiedGramSchmidt)
+                  << "', '"
+                  << get_output(
+                         LinearSolver::Orthogonalization::ClassicalGramSchmidt)
+                  << "' or '"
+                  << get_output(LinearSolver::Orthogonalization::Pipelined)
+                  << "'.");
+}
@@ -0,0 +1,63 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <iosfwd>
+
+/// \cond
+namespace Options {
+class Option;
+template <typename T>
+struct create_from_yaml;
+}  // namespace Options
+/// \endcond
+
+namespace LinearSolver {
+
+/*!
+ * \brief How a Krylov-subspace solver orthogonalizes new basis vectors against
+ * the previous ones.
+ *
+ * The schemes differ mainly in the number of global reductions they need per
+ * iteration, which is what limits the scaling of a distributed solver.
+ *
+ * \see LinearSolver::gmres::Gmres
+ */
+enum class Orthogonalization {
+  /// Modified Gram-Schmidt: Subtract the projection on each previous basis
+  /// vector in turn. Needs one reduction per basis vector, so the number of
+  /// reductions grows linearly with the iterations.
+  ModifiedGramSchmidt,
+  /// Classical Gram-Schmidt with reorthogonalization: Compute the projections
+  /// on all previous basis vectors and the norm of the new vector in a single
+  /// reduction. A second pass is performed only if the new vector loses more
+  /// than half of its norm to the projections ("twice is enough", see
+  /// \cite Giraud2005), so one or two reductions are needed per iteration.
+  ClassicalGramSchmidt,
+  /// Pipelined classical Gram-Schmidt: Like `ClassicalGramSchmidt`, but
+  /// overlaps the reduction with the next application of the operator (see
+  /// \cite Ghysels2013). The norm of the new vector is computed from the
+  /// Pythagorean identity without reorthogonalization, so this scheme is less
+  /// stable and may stagnate earlier than the others. It does not support
+  /// preconditioning.
+  Pipelined
+};
+
+std::ostream& operator<<(std::ostream& os,
+                         const Orthogonalization& orthogonalization);
+
+}  // namespace LinearSolver
+
+template <>
+struct Options::create_from_yaml<LinearSolver::Orthogonalization> {
+  template <typename Metavariables>
+  static LinearSolver::Orthogonalization create(
+      const Options::Option& options) {
+    return create<void>(options);
+  }
+};
+template <>
+LinearSolver::Orthogonalization
+Options::create_from_yaml<LinearSolver::Orthogonalization>::create<void>(
+    const Options::Option& options);
@@ -3,12 +3,15 @@
 
 #include "NumericalAlgorithms/Spectral/SwshTransform.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/ComplexModalVector.hpp"
 #include "DataStructures/SpinWeighted.hpp"  // IWYU pragma: keep
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/ThreadPool.hpp"
 
 // IWYU pragma: no_forward_declare SpinWeighted
 
@@ -67,37 +70,39 @@ void execute_libsharp_transform_set(
   // libsharp considers two arrays per transform when spin is not zero.
   const size_t number_of_arrays_per_transform = (spin == 0 ? 1 : 2);
   // libsharp has an internal flag for the maximum number of transforms, so if
-  // we have more than max_libsharp_transforms, we have to do them in chunks
-  // of max_libsharp_transforms.
-  for (size_t transform_block = 0;
-       transform_block <
-       (num_transforms + max_libsharp_transforms - 1) / max_libsharp_transforms;
-       ++transform_block) {
-    if (transform_block < (num_transforms / max_libsharp_transforms)) {
-      // clang-tidy cppcoreguidelines-pro-bounds-pointer-arithmetic
-      sharp_execute(jobtype, abs(spin),
-                    coefficient_data->data() +  // NOLINT
-                        number_of_arrays_per_transform *
-                            max_libsharp_transforms * transform_block,
-                    collocation_data->data() +  // NOLINT
-                        number_of_arrays_per_transform *
-                            max_libsharp_transforms * transform_block,
-                    collocation_metadata->get_sharp_geom_info(), alm_info,
-                    max_libsharp_transforms, SHARP_DP, nullptr, nullptr);
-    } else {
-      // clang-tidy cppcoreguidelines-pro-bounds-pointer-arithmetic
-      sharp_execute(jobtype, abs(spin),
-                    coefficient_data->data() +  // NOLINT
-                        number_of_arrays_per_transform *
-                            max_libsharp_transforms * transform_block,
-                    collocation_data->data() +  // NOLINT
-                        number_of_arrays_per_transform *
-                            max_libsharp_transforms * transform_block,
-                    collocation_metadata->get_sharp_geom_info(), alm_info,
-                    num_transforms % max_libsharp_transforms, SHARP_DP, nullptr,
-                    nullptr);
-    }
-  }
+  // we have more than max_libsharp_transforms, we have to do them in blocks of
+  // at most max_libsharp_transforms. The blocks are independent, so we make at
+  // least one block per thread of the pool and split them among the threads.
+  // `sharp_execute` is reentrant: it keeps all state of a transform in a job
+  // it allocates per call and only reads the (cached) geometry and alm info,
+  // so concurrent calls on disjoint arrays are safe. If libsharp was built
+  // with OpenMP, each call also spawns OMP_NUM_THREADS threads of its own.
+  const size_t number_of_blocks = std::max(
+      (num_transforms + max_libsharp_transforms - 1) / max_libsharp_transforms,
+      std::min(num_transforms, thread_pool::number_of_threads()));
+  thread_pool::parallel_for(
+      number_of_blocks,
+      [&jobtype, &spin, &coefficient_data, &collocation_data,
+       &collocation_metadata, &alm_info, &num_transforms,
+       &number_of_arrays_per_transform,
+       &number_of_blocks](const size_t first_block, const size_t last_block) {
+        for (size_t block = first_block; block < last_block; ++block) {
+          const size_t first_transform =
+              block * num_transforms / number_of_blocks;
+          const size_t number_of_transforms_in_block =
+              (block + 1) * num_transforms / number_of_blocks -
+              first_transform;
+          // clang-tidy cppcoreguidelines-pro-bounds-pointer-arithmetic
+          sharp_execute(jobtype, abs(spin),
+                        coefficient_data->data() +  // NOLINT
+                            number_of_arrays_per_transform * first_transform,
+                        collocation_data->data() +  // NOLINT
+                            number_of_arrays_per_transform * first_transform,
+                        collocation_metadata->get_sharp_geom_info(), alm_info,
+                        static_cast<int>(number_of_transforms_in_block),
+                        SHARP_DP, nullptr, nullptr);
+        }
+      });
 }
 }  // namespace detail
 
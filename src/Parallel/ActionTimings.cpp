@@ -0,0 +1,150 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/ActionTimings.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Utilities/Gsl.hpp"
+
+namespace Parallel::action_timings {
+namespace {
+// The histograms of one thread. The mutex is only contended while the
+// histograms are collected or reset.
+struct ThreadTimings {
+  std::mutex mutex{};
+  std::vector<Histogram> histograms{};
+};
+
+// The names of the timers and the histograms of all threads that have recorded
+// a call. The histograms are never deallocated so collecting them doesn't race
+// with threads that exit.
+struct Registry {
+  std::mutex mutex{};
+  std::vector<std::string> names{};
+  std::unordered_map<std::string, size_t> ids{};
+  std::vector<std::unique_ptr<ThreadTimings>> threads{};
+};
+
+Registry& registry() {
+  static Registry registry{};
+  return registry;
+}
+
+ThreadTimings& local_timings() {
+  thread_local ThreadTimings* timings = [] {
+    auto& global_registry = registry();
+    const std::lock_guard lock{global_registry.mutex};
+    return global_registry.threads
+        .emplace_back(std::make_unique<ThreadTimings>())
+        .get();
+  }();
+  return *timings;
+}
+}  // namespace
+
+size_t bin(const double duration) {
+  const double microseconds = duration * 1.0e6;
+  if (not(microseconds >= 1.0)) {
+    return 0;
+  }
+  const auto result = static_cast<size_t>(std::floor(std::log2(microseconds)));
+  return std::min(result + 1, number_of_bins - 1);
+}
+
+void Histogram::add(const double duration) {
+  ++calls;
+  total_time += duration;
+  max_time = std::max(max_time, duration);
+  ++gsl::at(counts, bin(duration));
+}
+
+Histogram& Histogram::operator+=(const Histogram& rhs) {
+  calls += rhs.calls;
+  total_time += rhs.total_time;
+  max_time = std::max(max_time, rhs.max_time);
+  for (size_t i = 0; i < number_of_bins; ++i) {
+    gsl::at(counts, i) += gsl::at(rhs.counts, i);
+  }
+  return *this;
+}
+
+void Histogram::pup(PUP::er& p) {
+  p | calls;
+  p | total_time;
+  p | max_time;
+  p | counts;
+}
+
+bool operator==(const Histogram& lhs, const Histogram& rhs) {
+  return lhs.calls == rhs.calls and lhs.total_time == rhs.total_time and
+         lhs.max_time == rhs.max_time and lhs.counts == rhs.counts;
+}
+
+bool operator!=(const Histogram& lhs, const Histogram& rhs) {
+  return not(lhs == rhs);
+}
+
+size_t register_timer(const std::string& name) {
+  auto& global_registry = registry();
+  const std::lock_guard lock{global_registry.mutex};
+  const auto [it, inserted] =
+      global_registry.ids.emplace(name, global_registry.names.size());
+  if (inserted) {
+    global_registry.names.push_back(name);
+  }
+  return it->second;
+}
+
+void record(const size_t timer_id, const double duration) {
+  auto& timings = local_timings();
+  const std::lock_guard lock{timings.mutex};
+  if (timer_id >= timings.histograms.size()) {
+    timings.histograms.resize(timer_id + 1);
+  }
+  timings.histograms[timer_id].add(duration);
+}
+
+std::vector<std::pair<std::string, Histogram>> node_timings() {
+  auto& global_registry = registry();
+  const std::lock_guard lock{global_registry.mutex};
+  std::vector<Histogram> totals(global_registry.names.size());
+  for (const auto& timings : global_registry.threads) {
+    const std::lock_guard thread_lock{timings->mutex};
+    for (size_t i = 0; i < timings->histograms.size(); ++i) {
+      totals[i] += timings->histograms[i];
+    }
+  }
+  std::vector<std::pair<std::string, Histogram>> result{};
+  for (size_t i = 0; i < totals.size(); ++i) {
+    if (totals[i].calls > 0) {
+      result.emplace_back(global_registry.names[i], totals[i]);
+    }
+  }
+  std::sort(result.begin(), result.end(),
+            [](const auto& lhs, const auto& rhs) {
+              return lhs.first < rhs.first;
+            });
+  return result;
+}
+
+void reset() {
+  auto& global_registry = registry();
+  const std::lock_guard lock{global_registry.mutex};
+  for (const auto& timings : global_registry.threads) {
+    const std::lock_guard thread_lock{timings->mutex};
+    timings->histograms.clear();
+  }
+}
+}  // namespace Parallel::action_timings
@@ -0,0 +1,114 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Parallel/Phase.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/PrettyType.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+/*!
+ * \brief Always-on wall-time statistics of the actions that the
+ * `Parallel::DistributedObject`s execute.
+ *
+ * \details Every iterable, simple, threaded and reduction action that a
+ * distributed object executes is timed with `sys::wall_time()` and recorded
+ * in a `Parallel::action_timings::Histogram` of the calling thread. The
+ * histograms are keyed by the name
+ * `<parallel component>/<category>/<action>`, where the category is the phase
+ * for iterable actions and one of `SimpleActions`, `ThreadedActions` or
+ * `ReductionActions` otherwise. The component and category are named by their
+ * `pretty_type::name`, but the action is named by its fully qualified
+ * `pretty_type::get_name`, including its namespaces and template parameters.
+ * That way actions with the same name in different namespaces, and different
+ * instantiations of an action template, get their own histograms.
+ *
+ * Recording only locks a mutex that belongs to the calling thread, so it is
+ * uncontended unless the timings are being collected at the same time.
+ * `Parallel::action_timings::node_timings()` sums the histograms of all
+ * threads of the process, i.e. of the node when running in SMP mode. The
+ * `Events::MonitorActionTimings` event writes them to the reduction file.
+ */
+namespace Parallel::action_timings {
+/// The number of bins of each histogram. Bin 0 counts calls that took less
+/// than a microsecond, bin \f$b\f$ counts calls that took between
+/// \f$2^{b-1}\f$ and \f$2^b\f$ microseconds, and the last bin also counts all
+/// longer calls (more than about 4 seconds).
+constexpr size_t number_of_bins = 24;
+
+/// The bin that a call of `duration` seconds is counted in
+size_t bin(double duration);
+
+/// Number of calls and a histogram of their wall time
+struct Histogram {
+  size_t calls = 0;
+  /// Total wall time of all calls in seconds
+  double total_time = 0.0;
+  /// Wall time of the longest call in seconds
+  double max_time = 0.0;
+  std::array<size_t, number_of_bins> counts{};
+
+  /// Record a call that took `duration` seconds
+  void add(double duration);
+
+  Histogram& operator+=(const Histogram& rhs);
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+};
+
+bool operator==(const Histogram& lhs, const Histogram& rhs);
+bool operator!=(const Histogram& lhs, const Histogram& rhs);
+
+/// Return the id of the histogram named `name`, adding it if this is the first
+/// time the name is seen. The id is the same on all threads.
+size_t register_timer(const std::string& name);
+
+/// Record a call that took `duration` seconds in the histogram `timer_id` of
+/// the calling thread.
+void record(size_t timer_id, double duration);
+
+/// The histograms of all threads of this process summed up, sorted by name.
+/// Histograms without any calls are omitted. The histograms accumulate over
+/// the whole run, so consecutive observations have to be subtracted to get
+/// the timings of the actions that ran in between.
+std::vector<std::pair<std::string, Histogram>> node_timings();
+
+/// Clear the histograms of all threads of this process
+void reset();
+
+/// Category of the iterable actions in the phase `P`
+template <Parallel::Phase P>
+struct InPhase {
+  static std::string name() { return get_output(P); }
+};
+
+/// Category of the simple actions
+struct SimpleActions {};
+/// Category of the threaded actions
+struct ThreadedActions {};
+/// Category of the reduction actions
+struct ReductionActions {};
+
+/// The id of the histogram of `Action` executed on `ParallelComponent` in
+/// `Category`. The name is only assembled on the first call.
+template <typename ParallelComponent, typename Category, typename Action>
+size_t timer_id() {
+  static const size_t id = register_timer(
+      pretty_type::name<ParallelComponent>() + "/" +
+      pretty_type::name<Category>() + "/" + pretty_type::get_name<Action>());
+  return id;
+}
+}  // namespace Parallel::action_timings
@@ -3,12 +3,14 @@
 
 #pragma once
 
+#include <atomic>
 #include <charm++.h>
 #include <converse.h>
 #include <cstddef>
 #include <exception>
 #include <initializer_list>
 #include <limits>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <ostream>
@@ -22,6 +24,7 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "Parallel/ActionTimings.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/AlgorithmMetafunctions.hpp"
 #include "Parallel/Algorithms/AlgorithmArrayDeclarations.hpp"
@@ -33,6 +36,7 @@
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Info.hpp"
 #include "Parallel/Local.hpp"
+#include "Parallel/LockFreeQueue.hpp"
 #include "Parallel/NodeLock.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Phase.hpp"
@@ -119,6 +123,16 @@ constexpr bool has_registration_list_v =
  * It is up to the person writing the Actions that will be executed on the
  * Nodegroup Algorithm to ensure they are threadsafe.
  *
+ * Iterable and simple actions on a nodegroup are serialized with its
+ * Parallel::NodeLock. Data sent to a nodegroup with `receive_data` (including
+ * Charm++ messages) doesn't wait for the lock, though: it is pushed to a
+ * Parallel::LockFreeQueue and inserted into the inboxes by the thread that
+ * holds the lock, before that thread runs the iterable actions. So many cores
+ * can send data to a nodegroup at once while one of them executes its actions.
+ * A thread that wants to run the algorithm but can't get the lock flags the
+ * request instead, and the thread that holds the lock runs the algorithm again
+ * after releasing it.
+ *
  * ### What is an Algorithm?
  * An Algorithm is a distributed object, a Charm++ chare, that repeatedly
  * executes a series of Actions. An Action is a struct that has a `static` apply
@@ -137,6 +151,13 @@ constexpr bool has_registration_list_v =
  * Note that any of the arguments can be const or non-const references except
  * `array_index`, which must be a `const&`.
  *
+ * ### Action timings
+ * The wall time of every iterable, simple, threaded and reduction action is
+ * recorded in the `Parallel::action_timings` histograms. This is always
+ * enabled and cheap enough for production runs, unlike the Projections trace
+ * events that are only available when building with
+ * `SPECTRE_CHARM_PROJECTIONS`.
+ *
  * ### Explicit instantiations of entry methods
  * The code in src/Parallel/CharmMain.tpp registers all entry methods, and if
  * one is not properly registered then a static_assert explains how to have it
@@ -299,8 +320,12 @@ class DistributedObject<ParallelComponent,
     // definition is out of line.
     (void)Parallel::charmxx::RegisterThreadedAction<ParallelComponent, Action,
                                                     Args...>::registrar;
+    const double start_time = sys::wall_time();
     forward_tuple_to_threaded_action<Action>(
         std::move(args), std::make_index_sequence<sizeof...(Args)>{});
+    record_action_time<Parallel::action_timings::ThreadedActions, Action>(
+        start_time);
+    perform_algorithm_if_requested();
   }
 
   template <typename Action>
@@ -430,9 +455,69 @@ class DistributedObject<ParallelComponent,
 
   size_t number_of_actions_in_phase(const Parallel::Phase phase) const;
 
+  // Record the wall time since `start_time` in the action timings of `Action`
+  template <typename Category, typename Action>
+  static void record_action_time(const double start_time) {
+    Parallel::action_timings::record(
+        Parallel::action_timings::timer_id<ParallelComponent, Category,
+                                           Action>(),
+        sys::wall_time() - start_time);
+  }
+
   // After catching an exception, shutdown the simulation
   void initiate_shutdown(const std::exception& exception);
 
+  // Execute the actions of the current phase until they can't continue. The
+  // node lock of nodegroups must be held.
+  void run_algorithm();
+
+  // Data sent to a nodegroup is queued by the sending thread and inserted into
+  // the inboxes by the thread that holds the node lock
+  struct QueuedInboxData {
+    QueuedInboxData() = default;
+    QueuedInboxData(const QueuedInboxData&) = delete;
+    QueuedInboxData& operator=(const QueuedInboxData&) = delete;
+    QueuedInboxData(QueuedInboxData&&) = delete;
+    QueuedInboxData& operator=(QueuedInboxData&&) = delete;
+    virtual ~QueuedInboxData() = default;
+    virtual void insert_into_inbox(gsl::not_null<inbox_type*> inboxes) = 0;
+    bool enable_if_disabled = false;
+  };
+
+  template <typename ReceiveTag, typename ReceiveDataType>
+  struct QueuedInboxDataImpl : QueuedInboxData {
+    QueuedInboxDataImpl(typename ReceiveTag::temporal_id local_instance,
+                        ReceiveDataType local_data)
+        : instance(std::move(local_instance)), data(std::move(local_data)) {}
+    void insert_into_inbox(const gsl::not_null<inbox_type*> inboxes) override {
+      ReceiveTag::insert_into_inbox(
+          make_not_null(&tuples::get<ReceiveTag>(*inboxes)), instance,
+          std::move(data));
+    }
+    typename ReceiveTag::temporal_id instance;
+    ReceiveDataType data;
+  };
+
+  template <typename ReceiveTag, typename MessageType>
+  struct QueuedInboxMessageImpl : QueuedInboxData {
+    explicit QueuedInboxMessageImpl(MessageType* local_message)
+        : message(local_message) {}
+    void insert_into_inbox(const gsl::not_null<inbox_type*> inboxes) override {
+      // The inbox takes ownership of the message
+      ReceiveTag::insert_into_inbox(
+          make_not_null(&tuples::get<ReceiveTag>(*inboxes)), message.release());
+    }
+    std::unique_ptr<MessageType> message;
+  };
+
+  // Move the queued data into the inboxes. The node lock must be held.
+  void insert_queued_inbox_data();
+
+  // Actions that are passed the node lock can hold it while other threads
+  // queue data or request to run the algorithm, so they have to run the
+  // algorithm for them afterwards
+  void perform_algorithm_if_requested();
+
   // Member variables
 #ifdef SPECTRE_CHARM_PROJECTIONS
   double non_action_time_start_;
@@ -446,6 +531,16 @@ class DistributedObject<ParallelComponent,
   tmpl::conditional_t<Parallel::is_node_group_proxy<cproxy_type>::value,
                       Parallel::NodeLock, NoSuchType>
       node_lock_;
+  tmpl::conditional_t<
+      Parallel::is_node_group_proxy<cproxy_type>::value,
+      Parallel::LockFreeQueue<std::unique_ptr<QueuedInboxData>>, NoSuchType>
+      queued_inbox_data_;
+  // Set by threads that couldn't get the node lock to run the algorithm. Not
+  // serialized because no thread holds the lock while the nodegroup is
+  // serialized.
+  tmpl::conditional_t<Parallel::is_node_group_proxy<cproxy_type>::value,
+                      std::atomic<bool>, NoSuchType>
+      algorithm_requested_{};
 
   bool terminate_{true};
   bool halt_algorithm_until_next_phase_{false};
@@ -655,6 +750,10 @@ void DistributedObject<
   p | algorithm_step_;
   if constexpr (Parallel::is_node_group_proxy<cproxy_type>::value) {
     p | node_lock_;
+    // No other thread can send data while the nodegroup is serialized
+    if (not p.isUnpacking()) {
+      insert_queued_inbox_data();
+    }
   }
   p | terminate_;
   p | halt_algorithm_until_next_phase_;
@@ -733,9 +832,12 @@ void DistributedObject<
             "no sense for a reduction.");
       }
       performing_action_ = true;
+      const double start_time = sys::wall_time();
       arg.finalize();
       forward_tuple_to_action<Action>(
           std::move(arg.data()), std::make_index_sequence<Arg::pack_size()>{});
+      record_action_time<Parallel::action_timings::ReductionActions, Action>(
+          start_time);
       performing_action_ = false;
     }
     perform_algorithm();
@@ -765,8 +867,11 @@ void DistributedObject<ParallelComponent,
             "we do not allow.");
       }
       performing_action_ = true;
+      const double start_time = sys::wall_time();
       forward_tuple_to_action<Action>(
           std::move(args), std::make_index_sequence<sizeof...(Args)>{});
+      record_action_time<Parallel::action_timings::SimpleActions, Action>(
+          start_time);
       performing_action_ = false;
     }
     perform_algorithm();
@@ -796,9 +901,12 @@ void DistributedObject<
             "we do not allow.");
       }
       performing_action_ = true;
+      const double start_time = sys::wall_time();
       Action::template apply<ParallelComponent>(
           box_, *Parallel::local_branch(global_cache_proxy_),
           static_cast<const array_index&>(array_index_));
+      record_action_time<Parallel::action_timings::SimpleActions, Action>(
+          start_time);
       performing_action_ = false;
     }
     perform_algorithm();
@@ -815,8 +923,17 @@ DistributedObject<ParallelComponent, tmpl::list<PhaseDepActionListsPack...>>::
   static_assert(Parallel::is_node_group_proxy<cproxy_type>::value,
                 "Cannot call a (blocking) local synchronous action on a "
                 "chare that is not a NodeGroup");
-  return Action::template apply<ParallelComponent>(
-      box_, make_not_null(&node_lock_), std::forward<Args>(args)...);
+  if constexpr (std::is_void_v<typename Action::return_type>) {
+    Action::template apply<ParallelComponent>(
+        box_, make_not_null(&node_lock_), std::forward<Args>(args)...);
+    perform_algorithm_if_requested();
+  } else {
+    typename Action::return_type result =
+        Action::template apply<ParallelComponent>(
+            box_, make_not_null(&node_lock_), std::forward<Args>(args)...);
+    perform_algorithm_if_requested();
+    return result;
+  }
 }
 
 template <typename ParallelComponent, typename... PhaseDepActionListsPack>
@@ -828,10 +945,14 @@ void DistributedObject<
     // NOLINTNEXTLINE(modernize-redundant-void-arg)
     (void)Parallel::charmxx::RegisterThreadedAction<ParallelComponent,
                                                     Action>::registrar;
+    const double start_time = sys::wall_time();
     Action::template apply<ParallelComponent>(
         box_, *Parallel::local_branch(global_cache_proxy_),
         static_cast<const array_index&>(array_index_),
         make_not_null(&node_lock_));
+    record_action_time<Parallel::action_timings::ThreadedActions, Action>(
+        start_time);
+    perform_algorithm_if_requested();
   } catch (const std::exception& exception) {
     initiate_shutdown(exception);
   }
@@ -846,11 +967,16 @@ void DistributedObject<ParallelComponent,
   try {
     (void)Parallel::charmxx::RegisterReceiveData<ParallelComponent, ReceiveTag,
                                                  false>::registrar;
-    {
-      std::optional<std::lock_guard<Parallel::NodeLock>> hold_lock{};
-      if constexpr (std::is_same_v<Parallel::NodeLock, decltype(node_lock_)>) {
-        hold_lock.emplace(node_lock_);
-      }
+    if constexpr (std::is_same_v<Parallel::NodeLock, decltype(node_lock_)>) {
+      // Queue the data instead of waiting for the node lock, which may be held
+      // for the whole action loop. It is inserted by the thread that holds the
+      // lock (see `perform_algorithm`).
+      auto queued_data = std::make_unique<
+          QueuedInboxDataImpl<ReceiveTag, std::decay_t<ReceiveDataType>>>(
+          std::move(instance), std::forward<ReceiveDataType>(t));
+      queued_data->enable_if_disabled = enable_if_disabled;
+      queued_inbox_data_.push(std::move(queued_data));
+    } else {
       if (enable_if_disabled) {
         set_terminate(false);
       }
@@ -872,19 +998,23 @@ void DistributedObject<ParallelComponent,
   try {
     (void)Parallel::charmxx::RegisterReceiveData<ParallelComponent, ReceiveTag,
                                                  true>::registrar;
-    {
-      std::optional<std::lock_guard<Parallel::NodeLock>> hold_lock{};
-      if constexpr (std::is_same_v<Parallel::NodeLock, decltype(node_lock_)>) {
-        hold_lock.emplace(node_lock_);
-      }
+    if constexpr (std::is_same_v<Parallel::NodeLock, decltype(node_lock_)>) {
+      // Queue the message instead of waiting for the node lock, like the data
+      // in the other `receive_data` overload
+      auto queued_data =
+          std::make_unique<QueuedInboxMessageImpl<ReceiveTag, MessageType>>(
+              message);
+      queued_data->enable_if_disabled = message->enable_if_disabled;
+      queued_inbox_data_.push(std::move(queued_data));
+    } else {
       if (message->enable_if_disabled) {
         set_terminate(false);
       }
       ReceiveTag::insert_into_inbox(
           make_not_null(&tuples::get<ReceiveTag>(inboxes_)), message);
-      // Cannot use message after this call because a std::unique_ptr now owns
-      // it. Doing so would result in undefined behavior
     }
+    // Cannot use message after this point because a std::unique_ptr now owns
+    // it. Doing so would result in undefined behavior
     perform_algorithm();
   } catch (const std::exception& exception) {
     initiate_shutdown(exception);
@@ -896,51 +1026,103 @@ void DistributedObject<
     ParallelComponent,
     tmpl::list<PhaseDepActionListsPack...>>::perform_algorithm() {
   try {
-    if (performing_action_ or get_terminate() or
-        halt_algorithm_until_next_phase_) {
-      return;
+    if constexpr (std::is_same_v<Parallel::NodeLock, decltype(node_lock_)>) {
+      // Only one thread runs the algorithm of a nodegroup at a time. Threads
+      // that can't get the lock flag the request and return right away. The
+      // request is flagged before trying the lock, so either the thread that
+      // holds the lock sees the flag after releasing the lock (or after
+      // acquiring it, in which case it runs the algorithm for the request
+      // anyway), or the lock is already released and `try_lock` succeeds.
+      // This is also how data queued by `receive_data` gets processed. Every
+      // thread that holds the lock, including threaded and local synchronous
+      // actions, checks the flag after releasing it.
+      do {
+        algorithm_requested_.store(true);
+        if (not node_lock_.try_lock()) {
+          return;
+        }
+        {
+          const std::lock_guard<Parallel::NodeLock> hold_lock{node_lock_,
+                                                              std::adopt_lock};
+          algorithm_requested_.store(false);
+          insert_queued_inbox_data();
+          run_algorithm();
+        }
+      } while (algorithm_requested_.load() or
+               not queued_inbox_data_.empty());
+    } else {
+      run_algorithm();
     }
+  } catch (const std::exception& exception) {
+    initiate_shutdown(exception);
+  }
+}
+
+template <typename ParallelComponent, typename... PhaseDepActionListsPack>
+void DistributedObject<
+    ParallelComponent,
+    tmpl::list<PhaseDepActionListsPack...>>::run_algorithm() {
+  if (performing_action_ or get_terminate() or
+      halt_algorithm_until_next_phase_) {
+    return;
+  }
 #ifdef SPECTRE_CHARM_PROJECTIONS
-    non_action_time_start_ = sys::wall_time();
+  non_action_time_start_ = sys::wall_time();
 #endif
-    {
-      std::optional<std::lock_guard<Parallel::NodeLock>> hold_lock{};
-      if constexpr (std::is_same_v<Parallel::NodeLock, decltype(node_lock_)>) {
-        hold_lock.emplace(node_lock_);
+  const auto invoke_for_phase = [this](auto phase_dep_v) {
+    using PhaseDep = decltype(phase_dep_v);
+    constexpr Parallel::Phase phase = PhaseDep::phase;
+    using actions_list = typename PhaseDep::action_list;
+    if (phase_ == phase) {
+      while (tmpl::size<actions_list>::value > 0 and not get_terminate() and
+             not halt_algorithm_until_next_phase_ and
+             iterate_over_actions<PhaseDep>(
+                 std::make_index_sequence<
+                     tmpl::size<actions_list>::value>{})) {
       }
-      const auto invoke_for_phase = [this](auto phase_dep_v) {
-        using PhaseDep = decltype(phase_dep_v);
-        constexpr Parallel::Phase phase = PhaseDep::phase;
-        using actions_list = typename PhaseDep::action_list;
-        if (phase_ == phase) {
-          while (tmpl::size<actions_list>::value > 0 and not get_terminate() and
-                 not halt_algorithm_until_next_phase_ and
-                 iterate_over_actions<PhaseDep>(
-                     std::make_index_sequence<
-                         tmpl::size<actions_list>::value>{})) {
-          }
-          tmpl::for_each<actions_list>([this](auto action_v) {
-            using action = tmpl::type_from<decltype(action_v)>;
-            if (algorithm_step_ ==
-                tmpl::index_of<actions_list, action>::value) {
-              deadlock_analysis_next_iterable_action_ =
-                  pretty_type::name<action>();
-            }
-          });
+      tmpl::for_each<actions_list>([this](auto action_v) {
+        using action = tmpl::type_from<decltype(action_v)>;
+        if (algorithm_step_ == tmpl::index_of<actions_list, action>::value) {
+          deadlock_analysis_next_iterable_action_ =
+              pretty_type::name<action>();
         }
-      };
-      // Loop over all phases, once the current phase is found we perform the
-      // algorithm in that phase until we are no longer able to because we are
-      // waiting on data to be sent or because the algorithm has been marked as
-      // terminated.
-      EXPAND_PACK_LEFT_TO_RIGHT(invoke_for_phase(PhaseDepActionListsPack{}));
+      });
     }
+  };
+  // Loop over all phases, once the current phase is found we perform the
+  // algorithm in that phase until we are no longer able to because we are
+  // waiting on data to be sent or because the algorithm has been marked as
+  // terminated.
+  EXPAND_PACK_LEFT_TO_RIGHT(invoke_for_phase(PhaseDepActionListsPack{}));
 #ifdef SPECTRE_CHARM_PROJECTIONS
-    traceUserBracketEvent(SPECTRE_CHARM_NON_ACTION_WALLTIME_EVENT_ID,
-                          non_action_time_start_, sys::wall_time());
+  traceUserBracketEvent(SPECTRE_CHARM_NON_ACTION_WALLTIME_EVENT_ID,
+                        non_action_time_start_, sys::wall_time());
 #endif
-  } catch (const std::exception& exception) {
-    initiate_shutdown(exception);
+}
+
+template <typename ParallelComponent, typename... PhaseDepActionListsPack>
+void DistributedObject<ParallelComponent,
+                       tmpl::list<PhaseDepActionListsPack...>>::
+    insert_queued_inbox_data() {
+  if constexpr (std::is_same_v<Parallel::NodeLock, decltype(node_lock_)>) {
+    queued_inbox_data_.consume_all(
+        [this](std::unique_ptr<QueuedInboxData>&& queued_data) {
+          if (queued_data->enable_if_disabled) {
+            set_terminate(false);
+          }
+          queued_data->insert_into_inbox(make_not_null(&inboxes_));
+        });
+  }
+}
+
+template <typename ParallelComponent, typename... PhaseDepActionListsPack>
+void DistributedObject<ParallelComponent,
+                       tmpl::list<PhaseDepActionListsPack...>>::
+    perform_algorithm_if_requested() {
+  if constexpr (std::is_same_v<Parallel::NodeLock, decltype(node_lock_)>) {
+    if (algorithm_requested_.load() or not queued_inbox_data_.empty()) {
+      perform_algorithm();
+    }
   }
 }
 
@@ -1118,10 +1300,14 @@ bool DistributedObject<
   }
 #endif // SPECTRE_CHARM_PROJECTIONS
 
+  const double start_time = sys::wall_time();
   const auto& [requested_execution, next_action_step] = ThisAction::apply(
       box_, inboxes_, *Parallel::local_branch(global_cache_proxy_),
       std::as_const(array_index_), actions_list{},
       std::add_pointer_t<ParallelComponent>{});
+  record_action_time<
+      Parallel::action_timings::InPhase<phase_dep_action::phase>, ThisAction>(
+      start_time);
 
   if (next_action_step.has_value()) {
     ASSERT(
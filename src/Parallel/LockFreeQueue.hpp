@@ -0,0 +1,78 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace Parallel {
+/*!
+ * \ingroup ParallelGroup
+ * \brief A queue that any number of threads can push to concurrently without
+ * locking, and that one thread at a time empties.
+ *
+ * \details Pushing allocates a node and links it into a list with a
+ * compare-and-swap on the head, so producers never wait for each other or for
+ * the consumer. `consume_all()` detaches the whole list with a single atomic
+ * exchange and passes the elements to a function in the order they were
+ * pushed. Only one thread may call `consume_all()` at a time, e.g. the thread
+ * that holds a `Parallel::NodeLock`.
+ */
+template <typename T>
+class LockFreeQueue {
+ public:
+  LockFreeQueue() = default;
+  LockFreeQueue(const LockFreeQueue&) = delete;
+  LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+  LockFreeQueue(LockFreeQueue&&) = delete;
+  LockFreeQueue& operator=(LockFreeQueue&&) = delete;
+  ~LockFreeQueue() {
+    consume_all([](T&& /*value*/) {});
+  }
+
+  /// Add `value` to the queue. Can be called from any thread.
+  void push(T value) {
+    auto* const node = new Node{std::move(value), head_.load()};
+    while (not head_.compare_exchange_weak(node->next, node)) {
+    }
+  }
+
+  /// Whether the queue was empty at the time of the call
+  bool empty() const { return head_.load() == nullptr; }
+
+  /// Remove all elements from the queue and call `f` on each of them (as an
+  /// rvalue) in the order they were pushed. Elements that are pushed while
+  /// `f` runs remain in the queue. Returns the number of elements removed.
+  template <typename F>
+  size_t consume_all(F&& f) {
+    // The list is linked from the most recent element, so reverse it first
+    Node* node = head_.exchange(nullptr);
+    Node* oldest = nullptr;
+    while (node != nullptr) {
+      Node* const next = node->next;
+      node->next = oldest;
+      oldest = node;
+      node = next;
+    }
+    size_t number_of_elements = 0;
+    while (oldest != nullptr) {
+      const std::unique_ptr<Node> current{oldest};
+      oldest = current->next;
+      f(std::move(current->value));
+      ++number_of_elements;
+    }
+    return number_of_elements;
+  }
+
+ private:
+  struct Node {
+    T value;
+    Node* next;
+  };
+
+  std::atomic<Node*> head_{nullptr};
+};
+}  // namespace Parallel
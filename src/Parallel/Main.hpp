@@ -55,6 +55,8 @@ namespace Parallel {
 namespace detail {
 CREATE_IS_CALLABLE(run_deadlock_analysis_simple_actions)
 CREATE_IS_CALLABLE_V(run_deadlock_analysis_simple_actions)
+CREATE_IS_CALLABLE(prepare_for_exit)
+CREATE_IS_CALLABLE_V(prepare_for_exit)
 }  // namespace detail
 
 /// \ingroup ParallelGroup
@@ -139,6 +141,12 @@ class Main : public CBase_Main<Metavariables> {
   /// detected.
   void post_deadlock_analysis_termination();
 
+  /// Check that all components terminated correctly before exiting
+  ///
+  /// \details This call is wrapped within an entry method so that it may be
+  /// used as the callback after a quiescence detection.
+  void start_termination_check();
+
  private:
   // Return the dir name for the next Charm++ checkpoint as well as the pieces
   // from which the name is built up: the basename and the padding. This is a
@@ -764,6 +772,24 @@ void Main<Metavariables>::execute_next_phase() {
   }
 
   if (Parallel::Phase::Exit == current_phase_) {
+    // Components that define a `prepare_for_exit` function get to finish their
+    // work, e.g. write buffered data to disk, before the executable exits.
+    bool prepare_for_exit = false;
+    tmpl::for_each<component_list>(
+        [this, &prepare_for_exit](auto parallel_component) {
+          using component = tmpl::type_from<decltype(parallel_component)>;
+          if constexpr (detail::is_prepare_for_exit_callable_v<
+                            component, CProxy_GlobalCache<Metavariables>&>) {
+            component::prepare_for_exit(global_cache_proxy_);
+            prepare_for_exit = true;
+          }
+        });
+    if (prepare_for_exit) {
+      CkStartQD(CkCallback(
+          CkIndex_Main<Metavariables>::start_termination_check(),
+          this->thisProxy));
+      return;
+    }
     check_if_component_terminated_correctly();
     return;
   }
@@ -807,6 +833,11 @@ void Main<Metavariables>::start_load_balance() {
   // ResumeFromSync instead.
 }
 
+template <typename Metavariables>
+void Main<Metavariables>::start_termination_check() {
+  check_if_component_terminated_correctly();
+}
+
 template <typename Metavariables>
 void Main<Metavariables>::start_write_checkpoint() {
   const std::string dir = checkpoint_dir();
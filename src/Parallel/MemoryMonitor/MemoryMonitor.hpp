@@ -24,12 +24,15 @@ namespace mem_monitor {}
 namespace mem_monitor {
 namespace detail {
 struct InitializeMutator {
-  using return_tags = tmpl::list<mem_monitor::Tags::MemoryHolder>;
+  using return_tags = tmpl::list<mem_monitor::Tags::MemoryHolder,
+                                 mem_monitor::Tags::MemoryPoolHolder>;
   using argument_tags = tmpl::list<>;
 
   using tag_type = typename mem_monitor::Tags::MemoryHolder::type;
+  using pool_tag_type = typename mem_monitor::Tags::MemoryPoolHolder::type;
 
-  static void apply(const gsl::not_null<tag_type*> /*holder*/) {}
+  static void apply(const gsl::not_null<tag_type*> /*holder*/,
+                    const gsl::not_null<pool_tag_type*> /*pool_holder*/) {}
 };
 }  // namespace detail
 
@@ -9,6 +9,7 @@
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "Options/Options.hpp"
+#include "Utilities/MemoryPool.hpp"
 #include "Utilities/PrettyType.hpp"
 
 namespace mem_monitor {
@@ -37,5 +38,20 @@ struct MemoryHolder : db::SimpleTag {
   using type = std::unordered_map<
       std::string, std::unordered_map<double, std::unordered_map<int, double>>>;
 };
+
+/*!
+ * \brief Tag to hold the `memory_pool::Statistics` of every proc before they
+ * are written to disk.
+ *
+ * \details The types in the unordered_map are as follows:
+ *
+ * \code
+ * std::unordered_map<%Time, std::unordered_map<Proc, Statistics>>
+ * \endcode
+ */
+struct MemoryPoolHolder : db::SimpleTag {
+  using type = std::unordered_map<
+      double, std::unordered_map<int, memory_pool::Statistics>>;
+};
 }  // namespace Tags
 }  // namespace mem_monitor
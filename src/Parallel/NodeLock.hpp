@@ -34,6 +34,16 @@ class NodeLock {
   NodeLock& operator=(NodeLock&& moved_lock);
   ~NodeLock();
 
+  /// Whether locking also synchronizes threads that Charm++ doesn't know
+  /// about, e.g. threads started with `std::async`. This is only the case in
+  /// SMP builds of Charm++. In non-SMP builds a `CmiNodeLock` is a plain
+  /// counter, because there is only one thread per process.
+#if defined(CMK_SMP) && CMK_SMP
+  static constexpr bool locks_all_threads = true;
+#else
+  static constexpr bool locks_all_threads = false;
+#endif
+
   void lock();
 
   bool try_lock();
@@ -0,0 +1,128 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
+#include "Parallel/MemoryMonitor/MemoryMonitor.hpp"
+#include "Parallel/MemoryMonitor/Tags.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MemoryPool.hpp"
+
+namespace mem_monitor {
+/*!
+ * \brief Simple action meant to be run on the MemoryMonitor component that
+ * collects the `memory_pool::Statistics` of every proc.
+ *
+ * \details Once the statistics of all procs for a time have arrived they are
+ * written to the `/MemoryMonitors/MemoryPool.dat` subfile of the reduction
+ * file. The counters cover the time since the previous observation, so
+ * comparing consecutive rows shows the allocator pressure of the actions that
+ * ran in between. The columns are
+ *
+ * - %Time
+ * - Allocations (summed over all procs)
+ * - Pool hits (summed over all procs)
+ * - Hit rate
+ * - Allocated (MB) (summed over all procs)
+ * - Cached (MB) (summed over all procs)
+ * - Proc of max peak
+ * - Peak in use on proc of max peak (MB)
+ */
+struct ContributeMemoryPoolData {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex>
+  static void apply(db::DataBox<DbTags>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/, const double time,
+                    const int proc,
+                    const memory_pool::Statistics& statistics) {
+    db::mutate<Tags::MemoryPoolHolder>(
+        make_not_null(&box),
+        [&cache, &time, &proc, &statistics](
+            const gsl::not_null<std::unordered_map<
+                double, std::unordered_map<int, memory_pool::Statistics>>*>
+                pool_holder) {
+          auto& statistics_at_time = (*pool_holder)[time];
+          statistics_at_time[proc] = statistics;
+
+          auto& mem_monitor_proxy =
+              Parallel::get_parallel_component<MemoryMonitor<Metavariables>>(
+                  cache);
+          const size_t num_procs = Parallel::number_of_procs<size_t>(
+              *Parallel::local(mem_monitor_proxy));
+          ASSERT(statistics_at_time.size() <= num_procs,
+                 "ContributeMemoryPoolData received more data than it was "
+                 "expecting. Was expecting "
+                     << num_procs << " calls but instead got "
+                     << statistics_at_time.size());
+          if (statistics_at_time.size() != num_procs) {
+            return;
+          }
+
+          memory_pool::Statistics total{};
+          int proc_of_max = 0;
+          std::int64_t max_peak = std::numeric_limits<std::int64_t>::min();
+          for (const auto& [local_proc, local_statistics] :
+               statistics_at_time) {
+            total.allocations += local_statistics.allocations;
+            total.pool_hits += local_statistics.pool_hits;
+            total.bytes_allocated += local_statistics.bytes_allocated;
+            total.bytes_cached += local_statistics.bytes_cached;
+            if (local_statistics.peak_bytes_in_use > max_peak or
+                (local_statistics.peak_bytes_in_use == max_peak and
+                 local_proc < proc_of_max)) {
+              max_peak = local_statistics.peak_bytes_in_use;
+              proc_of_max = local_proc;
+            }
+          }
+
+          const std::vector<std::string> legend{
+              "Time",
+              "Allocations",
+              "Pool hits",
+              "Hit rate",
+              "Allocated (MB)",
+              "Cached (MB)",
+              "Proc of max peak",
+              "Peak in use on proc of max peak (MB)"};
+          std::vector<double> data_to_append{
+              time,
+              static_cast<double>(total.allocations),
+              static_cast<double>(total.pool_hits),
+              total.hit_rate(),
+              static_cast<double>(total.bytes_allocated) / 1.0e6,
+              static_cast<double>(total.bytes_cached) / 1.0e6,
+              static_cast<double>(proc_of_max),
+              static_cast<double>(max_peak) / 1.0e6};
+
+          auto& observer_writer_proxy = Parallel::get_parallel_component<
+              observers::ObserverWriter<Metavariables>>(cache);
+          Parallel::threaded_action<
+              observers::ThreadedActions::WriteReductionDataRow>(
+              // Node 0 is always the writer
+              observer_writer_proxy[0],
+              std::string{"/MemoryMonitors/MemoryPool"}, legend,
+              std::make_tuple(std::move(data_to_append)));
+
+          pool_holder->erase(time);
+        });
+  }
+};
+}  // namespace mem_monitor
@@ -0,0 +1,54 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <type_traits>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
+#include "Parallel/MemoryMonitor/MemoryMonitor.hpp"
+#include "Parallel/TypeTraits.hpp"
+#include "ParallelAlgorithms/Actions/MemoryMonitor/ContributeMemoryPoolData.hpp"
+#include "Utilities/MemoryPool.hpp"
+
+namespace mem_monitor {
+/*!
+ * \brief Simple action meant to be run on every branch of a Group that reports
+ * the `memory_pool::Statistics` of the proc to the MemoryMonitor using the
+ * ContributeMemoryPoolData simple action.
+ *
+ * \details The counters of the proc are reset afterwards, so every observation
+ * covers the time since the previous one. Since the pool keeps its counters
+ * per thread, this must run on a Group (one branch per proc) rather than a
+ * Nodegroup.
+ */
+struct ProcessMemoryPool {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex>
+  static void apply(db::DataBox<DbTags>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& array_index, const double time) {
+    static_assert(Parallel::is_group_v<ParallelComponent>,
+                  "ProcessMemoryPool can only be run on Group parallel "
+                  "components.");
+    static_assert(std::is_same_v<ArrayIndex, int>,
+                  "ArrayIndex of Group parallel components must be an int to "
+                  "use the ProcessMemoryPool action.");
+
+    auto& singleton_proxy =
+        Parallel::get_parallel_component<MemoryMonitor<Metavariables>>(cache);
+
+    const memory_pool::Statistics statistics = memory_pool::statistics();
+    memory_pool::reset_statistics();
+
+    // As in ProcessGroups, the order in which the branches run this action is
+    // random so we can't use a reduction. `array_index` is my_proc here.
+    Parallel::simple_action<ContributeMemoryPoolData>(
+        singleton_proxy, time, array_index, statistics);
+  }
+};
+}  // namespace mem_monitor
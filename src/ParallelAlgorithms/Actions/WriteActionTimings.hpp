@@ -0,0 +1,95 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "Parallel/ActionTimings.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/TypeTraits.hpp"
+
+namespace Actions {
+/*!
+ * \brief Simple action meant to be run on every branch of the
+ * `observers::ObserverWriter` nodegroup that writes the
+ * `Parallel::action_timings` of the node to the reduction file.
+ *
+ * \details Every action that has been called on the node gets a row in the
+ * `/ActionTimings/<parallel component>/<category>/<action>` subfile, so the
+ * subfiles hold one row per node for each observation. The histograms
+ * accumulate over the whole run. The columns are
+ *
+ * - %Time
+ * - Node
+ * - Calls
+ * - Total time (s)
+ * - Max time (s)
+ * - The number of calls in each bin of the histogram, see
+ *   `Parallel::action_timings::number_of_bins`. The column name is the upper
+ *   bound of the bin in microseconds, except for the last bin.
+ *
+ * Each node sends the rows of all its timers to node 0 in a single
+ * `observers::ThreadedActions::WriteReductionDataRows` message.
+ */
+struct WriteActionTimings {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex>
+  static void apply(db::DataBox<DbTags>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& array_index, const double time) {
+    static_assert(Parallel::is_nodegroup_v<ParallelComponent>,
+                  "WriteActionTimings can only be run on Nodegroup parallel "
+                  "components.");
+    static_assert(std::is_same_v<ArrayIndex, int>,
+                  "ArrayIndex of Nodegroup parallel components must be an int "
+                  "to use the WriteActionTimings action.");
+
+    std::vector<std::string> legend{"Time", "Node", "Calls", "Total time (s)",
+                                    "Max time (s)"};
+    size_t bin_upper_bound = 1;
+    for (size_t i = 0; i < Parallel::action_timings::number_of_bins - 1; ++i) {
+      legend.push_back("< " + std::to_string(bin_upper_bound) + "us");
+      bin_upper_bound *= 2;
+    }
+    legend.push_back(">= " + std::to_string(bin_upper_bound / 2) + "us");
+
+    // Send the rows of all timers in one message, so the writer opens the
+    // reduction file once per node instead of once per timer
+    const auto node_timings = Parallel::action_timings::node_timings();
+    if (node_timings.empty()) {
+      return;
+    }
+    std::vector<std::string> subfile_names{};
+    std::vector<std::vector<double>> rows{};
+    subfile_names.reserve(node_timings.size());
+    rows.reserve(node_timings.size());
+    // `array_index` is my_node here
+    for (const auto& [name, histogram] : node_timings) {
+      subfile_names.push_back("/ActionTimings/" + name);
+      std::vector<double>& row = rows.emplace_back(std::vector<double>{
+          time, static_cast<double>(array_index),
+          static_cast<double>(histogram.calls), histogram.total_time,
+          histogram.max_time});
+      for (const size_t count : histogram.counts) {
+        row.push_back(static_cast<double>(count));
+      }
+    }
+    auto& observer_writer_proxy = Parallel::get_parallel_component<
+        observers::ObserverWriter<Metavariables>>(cache);
+    Parallel::threaded_action<
+        observers::ThreadedActions::WriteReductionDataRows>(
+        // Node 0 is always the writer
+        observer_writer_proxy[0], std::move(subfile_names), std::move(legend),
+        std::move(rows));
+  }
+};
+}  // namespace Actions
@@ -0,0 +1,142 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <unordered_map>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "ParallelAlgorithms/Amr/Projectors/Variables.hpp"
+#include "Time/History.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace amr::projectors {
+/*!
+ * \brief Project the time-stepper `history` of an element from its `old_mesh`
+ * to its `new_mesh` after p-refinement
+ *
+ * \details All values and derivatives in the history are projected with
+ * `amr::projectors::variables`.
+ *
+ * \warning The value that the history keeps for undoing the latest step is
+ * not projected, so `TimeSteppers::History::undo_latest` must not be called
+ * after projecting a history. AMR only changes elements after a step is
+ * complete, so this is not a restriction in practice.
+ */
+template <typename Vars, size_t Dim>
+void history(const gsl::not_null<TimeSteppers::History<Vars>*> history,
+             const Mesh<Dim>& old_mesh, const Mesh<Dim>& new_mesh) {
+  if (old_mesh == new_mesh) {
+    return;
+  }
+  history->map_entries([&old_mesh, &new_mesh](const auto entry) {
+    variables(entry, old_mesh, new_mesh);
+  });
+}
+
+/// Project the time-stepper `parent_history` to the child with ElementId
+/// `child_id` when the parent with ElementId `parent_id` splits
+///
+/// \warning See `amr::projectors::history`.
+template <typename Vars, size_t Dim>
+TimeSteppers::History<Vars> child_history(
+    const TimeSteppers::History<Vars>& parent_history,
+    const Mesh<Dim>& parent_mesh, const ElementId<Dim>& parent_id,
+    const Mesh<Dim>& child_mesh, const ElementId<Dim>& child_id) {
+  TimeSteppers::History<Vars> result = parent_history;
+  result.map_entries(
+      [&parent_mesh, &parent_id, &child_mesh, &child_id](const auto entry) {
+        *entry = child_variables(*entry, parent_mesh, parent_id, child_mesh,
+                                 child_id);
+      });
+  return result;
+}
+
+/*!
+ * \brief Project the time-stepper `children_histories` to the parent with
+ * ElementId `parent_id` when the children join
+ *
+ * \details The histories of all children must hold records for the same
+ * steps and substeps, which is the case for global time stepping. Values are
+ * only projected for records where all children hold a value.
+ *
+ * \warning See `amr::projectors::history`.
+ */
+template <typename Vars, size_t Dim>
+TimeSteppers::History<Vars> parent_history(
+    const Mesh<Dim>& parent_mesh, const ElementId<Dim>& parent_id,
+    const std::unordered_map<ElementId<Dim>, TimeSteppers::History<Vars>>&
+        children_histories,
+    const std::unordered_map<ElementId<Dim>, Mesh<Dim>>& children_meshes) {
+  using DerivVars = typename TimeSteppers::History<Vars>::DerivVars;
+  ASSERT(not children_histories.empty(), "No children to join.");
+  const auto& first_child_history = children_histories.begin()->second;
+  TimeSteppers::History<Vars> result{first_child_history.integration_order()};
+  const size_t number_of_grid_points = parent_mesh.number_of_grid_points();
+
+  const auto insert_record = [&result, &parent_mesh, &parent_id,
+                              &children_histories, &children_meshes,
+                              &number_of_grid_points](
+                                 const TimeStepId& time_step_id) {
+    std::optional<Vars> value{};
+    bool all_children_have_values = true;
+    for (const auto& [child_id, child_history] : children_histories) {
+      all_children_have_values = all_children_have_values and
+                                 child_history[time_step_id].value.has_value();
+    }
+    if (all_children_have_values) {
+      value.emplace(number_of_grid_points, 0.);
+    }
+    DerivVars derivative{number_of_grid_points, 0.};
+    for (const auto& [child_id, child_history] : children_histories) {
+      ASSERT(child_history.integration_order() == result.integration_order(),
+             "Child " << child_id << " has integration order "
+                      << child_history.integration_order() << ", but another "
+                      << "child has integration order "
+                      << result.integration_order() << ".");
+      ASSERT(children_meshes.count(child_id) == 1,
+             "No mesh for child " << child_id << ".");
+      const auto& child_mesh = children_meshes.at(child_id);
+      const auto& child_record = child_history[time_step_id];
+      add_child_contribution(make_not_null(&derivative), parent_mesh,
+                             parent_id, child_record.derivative, child_mesh,
+                             child_id);
+      if (value.has_value()) {
+        add_child_contribution(make_not_null(&*value), parent_mesh, parent_id,
+                               *child_record.value, child_mesh, child_id);
+      }
+    }
+    if (value.has_value()) {
+      result.insert(time_step_id, *value, derivative);
+    } else {
+      result.insert(time_step_id, TimeSteppers::History<Vars>::no_value,
+                    derivative);
+    }
+  };
+
+#ifdef SPECTRE_DEBUG
+  for (const auto& [child_id, child_history] : children_histories) {
+    ASSERT(child_history.size() == first_child_history.size() and
+               child_history.substeps().size() ==
+                   first_child_history.substeps().size(),
+           "Child " << child_id
+                    << " has a different number of records than another "
+                       "child. All children must have records for the same "
+                       "steps and substeps.");
+  }
+#endif  // SPECTRE_DEBUG
+  // Steps and substeps are inserted in order. Looking up the records of all
+  // children by their TimeStepId checks that they have the same records.
+  for (const auto& record : first_child_history) {
+    insert_record(record.time_step_id);
+  }
+  for (const auto& record : first_child_history.substeps()) {
+    insert_record(record.time_step_id);
+  }
+  return result;
+}
+}  // namespace amr::projectors
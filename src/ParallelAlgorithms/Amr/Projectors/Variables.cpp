@@ -0,0 +1,110 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/Amr/Projectors/Variables.hpp"
+
+#include <array>
+#include <cstddef>
+
+#include "DataStructures/Matrix.hpp"
+#include "Domain/Structure/ChildSize.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Projection.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace amr::projectors {
+namespace {
+Matrix projection_matrix(const Mesh<1>& old_mesh,
+                         const SegmentId& old_segment_id,
+                         const Mesh<1>& new_mesh,
+                         const SegmentId& new_segment_id) {
+  const size_t old_extent = old_mesh.extents(0);
+  const size_t new_extent = new_mesh.extents(0);
+  if (new_segment_id.refinement_level() > old_segment_id.refinement_level()) {
+    // Split: the new segment is a child of the old segment
+    const auto child_size = domain::child_size(new_segment_id, old_segment_id);
+    if (new_extent >= old_extent) {
+      return Spectral::projection_matrix_parent_to_child(old_mesh, new_mesh,
+                                                         child_size);
+    }
+    // Prolong to the child at the old resolution, then restrict to the new
+    // resolution
+    return Matrix{Spectral::projection_matrix_child_to_parent(
+                      old_mesh, new_mesh, Spectral::ChildSize::Full) *
+                  Spectral::projection_matrix_parent_to_child(
+                      old_mesh, old_mesh, child_size)};
+  } else if (new_segment_id.refinement_level() <
+             old_segment_id.refinement_level()) {
+    // Join: the old segment is a child of the new segment
+    const auto child_size = domain::child_size(old_segment_id, new_segment_id);
+    if (old_extent >= new_extent) {
+      return Spectral::projection_matrix_child_to_parent(old_mesh, new_mesh,
+                                                         child_size);
+    }
+    // Prolong to the new resolution on the child, then restrict to the parent
+    return Matrix{Spectral::projection_matrix_child_to_parent(
+                      new_mesh, new_mesh, child_size) *
+                  Spectral::projection_matrix_parent_to_child(
+                      old_mesh, new_mesh, Spectral::ChildSize::Full)};
+  }
+  ASSERT(old_segment_id == new_segment_id,
+         "Segment " << new_segment_id << " is neither " << old_segment_id
+                    << " nor its parent or child.");
+  if (new_extent > old_extent) {
+    return Spectral::projection_matrix_parent_to_child(
+        old_mesh, new_mesh, Spectral::ChildSize::Full);
+  } else if (new_extent < old_extent) {
+    return Spectral::projection_matrix_child_to_parent(
+        old_mesh, new_mesh, Spectral::ChildSize::Full);
+  }
+  // Identity
+  return {};
+}
+}  // namespace
+
+template <size_t Dim>
+std::array<Matrix, Dim> projection_matrices(
+    const Mesh<Dim>& old_mesh, const ElementId<Dim>& old_element_id,
+    const Mesh<Dim>& new_mesh, const ElementId<Dim>& new_element_id) {
+  ASSERT(old_element_id.block_id() == new_element_id.block_id(),
+         "Can't project between elements " << old_element_id << " and "
+                                           << new_element_id
+                                           << " in different blocks.");
+  std::array<Matrix, Dim> result{};
+  bool splits = false;
+  bool joins = false;
+  for (size_t d = 0; d < Dim; ++d) {
+    const auto& old_segment_id = gsl::at(old_element_id.segment_ids(), d);
+    const auto& new_segment_id = gsl::at(new_element_id.segment_ids(), d);
+    splits = splits or new_segment_id.refinement_level() >
+                           old_segment_id.refinement_level();
+    joins = joins or new_segment_id.refinement_level() <
+                         old_segment_id.refinement_level();
+    gsl::at(result, d) =
+        projection_matrix(old_mesh.slice_through(d), old_segment_id,
+                          new_mesh.slice_through(d), new_segment_id);
+  }
+  ASSERT(not(splits and joins),
+         "Element " << old_element_id << " can't split and join at once to "
+                    << new_element_id << ".");
+  return result;
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data)                                        \
+  template std::array<Matrix, DIM(data)> projection_matrices(       \
+      const Mesh<DIM(data)>& old_mesh,                              \
+      const ElementId<DIM(data)>& old_element_id,                   \
+      const Mesh<DIM(data)>& new_mesh,                              \
+      const ElementId<DIM(data)>& new_element_id);
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef DIM
+#undef INSTANTIATE
+}  // namespace amr::projectors
@@ -0,0 +1,121 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <unordered_map>
+
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace amr::projectors {
+/*!
+ * \brief The matrices that project data from the `old_mesh` of the Element
+ * with ElementId `old_element_id` to the `new_mesh` of the Element with
+ * ElementId `new_element_id`, in each dimension.
+ *
+ * \details In each dimension the new element is either the same as the old
+ * element (p-refinement), a child of the old element (split), or the parent of
+ * the old element (join). The projections use
+ * `Spectral::projection_matrix_parent_to_child` and
+ * `Spectral::projection_matrix_child_to_parent`, so they are exact when the
+ * resolution increases and are the \f$L_2\f$-projection when it decreases.
+ * An empty matrix is returned in dimensions that need no projection, which
+ * `apply_matrices` treats as the identity.
+ *
+ * When joining elements the projection from a child covers only the part of
+ * the parent that the child covers, and the data on the parent is the sum
+ * of the projections from all children.
+ *
+ * \note An element can't split in one dimension and join in another.
+ */
+template <size_t Dim>
+std::array<Matrix, Dim> projection_matrices(
+    const Mesh<Dim>& old_mesh, const ElementId<Dim>& old_element_id,
+    const Mesh<Dim>& new_mesh, const ElementId<Dim>& new_element_id);
+
+/// @{
+/// Project the `vars` of an element from its `old_mesh` to its `new_mesh`
+/// after p-refinement
+template <typename TagsList, size_t Dim>
+void variables(const gsl::not_null<Variables<TagsList>*> vars,
+               const Mesh<Dim>& old_mesh, const Mesh<Dim>& new_mesh) {
+  if (old_mesh == new_mesh) {
+    return;
+  }
+  // The ElementId only determines which part of the element the data covers,
+  // so any ElementId works for p-refinement
+  const ElementId<Dim> element_id{0};
+  *vars = apply_matrices(
+      projection_matrices(old_mesh, element_id, new_mesh, element_id), *vars,
+      old_mesh.extents());
+}
+
+template <typename TagsList, size_t Dim>
+Variables<TagsList> variables(const Variables<TagsList>& vars,
+                              const Mesh<Dim>& old_mesh,
+                              const Mesh<Dim>& new_mesh) {
+  Variables<TagsList> result = vars;
+  variables(make_not_null(&result), old_mesh, new_mesh);
+  return result;
+}
+/// @}
+
+/// Project the `parent_vars` to the child with ElementId `child_id` when the
+/// parent with ElementId `parent_id` splits
+template <typename TagsList, size_t Dim>
+Variables<TagsList> child_variables(const Variables<TagsList>& parent_vars,
+                                    const Mesh<Dim>& parent_mesh,
+                                    const ElementId<Dim>& parent_id,
+                                    const Mesh<Dim>& child_mesh,
+                                    const ElementId<Dim>& child_id) {
+  return apply_matrices(
+      projection_matrices(parent_mesh, parent_id, child_mesh, child_id),
+      parent_vars, parent_mesh.extents());
+}
+
+/// Project the `child_vars` of the child with ElementId `child_id` to the
+/// `parent_mesh` and add them to the `parent_vars`. Adding the contributions
+/// of all children that join gives the variables on the parent.
+template <typename TagsList, size_t Dim>
+void add_child_contribution(
+    const gsl::not_null<Variables<TagsList>*> parent_vars,
+    const Mesh<Dim>& parent_mesh, const ElementId<Dim>& parent_id,
+    const Variables<TagsList>& child_vars, const Mesh<Dim>& child_mesh,
+    const ElementId<Dim>& child_id) {
+  ASSERT(parent_vars->number_of_grid_points() ==
+             parent_mesh.number_of_grid_points(),
+         "The parent variables have "
+             << parent_vars->number_of_grid_points()
+             << " grid points, but the parent mesh has "
+             << parent_mesh.number_of_grid_points() << ".");
+  *parent_vars += apply_matrices(
+      projection_matrices(child_mesh, child_id, parent_mesh, parent_id),
+      child_vars, child_mesh.extents());
+}
+
+/// Project the `children_vars` to the parent with ElementId `parent_id` when
+/// the children join
+template <typename TagsList, size_t Dim>
+Variables<TagsList> parent_variables(
+    const Mesh<Dim>& parent_mesh, const ElementId<Dim>& parent_id,
+    const std::unordered_map<ElementId<Dim>, Variables<TagsList>>&
+        children_vars,
+    const std::unordered_map<ElementId<Dim>, Mesh<Dim>>& children_meshes) {
+  Variables<TagsList> result{parent_mesh.number_of_grid_points(), 0.};
+  for (const auto& [child_id, child_vars] : children_vars) {
+    ASSERT(children_meshes.count(child_id) == 1,
+           "No mesh for child " << child_id << ".");
+    add_child_contribution(make_not_null(&result), parent_mesh, parent_id,
+                           child_vars, children_meshes.at(child_id), child_id);
+  }
+  return result;
+}
+}  // namespace amr::projectors
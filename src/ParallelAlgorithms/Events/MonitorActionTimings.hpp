@@ -0,0 +1,96 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <pup.h>
+#include <utility>
+
+#include "Domain/Structure/Element.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Tags.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/TypeOfObservation.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "ParallelAlgorithms/Actions/WriteActionTimings.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Events {
+/*!
+ * \brief Event run on the DgElementArray that writes the wall-time histograms
+ * of the actions executed on each node to the reduction file.
+ *
+ * \details The zeroth element broadcasts `Actions::WriteActionTimings` to the
+ * `observers::ObserverWriter` nodegroup, which writes the
+ * `Parallel::action_timings` of every node to the `/ActionTimings/` group of
+ * the reductions file. The timings are always recorded, so this event only
+ * determines how often they are written.
+ */
+template <size_t Dim, typename ObservationValueTag>
+class MonitorActionTimings : public Event {
+ public:
+  /// \cond
+  explicit MonitorActionTimings(CkMigrateMessage* msg) : Event(msg) {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(MonitorActionTimings);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<>;
+  static constexpr Options::String help =
+      "Write the wall-time histograms of the actions executed on each node.";
+
+  MonitorActionTimings() = default;
+
+  using compute_tags_for_observation_box = tmpl::list<>;
+
+  using argument_tags =
+      tmpl::list<ObservationValueTag, domain::Tags::Element<Dim>>;
+
+  template <typename Metavariables, typename ArrayIndex,
+            typename ParallelComponent>
+  void operator()(const typename ObservationValueTag::type& observation_value,
+                  const ::Element<Dim>& element,
+                  Parallel::GlobalCache<Metavariables>& cache,
+                  const ArrayIndex& /*array_index*/,
+                  const ParallelComponent* const /*meta*/) const {
+    if (is_zeroth_element(element.id())) {
+      Parallel::simple_action<Actions::WriteActionTimings>(
+          Parallel::get_parallel_component<
+              observers::ObserverWriter<Metavariables>>(cache),
+          static_cast<double>(observation_value));
+    }
+  }
+
+  using observation_registration_tags = tmpl::list<>;
+
+  std::optional<
+      std::pair<observers::TypeOfObservation, observers::ObservationKey>>
+  get_observation_type_and_key_for_registration() const {
+    return {};
+  }
+
+  using is_ready_argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  bool needs_evolved_variables() const override { return false; }
+};
+
+/// \cond
+template <size_t Dim, typename ObservationValueTag>
+PUP::able::PUP_ID MonitorActionTimings<Dim, ObservationValueTag>::my_PUP_ID =
+    0;  // NOLINT
+/// \endcond
+}  // namespace Events
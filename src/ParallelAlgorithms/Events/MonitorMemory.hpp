@@ -39,10 +39,12 @@
 #include "Parallel/TypeTraits.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessArray.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessGroups.hpp"
+#include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessMemoryPool.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessSingleton.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Functional.hpp"
+#include "Utilities/MemoryPool.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -72,6 +74,12 @@ namespace Events {
  * component ("Blah" for example) in the input file. An ERROR will occur and a
  * list of the available components to monitor will be printed.
  *
+ * If the `memory_pool` is enabled and the `observers::Observer` group is
+ * part of the `component_list`, the allocator counters of every proc are
+ * also written to the `/MemoryMonitors/MemoryPool` subfile (see
+ * `mem_monitor::ContributeMemoryPoolData`), regardless of the components that
+ * are monitored.
+ *
  * \note Currently, the only Parallel::Algorithms::Array parallel component that
  * can be monitored is the DgElementArray itself.
  */
@@ -338,6 +346,18 @@ void MonitorMemory<Dim, ObservationValueTag>::operator()(
       }
     }
   });
+
+  // The pool keeps its counters per proc, so collect them from the branches of
+  // the Observer group
+  if constexpr (tmpl::list_contains_v<typename Metavariables::component_list,
+                                      observers::Observer<Metavariables>>) {
+    if (memory_pool::is_enabled() and is_zeroth_element(element.id())) {
+      Parallel::simple_action<mem_monitor::ProcessMemoryPool>(
+          Parallel::get_parallel_component<observers::Observer<Metavariables>>(
+              cache),
+          static_cast<double>(observation_value));
+    }
+  }
 }
 
 template <size_t Dim, typename ObservationValueTag>
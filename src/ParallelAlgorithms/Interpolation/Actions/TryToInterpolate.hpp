@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <utility>
+#include <vector>
+
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/Variables.hpp"
 #include "DataStructures/VariablesTag.hpp"
@@ -10,12 +13,18 @@
 #include "Domain/ElementLogicalCoordinates.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Domain/TagsTimeDependent.hpp"
+#include "IO/Logging/Tags.hpp"
+#include "IO/Logging/Verbosity.hpp"
 #include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
+#include "Parallel/ParallelComponentHelpers.hpp"
+#include "Parallel/Printf.hpp"
 #include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
 #include "ParallelAlgorithms/Interpolation/Tags.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/PrettyType.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -86,13 +95,82 @@ void interpolate_data(
             }
           }
 
-          // Get element logical coordinates.
-          const auto element_coord_holders = element_logical_coordinates(
-              element_ids, interp_info.block_coord_holders);
+          // Reuse the cached interpolants if the target points are the ones
+          // they were computed for, and reset the cache otherwise. The points
+          // only need to be compared once for each temporal_id, unless
+          // another temporal_id has reset the cache in the meantime.
+          auto& interpolant_cache =
+              get<Vars::HolderTag<InterpolationTargetTag, Metavariables>>(
+                  *holders)
+                  .interpolant_cache;
+          if (interp_info.interpolant_cache_generation !=
+              interpolant_cache.generation) {
+            const double validation_start_time = sys::wall_time();
+            if (interp_info.block_coord_holders !=
+                interpolant_cache.block_coord_holders) {
+              interpolant_cache.block_coord_holders =
+                  interp_info.block_coord_holders;
+              interpolant_cache.interpolants.clear();
+              ++interpolant_cache.generation;
+            }
+            interp_info.interpolant_cache_generation =
+                interpolant_cache.generation;
+            interpolant_cache.time_validating +=
+                sys::wall_time() - validation_start_time;
+          }
+
+          // Get element logical coordinates and build interpolants for the
+          // elements that aren't cached, or whose mesh has changed.
+          std::vector<ElementId<Metavariables::volume_dim>>
+              uncached_element_ids{};
+          for (const auto& element_id : element_ids) {
+            const auto cached_interpolant =
+                interpolant_cache.interpolants.find(element_id);
+            if (cached_interpolant == interpolant_cache.interpolants.end() or
+                cached_interpolant->second.mesh !=
+                    volume_info_outer.second.at(element_id).mesh) {
+              uncached_element_ids.push_back(element_id);
+            }
+          }
+          interpolant_cache.number_of_hits +=
+              element_ids.size() - uncached_element_ids.size();
+          if (not uncached_element_ids.empty()) {
+            const double start_time = sys::wall_time();
+            auto element_coord_holders = element_logical_coordinates(
+                uncached_element_ids, interp_info.block_coord_holders);
+            for (const auto& element_id : uncached_element_ids) {
+              const auto& mesh = volume_info_outer.second.at(element_id).mesh;
+              auto& cached_interpolant =
+                  interpolant_cache.interpolants[element_id];
+              cached_interpolant.mesh = mesh;
+              auto element_coord_holder =
+                  element_coord_holders.find(element_id);
+              if (element_coord_holder == element_coord_holders.end()) {
+                // The element contains none of the points
+                cached_interpolant.offsets.clear();
+                cached_interpolant.interpolator =
+                    intrp::Irregular<Metavariables::volume_dim>{};
+              } else {
+                cached_interpolant.offsets =
+                    std::move(element_coord_holder->second.offsets);
+                cached_interpolant.interpolator =
+                    intrp::Irregular<Metavariables::volume_dim>{
+                        mesh,
+                        element_coord_holder->second.element_logical_coords};
+              }
+            }
+            interpolant_cache.number_of_misses += uncached_element_ids.size();
+            interpolant_cache.time_computing_interpolants +=
+                sys::wall_time() - start_time;
+          }
 
           // Construct local vars and interpolate.
-          for (const auto& element_coord_pair : element_coord_holders) {
-            const auto& element_id = element_coord_pair.first;
+          for (const auto& element_id : element_ids) {
+            const auto& cached_interpolant =
+                interpolant_cache.interpolants.at(element_id);
+            if (cached_interpolant.offsets.empty()) {
+              continue;
+            }
             auto& volume_info = volume_info_outer.second.at(element_id);
             auto& vars_to_interpolate =
                 get<::intrp::Tags::VarsToInterpolateToTarget<
@@ -117,9 +195,7 @@ void interpolate_data(
             }
 
             // Now interpolate.
-            const auto& element_coord_holder = element_coord_pair.second;
-            intrp::Irregular<Metavariables::volume_dim> interpolator(
-                volume_info.mesh, element_coord_holder.element_logical_coords);
+            const auto& interpolator = cached_interpolant.interpolator;
             // This first branch is used if compute_vars_to_interpolate exists
             // or if the vars_to_interpolate_to_target is a subset of the
             // interpolator_source_vars.
@@ -143,8 +219,7 @@ void interpolate_data(
               interp_info.vars.emplace_back(interpolator.interpolate(
                   volume_info.source_vars_from_element));
             }
-            interp_info.global_offsets.emplace_back(
-                element_coord_holder.offsets);
+            interp_info.global_offsets.emplace_back(cached_interpolant.offsets);
           }
         }
       },
@@ -191,17 +266,41 @@ void try_to_interpolate(
           receiver_proxy, info.vars, info.global_offsets, temporal_id);
     }
 
-    // Clear interpolated data, since we don't need it anymore.
+    // Clear interpolated data, since we don't need it anymore. All local
+    // elements have sent data for this temporal_id, so the cached interpolants
+    // of any other element belong to an element that doesn't exist anymore.
     db::mutate<Tags::InterpolatedVarsHolders<Metavariables>>(
         box,
         [&temporal_id](
             const gsl::not_null<
                 typename Tags::InterpolatedVarsHolders<Metavariables>::type*>
                 holders_l) {
-          get<Vars::HolderTag<InterpolationTargetTag, Metavariables>>(
-              *holders_l)
-              .infos.erase(temporal_id);
+          auto& holder =
+              get<Vars::HolderTag<InterpolationTargetTag, Metavariables>>(
+                  *holders_l);
+          holder.interpolant_cache.evict_elements_not_in(
+              holder.infos.at(temporal_id)
+                  .interpolation_is_done_for_these_elements);
+          holder.infos.erase(temporal_id);
         });
+
+    using verbosity_tag = logging::Tags::Verbosity<OptionTags::Interpolator>;
+    if constexpr (Parallel::is_in_global_cache<Metavariables, verbosity_tag>) {
+      if (Parallel::get<verbosity_tag>(*cache) >= ::Verbosity::Verbose) {
+        const auto& interpolant_cache =
+            get<Vars::HolderTag<InterpolationTargetTag, Metavariables>>(
+                db::get<Tags::InterpolatedVarsHolders<Metavariables>>(*box))
+                .interpolant_cache;
+        Parallel::printf(
+            "%s, core %d, %s: Interpolant cache hits: %zu, misses: %zu, time "
+            "computing interpolants: %f s, time validating points: %f s\n",
+            pretty_type::name<InterpolationTargetTag>(), sys::my_proc(),
+            temporal_id, interpolant_cache.number_of_hits,
+            interpolant_cache.number_of_misses,
+            interpolant_cache.time_computing_interpolants,
+            interpolant_cache.time_validating);
+      }
+    }
   }
 }
 
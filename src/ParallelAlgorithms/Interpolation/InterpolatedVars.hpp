@@ -15,6 +15,8 @@
 #include "DataStructures/Variables.hpp"
 #include "Domain/Structure/BlockId.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
 
 namespace intrp {
 
@@ -59,6 +61,10 @@ struct Info {
   /// already been done for this `Info`.
   std::unordered_set<ElementId<VolumeDim>>
       interpolation_is_done_for_these_elements{};
+  /// The `InterpolantCache::generation` that `block_coord_holders` was found
+  /// to match, or `std::nullopt` if it hasn't been checked against the
+  /// current cache.
+  std::optional<size_t> interpolant_cache_generation{};
 };
 
 template <size_t VolumeDim, typename TagList>
@@ -67,6 +73,7 @@ void pup(PUP::er& p, Info<VolumeDim, TagList>& t) {  // NOLINT
   p | t.vars;
   p | t.global_offsets;
   p | t.interpolation_is_done_for_these_elements;
+  p | t.interpolant_cache_generation;
 }
 
 template <size_t VolumeDim, typename TagList>
@@ -74,6 +81,91 @@ void operator|(PUP::er& p, Info<VolumeDim, TagList>& t) {  // NOLINT
   pup(p, t);
 }
 
+/// \brief Interpolants from the local `Element`s to the points of an
+/// `InterpolationTarget`, reused across `temporal_id`s.
+///
+/// Targets whose points are fixed in block logical coordinates (e.g. a
+/// `Sphere` in a time-independent frame, or `SpecifiedPoints`) send the same
+/// `block_coord_holders` at every `temporal_id`, so the element logical
+/// coordinates of the points and the interpolation matrices only need to be
+/// computed once for each `Element`. The cache is reset whenever an `Info`
+/// holds different `block_coord_holders`, e.g. because the points of the
+/// target are time dependent, and an entry is recomputed when the `Mesh` of
+/// its `Element` has changed. Entries of `Element`s that no longer send data to
+/// this `Interpolator`, e.g. because AMR removed them, are evicted once a
+/// `temporal_id` has been interpolated, see `evict_elements_not_in`.
+///
+/// The cache counts how often it was used, so the saving can be measured. The
+/// `Interpolator` prints the counters with `::Verbosity::Verbose` or higher,
+/// see `intrp::Interpolator`.
+template <size_t VolumeDim>
+struct InterpolantCache {
+  struct ElementInterpolant {
+    Mesh<VolumeDim> mesh{};
+    /// Indices into `block_coord_holders` of the points in the `Element`.
+    /// Empty if the `Element` contains none of the points.
+    std::vector<size_t> offsets{};
+    Irregular<VolumeDim> interpolator{};
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p) {
+      p | mesh;
+      p | offsets;
+      p | interpolator;
+    }
+  };
+
+  /// The points that the cached interpolants were computed for
+  std::vector<std::optional<
+      IdPair<domain::BlockId,
+             tnsr::I<double, VolumeDim, typename ::Frame::BlockLogical>>>>
+      block_coord_holders{};
+  std::unordered_map<ElementId<VolumeDim>, ElementInterpolant> interpolants{};
+  /// Incremented every time the cache is reset
+  size_t generation = 0;
+
+  /// @{
+  /// Timing counters. `number_of_hits` and `number_of_misses` count the
+  /// interpolations from an `Element` that reused or computed an interpolant,
+  /// respectively. `time_computing_interpolants` is the wall time in seconds
+  /// spent on the misses, and `time_validating` is the wall time spent
+  /// comparing `block_coord_holders` to the cached points.
+  size_t number_of_hits = 0;
+  size_t number_of_misses = 0;
+  double time_computing_interpolants = 0.;
+  double time_validating = 0.;
+  /// @}
+
+  /// Remove the interpolants of all `Element`s that are not in
+  /// `local_element_ids`, the `Element`s that sent data for a `temporal_id`
+  /// that has been interpolated completely.
+  void evict_elements_not_in(
+      const std::unordered_set<ElementId<VolumeDim>>& local_element_ids) {
+    for (auto it = interpolants.begin(); it != interpolants.end();) {
+      if (local_element_ids.count(it->first) == 0) {
+        it = interpolants.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+};
+
+template <size_t VolumeDim>
+void pup(PUP::er& p, InterpolantCache<VolumeDim>& t) {  // NOLINT
+  p | t.block_coord_holders;
+  p | t.interpolants;
+  p | t.generation;
+  p | t.number_of_hits;
+  p | t.number_of_misses;
+  p | t.time_computing_interpolants;
+  p | t.time_validating;
+}
+
+template <size_t VolumeDim>
+void operator|(PUP::er& p, InterpolantCache<VolumeDim>& t) {  // NOLINT
+  pup(p, t);
+}
+
 /// Holds `Info`s at all `temporal_id`s for a given
 /// `InterpolationTargetTag`.  Also holds `temporal_id`s when data has
 /// been interpolated; this is used for cleanup purposes.  All
@@ -89,6 +181,7 @@ struct Holder {
       infos;
   std::deque<typename InterpolationTargetTag::temporal_id::type>
       temporal_ids_when_data_has_been_interpolated;
+  InterpolantCache<Metavariables::volume_dim> interpolant_cache{};
 };
 
 template <typename Metavariables, typename InterpolationTargetTag,
@@ -98,6 +191,7 @@ void pup(PUP::er& p,                                              // NOLINT
              t) {                                                 // NOLINT
   p | t.infos;
   p | t.temporal_ids_when_data_has_been_interpolated;
+  p | t.interpolant_cache;
 }
 
 template <typename Metavariables, typename InterpolationTargetTag,
@@ -5,6 +5,7 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/TagName.hpp"
+#include "IO/Logging/Tags.hpp"
 #include "IO/Observer/Actions/ObserverRegistration.hpp"
 #include "IO/Observer/Actions/RegisterWithObservers.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
@@ -19,6 +20,7 @@
 #include "ParallelAlgorithms/Actions/TerminatePhase.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/DumpInterpolatorVolumeData.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/InitializeInterpolator.hpp"
+#include "ParallelAlgorithms/Interpolation/Tags.hpp"
 #include "Utilities/GetOutput.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TypeTraits/IsA.hpp"
@@ -71,11 +73,18 @@ struct get_temporal_id {
 /// \brief ParallelComponent responsible for collecting data from
 /// `Element`s and interpolating it onto `InterpolationTarget`s.
 ///
+/// With the `Interpolator.Verbosity` option set to `Verbose` or higher, the
+/// `Interpolator` prints the counters of the `intrp::Vars::InterpolantCache`
+/// of a target every time it has interpolated all local `Element`s at a
+/// `temporal_id`.
+///
 /// For requirements on Metavariables, see InterpolationTarget
 template <class Metavariables>
 struct Interpolator {
   using chare_type = Parallel::Algorithms::Group;
   using metavariables = Metavariables;
+  using const_global_cache_tags =
+      tmpl::list<logging::Tags::Verbosity<OptionTags::Interpolator>>;
   using all_interpolation_target_tags = tmpl::transform<
       tmpl::filter<typename Metavariables::component_list,
                    tt::is_a<intrp::InterpolationTarget, tmpl::_1>>,
@@ -58,6 +58,20 @@ namespace LinearSolver::cg {
  * flag if the `Convergence::Tags::Criteria` are met.
  * 5. `UpdateOperand` (on elements): Update \f$p\f$.
  *
+ * \par Pipelined algorithm
+ * With the `LinearSolver::cg::OptionTags::Pipelined` option the solver runs
+ * the pipelined conjugate gradient algorithm of \cite Ghysels2014 instead
+ * (Alg. 4, without preconditioning). It recurs additional vectors so that both
+ * inner products of an iteration, \f$\langle r, r\rangle\f$ and
+ * \f$\langle A(r), r\rangle\f$, are computed in a single reduction, and it
+ * overlaps that reduction with the next operator application. In exact
+ * arithmetic the iterates are the same as the standard algorithm's, so
+ * convergence is monitored in the same way. In this mode the operand holds
+ * \f$w=A(r)\f$ rather than the search direction \f$p\f$, and the operator
+ * is applied once more at the start of the solve to compute it. The
+ * additional vector recurrences make the algorithm somewhat less stable, so
+ * the attainable residual can be larger than with the standard algorithm.
+ *
  * \see Gmres for a linear solver that can invert nonsymmetric operators
  * \f$A\f$.
  */
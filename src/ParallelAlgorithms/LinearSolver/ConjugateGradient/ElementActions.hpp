@@ -11,6 +11,7 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "NumericalAlgorithms/Convergence/HasConverged.hpp"
 #include "NumericalAlgorithms/Convergence/Tags.hpp"
 #include "NumericalAlgorithms/LinearSolver/InnerProduct.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
@@ -19,6 +20,7 @@
 #include "Parallel/Reduction.hpp"
 #include "ParallelAlgorithms/LinearSolver/ConjugateGradient/ResidualMonitorActions.hpp"
 #include "ParallelAlgorithms/LinearSolver/ConjugateGradient/Tags/InboxTags.hpp"
+#include "ParallelAlgorithms/LinearSolver/ConjugateGradient/Tags/Pipelined.hpp"
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
 #include "Utilities/Functional.hpp"
 #include "Utilities/Gsl.hpp"
@@ -26,9 +28,6 @@
 #include "Utilities/TMPL.hpp"
 
 /// \cond
-namespace Convergence {
-struct HasConverged;
-}  // namespace Convergence
 namespace tuples {
 template <typename...>
 class TaggedTuple;
@@ -37,6 +36,8 @@ namespace LinearSolver::cg::detail {
 template <typename Metavariables, typename FieldsTag, typename OptionsGroup>
 struct ResidualMonitor;
 template <typename FieldsTag, typename OptionsGroup, typename Label>
+struct InitializeHasConverged;
+template <typename FieldsTag, typename OptionsGroup, typename Label>
 struct UpdateOperand;
 }  // namespace LinearSolver::cg::detail
 /// \endcond
@@ -57,6 +58,8 @@ struct PrepareSolve {
       db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>;
 
  public:
+  using const_global_cache_tags = tmpl::list<cg::Tags::Pipelined<OptionsGroup>>;
+
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             typename ArrayIndex, typename ActionList,
             typename ParallelComponent>
@@ -78,6 +81,23 @@ struct PrepareSolve {
         },
         get<source_tag>(box), get<operator_applied_to_fields_tag>(box));
 
+    // The pipelined algorithm applies the operator to the initial residual
+    // first, and includes the initial residual magnitude in the first fused
+    // reduction in `PerformStep`
+    if (db::get<cg::Tags::Pipelined<OptionsGroup>>(box)) {
+      db::mutate<Convergence::Tags::HasConverged<OptionsGroup>>(
+          make_not_null(&box),
+          [](const gsl::not_null<Convergence::HasConverged*> has_converged) {
+            *has_converged = Convergence::HasConverged{};
+          });
+      constexpr size_t apply_operator_index =
+          tmpl::index_of<ActionList,
+                         InitializeHasConverged<FieldsTag, OptionsGroup,
+                                                Label>>::value +
+          1;
+      return {Parallel::AlgorithmExecution::Continue, apply_operator_index};
+    }
+
     // Perform global reduction to compute initial residual magnitude square for
     // residual monitor
     const auto& residual = get<residual_tag>(box);
@@ -133,8 +153,38 @@ struct InitializeHasConverged {
   }
 };
 
+// Contribute the fused reduction of the pipelined algorithm: the residual
+// magnitude square and the inner product of the residual with the operator
+// applied to it, which the pipelined algorithm stores as the operand
+template <typename FieldsTag, typename OptionsGroup,
+          typename ParallelComponent, typename DbTagsList,
+          typename Metavariables, typename ArrayIndex>
+void contribute_pipelined_reduction(
+    const db::DataBox<DbTagsList>& box,
+    Parallel::GlobalCache<Metavariables>& cache, const ArrayIndex& array_index,
+    const size_t iteration_id) {
+  using operand_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Operand, FieldsTag>;
+  using residual_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Residual, FieldsTag>;
+  const auto& residual = get<residual_tag>(box);
+  Parallel::contribute_to_reduction<
+      UpdatePipelinedResidual<FieldsTag, OptionsGroup, ParallelComponent>>(
+      Parallel::ReductionData<
+          Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
+          Parallel::ReductionDatum<double, funcl::Plus<>>,
+          Parallel::ReductionDatum<double, funcl::Plus<>>>{
+          iteration_id, inner_product(residual, residual),
+          inner_product(get<operand_tag>(box), residual)},
+      Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
+      Parallel::get_parallel_component<
+          ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache));
+}
+
 template <typename FieldsTag, typename OptionsGroup, typename Label>
 struct PerformStep {
+  using const_global_cache_tags = tmpl::list<cg::Tags::Pipelined<OptionsGroup>>;
+
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             typename ArrayIndex, typename ActionList,
             typename ParallelComponent>
@@ -150,6 +200,39 @@ struct PerformStep {
     using operator_tag =
         db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo, operand_tag>;
 
+    if (db::get<cg::Tags::Pipelined<OptionsGroup>>(box)) {
+      // The operator is applied to the initial residual in iteration 0 and to
+      // the operand in all following iterations, so the iteration ID
+      // distinguishes the two cases. The latter only needs the result of the
+      // reduction, so proceed to receive it.
+      const size_t iteration_id =
+          db::get<Convergence::Tags::IterationId<OptionsGroup>>(box);
+      if (iteration_id > 0) {
+        return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+      }
+      db::mutate<operand_tag, Convergence::Tags::IterationId<OptionsGroup>>(
+          make_not_null(&box),
+          [](const auto operand,
+             const gsl::not_null<size_t*> local_iteration_id,
+             const auto& operator_applied_to_residual) {
+            *operand = operator_applied_to_residual;
+            // Advance the iteration ID before applying the operator again, so
+            // consecutive operator applications don't share it
+            ++(*local_iteration_id);
+          },
+          get<operator_tag>(box));
+      contribute_pipelined_reduction<FieldsTag, OptionsGroup,
+                                     ParallelComponent>(box, cache, array_index,
+                                                        iteration_id);
+      // Overlap the reduction with the next operator application
+      constexpr size_t apply_operator_index =
+          tmpl::index_of<ActionList,
+                         InitializeHasConverged<FieldsTag, OptionsGroup,
+                                                Label>>::value +
+          1;
+      return {Parallel::AlgorithmExecution::Continue, apply_operator_index};
+    }
+
     // At this point Ap must have been computed in a previous action
     // We compute the inner product <p,p> w.r.t A. This requires a global
     // reduction.
@@ -181,9 +264,19 @@ struct UpdateFieldValues {
       db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo, operand_tag>;
   using residual_tag =
       db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>;
+  using search_direction_tag =
+      db::add_tag_prefix<cg::Tags::SearchDirection, fields_tag>;
+  using operator_applied_to_search_direction_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo,
+                         search_direction_tag>;
+  using operator_squared_applied_to_search_direction_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo,
+                         operator_applied_to_search_direction_tag>;
 
  public:
-  using inbox_tags = tmpl::list<Tags::Alpha<OptionsGroup>>;
+  using const_global_cache_tags = tmpl::list<cg::Tags::Pipelined<OptionsGroup>>;
+  using inbox_tags = tmpl::list<Tags::Alpha<OptionsGroup>,
+                                Tags::PipelinedStep<OptionsGroup>>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             typename ArrayIndex, typename ActionList,
@@ -193,6 +286,11 @@ struct UpdateFieldValues {
       Parallel::GlobalCache<Metavariables>& cache,
       const ArrayIndex& array_index, const ActionList /*meta*/,
       const ParallelComponent* const /*meta*/) {
+    if (db::get<cg::Tags::Pipelined<OptionsGroup>>(box)) {
+      return apply_pipelined<ActionList, ParallelComponent>(
+          make_not_null(&box), inboxes, cache, array_index);
+    }
+
     auto& inbox = get<Tags::Alpha<OptionsGroup>>(inboxes);
     const auto& iteration_id =
         db::get<Convergence::Tags::IterationId<OptionsGroup>>(box);
@@ -229,6 +327,95 @@ struct UpdateFieldValues {
 
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
+
+ private:
+  // Update all vectors with the recurrences of the pipelined algorithm (see
+  // Alg. 4 in \cite Ghysels2014), then start the next fused reduction and
+  // overlap it with the next operator application. The operand holds
+  // \f$w=A(r)\f$ and the operator applied to it holds \f$q=A(w)\f$.
+  template <typename ActionList, typename ParallelComponent,
+            typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex>
+  static Parallel::iterable_action_return_t apply_pipelined(
+      const gsl::not_null<db::DataBox<DbTagsList>*> box,
+      tuples::TaggedTuple<InboxTags...>& inboxes,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& array_index) {
+    // The iteration ID was advanced before the operator application already
+    const size_t iteration_id =
+        db::get<Convergence::Tags::IterationId<OptionsGroup>>(*box) - 1;
+    auto& inbox = get<Tags::PipelinedStep<OptionsGroup>>(inboxes);
+    if (inbox.find(iteration_id) == inbox.end()) {
+      return {Parallel::AlgorithmExecution::Retry, std::nullopt};
+    }
+
+    auto received_data = std::move(inbox.extract(iteration_id).mapped());
+    const double alpha = get<0>(received_data);
+    const double beta = get<1>(received_data);
+    auto& has_converged = get<2>(received_data);
+    db::mutate<Convergence::Tags::HasConverged<OptionsGroup>>(
+        box, [&has_converged](const gsl::not_null<Convergence::HasConverged*>
+                                  local_has_converged) {
+          *local_has_converged = std::move(has_converged);
+        });
+
+    // The fields and the residual are current when the solve has converged.
+    // Reset the iteration ID to the number of completed iterations, like the
+    // standard algorithm.
+    if (get<Convergence::Tags::HasConverged<OptionsGroup>>(*box)) {
+      db::mutate<Convergence::Tags::IterationId<OptionsGroup>>(
+          box, [iteration_id](const gsl::not_null<size_t*> local_iteration_id) {
+            *local_iteration_id = iteration_id;
+          });
+      constexpr size_t step_end_index =
+          tmpl::index_of<ActionList,
+                         UpdateOperand<FieldsTag, OptionsGroup, Label>>::value;
+      return {Parallel::AlgorithmExecution::Continue, step_end_index + 1};
+    }
+
+    db::mutate<fields_tag, residual_tag, operand_tag, search_direction_tag,
+               operator_applied_to_search_direction_tag,
+               operator_squared_applied_to_search_direction_tag,
+               Convergence::Tags::IterationId<OptionsGroup>>(
+        box,
+        [alpha, beta, iteration_id](
+            const auto fields, const auto residual, const auto operand,
+            const auto search_direction,
+            const auto operator_applied_to_search_direction,
+            const auto operator_squared_applied_to_search_direction,
+            const gsl::not_null<size_t*> local_iteration_id,
+            const auto& operator_applied_to_operand) {
+          if (iteration_id == 0) {
+            *operator_squared_applied_to_search_direction =
+                operator_applied_to_operand;
+            *operator_applied_to_search_direction = *operand;
+            *search_direction = *residual;
+          } else {
+            *operator_squared_applied_to_search_direction =
+                operator_applied_to_operand +
+                beta * *operator_squared_applied_to_search_direction;
+            *operator_applied_to_search_direction =
+                *operand + beta * *operator_applied_to_search_direction;
+            *search_direction = *residual + beta * *search_direction;
+          }
+          *fields += alpha * *search_direction;
+          *residual -= alpha * *operator_applied_to_search_direction;
+          *operand -= alpha * *operator_squared_applied_to_search_direction;
+          ++(*local_iteration_id);
+        },
+        get<operator_tag>(*box));
+
+    contribute_pipelined_reduction<FieldsTag, OptionsGroup, ParallelComponent>(
+        *box, cache, array_index, iteration_id + 1);
+
+    // Overlap the reduction with the next operator application
+    constexpr size_t apply_operator_index =
+        tmpl::index_of<ActionList,
+                       InitializeHasConverged<FieldsTag, OptionsGroup,
+                                              Label>>::value +
+        1;
+    return {Parallel::AlgorithmExecution::Continue, apply_operator_index};
+  }
 };
 
 template <typename FieldsTag, typename OptionsGroup, typename Label>
@@ -15,6 +15,7 @@
 #include "NumericalAlgorithms/Convergence/Tags.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
+#include "ParallelAlgorithms/LinearSolver/ConjugateGradient/Tags/Pipelined.hpp"
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
 
 /// \cond
@@ -42,12 +43,24 @@ struct InitializeElement {
       db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo, operand_tag>;
   using residual_tag =
       db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>;
+  // Only used by the pipelined algorithm
+  using search_direction_tag =
+      db::add_tag_prefix<cg::Tags::SearchDirection, fields_tag>;
+  using operator_applied_to_search_direction_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo,
+                         search_direction_tag>;
+  using operator_squared_applied_to_search_direction_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo,
+                         operator_applied_to_search_direction_tag>;
 
  public:
   using simple_tags =
       tmpl::list<Convergence::Tags::IterationId<OptionsGroup>,
                  operator_applied_to_fields_tag, operand_tag,
                  operator_applied_to_operand_tag, residual_tag,
+                 search_direction_tag,
+                 operator_applied_to_search_direction_tag,
+                 operator_squared_applied_to_search_direction_tag,
                  Convergence::Tags::HasConverged<OptionsGroup>>;
   using compute_tags = tmpl::list<>;
 
@@ -21,6 +21,7 @@
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
+#include "ParallelAlgorithms/LinearSolver/ConjugateGradient/Tags/Pipelined.hpp"
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -75,7 +76,8 @@ struct InitializeResidualMonitor {
 
  public:
   using simple_tags =
-      tmpl::list<residual_square_tag, initial_residual_magnitude_tag>;
+      tmpl::list<residual_square_tag, initial_residual_magnitude_tag,
+                 Tags::StepLength<OptionsGroup>>;
   using compute_tags = tmpl::list<>;
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             typename ArrayIndex, typename ActionList,
@@ -86,9 +88,11 @@ struct InitializeResidualMonitor {
       const Parallel::GlobalCache<Metavariables>& /*cache*/,
       const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
       const ParallelComponent* const /*meta*/) {
-    // The `InitializeResidual` action populates these tags with initial values
+    // The `InitializeResidual` and `UpdatePipelinedResidual` actions populate
+    // these tags with initial values
     Initialization::mutate_assign<simple_tags>(
         make_not_null(&box), std::numeric_limits<double>::signaling_NaN(),
+        std::numeric_limits<double>::signaling_NaN(),
         std::numeric_limits<double>::signaling_NaN());
     return {Parallel::AlgorithmExecution::Pause, std::nullopt};
   }
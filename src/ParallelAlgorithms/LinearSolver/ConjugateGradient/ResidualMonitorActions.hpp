@@ -17,6 +17,7 @@
 #include "Parallel/Invoke.hpp"
 #include "Parallel/Printf.hpp"
 #include "ParallelAlgorithms/LinearSolver/ConjugateGradient/Tags/InboxTags.hpp"
+#include "ParallelAlgorithms/LinearSolver/ConjugateGradient/Tags/Pipelined.hpp"
 #include "ParallelAlgorithms/LinearSolver/Observe.hpp"
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
@@ -178,4 +179,107 @@ struct UpdateResidual {
   }
 };
 
+// Receives the fused reduction of the pipelined algorithm: the residual
+// magnitude square \f$\gamma_i=\langle r_i,r_i\rangle\f$ and the inner
+// product \f$\delta_i=\langle A(r_i),r_i\rangle\f$. Monitors convergence of
+// the residual \f$r_i\f$ and computes the step length \f$\alpha_i\f$ and the
+// ratio \f$\beta_i=\gamma_i/\gamma_{i-1}\f$ from the recurrence in
+// \cite Ghysels2014.
+template <typename FieldsTag, typename OptionsGroup, typename BroadcastTarget>
+struct UpdatePipelinedResidual {
+ private:
+  using fields_tag = FieldsTag;
+  using residual_square_tag = LinearSolver::Tags::MagnitudeSquare<
+      db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>>;
+  using initial_residual_magnitude_tag =
+      ::Tags::Initial<LinearSolver::Tags::Magnitude<
+          db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>>>;
+  using step_length_tag = Tags::StepLength<OptionsGroup>;
+
+ public:
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex,
+            typename DataBox = db::DataBox<DbTagsList>>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const size_t iteration_id, const double residual_square,
+                    const double residual_operator_inner_product) {
+    // The residual in the reduction is the residual after `iteration_id`
+    // completed iterations
+    const double residual_magnitude = sqrt(residual_square);
+    if (iteration_id == 0) {
+      db::mutate<initial_residual_magnitude_tag>(
+          make_not_null(&box),
+          [residual_magnitude](
+              const gsl::not_null<double*> initial_residual_magnitude) {
+            *initial_residual_magnitude = residual_magnitude;
+          });
+    }
+
+    LinearSolver::observe_detail::contribute_to_reduction_observer<
+        OptionsGroup, ParallelComponent>(iteration_id, residual_magnitude,
+                                         cache);
+
+    // Determine whether the linear solver has converged
+    Convergence::HasConverged has_converged{
+        get<Convergence::Tags::Criteria<OptionsGroup>>(box), iteration_id,
+        residual_magnitude, get<initial_residual_magnitude_tag>(box)};
+
+    // Do some logging
+    if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(cache) >=
+                 ::Verbosity::Quiet)) {
+      if (iteration_id == 0) {
+        Parallel::printf("%s initialized with residual: %e\n",
+                         pretty_type::name<OptionsGroup>(),
+                         residual_magnitude);
+      } else {
+        Parallel::printf(
+            "%s(%zu) iteration complete. Remaining residual: %e\n",
+            pretty_type::name<OptionsGroup>(), iteration_id,
+            residual_magnitude);
+      }
+    }
+    if (UNLIKELY(has_converged and get<logging::Tags::Verbosity<OptionsGroup>>(
+                                       cache) >= ::Verbosity::Quiet)) {
+      if (iteration_id == 0) {
+        Parallel::printf("%s has converged without any iterations: %s\n",
+                         pretty_type::name<OptionsGroup>(), has_converged);
+      } else {
+        Parallel::printf("%s has converged in %zu iterations: %s\n",
+                         pretty_type::name<OptionsGroup>(), iteration_id,
+                         has_converged);
+      }
+    }
+
+    // Compute the step only if there is a next iteration, to avoid dividing by
+    // zero when the residual vanishes
+    double alpha = 0.;
+    double beta = 0.;
+    if (not has_converged) {
+      if (iteration_id == 0) {
+        alpha = residual_square / residual_operator_inner_product;
+      } else {
+        beta = residual_square / get<residual_square_tag>(box);
+        alpha = residual_square /
+                (residual_operator_inner_product -
+                 beta * residual_square / get<step_length_tag>(box));
+      }
+    }
+    db::mutate<residual_square_tag, step_length_tag>(
+        make_not_null(&box),
+        [residual_square, alpha](
+            const gsl::not_null<double*> local_residual_square,
+            const gsl::not_null<double*> step_length) {
+          *local_residual_square = residual_square;
+          *step_length = alpha;
+        });
+
+    Parallel::receive_data<Tags::PipelinedStep<OptionsGroup>>(
+        Parallel::get_parallel_component<BroadcastTarget>(cache), iteration_id,
+        // NOLINTNEXTLINE(performance-move-const-arg)
+        std::make_tuple(alpha, beta, std::move(has_converged)));
+  }
+};
+
 }  // namespace LinearSolver::cg::detail
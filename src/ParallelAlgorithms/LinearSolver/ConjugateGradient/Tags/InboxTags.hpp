@@ -35,4 +35,15 @@ struct ResidualRatioAndHasConverged
       std::map<temporal_id, std::tuple<double, Convergence::HasConverged>>;
 };
 
+/// The step length \f$\alpha\f$, the ratio \f$\beta\f$ of the new and old
+/// residual magnitude squares and the convergence status of the pipelined
+/// conjugate gradient algorithm
+template <typename OptionsGroup>
+struct PipelinedStep
+    : Parallel::InboxInserters::Value<PipelinedStep<OptionsGroup>> {
+  using temporal_id = size_t;
+  using type = std::map<temporal_id,
+                        std::tuple<double, double, Convergence::HasConverged>>;
+};
+
 }  // namespace LinearSolver::cg::detail::Tags
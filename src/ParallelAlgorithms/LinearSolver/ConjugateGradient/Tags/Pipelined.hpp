@@ -0,0 +1,72 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <string>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataBox/TagName.hpp"
+#include "Options/Options.hpp"
+#include "Utilities/PrettyType.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace LinearSolver::cg {
+
+namespace OptionTags {
+
+template <typename OptionsGroup>
+struct Pipelined {
+  using type = bool;
+  static constexpr Options::String help =
+      "Fuse the inner products of each iteration into a single global "
+      "reduction and overlap it with the operator application. Needs one "
+      "additional operator application to start the solve and more memory.";
+  using group = OptionsGroup;
+};
+
+}  // namespace OptionTags
+
+/// DataBox tags for the `LinearSolver::cg::ConjugateGradient` linear solver
+namespace Tags {
+
+/// Whether or not to run the pipelined variant of the conjugate gradient
+/// algorithm
+///
+/// \see `LinearSolver::cg::ConjugateGradient`
+template <typename OptionsGroup>
+struct Pipelined : db::SimpleTag {
+  using type = bool;
+  static constexpr bool pass_metavariables = false;
+  using option_tags = tmpl::list<OptionTags::Pipelined<OptionsGroup>>;
+  static bool create_from_options(const bool value) { return value; }
+  static std::string name() {
+    return "Pipelined(" + pretty_type::name<OptionsGroup>() + ")";
+  }
+};
+
+/// The search direction \f$p\f$ of the pipelined conjugate gradient algorithm.
+/// In the standard algorithm the search direction is the operand.
+template <typename Tag>
+struct SearchDirection : db::PrefixTag, db::SimpleTag {
+  static std::string name() {
+    // Add "Linear" prefix to abbreviate the namespace for uniqueness
+    return "LinearSearchDirection(" + db::tag_name<Tag>() + ")";
+  }
+  using type = typename Tag::type;
+  using tag = Tag;
+};
+
+}  // namespace Tags
+}  // namespace LinearSolver::cg
+
+namespace LinearSolver::cg::detail::Tags {
+
+/// The step length \f$\alpha\f$ of the previous iteration, which the pipelined
+/// conjugate gradient algorithm needs to compute the next step length
+template <typename OptionsGroup>
+struct StepLength : db::SimpleTag {
+  using type = double;
+};
+
+}  // namespace LinearSolver::cg::detail::Tags
@@ -9,12 +9,14 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "NumericalAlgorithms/Convergence/HasConverged.hpp"
 #include "NumericalAlgorithms/Convergence/Tags.hpp"
 #include "NumericalAlgorithms/LinearSolver/InnerProduct.hpp"
+#include "NumericalAlgorithms/LinearSolver/Orthogonalization.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/GetSection.hpp"
 #include "Parallel/GlobalCache.hpp"
@@ -23,8 +25,10 @@
 #include "Parallel/Tags/Section.hpp"
 #include "ParallelAlgorithms/LinearSolver/Gmres/ResidualMonitorActions.hpp"
 #include "ParallelAlgorithms/LinearSolver/Gmres/Tags/InboxTags.hpp"
+#include "ParallelAlgorithms/LinearSolver/Gmres/Tags/Orthogonalization.hpp"
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Functional.hpp"
 #include "Utilities/GetOutput.hpp"
 #include "Utilities/Gsl.hpp"
@@ -52,6 +56,46 @@ struct NormalizeOperandAndUpdateField;
 
 namespace LinearSolver::gmres::detail {
 
+// Contribute the projections of the operand on all basis vectors and its
+// magnitude squared to a single reduction. Used by the
+// `LinearSolver::Orthogonalization::ClassicalGramSchmidt` and
+// `LinearSolver::Orthogonalization::Pipelined` schemes.
+template <typename FieldsTag, typename OptionsGroup, typename ArraySectionIdTag,
+          typename ParallelComponent, typename DbTagsList,
+          typename Metavariables, typename ArrayIndex>
+void contribute_fused_orthogonalization(
+    const gsl::not_null<db::DataBox<DbTagsList>*> box,
+    Parallel::GlobalCache<Metavariables>& cache, const ArrayIndex& array_index,
+    const size_t iteration_id, const size_t orthogonalization_iteration_id) {
+  using operand_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Operand, FieldsTag>;
+  using basis_history_tag =
+      LinearSolver::Tags::KrylovSubspaceBasis<operand_tag>;
+  const auto& operand = get<operand_tag>(*box);
+  const auto& basis_history = get<basis_history_tag>(*box);
+  std::vector<double> inner_products(basis_history.size() + 1);
+  for (size_t j = 0; j < basis_history.size(); ++j) {
+    inner_products[j] = inner_product(gsl::at(basis_history, j), operand);
+  }
+  inner_products.back() = inner_product(operand, operand);
+
+  auto& section =
+      Parallel::get_section<ParallelComponent, ArraySectionIdTag>(box);
+  Parallel::contribute_to_reduction<
+      StoreFusedOrthogonalization<FieldsTag, OptionsGroup, ParallelComponent>>(
+      Parallel::ReductionData<
+          Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
+          Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
+          Parallel::ReductionDatum<std::vector<double>,
+                                   funcl::ElementWise<funcl::Plus<>>>>{
+          iteration_id, orthogonalization_iteration_id,
+          std::move(inner_products)},
+      Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
+      Parallel::get_parallel_component<
+          ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache),
+      make_not_null(&section));
+}
+
 template <typename FieldsTag, typename OptionsGroup, bool Preconditioned,
           typename Label, typename SourceTag, typename ArraySectionIdTag>
 struct PrepareSolve {
@@ -67,6 +111,9 @@ struct PrepareSolve {
       LinearSolver::Tags::KrylovSubspaceBasis<operand_tag>;
 
  public:
+  using const_global_cache_tags =
+      tmpl::list<gmres::Tags::Orthogonalization<OptionsGroup>>;
+
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             typename ArrayIndex, typename ActionList,
             typename ParallelComponent>
@@ -76,6 +123,24 @@ struct PrepareSolve {
       Parallel::GlobalCache<Metavariables>& cache,
       const ArrayIndex& array_index, const ActionList /*meta*/,
       const ParallelComponent* const /*meta*/) {
+    // The pipelined scheme applies the operator to the unorthogonalized
+    // operand, which doesn't work with a (possibly nonlinear) preconditioner.
+    // It also assumes all elements apply the operator in every step.
+    if constexpr (Preconditioned or
+                  not std::is_same_v<ArraySectionIdTag, void>) {
+      if (db::get<gmres::Tags::Orthogonalization<OptionsGroup>>(box) ==
+          LinearSolver::Orthogonalization::Pipelined) {
+        ERROR("The '"
+              << LinearSolver::Orthogonalization::Pipelined
+              << "' orthogonalization of the GMRES solver '"
+              << pretty_type::name<OptionsGroup>()
+              << "' supports neither preconditioning nor array sections. "
+                 "Choose '"
+              << LinearSolver::Orthogonalization::ClassicalGramSchmidt
+              << "' instead.");
+      }
+    }
+
     db::mutate<Convergence::Tags::IterationId<OptionsGroup>>(
         make_not_null(&box),
         [](const gsl::not_null<size_t*> iteration_id) { *iteration_id = 0; });
@@ -130,6 +195,16 @@ struct PrepareSolve {
             *preconditioned_basis_history =
                 typename preconditioned_basis_history_tag::type{};
           });
+    } else {
+      using operator_basis_history_tag =
+          LinearSolver::Tags::KrylovSubspaceBasis<db::add_tag_prefix<
+              LinearSolver::Tags::OperatorAppliedTo, operand_tag>>;
+
+      db::mutate<operator_basis_history_tag>(
+          make_not_null(&box), [](const auto operator_basis_history) {
+            *operator_basis_history =
+                typename operator_basis_history_tag::type{};
+          });
     }
 
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
@@ -292,7 +367,8 @@ struct PerformStep {
 
  public:
   using const_global_cache_tags =
-      tmpl::list<logging::Tags::Verbosity<OptionsGroup>>;
+      tmpl::list<logging::Tags::Verbosity<OptionsGroup>,
+                 gmres::Tags::Orthogonalization<OptionsGroup>>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             typename ArrayIndex, typename ActionList,
@@ -334,6 +410,8 @@ struct PerformStep {
             Convergence::Tags::IterationId<OptionsGroup>>;
     using basis_history_tag =
         LinearSolver::Tags::KrylovSubspaceBasis<operand_tag>;
+    const auto orthogonalization =
+        db::get<gmres::Tags::Orthogonalization<OptionsGroup>>(box);
 
     if constexpr (Preconditioned) {
       using preconditioned_basis_history_tag =
@@ -346,6 +424,28 @@ struct PerformStep {
             preconditioned_basis_history->push_back(preconditioned_operand);
           },
           get<preconditioned_operand_tag>(box));
+    } else {
+      // The pipelined scheme passes through this action twice per step. The
+      // first time, the operator has been applied to the latest basis vector.
+      // We keep track of it so the operator applied to the next basis vector
+      // can be constructed without another operator application. The second
+      // time, the operator has been applied to the unorthogonalized operand
+      // while the reduction was in flight, so we proceed to orthogonalize.
+      if (orthogonalization == LinearSolver::Orthogonalization::Pipelined) {
+        using operator_basis_history_tag =
+            LinearSolver::Tags::KrylovSubspaceBasis<operator_tag>;
+        if (get<operator_basis_history_tag>(box).size() ==
+            get<basis_history_tag>(box).size()) {
+          return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+        }
+        db::mutate<operator_basis_history_tag>(
+            make_not_null(&box),
+            [](const auto operator_basis_history,
+               const auto& operator_action) {
+              operator_basis_history->push_back(operator_action);
+            },
+            get<operator_tag>(box));
+      }
     }
 
     db::mutate<operand_tag, orthogonalization_iteration_id_tag>(
@@ -358,6 +458,29 @@ struct PerformStep {
         },
         get<operator_tag>(box));
 
+    if (orthogonalization !=
+        LinearSolver::Orthogonalization::ModifiedGramSchmidt) {
+      contribute_fused_orthogonalization<FieldsTag, OptionsGroup,
+                                         ArraySectionIdTag, ParallelComponent>(
+          make_not_null(&box), cache, array_index, iteration_id, 0);
+      if (orthogonalization == LinearSolver::Orthogonalization::Pipelined) {
+        // Apply the operator to the operand while the reduction is in flight.
+        // The iteration ID is incremented already so the operator application
+        // is labeled differently than the previous one.
+        db::mutate<Convergence::Tags::IterationId<OptionsGroup>>(
+            make_not_null(&box),
+            [](const gsl::not_null<size_t*> local_iteration_id) {
+              ++(*local_iteration_id);
+            });
+        constexpr size_t prepare_step_index =
+            tmpl::index_of<ActionList,
+                           PrepareStep<FieldsTag, OptionsGroup, Preconditioned,
+                                       Label, ArraySectionIdTag>>::value;
+        return {Parallel::AlgorithmExecution::Continue, prepare_step_index};
+      }
+      return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+    }
+
     auto& section = Parallel::get_section<ParallelComponent, ArraySectionIdTag>(
         make_not_null(&box));
     Parallel::contribute_to_reduction<
@@ -393,7 +516,10 @@ struct OrthogonalizeOperand {
       LinearSolver::Tags::KrylovSubspaceBasis<operand_tag>;
 
  public:
-  using inbox_tags = tmpl::list<Tags::Orthogonalization<OptionsGroup>>;
+  using const_global_cache_tags =
+      tmpl::list<gmres::Tags::Orthogonalization<OptionsGroup>>;
+  using inbox_tags = tmpl::list<Tags::Orthogonalization<OptionsGroup>,
+                                Tags::FusedOrthogonalization<OptionsGroup>>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             typename ArrayIndex, typename ActionList,
@@ -403,6 +529,13 @@ struct OrthogonalizeOperand {
       Parallel::GlobalCache<Metavariables>& cache,
       const ArrayIndex& array_index, const ActionList /*meta*/,
       const ParallelComponent* const /*meta*/) {
+    if (db::get<gmres::Tags::Orthogonalization<OptionsGroup>>(box) !=
+        LinearSolver::Orthogonalization::ModifiedGramSchmidt) {
+      return apply_fused<ActionList, ParallelComponent>(make_not_null(&box),
+                                                        inboxes, cache,
+                                                        array_index);
+    }
+
     const size_t iteration_id =
         db::get<Convergence::Tags::IterationId<OptionsGroup>>(box);
     auto& inbox = get<Tags::Orthogonalization<OptionsGroup>>(inboxes);
@@ -458,6 +591,81 @@ struct OrthogonalizeOperand {
             orthogonalization_complete ? (this_action_index + 1)
                                        : this_action_index};
   }
+
+ private:
+  // Subtract the projections on all basis vectors at once, then either
+  // proceed or repeat the orthogonalization if requested by the
+  // `ResidualMonitor`
+  template <typename ActionList, typename ParallelComponent,
+            typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex>
+  static Parallel::iterable_action_return_t apply_fused(
+      const gsl::not_null<db::DataBox<DbTagsList>*> box,
+      tuples::TaggedTuple<InboxTags...>& inboxes,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& array_index) {
+    const bool pipelined =
+        db::get<gmres::Tags::Orthogonalization<OptionsGroup>>(*box) ==
+        LinearSolver::Orthogonalization::Pipelined;
+    // The pipelined scheme has incremented the iteration ID already
+    const size_t iteration_id =
+        db::get<Convergence::Tags::IterationId<OptionsGroup>>(*box) -
+        (pipelined ? 1 : 0);
+    auto& inbox = get<Tags::FusedOrthogonalization<OptionsGroup>>(inboxes);
+    if (inbox.find(iteration_id) == inbox.end()) {
+      return {Parallel::AlgorithmExecution::Retry, std::nullopt};
+    }
+
+    auto received_data = std::move(inbox.extract(iteration_id).mapped());
+    const auto& projections = get<0>(received_data);
+    const bool reorthogonalize = get<1>(received_data);
+
+    db::mutate<operand_tag, orthogonalization_iteration_id_tag>(
+        box,
+        [&projections](
+            const auto operand,
+            const gsl::not_null<size_t*> orthogonalization_iteration_id,
+            const auto& basis_history) {
+          for (size_t j = 0; j < projections.size(); ++j) {
+            *operand -= projections[j] * gsl::at(basis_history, j);
+          }
+          ++(*orthogonalization_iteration_id);
+        },
+        get<basis_history_tag>(*box));
+
+    if constexpr (not Preconditioned) {
+      // The operator is linear, so the same projections construct the
+      // operator applied to the orthogonalized operand
+      if (pipelined) {
+        using operator_tag =
+            db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo,
+                               operand_tag>;
+        using operator_basis_history_tag =
+            LinearSolver::Tags::KrylovSubspaceBasis<operator_tag>;
+        db::mutate<operator_tag>(
+            box,
+            [&projections](const auto operator_action,
+                           const auto& operator_basis_history) {
+              for (size_t j = 0; j < projections.size(); ++j) {
+                *operator_action -=
+                    projections[j] * gsl::at(operator_basis_history, j);
+              }
+            },
+            get<operator_basis_history_tag>(*box));
+      }
+    }
+
+    constexpr size_t this_action_index =
+        tmpl::index_of<ActionList, OrthogonalizeOperand>::value;
+    if (not reorthogonalize) {
+      return {Parallel::AlgorithmExecution::Continue, this_action_index + 1};
+    }
+    contribute_fused_orthogonalization<FieldsTag, OptionsGroup,
+                                       ArraySectionIdTag, ParallelComponent>(
+        box, cache, array_index, iteration_id,
+        get<orthogonalization_iteration_id_tag>(*box));
+    return {Parallel::AlgorithmExecution::Continue, this_action_index};
+  }
 };
 
 template <typename FieldsTag, typename OptionsGroup, bool Preconditioned,
@@ -478,7 +686,8 @@ struct NormalizeOperandAndUpdateField {
 
  public:
   using const_global_cache_tags =
-      tmpl::list<logging::Tags::Verbosity<OptionsGroup>>;
+      tmpl::list<logging::Tags::Verbosity<OptionsGroup>,
+                 gmres::Tags::Orthogonalization<OptionsGroup>>;
   using inbox_tags = tmpl::list<Tags::FinalOrthogonalization<OptionsGroup>>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
@@ -489,8 +698,13 @@ struct NormalizeOperandAndUpdateField {
       const Parallel::GlobalCache<Metavariables>& /*cache*/,
       const ArrayIndex& array_index, const ActionList /*meta*/,
       const ParallelComponent* const /*meta*/) {
+    const bool pipelined =
+        db::get<gmres::Tags::Orthogonalization<OptionsGroup>>(box) ==
+        LinearSolver::Orthogonalization::Pipelined;
+    // The pipelined scheme has incremented the iteration ID already
     const size_t iteration_id =
-        db::get<Convergence::Tags::IterationId<OptionsGroup>>(box);
+        db::get<Convergence::Tags::IterationId<OptionsGroup>>(box) -
+        (pipelined ? 1 : 0);
     auto& inbox = get<Tags::FinalOrthogonalization<OptionsGroup>>(inboxes);
     if (inbox.find(iteration_id) == inbox.end()) {
       return {Parallel::AlgorithmExecution::Retry, std::nullopt};
@@ -504,11 +718,13 @@ struct NormalizeOperandAndUpdateField {
     db::mutate<Convergence::Tags::HasConverged<OptionsGroup>,
                Convergence::Tags::IterationId<OptionsGroup>>(
         make_not_null(&box),
-        [&has_converged](
+        [&has_converged, pipelined](
             const gsl::not_null<Convergence::HasConverged*> local_has_converged,
             const gsl::not_null<size_t*> local_iteration_id) {
           *local_has_converged = std::move(has_converged);
-          ++(*local_iteration_id);
+          if (not pipelined) {
+            ++(*local_iteration_id);
+          }
         });
 
     // Elements that are not part of the section jump directly to the
@@ -557,6 +773,31 @@ struct NormalizeOperandAndUpdateField {
         get<initial_fields_tag>(box),
         get<preconditioned_basis_history_tag>(box));
 
+    if constexpr (not Preconditioned) {
+      // The pipelined scheme has constructed the operator applied to the new
+      // operand already, so it skips the operator application in the next
+      // step
+      if (pipelined) {
+        using operator_tag =
+            db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo,
+                               operand_tag>;
+        db::mutate<operator_tag>(
+            make_not_null(&box), [normalization](const auto operator_action) {
+              if (LIKELY(normalization > 0.)) {
+                *operator_action /= normalization;
+              }
+            });
+        constexpr size_t perform_step_index =
+            tmpl::index_of<ActionList,
+                           PerformStep<FieldsTag, OptionsGroup, Preconditioned,
+                                       Label, ArraySectionIdTag>>::value;
+        return {Parallel::AlgorithmExecution::Continue,
+                get<Convergence::Tags::HasConverged<OptionsGroup>>(box)
+                    ? (this_action_index + 1)
+                    : perform_step_index};
+      }
+    }
+
     // Repeat steps until the solve has converged
     return {Parallel::AlgorithmExecution::Continue,
             get<Convergence::Tags::HasConverged<OptionsGroup>>(box)
@@ -57,9 +57,11 @@ namespace LinearSolver::gmres {
  * received by a `ResidualMonitor` singleton parallel component, processed, and
  * then broadcast back to all elements. Since the reductions are performed to
  * find a vector that is orthogonal to those used in previous steps, the number
- * of reductions increases linearly with iterations. No restarting mechanism is
- * currently implemented. The actions are implemented in the `gmres::detail`
- * namespace and constitute the full algorithm in the following order:
+ * of reductions increases linearly with iterations when the
+ * `LinearSolver::Orthogonalization::ModifiedGramSchmidt` scheme is selected
+ * (see "Orthogonalization" below). No restarting mechanism is currently
+ * implemented. The actions are implemented in the `gmres::detail` namespace and
+ * constitute the full algorithm in the following order:
  * 1. `PerformStep` (on elements): Start an Arnoldi orthogonalization by
  * computing the inner product between \f$A(q)\f$ and the first of the
  * previously determined set of orthogonal vectors.
@@ -77,6 +79,28 @@ namespace LinearSolver::gmres {
  * the new orthogonal vector and normalize. Use the residual vector and the set
  * of orthogonal vectors to determine the solution \f$x\f$.
  *
+ * \par Orthogonalization
+ * The `Orthogonalization` option selects the `LinearSolver::Orthogonalization`
+ * scheme that constructs the new basis vector in steps 1-4 above. With
+ * `ModifiedGramSchmidt` the steps proceed as described, so every iteration
+ * waits for one reduction per basis vector. With `ClassicalGramSchmidt`,
+ * `PerformStep` contributes the inner products with all basis vectors and the
+ * magnitude squared of \f$A(q)\f$ to a single reduction, and
+ * `StoreFusedOrthogonalization` on the `ResidualMonitor` completes the
+ * iteration right away unless the new vector lost too much of its magnitude
+ * to cancellation. In that case it asks the elements for a second pass in
+ * `OrthogonalizeOperand` before completing the iteration. The `Pipelined`
+ * scheme also performs a single reduction per iteration, but `PerformStep`
+ * jumps back to the `ApplyOperatorActions` to apply the operator to the
+ * unorthogonalized vector while the reduction is in flight. The operator
+ * applied to the next basis vector then follows from linearity, so each
+ * iteration still needs only a single operator application. Each step
+ * increments the iteration ID before this operator application, so
+ * communication in the `ApplyOperatorActions` can be labeled by the iteration
+ * ID. The pipelined scheme does not support preconditioning or array sections
+ * and can lose orthogonality, so it may stagnate at a larger residual than the
+ * other schemes (see \cite Ghysels2013).
+ *
  * \par Array sections
  * This linear solver supports running over a subset of the elements in the
  * array parallel component (see `Parallel::Section`). Set the
@@ -50,6 +50,8 @@ struct InitializeElement {
       LinearSolver::Tags::KrylovSubspaceBasis<operand_tag>;
   using preconditioned_basis_history_tag =
       LinearSolver::Tags::KrylovSubspaceBasis<preconditioned_operand_tag>;
+  using operator_basis_history_tag =
+      LinearSolver::Tags::KrylovSubspaceBasis<operator_applied_to_operand_tag>;
 
  public:
   using simple_tags = tmpl::append<
@@ -61,7 +63,7 @@ struct InitializeElement {
       tmpl::conditional_t<Preconditioned,
                           tmpl::list<preconditioned_basis_history_tag,
                                      preconditioned_operand_tag>,
-                          tmpl::list<>>>;
+                          tmpl::list<operator_basis_history_tag>>>;
   using compute_tags = tmpl::list<>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
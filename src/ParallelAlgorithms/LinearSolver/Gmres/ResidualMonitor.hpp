@@ -20,6 +20,7 @@
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
+#include "ParallelAlgorithms/LinearSolver/Gmres/Tags/Orthogonalization.hpp"
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -41,7 +42,8 @@ struct ResidualMonitor {
   using chare_type = Parallel::Algorithms::Singleton;
   using const_global_cache_tags =
       tmpl::list<logging::Tags::Verbosity<OptionsGroup>,
-                 Convergence::Tags::Criteria<OptionsGroup>>;
+                 Convergence::Tags::Criteria<OptionsGroup>,
+                 gmres::Tags::Orthogonalization<OptionsGroup>>;
   using metavariables = Metavariables;
   // The actions in `ResidualMonitorActions.hpp` are invoked as simple actions
   // on this component as the result of reductions from the actions in
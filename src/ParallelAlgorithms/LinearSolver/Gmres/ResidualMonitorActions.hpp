@@ -3,24 +3,31 @@
 
 #pragma once
 
+#include <algorithm>
+#include <blaze/math/Column.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
+#include <blaze/math/Subvector.h>
 #include <cstddef>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "IO/Logging/Tags.hpp"
 #include "IO/Logging/Verbosity.hpp"
 #include "NumericalAlgorithms/Convergence/Tags.hpp"
+#include "NumericalAlgorithms/LinearSolver/Orthogonalization.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/Printf.hpp"
 #include "ParallelAlgorithms/LinearSolver/Gmres/Tags/InboxTags.hpp"
+#include "ParallelAlgorithms/LinearSolver/Gmres/Tags/Orthogonalization.hpp"
 #include "ParallelAlgorithms/LinearSolver/Observe.hpp"
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/Requires.hpp"
@@ -89,13 +96,76 @@ struct InitializeResidualMagnitude {
   }
 };
 
+// Solve the least-squares problem with the completed Hessenberg matrix, then
+// observe, log and check convergence before broadcasting the result back to the
+// elements. The `normalization` is the magnitude of the new orthogonal vector.
+template <typename FieldsTag, typename OptionsGroup, typename ParallelComponent,
+          typename BroadcastTarget, typename DbTagsList, typename Metavariables>
+void complete_iteration(const db::DataBox<DbTagsList>& box,
+                        Parallel::GlobalCache<Metavariables>& cache,
+                        const size_t iteration_id, const double normalization) {
+  using initial_residual_magnitude_tag =
+      ::Tags::Initial<LinearSolver::Tags::Magnitude<
+          db::add_tag_prefix<LinearSolver::Tags::Residual, FieldsTag>>>;
+  using orthogonalization_history_tag =
+      LinearSolver::Tags::OrthogonalizationHistory<FieldsTag>;
+
+  // Perform a QR decomposition of the Hessenberg matrix that was built during
+  // the orthogonalization
+  const auto& orthogonalization_history =
+      get<orthogonalization_history_tag>(box);
+  const auto num_rows = iteration_id + 2;
+  blaze::DynamicMatrix<double> qr_Q;
+  blaze::DynamicMatrix<double> qr_R;
+  blaze::qr(orthogonalization_history, qr_Q, qr_R);
+  // Compute the residual vector from the QR decomposition
+  blaze::DynamicVector<double> beta(num_rows, 0.);
+  beta[0] = get<initial_residual_magnitude_tag>(box);
+  blaze::DynamicVector<double> minres =
+      blaze::inv(qr_R) * blaze::trans(qr_Q) * beta;
+  const double residual_magnitude =
+      blaze::length(beta - orthogonalization_history * minres);
+
+  // At this point, the iteration is complete. We proceed with observing,
+  // logging and checking convergence before broadcasting back to the
+  // elements.
+
+  const size_t completed_iterations = iteration_id + 1;
+  LinearSolver::observe_detail::contribute_to_reduction_observer<
+      OptionsGroup, ParallelComponent>(completed_iterations, residual_magnitude,
+                                       cache);
+
+  // Determine whether the linear solver has converged
+  Convergence::HasConverged has_converged{
+      get<Convergence::Tags::Criteria<OptionsGroup>>(box),
+      completed_iterations, residual_magnitude,
+      get<initial_residual_magnitude_tag>(box)};
+
+  // Do some logging
+  if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(cache) >=
+               ::Verbosity::Quiet)) {
+    Parallel::printf("%s(%zu) iteration complete. Remaining residual: %e\n",
+                     pretty_type::name<OptionsGroup>(), completed_iterations,
+                     residual_magnitude);
+  }
+  if (UNLIKELY(has_converged and get<logging::Tags::Verbosity<OptionsGroup>>(
+                                     cache) >= ::Verbosity::Quiet)) {
+    Parallel::printf("%s has converged in %zu iterations: %s\n",
+                     pretty_type::name<OptionsGroup>(), completed_iterations,
+                     has_converged);
+  }
+
+  Parallel::receive_data<Tags::FinalOrthogonalization<OptionsGroup>>(
+      Parallel::get_parallel_component<BroadcastTarget>(cache), iteration_id,
+      std::make_tuple(normalization, std::move(minres),
+                      // NOLINTNEXTLINE(performance-move-const-arg)
+                      std::move(has_converged)));
+}
+
 template <typename FieldsTag, typename OptionsGroup, typename BroadcastTarget>
 struct StoreOrthogonalization {
  private:
   using fields_tag = FieldsTag;
-  using initial_residual_magnitude_tag =
-      ::Tags::Initial<LinearSolver::Tags::Magnitude<
-          db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>>>;
   using orthogonalization_history_tag =
       LinearSolver::Tags::OrthogonalizationHistory<fields_tag>;
 
@@ -151,56 +221,117 @@ struct StoreOrthogonalization {
                                        iteration_id) = sqrt(orthogonalization);
         });
 
-    // Perform a QR decomposition of the Hessenberg matrix that was built during
-    // the orthogonalization
-    const auto& orthogonalization_history =
-        get<orthogonalization_history_tag>(box);
-    const auto num_rows = orthogonalization_iteration_id + 1;
-    blaze::DynamicMatrix<double> qr_Q;
-    blaze::DynamicMatrix<double> qr_R;
-    blaze::qr(orthogonalization_history, qr_Q, qr_R);
-    // Compute the residual vector from the QR decomposition
-    blaze::DynamicVector<double> beta(num_rows, 0.);
-    beta[0] = get<initial_residual_magnitude_tag>(box);
-    blaze::DynamicVector<double> minres =
-        blaze::inv(qr_R) * blaze::trans(qr_Q) * beta;
-    const double residual_magnitude =
-        blaze::length(beta - orthogonalization_history * minres);
-
-    // At this point, the iteration is complete. We proceed with observing,
-    // logging and checking convergence before broadcasting back to the
-    // elements.
-
-    const size_t completed_iterations = iteration_id + 1;
-    LinearSolver::observe_detail::contribute_to_reduction_observer<
-        OptionsGroup, ParallelComponent>(completed_iterations,
-                                         residual_magnitude, cache);
+    complete_iteration<FieldsTag, OptionsGroup, ParallelComponent,
+                       BroadcastTarget>(box, cache, iteration_id,
+                                        sqrt(orthogonalization));
+  }
+};
 
-    // Determine whether the linear solver has converged
-    Convergence::HasConverged has_converged{
-        get<Convergence::Tags::Criteria<OptionsGroup>>(box),
-        completed_iterations, residual_magnitude,
-        get<initial_residual_magnitude_tag>(box)};
+// Receives the projections of the new operand on all previous basis vectors
+// and its magnitude squared in a single reduction. This is used by the
+// `LinearSolver::Orthogonalization::ClassicalGramSchmidt` and
+// `LinearSolver::Orthogonalization::Pipelined` schemes. The
+// `orthogonalization_iteration_id` counts the orthogonalization passes.
+template <typename FieldsTag, typename OptionsGroup, typename BroadcastTarget>
+struct StoreFusedOrthogonalization {
+ private:
+  using fields_tag = FieldsTag;
+  using orthogonalization_history_tag =
+      LinearSolver::Tags::OrthogonalizationHistory<fields_tag>;
 
-    // Do some logging
-    if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(cache) >=
-                 ::Verbosity::Quiet)) {
-      Parallel::printf("%s(%zu) iteration complete. Remaining residual: %e\n",
-                       pretty_type::name<OptionsGroup>(), completed_iterations,
-                       residual_magnitude);
+ public:
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex,
+            typename DataBox = db::DataBox<DbTagsList>>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const size_t iteration_id,
+                    const size_t orthogonalization_iteration_id,
+                    const std::vector<double>& inner_products) {
+    ASSERT(inner_products.size() == iteration_id + 2,
+           "Expected the projections on " << iteration_id + 1
+                                           << " basis vectors and the "
+                                              "magnitude squared, but got "
+                                           << inner_products.size()
+                                           << " inner products.");
+    blaze::DynamicVector<double> projections(iteration_id + 1);
+    for (size_t j = 0; j < projections.size(); ++j) {
+      projections[j] = inner_products[j];
     }
-    if (UNLIKELY(has_converged and get<logging::Tags::Verbosity<OptionsGroup>>(
-                                       cache) >= ::Verbosity::Quiet)) {
-      Parallel::printf("%s has converged in %zu iterations: %s\n",
-                       pretty_type::name<OptionsGroup>(), completed_iterations,
-                       has_converged);
+    const double magnitude_square = inner_products.back();
+
+    db::mutate<orthogonalization_history_tag>(
+        make_not_null(&box),
+        [&projections, iteration_id, orthogonalization_iteration_id](
+            const auto orthogonalization_history) {
+          if (orthogonalization_iteration_id == 0) {
+            // Append a row and a column to the orthogonalization history
+            orthogonalization_history->resize(iteration_id + 2,
+                                              iteration_id + 1);
+            for (size_t j = 0; j < orthogonalization_history->columns(); ++j) {
+              (*orthogonalization_history)(iteration_id + 1, j) = 0.;
+            }
+            blaze::subvector(blaze::column(*orthogonalization_history,
+                                           iteration_id),
+                             0, iteration_id + 1) = projections;
+          } else {
+            // Reorthogonalization corrects the projections
+            blaze::subvector(blaze::column(*orthogonalization_history,
+                                           iteration_id),
+                             0, iteration_id + 1) += projections;
+          }
+        });
+
+    // The magnitude of the orthogonalized vector follows from the Pythagorean
+    // identity. When the vector has lost more than half of its magnitude
+    // squared to the projections, cancellation makes both the orthogonality
+    // and the magnitude inaccurate, so orthogonalize a second time ("twice is
+    // enough"). The pipelined scheme can't repeat the orthogonalization
+    // because the operator is already being applied to the unorthogonalized
+    // vector.
+    const double orthogonalized_magnitude_square =
+        magnitude_square - blaze::sqrLength(projections);
+    const bool reorthogonalize =
+        get<gmres::Tags::Orthogonalization<OptionsGroup>>(cache) !=
+            LinearSolver::Orthogonalization::Pipelined and
+        orthogonalization_iteration_id == 0 and
+        orthogonalized_magnitude_square < 0.5 * magnitude_square;
+
+    if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(cache) >=
+                 ::Verbosity::Debug)) {
+      Parallel::printf(
+          "%s(%zu): Orthogonalization pass %zu retained %e of the magnitude "
+          "squared%s\n",
+          pretty_type::name<OptionsGroup>(), iteration_id,
+          orthogonalization_iteration_id,
+          magnitude_square > 0.
+              ? orthogonalized_magnitude_square / magnitude_square
+              : 0.,
+          reorthogonalize ? ", reorthogonalizing" : "");
     }
 
-    Parallel::receive_data<Tags::FinalOrthogonalization<OptionsGroup>>(
+    Parallel::receive_data<Tags::FusedOrthogonalization<OptionsGroup>>(
         Parallel::get_parallel_component<BroadcastTarget>(cache), iteration_id,
-        std::make_tuple(sqrt(orthogonalization), std::move(minres),
-                        // NOLINTNEXTLINE(performance-move-const-arg)
-                        std::move(has_converged)));
+        std::make_tuple(std::move(projections), reorthogonalize));
+    if (reorthogonalize) {
+      return;
+    }
+
+    // At this point, the orthogonalization procedure is complete. Roundoff can
+    // make the magnitude squared slightly negative when the operand is (close
+    // to) linearly dependent on the previous basis vectors.
+    const double normalization =
+        sqrt(std::max(orthogonalized_magnitude_square, 0.));
+    db::mutate<orthogonalization_history_tag>(
+        make_not_null(&box),
+        [normalization, iteration_id](const auto orthogonalization_history) {
+          (*orthogonalization_history)(iteration_id + 1, iteration_id) =
+              normalization;
+        });
+    complete_iteration<FieldsTag, OptionsGroup, ParallelComponent,
+                       BroadcastTarget>(box, cache, iteration_id,
+                                        normalization);
   }
 };
 
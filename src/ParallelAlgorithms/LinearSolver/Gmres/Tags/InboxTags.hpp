@@ -29,6 +29,18 @@ struct Orthogonalization
   using type = std::map<temporal_id, double>;
 };
 
+/// The projections of the new operand on all previous basis vectors, and
+/// whether or not to repeat the orthogonalization. Used by the
+/// `LinearSolver::Orthogonalization::ClassicalGramSchmidt` and
+/// `LinearSolver::Orthogonalization::Pipelined` schemes.
+template <typename OptionsGroup>
+struct FusedOrthogonalization
+    : Parallel::InboxInserters::Value<FusedOrthogonalization<OptionsGroup>> {
+  using temporal_id = size_t;
+  using type =
+      std::map<temporal_id, std::tuple<blaze::DynamicVector<double>, bool>>;
+};
+
 template <typename OptionsGroup>
 struct FinalOrthogonalization
     : Parallel::InboxInserters::Value<FinalOrthogonalization<OptionsGroup>> {
@@ -0,0 +1,50 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <string>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "NumericalAlgorithms/LinearSolver/Orthogonalization.hpp"
+#include "Options/Options.hpp"
+#include "Utilities/PrettyType.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace LinearSolver::gmres {
+
+namespace OptionTags {
+
+template <typename OptionsGroup>
+struct Orthogonalization {
+  using type = LinearSolver::Orthogonalization;
+  static constexpr Options::String help =
+      "How to orthogonalize new Krylov basis vectors. 'ModifiedGramSchmidt' "
+      "needs one global reduction per previous basis vector, "
+      "'ClassicalGramSchmidt' needs one or two reductions per iteration, and "
+      "'Pipelined' needs one reduction per iteration and overlaps it with the "
+      "next operator application. 'Pipelined' is less stable and doesn't "
+      "support preconditioning.";
+  using group = OptionsGroup;
+};
+
+}  // namespace OptionTags
+
+/// DataBox tags for the `LinearSolver::gmres::Gmres` linear solver
+namespace Tags {
+
+/// The `LinearSolver::Orthogonalization` scheme used to construct the Krylov
+/// subspace basis
+template <typename OptionsGroup>
+struct Orthogonalization : db::SimpleTag {
+  using type = LinearSolver::Orthogonalization;
+  static constexpr bool pass_metavariables = false;
+  using option_tags = tmpl::list<OptionTags::Orthogonalization<OptionsGroup>>;
+  static type create_from_options(const type value) { return value; }
+  static std::string name() {
+    return "Orthogonalization(" + pretty_type::name<OptionsGroup>() + ")";
+  }
+};
+
+}  // namespace Tags
+}  // namespace LinearSolver::gmres
@@ -0,0 +1,90 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DynamicMatrix.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "IO/Logging/Tags.hpp"
+#include "IO/Logging/Verbosity.hpp"
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/Printf.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/PrettyType.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace Parallel {
+template <typename Metavariables>
+struct GlobalCache;
+}  // namespace Parallel
+namespace tuples {
+template <typename...>
+struct TaggedTuple;
+}  // namespace tuples
+/// \endcond
+
+namespace LinearSolver::multigrid::Actions {
+
+/*!
+ * \brief Clear the assembled and LU-decomposed coarse-grid operator of the
+ * direct solve on the coarsest grid, so it is assembled again the next time the
+ * V-cycle reaches the coarsest grid.
+ *
+ * Invoke this action when the linear operator has changed. For example, an
+ * operator representing the linearization of a nonlinear operator changes in
+ * every iteration of a nonlinear solve. Note that the operator does _not_
+ * change between iterations of a linear solve, so make sure you place this
+ * action _outside_ the looping action list for the linear solve. The action
+ * has no effect unless the `LinearSolver::multigrid::Tags::DirectSolveAtBottom`
+ * option is enabled.
+ */
+template <size_t Dim, typename OptionsGroup>
+struct ResetCoarseOperator {
+  using const_global_cache_tags = tmpl::list<
+      LinearSolver::multigrid::Tags::DirectSolveAtBottom<OptionsGroup>,
+      logging::Tags::Verbosity<OptionsGroup>>;
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    if (not db::get<LinearSolver::multigrid::Tags::DirectSolveAtBottom<
+            OptionsGroup>>(box) or
+        db::get<Tags::CoarseGridLayout<Dim, OptionsGroup>>(box).empty()) {
+      return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+    }
+    if (UNLIKELY(db::get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
+                 ::Verbosity::Debug)) {
+      Parallel::printf("%s %s: Reset coarse-grid operator\n", element_id,
+                       pretty_type::name<OptionsGroup>());
+    }
+    db::mutate<Tags::CoarseGridLayout<Dim, OptionsGroup>,
+               Tags::CoarseOperatorColumn<OptionsGroup>,
+               Tags::CoarseOperatorLu<OptionsGroup>,
+               Tags::CoarseOperatorPivots<OptionsGroup>>(
+        make_not_null(&box),
+        [](const gsl::not_null<std::map<ElementId<Dim>, size_t>*> layout,
+           const gsl::not_null<size_t*> column, const auto matrix,
+           const gsl::not_null<std::vector<int>*> pivots) {
+          layout->clear();
+          *column = 0;
+          *matrix = blaze::DynamicMatrix<double, blaze::columnMajor>{};
+          pivots->clear();
+        });
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+
+}  // namespace LinearSolver::multigrid::Actions
@@ -0,0 +1,568 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/lapack/getrf.h>
+#include <blaze/math/lapack/getrs.h>
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DynamicMatrix.hpp"
+#include "Domain/Creators/Tags/InitialRefinementLevels.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/InitialElementIds.hpp"
+#include "IO/Logging/Tags.hpp"
+#include "IO/Logging/Verbosity.hpp"
+#include "NumericalAlgorithms/Convergence/Tags.hpp"
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/InboxInserters.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Printf.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Tags.hpp"
+#include "ParallelAlgorithms/LinearSolver/Tags.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/PrettyType.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+// The actions in this file solve the coarsest grid of the multigrid hierarchy
+// directly. The first time the V-cycle reaches the coarsest grid, the elements
+// assemble a matrix representation of the linear operator column by column by
+// applying it to unit vectors, like `LinearSolver::Serial::build_matrix` does
+// for a serial operator. Here the operator couples the elements, so every
+// column takes one distributed operator application. One element on the
+// coarsest grid (the "root") gathers the columns and LU-decomposes the matrix
+// once, until `LinearSolver::multigrid::Actions::ResetCoarseOperator` clears
+// it. In every V-cycle the elements then send their source to the root, which
+// solves the linear problem and scatters the solution back to the elements.
+namespace LinearSolver::multigrid::detail {
+
+/// \cond
+template <typename FieldsTag, typename OptionsGroup, typename SourceTag>
+struct SkipPostSmoothingAtBottom;
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag>
+struct PrepareCoarseOperatorColumn;
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag>
+struct SendCoarseGridSource;
+/// \endcond
+
+// The element on the coarsest grid that assembles the coarse-grid operator and
+// performs the direct solve
+template <size_t Dim, typename DbTagsList>
+ElementId<Dim> coarse_grid_root_id(const db::DataBox<DbTagsList>& box,
+                                   const ElementId<Dim>& element_id) {
+  return initial_element_ids(
+             db::get<domain::Tags::InitialRefinementLevels<Dim>>(box),
+             element_id.grid_index())
+      .front();
+}
+
+// The position of the element's data in the assembled coarse-grid vector
+template <size_t Dim>
+size_t coarse_grid_offset(const std::map<ElementId<Dim>, size_t>& layout,
+                          const ElementId<Dim>& element_id) {
+  size_t offset = 0;
+  for (const auto& [coarse_element_id, num_values] : layout) {
+    if (coarse_element_id == element_id) {
+      return offset;
+    }
+    offset += num_values;
+  }
+  ERROR("Element " << element_id << " is not part of the coarse grid.");
+}
+
+// The total number of values on the coarsest grid
+template <size_t Dim>
+size_t coarse_grid_size(const std::map<ElementId<Dim>, size_t>& layout) {
+  size_t size = 0;
+  for (const auto& coarse_element : layout) {
+    size += coarse_element.second;
+  }
+  return size;
+}
+
+template <size_t Dim, typename OptionsGroup>
+struct CoarseGridSizesInboxTag
+    : public Parallel::InboxInserters::Map<
+          CoarseGridSizesInboxTag<Dim, OptionsGroup>> {
+  using temporal_id = size_t;
+  using type = std::map<temporal_id, std::map<ElementId<Dim>, size_t>>;
+};
+
+template <size_t Dim, typename OptionsGroup>
+struct CoarseGridLayoutInboxTag
+    : public Parallel::InboxInserters::Value<
+          CoarseGridLayoutInboxTag<Dim, OptionsGroup>> {
+  using temporal_id = size_t;
+  using type = std::map<temporal_id, std::map<ElementId<Dim>, size_t>>;
+};
+
+template <size_t Dim, typename FieldsTag, typename OptionsGroup>
+struct CoarseOperatorColumnInboxTag
+    : public Parallel::InboxInserters::Map<
+          CoarseOperatorColumnInboxTag<Dim, FieldsTag, OptionsGroup>> {
+  using temporal_id = size_t;
+  using type = std::map<
+      temporal_id,
+      std::map<ElementId<Dim>, typename db::add_tag_prefix<
+                                   LinearSolver::Tags::OperatorAppliedTo,
+                                   FieldsTag>::type>>;
+};
+
+template <typename OptionsGroup>
+struct CoarseOperatorColumnReceivedInboxTag
+    : public Parallel::InboxInserters::Value<
+          CoarseOperatorColumnReceivedInboxTag<OptionsGroup>> {
+  using temporal_id = size_t;
+  using type = std::map<temporal_id, size_t>;
+};
+
+template <size_t Dim, typename SourceTag, typename OptionsGroup>
+struct CoarseGridSourceInboxTag
+    : public Parallel::InboxInserters::Map<
+          CoarseGridSourceInboxTag<Dim, SourceTag, OptionsGroup>> {
+  using temporal_id = size_t;
+  using type =
+      std::map<temporal_id, std::map<ElementId<Dim>, typename SourceTag::type>>;
+};
+
+template <typename FieldsTag, typename OptionsGroup>
+struct CoarseGridSolutionInboxTag
+    : public Parallel::InboxInserters::Value<
+          CoarseGridSolutionInboxTag<FieldsTag, OptionsGroup>> {
+  using temporal_id = size_t;
+  using type = std::map<temporal_id, typename FieldsTag::type>;
+};
+
+// Entry point of the direct solve. If the coarse-grid operator has already been
+// assembled we skip straight to the solve. Otherwise, the elements send the
+// size of their data to the root so it can determine where each element's data
+// goes in the assembled matrix.
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag>
+struct SendCoarseGridSize {
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    if (not db::get<Tags::CoarseGridLayout<Dim, OptionsGroup>>(box).empty()) {
+      return {Parallel::AlgorithmExecution::Continue,
+              tmpl::index_of<ActionList,
+                             SendCoarseGridSource<Dim, FieldsTag, OptionsGroup,
+                                                  SourceTag>>::value};
+    }
+
+    const size_t iteration_id =
+        db::get<Convergence::Tags::IterationId<OptionsGroup>>(box);
+    if (UNLIKELY(db::get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
+                 ::Verbosity::Debug)) {
+      Parallel::printf("%s %s(%zu): Assemble coarse-grid operator\n",
+                       element_id, pretty_type::name<OptionsGroup>(),
+                       iteration_id);
+    }
+
+    auto& receiver_proxy =
+        Parallel::get_parallel_component<ParallelComponent>(cache);
+    Parallel::receive_data<CoarseGridSizesInboxTag<Dim, OptionsGroup>>(
+        receiver_proxy[coarse_grid_root_id(box, element_id)], iteration_id,
+        std::make_pair(element_id, db::get<FieldsTag>(box).size()));
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag>
+struct ReceiveCoarseGridLayout {
+  using inbox_tags = tmpl::list<CoarseGridSizesInboxTag<Dim, OptionsGroup>,
+                                CoarseGridLayoutInboxTag<Dim, OptionsGroup>>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box, tuples::TaggedTuple<InboxTags...>& inboxes,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    const size_t iteration_id =
+        db::get<Convergence::Tags::IterationId<OptionsGroup>>(box);
+    const auto coarse_element_ids = initial_element_ids(
+        db::get<domain::Tags::InitialRefinementLevels<Dim>>(box),
+        element_id.grid_index());
+    const bool is_root = element_id == coarse_element_ids.front();
+
+    // The root waits for the sizes of all elements and sends the resulting
+    // layout back to them
+    if (is_root) {
+      auto& sizes_inbox =
+          tuples::get<CoarseGridSizesInboxTag<Dim, OptionsGroup>>(inboxes);
+      const auto received_sizes = sizes_inbox.find(iteration_id);
+      if (received_sizes != sizes_inbox.end() and
+          received_sizes->second.size() == coarse_element_ids.size()) {
+        const auto layout =
+            std::move(sizes_inbox.extract(iteration_id).mapped());
+        auto& receiver_proxy =
+            Parallel::get_parallel_component<ParallelComponent>(cache);
+        for (const auto& coarse_element : layout) {
+          Parallel::receive_data<CoarseGridLayoutInboxTag<Dim, OptionsGroup>>(
+              receiver_proxy[coarse_element.first], iteration_id, layout);
+        }
+      }
+    }
+
+    auto& layout_inbox =
+        tuples::get<CoarseGridLayoutInboxTag<Dim, OptionsGroup>>(inboxes);
+    if (layout_inbox.find(iteration_id) == layout_inbox.end()) {
+      return {Parallel::AlgorithmExecution::Retry, std::nullopt};
+    }
+    auto layout = std::move(layout_inbox.extract(iteration_id).mapped());
+    const size_t size = coarse_grid_size(layout);
+
+    db::mutate<Tags::CoarseGridLayout<Dim, OptionsGroup>,
+               Tags::CoarseOperatorColumn<OptionsGroup>,
+               Tags::CoarseOperatorLu<OptionsGroup>,
+               Tags::CoarseOperatorPivots<OptionsGroup>>(
+        make_not_null(&box),
+        [&layout, &size, &is_root](const auto local_layout,
+                                   const auto column, const auto matrix,
+                                   const auto pivots) {
+          *local_layout = std::move(layout);
+          *column = 0;
+          if (is_root) {
+            *matrix = blaze::DynamicMatrix<double, blaze::columnMajor>(
+                size, size, 0.);
+            pivots->resize(size);
+          }
+        });
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+
+// Set the fields to the unit vector that corresponds to the column of the
+// coarse-grid operator that is being assembled. The linear operator is applied
+// to it after this action.
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag>
+struct PrepareCoarseOperatorColumn {
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    const size_t column =
+        db::get<Tags::CoarseOperatorColumn<OptionsGroup>>(box);
+    const size_t offset = coarse_grid_offset(
+        db::get<Tags::CoarseGridLayout<Dim, OptionsGroup>>(box), element_id);
+    db::mutate<FieldsTag>(
+        make_not_null(&box), [&column, &offset](const auto fields) {
+          std::fill(fields->data(), fields->data() + fields->size(), 0.);
+          if (column >= offset and column < offset + fields->size()) {
+            fields->data()[column - offset] = 1.;
+          }
+        });
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag>
+struct SendCoarseOperatorColumn {
+ private:
+  using operator_applied_to_fields_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo, FieldsTag>;
+
+ public:
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    auto& receiver_proxy =
+        Parallel::get_parallel_component<ParallelComponent>(cache);
+    Parallel::receive_data<
+        CoarseOperatorColumnInboxTag<Dim, FieldsTag, OptionsGroup>>(
+        receiver_proxy[coarse_grid_root_id(box, element_id)],
+        db::get<Tags::CoarseOperatorColumn<OptionsGroup>>(box),
+        std::make_pair(element_id,
+                       db::get<operator_applied_to_fields_tag>(box)));
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+
+// The root inserts the column into the matrix once it has received it from all
+// elements, and LU-decomposes the matrix once all columns are assembled. It
+// then notifies the elements, which either proceed with the next column or
+// continue to the solve. Waiting for the root here also ensures that all
+// elements have completed the operator application before the next one starts.
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag>
+struct ReceiveCoarseOperatorColumn {
+  using inbox_tags =
+      tmpl::list<CoarseOperatorColumnInboxTag<Dim, FieldsTag, OptionsGroup>,
+                 CoarseOperatorColumnReceivedInboxTag<OptionsGroup>>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box, tuples::TaggedTuple<InboxTags...>& inboxes,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    const size_t column =
+        db::get<Tags::CoarseOperatorColumn<OptionsGroup>>(box);
+    const auto& layout =
+        db::get<Tags::CoarseGridLayout<Dim, OptionsGroup>>(box);
+    const size_t size = coarse_grid_size(layout);
+
+    if (element_id == coarse_grid_root_id(box, element_id)) {
+      auto& column_inbox = tuples::get<
+          CoarseOperatorColumnInboxTag<Dim, FieldsTag, OptionsGroup>>(inboxes);
+      const auto received_column = column_inbox.find(column);
+      if (received_column != column_inbox.end() and
+          received_column->second.size() == layout.size()) {
+        const auto column_data =
+            std::move(column_inbox.extract(column).mapped());
+        db::mutate<Tags::CoarseOperatorLu<OptionsGroup>,
+                   Tags::CoarseOperatorPivots<OptionsGroup>>(
+            make_not_null(&box),
+            [&column_data, &column, &size](const auto matrix,
+                                           const auto pivots) {
+              // The received data is ordered by element ID, like the layout
+              size_t row = 0;
+              for (const auto& [coarse_element_id, data] : column_data) {
+                for (size_t i = 0; i < data.size(); ++i) {
+                  (*matrix)(row + i, column) = data.data()[i];
+                }
+                row += data.size();
+              }
+              if (column + 1 == size) {
+                const int n = static_cast<int>(size);
+                int info = 0;
+                blaze::getrf(n, n, matrix->data(),
+                             static_cast<int>(matrix->spacing()),
+                             pivots->data(), &info);
+                if (UNLIKELY(info != 0)) {
+                  ERROR("The LU decomposition of the coarse-grid operator "
+                        "failed with LAPACK info "
+                        << info
+                        << ". A positive value means the operator is "
+                           "singular, so it can't be solved directly. "
+                           "Disable the 'DirectSolveAtBottom' option.");
+                }
+              }
+            });
+        if (column + 1 == size and
+            UNLIKELY(db::get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
+                     ::Verbosity::Verbose)) {
+          Parallel::printf(
+              "%s: Assembled and LU-decomposed the coarse-grid operator of "
+              "size %zu\n",
+              pretty_type::name<OptionsGroup>(), size);
+        }
+        auto& receiver_proxy =
+            Parallel::get_parallel_component<ParallelComponent>(cache);
+        for (const auto& coarse_element : layout) {
+          Parallel::receive_data<
+              CoarseOperatorColumnReceivedInboxTag<OptionsGroup>>(
+              receiver_proxy[coarse_element.first], column, column + 1);
+        }
+      }
+    }
+
+    auto& received_inbox =
+        tuples::get<CoarseOperatorColumnReceivedInboxTag<OptionsGroup>>(
+            inboxes);
+    if (received_inbox.find(column) == received_inbox.end()) {
+      return {Parallel::AlgorithmExecution::Retry, std::nullopt};
+    }
+    const size_t next_column = received_inbox.extract(column).mapped();
+    db::mutate<Tags::CoarseOperatorColumn<OptionsGroup>>(
+        make_not_null(&box),
+        [&next_column](const gsl::not_null<size_t*> local_column) {
+          *local_column = next_column;
+        });
+
+    // Repeat until all columns are assembled
+    if (next_column < size) {
+      return {Parallel::AlgorithmExecution::Continue,
+              tmpl::index_of<ActionList,
+                             PrepareCoarseOperatorColumn<
+                                 Dim, FieldsTag, OptionsGroup,
+                                 SourceTag>>::value};
+    }
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag>
+struct SendCoarseGridSource {
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    const size_t iteration_id =
+        db::get<Convergence::Tags::IterationId<OptionsGroup>>(box);
+    if (UNLIKELY(db::get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
+                 ::Verbosity::Debug)) {
+      Parallel::printf("%s %s(%zu): Send source to coarse-grid direct solve\n",
+                       element_id, pretty_type::name<OptionsGroup>(),
+                       iteration_id);
+    }
+
+    auto& receiver_proxy =
+        Parallel::get_parallel_component<ParallelComponent>(cache);
+    Parallel::receive_data<
+        CoarseGridSourceInboxTag<Dim, SourceTag, OptionsGroup>>(
+        receiver_proxy[coarse_grid_root_id(box, element_id)], iteration_id,
+        std::make_pair(element_id, db::get<SourceTag>(box)));
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+
+// The root solves the linear problem once it has received the source from all
+// elements, and sends each element its part of the solution. The elements then
+// continue to the post-smoothing on the coarsest grid, just like they would
+// after pre-smoothing.
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag>
+struct ReceiveCoarseGridSolution {
+ private:
+  using fields_tag = FieldsTag;
+  using operator_applied_to_fields_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo, fields_tag>;
+  using source_tag = SourceTag;
+
+ public:
+  using inbox_tags =
+      tmpl::list<CoarseGridSourceInboxTag<Dim, SourceTag, OptionsGroup>,
+                 CoarseGridSolutionInboxTag<FieldsTag, OptionsGroup>>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box, tuples::TaggedTuple<InboxTags...>& inboxes,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    const size_t iteration_id =
+        db::get<Convergence::Tags::IterationId<OptionsGroup>>(box);
+    const auto& layout =
+        db::get<Tags::CoarseGridLayout<Dim, OptionsGroup>>(box);
+
+    if (element_id == coarse_grid_root_id(box, element_id)) {
+      auto& source_inbox =
+          tuples::get<CoarseGridSourceInboxTag<Dim, SourceTag, OptionsGroup>>(
+              inboxes);
+      const auto received_source = source_inbox.find(iteration_id);
+      if (received_source != source_inbox.end() and
+          received_source->second.size() == layout.size()) {
+        const auto sources =
+            std::move(source_inbox.extract(iteration_id).mapped());
+        // Gather the source. It is ordered by element ID, like the layout.
+        blaze::DynamicVector<double> solution(coarse_grid_size(layout));
+        size_t offset = 0;
+        for (const auto& [coarse_element_id, source] : sources) {
+          std::copy(source.data(), source.data() + source.size(),
+                    solution.begin() + offset);
+          offset += source.size();
+        }
+        // Solve directly with the LU decomposition
+        const auto& pivots =
+            db::get<Tags::CoarseOperatorPivots<OptionsGroup>>(box);
+        blaze::getrs(db::get<Tags::CoarseOperatorLu<OptionsGroup>>(box),
+                     solution, 'N', pivots.data());
+        // Scatter the solution
+        auto& receiver_proxy =
+            Parallel::get_parallel_component<ParallelComponent>(cache);
+        offset = 0;
+        for (const auto& [coarse_element_id, num_values] : layout) {
+          typename fields_tag::type element_solution{
+              num_values /
+              fields_tag::type::number_of_independent_components};
+          std::copy(solution.begin() + offset,
+                    solution.begin() + offset + num_values,
+                    element_solution.data());
+          Parallel::receive_data<
+              CoarseGridSolutionInboxTag<FieldsTag, OptionsGroup>>(
+              receiver_proxy[coarse_element_id], iteration_id,
+              std::move(element_solution));
+          offset += num_values;
+        }
+      }
+    }
+
+    auto& solution_inbox =
+        tuples::get<CoarseGridSolutionInboxTag<FieldsTag, OptionsGroup>>(
+            inboxes);
+    if (solution_inbox.find(iteration_id) == solution_inbox.end()) {
+      return {Parallel::AlgorithmExecution::Retry, std::nullopt};
+    }
+    auto solution = std::move(solution_inbox.extract(iteration_id).mapped());
+    ASSERT(solution.size() == db::get<fields_tag>(box).size(),
+           "Received a coarse-grid solution of size "
+               << solution.size() << " on element " << element_id
+               << ", but expected size " << db::get<fields_tag>(box).size()
+               << ".");
+
+    // The solution is exact, so the linear operator applied to it is the
+    // source (up to roundoff) and the residual vanishes
+    db::mutate<fields_tag, operator_applied_to_fields_tag>(
+        make_not_null(&box),
+        [&solution](const auto fields, const auto operator_applied_to_fields,
+                    const auto& source) {
+          *fields = std::move(solution);
+          *operator_applied_to_fields =
+              typename operator_applied_to_fields_tag::type(source);
+        },
+        db::get<source_tag>(box));
+
+    return {Parallel::AlgorithmExecution::Continue,
+            tmpl::index_of<ActionList,
+                           SkipPostSmoothingAtBottom<FieldsTag, OptionsGroup,
+                                                     SourceTag>>::value};
+  }
+};
+
+// Solve the coarsest grid directly with an assembled matrix representation of
+// the linear operator. See
+// `LinearSolver::multigrid::Tags::DirectSolveAtBottom`.
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag, typename ApplyOperatorActions>
+using DirectSolveAtBottom = tmpl::list<
+    SendCoarseGridSize<Dim, FieldsTag, OptionsGroup, SourceTag>,
+    ReceiveCoarseGridLayout<Dim, FieldsTag, OptionsGroup, SourceTag>,
+    PrepareCoarseOperatorColumn<Dim, FieldsTag, OptionsGroup, SourceTag>,
+    ApplyOperatorActions,
+    SendCoarseOperatorColumn<Dim, FieldsTag, OptionsGroup, SourceTag>,
+    ReceiveCoarseOperatorColumn<Dim, FieldsTag, OptionsGroup, SourceTag>,
+    SendCoarseGridSource<Dim, FieldsTag, OptionsGroup, SourceTag>,
+    ReceiveCoarseGridSolution<Dim, FieldsTag, OptionsGroup, SourceTag>>;
+
+}  // namespace LinearSolver::multigrid::detail
@@ -7,10 +7,12 @@
 #include <map>
 #include <optional>
 #include <unordered_set>
+#include <vector>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DynamicMatrix.hpp"
 #include "DataStructures/FixedHashMap.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "Domain/Creators/Tags/InitialRefinementLevels.hpp"
@@ -46,6 +48,7 @@ template <typename FieldsTag, typename OptionsGroup, typename SourceTag>
 struct SkipPostSmoothingAtBottom;
 /// \endcond
 
+struct PreSmoothingBeginLabel {};
 struct PostSmoothingBeginLabel {};
 
 template <size_t Dim, typename FieldsTag, typename OptionsGroup,
@@ -60,7 +63,11 @@ struct InitializeElement {
                  observers::Tags::ObservationKey<Tags::MultigridLevel>,
                  observers::Tags::ObservationKey<Tags::IsFinestGrid>,
                  Tags::ObservationId<OptionsGroup>,
-                 Tags::VolumeDataForOutput<OptionsGroup, FieldsTag>>;
+                 Tags::VolumeDataForOutput<OptionsGroup, FieldsTag>,
+                 Tags::CoarseGridLayout<Dim, OptionsGroup>,
+                 Tags::CoarseOperatorColumn<OptionsGroup>,
+                 Tags::CoarseOperatorLu<OptionsGroup>,
+                 Tags::CoarseOperatorPivots<OptionsGroup>>;
   using compute_tags = tmpl::list<>;
   using const_global_cache_tags =
       tmpl::list<Tags::MaxLevels<OptionsGroup>,
@@ -113,7 +120,8 @@ struct InitializeElement {
         make_not_null(&box), std::move(parent_id), std::move(child_ids),
         std::move(parent_mesh), std::move(observation_key_level),
         std::move(observation_key_is_finest_grid), size_t{0},
-        std::move(volume_data));
+        std::move(volume_data), std::map<ElementId<Dim>, size_t>{}, size_t{0},
+        blaze::DynamicMatrix<double, blaze::columnMajor>{}, std::vector<int>{});
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
 };
@@ -147,7 +155,8 @@ struct PreparePreSmoothing {
 
  public:
   using const_global_cache_tags = tmpl::list<
-      LinearSolver::multigrid::Tags::EnablePreSmoothing<OptionsGroup>>;
+      LinearSolver::multigrid::Tags::EnablePreSmoothing<OptionsGroup>,
+      LinearSolver::multigrid::Tags::DirectSolveAtBottom<OptionsGroup>>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             size_t Dim, typename ActionList, typename ParallelComponent>
@@ -201,18 +210,32 @@ struct PreparePreSmoothing {
           db::get<fields_tag>(box), db::get<source_tag>(box));
     }
 
+    // Solve the coarsest grid directly instead of pre-smoothing, if requested.
+    // The direct solve actions follow this action.
+    const bool is_coarsest_grid =
+        not db::get<Tags::ParentId<Dim>>(box).has_value();
+    const size_t this_action_index =
+        tmpl::index_of<ActionList, PreparePreSmoothing>::value;
+    if (is_coarsest_grid and
+        db::get<LinearSolver::multigrid::Tags::DirectSolveAtBottom<
+            OptionsGroup>>(box)) {
+      return {Parallel::AlgorithmExecution::Continue, this_action_index + 1};
+    }
+
     // Skip pre-smoothing, if requested
+    const size_t pre_smoothing_begin_index =
+        tmpl::index_of<ActionList,
+                       ::Actions::Label<PreSmoothingBeginLabel>>::value +
+        1;
     const size_t first_action_after_pre_smoothing_index = tmpl::index_of<
         ActionList,
         SkipPostSmoothingAtBottom<FieldsTag, OptionsGroup, SourceTag>>::value;
-    const size_t this_action_index =
-        tmpl::index_of<ActionList, PreparePreSmoothing>::value;
     return {
         Parallel::AlgorithmExecution::Continue,
         db::get<
             LinearSolver::multigrid::Tags::EnablePreSmoothing<OptionsGroup>>(
             box)
-            ? (this_action_index + 1)
+            ? pre_smoothing_begin_index
             : first_action_after_pre_smoothing_index};
   }
 };
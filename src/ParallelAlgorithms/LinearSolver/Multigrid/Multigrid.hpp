@@ -10,6 +10,7 @@
 #include "IO/Observer/Helpers.hpp"
 #include "ParallelAlgorithms/Actions/Goto.hpp"
 #include "ParallelAlgorithms/LinearSolver/AsynchronousSolvers/ElementActions.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/DirectSolveAtBottom.hpp"
 #include "ParallelAlgorithms/LinearSolver/Multigrid/ElementActions.hpp"
 #include "ParallelAlgorithms/LinearSolver/Multigrid/ObserveVolumeData.hpp"
 #include "Utilities/TMPL.hpp"
@@ -109,6 +110,27 @@ struct VcycleUpLabel {};
  * top-most finest grid (the "original" grid that represents the overall
  * solution) the algorithm applies the smoothing and the corrections from the
  * coarser grids directly to the solution fields.
+ *
+ * \par Direct solve at the bottom
+ * Since the smoother only solves approximately on the coarsest grid, the number
+ * of V-cycles needed to converge can grow with the size of the coarsest grid.
+ * The option `LinearSolver::multigrid::Tags::DirectSolveAtBottom` replaces the
+ * pre-smoothing on the coarsest grid by an exact solve. To this end, the
+ * linear operator on the coarsest grid is assembled into a matrix the first
+ * time the V-cycle reaches the coarsest grid. Every column of the matrix is
+ * obtained by applying the `ApplyOperatorActions` to a unit vector, which
+ * requires one operator application per degree of freedom on the coarsest
+ * grid. The matrix is gathered on one of the elements of the coarsest grid and
+ * LU-decomposed once. In every V-cycle the elements on the coarsest grid send
+ * their source to this element, which solves the linear problem and sends the
+ * solution back. Since the matrix is dense and stored on a single element,
+ * this option is only feasible if the coarsest grid is small, e.g. when it
+ * covers every block with a single element. Note that assembling the matrix
+ * is sequential: every column takes a full operator application plus a round
+ * trip to the element that gathers the matrix. The matrix is reused for all
+ * solves until `LinearSolver::multigrid::Actions::ResetCoarseOperator` is
+ * invoked, so invoke it whenever the linear operator changes, e.g. in every
+ * iteration of a nonlinear solve.
  */
 template <size_t Dim, typename FieldsTag, typename OptionsGroup,
           typename ResidualIsMassiveTag,
@@ -147,6 +169,9 @@ struct Multigrid {
       detail::ReceiveResidualFromFinerGrid<Dim, FieldsTag, OptionsGroup,
                                            SourceTag>,
       detail::PreparePreSmoothing<FieldsTag, OptionsGroup, SourceTag>,
+      detail::DirectSolveAtBottom<Dim, FieldsTag, OptionsGroup, SourceTag,
+                                  ApplyOperatorActions>,
+      ::Actions::Label<detail::PreSmoothingBeginLabel>,
       // No need to apply the linear operator here:
       // - On the finest grid, the operator applied to the fields should have
       //   already been computed at this point, either applied to the initial
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <map>
 #include <optional>
 #include <string>
 #include <unordered_set>
@@ -12,8 +13,10 @@
 
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DynamicMatrix.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/Creators/Tags/InitialRefinementLevels.hpp"
+#include "Domain/Structure/ElementId.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/Auto.hpp"
 #include "Options/Options.hpp"
@@ -72,6 +75,23 @@ struct EnablePostSmoothingAtBottom {
   using group = OptionsGroup;
 };
 
+template <typename OptionsGroup>
+struct DirectSolveAtBottom {
+  using type = bool;
+  static constexpr Options::String help =
+      "Set to 'True' to solve the coarsest grid exactly instead of smoothing "
+      "it. The linear operator on the coarsest grid is assembled into a matrix "
+      "the first time the V-cycle reaches the coarsest grid. Every degree of "
+      "freedom on the coarsest grid costs one full distributed operator "
+      "application plus a round trip to the root element, all in sequence. "
+      "The matrix is gathered on a single element and LU-decomposed, so it "
+      "must fit into memory on a single node. It is reused for all subsequent "
+      "V-cycles until the linear operator changes, e.g. in every iteration of "
+      "a nonlinear solve. Only enable this option if the coarsest grid is "
+      "small.";
+  using group = OptionsGroup;
+};
+
 }  // namespace OptionTags
 
 /// DataBox tags for the `LinearSolver::multigrid::Multigrid` linear solver
@@ -159,6 +179,23 @@ struct EnablePostSmoothingAtBottom : db::SimpleTag {
   }
 };
 
+/// Solve the coarsest grid exactly with an assembled and LU-decomposed matrix
+/// representation of the linear operator, instead of smoothing it. A value of
+/// `true` skips pre-smoothing on the coarsest grid. Invoke
+/// `LinearSolver::multigrid::Actions::ResetCoarseOperator` when the linear
+/// operator changes.
+template <typename OptionsGroup>
+struct DirectSolveAtBottom : db::SimpleTag {
+  using type = bool;
+  static constexpr bool pass_metavariables = false;
+  using option_tags =
+      tmpl::list<OptionTags::DirectSolveAtBottom<OptionsGroup>>;
+  static type create_from_options(const type value) { return value; };
+  static std::string name() {
+    return "DirectSolveAtBottom(" + pretty_type::name<OptionsGroup>() + ")";
+  }
+};
+
 /// The multigrid level. The finest grid is always level 0 and the coarsest grid
 /// has the highest level.
 struct MultigridLevel : db::SimpleTag {
@@ -189,6 +226,48 @@ struct ParentMesh : db::SimpleTag {
   using type = std::optional<Mesh<Dim>>;
 };
 
+// The following tags are related to the direct solve on the coarsest grid
+
+/// The number of values that each element on the coarsest grid contributes to
+/// the assembled coarse-grid operator, ordered by element ID. Empty until the
+/// elements on the coarsest grid have exchanged their sizes.
+template <size_t Dim, typename OptionsGroup>
+struct CoarseGridLayout : db::SimpleTag {
+  using type = std::map<ElementId<Dim>, size_t>;
+  static std::string name() {
+    return "CoarseGridLayout(" + pretty_type::name<OptionsGroup>() + ")";
+  }
+};
+
+/// The number of columns of the coarse-grid operator that have been assembled
+template <typename OptionsGroup>
+struct CoarseOperatorColumn : db::SimpleTag {
+  using type = size_t;
+  static std::string name() {
+    return "CoarseOperatorColumn(" + pretty_type::name<OptionsGroup>() + ")";
+  }
+};
+
+/// The assembled coarse-grid operator, or its LU decomposition once all
+/// columns have been assembled. Only the element on the coarsest grid that
+/// performs the direct solve holds this matrix, it is empty on all others.
+template <typename OptionsGroup>
+struct CoarseOperatorLu : db::SimpleTag {
+  using type = blaze::DynamicMatrix<double, blaze::columnMajor>;
+  static std::string name() {
+    return "CoarseOperatorLu(" + pretty_type::name<OptionsGroup>() + ")";
+  }
+};
+
+/// The row pivots of the LU decomposition of the coarse-grid operator
+template <typename OptionsGroup>
+struct CoarseOperatorPivots : db::SimpleTag {
+  using type = std::vector<int>;
+  static std::string name() {
+    return "CoarseOperatorPivots(" + pretty_type::name<OptionsGroup>() + ")";
+  }
+};
+
 // The following tags are related to volume data output
 
 /// Continuously incrementing ID for volume observations
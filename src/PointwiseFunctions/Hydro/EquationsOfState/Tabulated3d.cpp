@@ -44,12 +44,8 @@ Scalar<DataType> Tabulated3D<IsRelativistic>::
     const auto& log_T = get(log_temperature);
 
     const auto f = [this, log_rho, log_T](const double ye) {
-
-      const auto weights = interpolator_.get_weights(log_T, log_rho, ye);
-      const auto interpolated_values =
-          interpolator_.template interpolate<DeltaMu>(weights);
-
-      return interpolated_values[0];
+      return table_.template interpolate<DeltaMu>(
+          table_.locate(log_T, log_rho, ye))[0];
     };
 
     const auto root_from_lambda =
@@ -64,12 +60,8 @@ Scalar<DataType> Tabulated3D<IsRelativistic>::
       const auto& log_T = get(log_temperature)[s];
 
       const auto f = [this, log_rho, log_T](const double ye) {
-
-        const auto weights = interpolator_.get_weights(log_T, log_rho, ye);
-        const auto interpolated_values =
-            interpolator_.template interpolate<DeltaMu>(weights);
-
-        return interpolated_values[0];
+        return table_.template interpolate<DeltaMu>(
+            table_.locate(log_T, log_rho, ye))[0];
       };
 
       const auto root_from_lambda = RootFinder::toms748(
@@ -211,30 +203,16 @@ void Tabulated3D<IsRelativistic>::initialize(
   table_electron_fraction_ = std::move(electron_fraction);
   table_log_density_ = std::move(log_density);
   table_log_temperature_ = std::move(log_temperature);
-  table_data_ = std::move(table_data);
-  // Need to table
-
-  Index<3> num_x_points;
 
   // The order is T, rho, Ye
-  num_x_points[0] = table_log_temperature_.size();
-  num_x_points[1] = table_log_density_.size();
-  num_x_points[2] = table_electron_fraction_.size();
-
-  std::array<gsl::span<double const>, 3> independent_data_view;
-
-  independent_data_view[0] =
-      gsl::span<double const>{table_log_temperature_.data(), num_x_points[0]};
-
-  independent_data_view[1] =
-      gsl::span<double const>{table_log_density_.data(), num_x_points[1]};
-
-  independent_data_view[2] =
-      gsl::span<double const>{table_electron_fraction_.data(), num_x_points[2]};
-
-  interpolator_ = intrp::UniformMultiLinearSpanInterpolation<3, NumberOfVars>(
-      independent_data_view, {table_data_.data(), table_data_.size()},
-      num_x_points);
+  table_ = intrp::UniformTable3D<NumberOfVars>(
+      {{table_log_temperature_.front(), table_log_density_.front(),
+        table_electron_fraction_.front()}},
+      {{table_log_temperature_.back(), table_log_density_.back(),
+        table_electron_fraction_.back()}},
+      Index<3>(table_log_temperature_.size(), table_log_density_.size(),
+               table_electron_fraction_.size()),
+      std::move(table_data), Epsilon);
 }
 
 template <bool IsRelativistic>
@@ -254,7 +232,7 @@ bool Tabulated3D<IsRelativistic>::operator==(
   result &= (rhs.table_electron_fraction_ == this->table_electron_fraction_);
   result &= (rhs.table_log_density_ == this->table_log_density_);
   result &= (rhs.table_log_temperature_ == this->table_log_temperature_);
-  result &= (rhs.table_data_ == this->table_data_);
+  result &= (rhs.table_ == this->table_);
 
   return result;
 }
@@ -338,22 +316,16 @@ Tabulated3D<IsRelativistic>::pressure_from_density_and_temperature_impl(
       make_with_value<Scalar<DataType>>(get(rest_mass_density), 0.0);
 
   if constexpr (std::is_same_v<DataType, double>) {
-    auto weights = interpolator_.get_weights(get(log_temperature),
-                                             get(log_rest_mass_density),
-                                             get(converted_electron_fraction));
-    auto interpolated_state =
-        interpolator_.template interpolate<Pressure>(weights);
+    const auto interpolated_state = table_.template interpolate<Pressure>(
+        table_.locate(get(log_temperature), get(log_rest_mass_density),
+                      get(converted_electron_fraction)));
     get(pressure) = std::exp(interpolated_state[0]);
 
   } else if constexpr (std::is_same_v<DataType, DataVector>) {
-    for (size_t s = 0; s < electron_fraction.size(); ++s) {
-      auto weights = interpolator_.get_weights(
-          get(log_temperature)[s], get(log_rest_mass_density)[s],
-          get(converted_electron_fraction)[s]);
-      auto interpolated_state =
-          interpolator_.template interpolate<Pressure>(weights);
-      get(pressure)[s] = std::exp(interpolated_state[0]);
-    }
+    table_.template interpolate<Pressure>(
+        make_not_null(&get(pressure)), get(log_temperature),
+        get(log_rest_mass_density), get(converted_electron_fraction));
+    get(pressure) = exp(get(pressure));
   }
 
   return pressure;
@@ -368,7 +340,7 @@ void Tabulated3D<IsRelativistic>::pup(PUP::er& p) {
   p | table_electron_fraction_;
   p | table_log_density_;
   p | table_log_temperature_;
-  p | table_data_;
+  p | table_;
 }
 
 template <bool IsRelativistic>
@@ -417,52 +389,18 @@ Tabulated3D<IsRelativistic>::temperature_from_density_and_energy_impl(
   get(log_specific_internal_energy) -= energy_shift_;
   get(log_specific_internal_energy) = log(get(log_specific_internal_energy));
 
+  // The interpolated energy is piecewise linear in log T, so the precomputed
+  // inverse table of the interpolation table gives the exact root
   if constexpr (std::is_same_v<DataType, double>) {
-    const auto& log_eps = get(log_specific_internal_energy);
-    const auto& log_rho = get(log_rest_mass_density);
-    const auto& ye = get(converted_electron_fraction);
-
-    // Root-finding appropriate between reference density and maximum density
-    // We can use x=0 and x=x_max as bounds
-    const auto f = [this, log_eps, log_rho, ye](const double log_T) {
-
-      const auto weights = interpolator_.get_weights(log_T, log_rho, ye);
-      const auto interpolated_values =
-          interpolator_.template interpolate<Epsilon>(weights);
-
-      return log_eps - interpolated_values[0];
-    };
-
-    const auto root_from_lambda = RootFinder::toms748(
-        f, table_log_temperature_.front(),
-        upper_bound_tolerance_ * table_log_temperature_.back(), 1.0e-14,
-        1.0e-15);
-
-    get(temperature) = exp(root_from_lambda);
-
+    get(temperature) = exp(table_.invert_first_coordinate(
+        get(log_specific_internal_energy), get(log_rest_mass_density),
+        get(converted_electron_fraction)));
   } else if constexpr (std::is_same_v<DataType, DataVector>) {
-    for (size_t s = 0; s < electron_fraction.size(); ++s) {
-      const auto& log_eps = get(log_specific_internal_energy)[s];
-      const auto& log_rho = get(log_rest_mass_density)[s];
-      const auto& ye = get(converted_electron_fraction)[s];
-
-      // Root-finding appropriate between reference density and maximum density
-      // We can use x=0 and x=x_max as bounds
-      const auto f = [this, log_eps, log_rho, ye](const double log_T) {
-
-        const auto weights = interpolator_.get_weights(log_T, log_rho, ye);
-        const auto interpolated_values =
-            interpolator_.template interpolate<Epsilon>(weights);
-
-        return log_eps - interpolated_values[0];
-      };
-      const auto root_from_lambda = RootFinder::toms748(
-          f, table_log_temperature_.front(),
-          upper_bound_tolerance_ * table_log_temperature_.back(), 1.0e-14,
-          1.0e-15);
-
-      get(temperature)[s] = exp(root_from_lambda);
-    }
+    table_.invert_first_coordinate(make_not_null(&get(temperature)),
+                                   get(log_specific_internal_energy),
+                                   get(log_rest_mass_density),
+                                   get(converted_electron_fraction));
+    get(temperature) = exp(get(temperature));
   }
   return temperature;
 }
@@ -487,23 +425,17 @@ Scalar<DataType> Tabulated3D<IsRelativistic>::
       make_with_value<Scalar<DataType>>(get(rest_mass_density), 0.0);
 
   if constexpr (std::is_same_v<DataType, double>) {
-    auto weights = interpolator_.get_weights(get(log_temperature),
-                                             get(log_rest_mass_density),
-                                             get(converted_electron_fraction));
-    auto interpolated_state =
-        interpolator_.template interpolate<Epsilon>(weights);
+    const auto interpolated_state = table_.template interpolate<Epsilon>(
+        table_.locate(get(log_temperature), get(log_rest_mass_density),
+                      get(converted_electron_fraction)));
     get(specific_internal_energy) =
         std::exp(interpolated_state[0]) + energy_shift_;
   } else if constexpr (std::is_same_v<DataType, DataVector>) {
-    for (size_t s = 0; s < electron_fraction.size(); ++s) {
-      auto weights = interpolator_.get_weights(
-          get(log_temperature)[s], get(log_rest_mass_density)[s],
-          get(converted_electron_fraction)[s]);
-      auto interpolated_state =
-          interpolator_.template interpolate<Epsilon>(weights);
-      get(specific_internal_energy)[s] =
-          std::exp(interpolated_state[0]) + energy_shift_;
-    }
+    table_.template interpolate<Epsilon>(
+        make_not_null(&get(specific_internal_energy)), get(log_temperature),
+        get(log_rest_mass_density), get(converted_electron_fraction));
+    get(specific_internal_energy) =
+        exp(get(specific_internal_energy)) + energy_shift_;
   }
 
   return specific_internal_energy;
@@ -529,22 +461,15 @@ Scalar<DataType> Tabulated3D<IsRelativistic>::
       make_with_value<Scalar<DataType>>(get(rest_mass_density), 0.0);
 
   if constexpr (std::is_same_v<DataType, double>) {
-    auto weights = interpolator_.get_weights(get(log_temperature),
-                                             get(log_rest_mass_density),
-                                             get(converted_electron_fraction));
-    auto interpolated_state =
-        interpolator_.template interpolate<CsSquared>(weights);
+    const auto interpolated_state = table_.template interpolate<CsSquared>(
+        table_.locate(get(log_temperature), get(log_rest_mass_density),
+                      get(converted_electron_fraction)));
     get(cs2) = interpolated_state[0];
 
   } else if constexpr (std::is_same_v<DataType, DataVector>) {
-    for (size_t s = 0; s < electron_fraction.size(); ++s) {
-      auto weights = interpolator_.get_weights(
-          get(log_temperature)[s], get(log_rest_mass_density)[s],
-          get(converted_electron_fraction)[s]);
-      auto interpolated_state =
-          interpolator_.template interpolate<CsSquared>(weights);
-      get(cs2)[s] = interpolated_state[0];
-    }
+    table_.template interpolate<CsSquared>(
+        make_not_null(&get(cs2)), get(log_temperature),
+        get(log_rest_mass_density), get(converted_electron_fraction));
   }
 
   return cs2;
@@ -563,11 +488,9 @@ double Tabulated3D<IsRelativistic>::specific_internal_energy_lower_bound(
 
   log_rest_mass_density = log(log_rest_mass_density);
 
-  auto weights = interpolator_.get_weights(log(temperature_lower_bound()),
-                                           log_rest_mass_density,
-                                           converted_electron_fraction);
-  auto interpolated_state =
-      interpolator_.template interpolate<Epsilon>(weights);
+  const auto interpolated_state = table_.template interpolate<Epsilon>(
+      table_.locate(log(temperature_lower_bound()), log_rest_mass_density,
+                    converted_electron_fraction));
 
   return exp(interpolated_state[0]) + energy_shift_;
 }
@@ -585,11 +508,9 @@ double Tabulated3D<IsRelativistic>::specific_internal_energy_upper_bound(
 
   log_rest_mass_density = log(log_rest_mass_density);
 
-  auto weights = interpolator_.get_weights(
-      log(upper_bound_tolerance_ * temperature_upper_bound()),
-      log_rest_mass_density, converted_electron_fraction);
-  auto interpolated_state =
-      interpolator_.template interpolate<Epsilon>(weights);
+  const auto interpolated_state = table_.template interpolate<Epsilon>(
+      table_.locate(log(upper_bound_tolerance_ * temperature_upper_bound()),
+                    log_rest_mass_density, converted_electron_fraction));
 
   return exp(interpolated_state[0]) + energy_shift_;
 }
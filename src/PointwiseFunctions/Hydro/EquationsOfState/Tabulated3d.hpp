@@ -16,7 +16,7 @@
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "IO/H5/EosTable.hpp"
 #include "IO/H5/File.hpp"
-#include "NumericalAlgorithms/Interpolation/MultiLinearSpanInterpolation.hpp"
+#include "NumericalAlgorithms/Interpolation/UniformTable3D.hpp"
 #include "Options/Options.hpp"
 #include "Parallel/CharmPupable.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"  // IWYU pragma: keep
@@ -40,6 +40,13 @@ namespace EquationsOfState {
  * where \f$\rho\f$ is the rest mass density, \f$T\f$ is the
  * temperature, and \f$Y_e\f$ is the electron fraction.
  * The temperature is given in units of MeV.
+ *
+ * The table is uniform in \f$(\log T, \log \rho, Y_e)\f$ and is interpolated
+ * with `intrp::UniformTable3D`, which stores all tabulated quantities of a
+ * node next to each other. The temperature is computed from the specific
+ * internal energy with the precomputed inverse table of
+ * `intrp::UniformTable3D` instead of a root find, which requires the specific
+ * internal energy to increase monotonically with the temperature.
  */
 template <bool IsRelativistic>
 class Tabulated3D : public EquationOfState<IsRelativistic, 3> {
@@ -220,18 +227,17 @@ class Tabulated3D : public EquationOfState<IsRelativistic, 3> {
   /// Enthalpy minium  across the table
   double enthalpy_minimum_ = 1.;
 
-  /// Main interpolator for the EoS.
+  /// Main interpolation table for the EoS, which also holds the tabulated
+  /// data. Entries are stated in the enum.
   /// The ordering is  \f$(\log T. \log \rho, Y_e)\f$.
   /// Assumed to be sorted in ascending order.
-  intrp::UniformMultiLinearSpanInterpolation<3, NumberOfVars> interpolator_{};
+  intrp::UniformTable3D<NumberOfVars> table_{};
   /// Electron fraction
   std::vector<double> table_electron_fraction_{};
   /// Logarithmic rest-mass denisty
   std::vector<double> table_log_density_{};
   /// Logarithmic temperature
   std::vector<double> table_log_temperature_{};
-  /// Tabulate data. Entries are stated in the enum
-  std::vector<double> table_data_{};
 
   /// Tolerance on upper bound for root finding
   static constexpr double upper_bound_tolerance_ = 0.9999;
@@ -0,0 +1,186 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Utilities/MemoryPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <pup.h>
+#include <unordered_map>
+#include <vector>
+
+namespace memory_pool {
+namespace {
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<bool> pool_enabled{false};
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<size_t> max_cached_bytes_per_thread{size_t{256} * 1024 * 1024};
+
+size_t size_class(const size_t bytes) {
+  return (bytes + size_class_alignment - 1) / size_class_alignment *
+         size_class_alignment;
+}
+
+class Pool {
+ public:
+  Pool() = default;
+  Pool(const Pool&) = delete;
+  Pool& operator=(const Pool&) = delete;
+  Pool(Pool&&) = delete;
+  Pool& operator=(Pool&&) = delete;
+  ~Pool();
+
+  void* allocate(size_t bytes);
+  void deallocate(void* ptr, size_t bytes);
+  void release();
+
+  Statistics statistics{};
+
+ private:
+  // Free blocks keyed by size class
+  std::unordered_map<size_t, std::vector<void*>> free_lists_{};
+};
+
+// Set when the pool of a thread is destroyed at thread exit, so memory that is
+// freed afterwards (e.g. by static objects) goes straight to the system.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local bool pool_destroyed = false;
+
+Pool* local_pool() {
+  thread_local Pool pool{};
+  return pool_destroyed ? nullptr : &pool;
+}
+
+Pool::~Pool() {
+  release();
+  pool_destroyed = true;
+}
+
+void* Pool::allocate(const size_t bytes) {
+  ++statistics.allocations;
+  statistics.bytes_allocated += bytes;
+  statistics.bytes_in_use += static_cast<std::int64_t>(bytes);
+  statistics.peak_bytes_in_use =
+      std::max(statistics.peak_bytes_in_use, statistics.bytes_in_use);
+  const auto free_list = free_lists_.find(bytes);
+  if (free_list != free_lists_.end() and not free_list->second.empty()) {
+    ++statistics.pool_hits;
+    statistics.bytes_cached -= bytes;
+    void* const ptr = free_list->second.back();
+    free_list->second.pop_back();
+    return ptr;
+  }
+  return ::operator new(bytes);
+}
+
+void Pool::deallocate(void* const ptr, const size_t bytes) {
+  statistics.bytes_in_use -= static_cast<std::int64_t>(bytes);
+  if (statistics.bytes_cached + bytes > max_cached_bytes()) {
+    ::operator delete(ptr);
+    return;
+  }
+  free_lists_[bytes].push_back(ptr);
+  statistics.bytes_cached += bytes;
+}
+
+void Pool::release() {
+  for (auto& [bytes, free_list] : free_lists_) {
+    for (void* const ptr : free_list) {
+      ::operator delete(ptr);
+    }
+  }
+  free_lists_.clear();
+  statistics.bytes_cached = 0;
+}
+}  // namespace
+
+double Statistics::hit_rate() const {
+  return allocations == 0 ? 0.0
+                          : static_cast<double>(pool_hits) /
+                                static_cast<double>(allocations);
+}
+
+void Statistics::pup(PUP::er& p) {
+  p | allocations;
+  p | pool_hits;
+  p | bytes_allocated;
+  p | bytes_in_use;
+  p | peak_bytes_in_use;
+  p | bytes_cached;
+}
+
+void enable() { pool_enabled.store(true, std::memory_order_relaxed); }
+
+void disable() { pool_enabled.store(false, std::memory_order_relaxed); }
+
+bool is_enabled() { return pool_enabled.load(std::memory_order_relaxed); }
+
+size_t max_cached_bytes() {
+  return max_cached_bytes_per_thread.load(std::memory_order_relaxed);
+}
+
+void set_max_cached_bytes(const size_t max_cached_bytes) {
+  max_cached_bytes_per_thread.store(max_cached_bytes,
+                                    std::memory_order_relaxed);
+}
+
+void* allocate(const size_t bytes) {
+  if (bytes == 0) {
+    return nullptr;
+  }
+  // Memory is always obtained from `::operator new` so it can be freed
+  // regardless of whether the pool is enabled at that point.
+  const size_t rounded_bytes = size_class(bytes);
+  if (not is_enabled() or rounded_bytes > max_cached_bytes()) {
+    return ::operator new(rounded_bytes);
+  }
+  Pool* const pool = local_pool();
+  if (pool == nullptr) {
+    return ::operator new(rounded_bytes);  // LCOV_EXCL_LINE
+  }
+  return pool->allocate(rounded_bytes);
+}
+
+void deallocate(void* const ptr, const size_t bytes) {
+  if (ptr == nullptr) {
+    return;
+  }
+  const size_t rounded_bytes = size_class(bytes);
+  if (not is_enabled() or rounded_bytes > max_cached_bytes()) {
+    ::operator delete(ptr);
+    return;
+  }
+  Pool* const pool = local_pool();
+  if (pool == nullptr) {
+    ::operator delete(ptr);  // LCOV_EXCL_LINE
+    return;                  // LCOV_EXCL_LINE
+  }
+  pool->deallocate(ptr, rounded_bytes);
+}
+
+void release_cached_memory() {
+  Pool* const pool = local_pool();
+  if (pool != nullptr) {
+    pool->release();
+  }
+}
+
+Statistics statistics() {
+  const Pool* const pool = local_pool();
+  return pool == nullptr ? Statistics{} : pool->statistics;
+}
+
+void reset_statistics() {
+  Pool* const pool = local_pool();
+  if (pool != nullptr) {
+    auto& stats = pool->statistics;
+    stats.allocations = 0;
+    stats.pool_hits = 0;
+    stats.bytes_allocated = 0;
+    stats.peak_bytes_in_use = stats.bytes_in_use;
+  }
+}
+}  // namespace memory_pool
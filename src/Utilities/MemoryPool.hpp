@@ -0,0 +1,129 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+/*!
+ * \brief A per-thread (i.e. per-PE) pool of heap memory for the data of
+ * `DataVector`s, `Variables` and `DynamicBuffer`s.
+ *
+ * \details Temporary vectors and `Variables` are created and destroyed all the
+ * time, and their sizes repeat endlessly because they are mostly determined by
+ * the number of grid points of the elements and the number of tensor
+ * components. When the pool is enabled, freed memory is kept in a free list of
+ * its size class (the requested size rounded up to
+ * `memory_pool::size_class_alignment` bytes) and reused for the next request
+ * of the same size class instead of returning it to the system allocator.
+ *
+ * The pool is disabled by default. Enable it in an executable by adding
+ * `&memory_pool::enable` to the `charm_init_node_funcs`. Memory may be freed
+ * on a different thread than the one it was allocated on; it is then cached in
+ * the pool of the freeing thread. Each thread caches at most
+ * `memory_pool::max_cached_bytes()` bytes, and allocations larger than that
+ * bypass the pool.
+ *
+ * The pool keeps counters of the allocator traffic on each thread, which the
+ * memory monitor (see `Events::MonitorMemory`) reports for each PE.
+ */
+namespace memory_pool {
+/// Sizes of pooled allocations are rounded up to a multiple of this number of
+/// bytes.
+constexpr size_t size_class_alignment = 64;
+
+/// Counters of the allocator traffic on one thread since the last call to
+/// `memory_pool::reset_statistics()`.
+struct Statistics {
+  /// Number of allocations requested while the pool was enabled
+  size_t allocations = 0;
+  /// Number of allocations that were served from the pool
+  size_t pool_hits = 0;
+  /// Total number of bytes requested (rounded up to the size class)
+  size_t bytes_allocated = 0;
+  /// Bytes allocated minus bytes freed on this thread. This can be negative if
+  /// memory allocated on another thread is freed on this one.
+  std::int64_t bytes_in_use = 0;
+  /// Maximum of `bytes_in_use`
+  std::int64_t peak_bytes_in_use = 0;
+  /// Bytes held in the free lists of this thread
+  size_t bytes_cached = 0;
+
+  /// Fraction of allocations that were served from the pool
+  double hit_rate() const;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+};
+
+/// @{
+/// Enable or disable pooling for all threads of the process. Memory allocated
+/// while the pool was disabled can be freed while it is enabled and vice versa.
+void enable();
+void disable();
+bool is_enabled();
+/// @}
+
+/// @{
+/// The maximum number of bytes each thread keeps in its free lists. Memory that
+/// is freed while the free lists are full is returned to the system.
+size_t max_cached_bytes();
+void set_max_cached_bytes(size_t max_cached_bytes);
+/// @}
+
+/// Allocate `bytes` bytes of memory, aligned for any fundamental type.
+void* allocate(size_t bytes);
+
+/// Free memory returned by `memory_pool::allocate()`. The `bytes` must be the
+/// size that was requested from `memory_pool::allocate()`.
+void deallocate(void* ptr, size_t bytes);
+
+/// Return all memory cached on the calling thread to the system.
+void release_cached_memory();
+
+/// The counters of the calling thread
+Statistics statistics();
+
+/// Reset the counters of the calling thread. The peak is reset to the current
+/// `bytes_in_use`.
+void reset_statistics();
+
+/// Deleter for arrays allocated with `memory_pool::make_unique_for_overwrite`
+template <typename T>
+class ArrayDeleter {
+ public:
+  ArrayDeleter() = default;
+  explicit ArrayDeleter(const size_t size) : size_(size) {}
+
+  void operator()(T* const ptr) const {
+    std::destroy_n(ptr, size_);
+    deallocate(ptr, size_ * sizeof(T));
+  }
+
+ private:
+  size_t size_{0};
+};
+
+template <typename T>
+using unique_array = std::unique_ptr<T[], ArrayDeleter<T>>;
+
+/// Allocate a default-initialized array of `size` elements from the pool. Like
+/// `cpp20::make_unique_for_overwrite`, fundamental types are not initialized.
+template <typename T>
+unique_array<T> make_unique_for_overwrite(const size_t size) {
+  static_assert(std::is_trivially_destructible_v<T>,
+                "The memory pool is meant for arrays of numbers.");
+  T* const ptr = static_cast<T*>(allocate(size * sizeof(T)));
+  std::uninitialized_default_construct_n(ptr, size);
+  return unique_array<T>{ptr, ArrayDeleter<T>{size}};
+}
+}  // namespace memory_pool
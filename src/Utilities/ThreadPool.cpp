@@ -0,0 +1,224 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Utilities/ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif  // defined(__linux__)
+
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace thread_pool {
+namespace {
+// Set on the worker threads, and on the calling thread while it works on a
+// loop, so that nested loops run serially instead of waiting for the pool.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local bool working_on_pool = false;
+
+// Threads inherit the CPU affinity of the thread that creates them. Charm++
+// pins each PE to a single core with `+setcpuaffinity` or `+pemap`, so without
+// this all workers would share the core of the PE that created them. Instead,
+// the workers may run on all cores except the ones the calling thread is
+// restricted to, and the OS moves them to idle cores. Nothing changes if the
+// calling thread isn't restricted to a subset of the cores. Failures only
+// leave the workers on the inherited cores, so they are ignored.
+void allow_workers_on_other_cores(
+    [[maybe_unused]] const gsl::not_null<std::vector<std::thread>*> workers) {
+#ifdef __linux__
+  cpu_set_t caller_cpus;
+  CPU_ZERO(&caller_cpus);
+  if (sched_getaffinity(0, sizeof(cpu_set_t), &caller_cpus) != 0) {
+    return;
+  }
+  const auto number_of_cpus = std::min(
+      static_cast<int>(sysconf(_SC_NPROCESSORS_CONF)), CPU_SETSIZE);
+  cpu_set_t other_cpus;
+  CPU_ZERO(&other_cpus);
+  for (int cpu = 0; cpu < number_of_cpus; ++cpu) {
+    if (not CPU_ISSET(cpu, &caller_cpus)) {
+      CPU_SET(cpu, &other_cpus);
+    }
+  }
+  if (CPU_COUNT(&other_cpus) == 0) {
+    return;
+  }
+  for (auto& worker : *workers) {
+    // The kernel drops the cores that the process may not use, e.g. because
+    // of a cpuset of the batch system
+    pthread_setaffinity_np(worker.native_handle(), sizeof(cpu_set_t),
+                           &other_cpus);
+  }
+#endif  // defined(__linux__)
+}
+
+class Pool {
+ public:
+  Pool() = default;
+  Pool(const Pool&) = delete;
+  Pool& operator=(const Pool&) = delete;
+  Pool(Pool&&) = delete;
+  Pool& operator=(Pool&&) = delete;
+  ~Pool() { stop_workers(); }
+
+  size_t number_of_threads() const {
+    return number_of_threads_.load(std::memory_order_relaxed);
+  }
+
+  void set_number_of_threads(size_t number_of_threads);
+
+  // Returns false without doing any work if the pool is busy or has no
+  // workers
+  bool try_run(size_t number_of_items,
+               const std::function<void(size_t, size_t)>& work);
+
+ private:
+  void stop_workers();
+  void worker_loop();
+  // Works on chunks of the current loop until none are left. Must be called
+  // with `lock` holding `mutex_`.
+  void run_chunks(gsl::not_null<std::unique_lock<std::mutex>*> lock);
+
+  // Held by the thread that runs a loop on the pool and while the workers are
+  // replaced
+  std::mutex busy_mutex_{};
+  // Protects all members below
+  std::mutex mutex_{};
+  std::condition_variable work_available_{};
+  std::condition_variable work_done_{};
+  std::vector<std::thread> workers_{};
+  std::atomic<size_t> number_of_threads_{1};
+  const std::function<void(size_t, size_t)>* work_ = nullptr;
+  size_t number_of_items_ = 0;
+  size_t number_of_chunks_ = 0;
+  size_t next_chunk_ = 0;
+  size_t unfinished_chunks_ = 0;
+  size_t generation_ = 0;
+  bool stop_ = false;
+};
+
+void Pool::set_number_of_threads(const size_t number_of_threads) {
+  const std::lock_guard busy_lock(busy_mutex_);
+  stop_workers();
+  {
+    const std::lock_guard lock(mutex_);
+    stop_ = false;
+  }
+  workers_.reserve(number_of_threads - 1);
+  for (size_t i = 0; i < number_of_threads - 1; ++i) {
+    workers_.emplace_back([this]() { worker_loop(); });
+  }
+  allow_workers_on_other_cores(make_not_null(&workers_));
+  number_of_threads_.store(number_of_threads, std::memory_order_relaxed);
+}
+
+bool Pool::try_run(const size_t number_of_items,
+                   const std::function<void(size_t, size_t)>& work) {
+  const std::unique_lock busy_lock(busy_mutex_, std::try_to_lock);
+  if (not busy_lock.owns_lock()) {
+    return false;
+  }
+  std::unique_lock lock(mutex_);
+  const size_t number_of_chunks =
+      std::min(number_of_items, workers_.size() + 1);
+  if (number_of_chunks <= 1) {
+    return false;
+  }
+  work_ = &work;
+  number_of_items_ = number_of_items;
+  number_of_chunks_ = number_of_chunks;
+  next_chunk_ = 0;
+  unfinished_chunks_ = number_of_chunks;
+  ++generation_;
+  work_available_.notify_all();
+
+  working_on_pool = true;
+  run_chunks(make_not_null(&lock));
+  working_on_pool = false;
+  work_done_.wait(lock, [this]() { return unfinished_chunks_ == 0; });
+  work_ = nullptr;
+  return true;
+}
+
+void Pool::stop_workers() {
+  {
+    const std::lock_guard lock(mutex_);
+    stop_ = true;
+  }
+  work_available_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+  workers_.clear();
+  number_of_threads_.store(1, std::memory_order_relaxed);
+}
+
+void Pool::worker_loop() {
+  working_on_pool = true;
+  std::unique_lock lock(mutex_);
+  size_t last_generation = generation_;
+  while (true) {
+    work_available_.wait(lock, [this, &last_generation]() {
+      return stop_ or generation_ != last_generation;
+    });
+    if (stop_) {
+      return;
+    }
+    last_generation = generation_;
+    run_chunks(make_not_null(&lock));
+  }
+}
+
+void Pool::run_chunks(
+    const gsl::not_null<std::unique_lock<std::mutex>*> lock) {
+  while (next_chunk_ < number_of_chunks_) {
+    const size_t chunk = next_chunk_++;
+    const auto& work = *work_;
+    const size_t begin = chunk * number_of_items_ / number_of_chunks_;
+    const size_t end = (chunk + 1) * number_of_items_ / number_of_chunks_;
+    lock->unlock();
+    work(begin, end);
+    lock->lock();
+    if (--unfinished_chunks_ == 0) {
+      work_done_.notify_all();
+    }
+  }
+}
+
+Pool& global_pool() {
+  static Pool pool{};
+  return pool;
+}
+}  // namespace
+
+void set_number_of_threads(const size_t number_of_threads) {
+  ASSERT(number_of_threads > 0, "The thread pool needs at least one thread.");
+  ASSERT(not working_on_pool,
+         "Can't change the number of threads from within a parallel loop.");
+  global_pool().set_number_of_threads(number_of_threads);
+}
+
+size_t number_of_threads() { return global_pool().number_of_threads(); }
+
+void parallel_for(const size_t number_of_items,
+                  const std::function<void(size_t, size_t)>& work) {
+  if (number_of_items == 0) {
+    return;
+  }
+  if (working_on_pool or not global_pool().try_run(number_of_items, work)) {
+    work(0, number_of_items);
+  }
+}
+}  // namespace thread_pool
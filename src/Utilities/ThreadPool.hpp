@@ -0,0 +1,58 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+/*!
+ * \brief A process-wide pool of worker threads for splitting loops over
+ * independent items within a single (Charm++) task.
+ *
+ * \details Some components do a lot of work in a single action while other
+ * cores of the process have nothing to do, e.g. the singleton that evolves the
+ * characteristic system in CCE. `thread_pool::parallel_for` splits a loop over
+ * independent items into contiguous chunks and runs them on the threads of the
+ * pool and on the calling thread.
+ *
+ * The pool has a single thread (the caller) by default, in which case
+ * `thread_pool::parallel_for` just runs the loop. The worker threads are not
+ * Charm++ PEs, so they compete with the PEs of the process for cores. Only use
+ * more threads if the process has idle cores, e.g. by launching fewer PEs than
+ * cores.
+ *
+ * On Linux, the workers may run on all cores except the ones that the thread
+ * that sets the number of threads is pinned to, e.g. by Charm++'s
+ * `+setcpuaffinity` or `+pemap`. Otherwise they would all inherit the single
+ * core of the pinned PE. The OS then places the workers on idle cores, so when
+ * the PEs are pinned, leave cores out of the `+pemap` for the workers. On other
+ * platforms the workers keep the affinity of the calling thread, so the PEs
+ * must not be pinned.
+ *
+ * Only one loop runs on the pool at a time. A `thread_pool::parallel_for` that
+ * is called while the pool is busy (from another PE or from within a loop that
+ * runs on the pool) runs serially on the calling thread.
+ */
+namespace thread_pool {
+/// @{
+/// The number of threads that work on a `thread_pool::parallel_for`, including
+/// the calling thread. Setting the number of threads waits for a running loop
+/// to finish and then replaces the worker threads.
+void set_number_of_threads(size_t number_of_threads);
+size_t number_of_threads();
+/// @}
+
+/*!
+ * \brief Call `work(begin, end)` for contiguous chunks `[begin, end)` that
+ * cover the items `[0, number_of_items)`, in parallel on the threads of the
+ * pool.
+ *
+ * \details The items are split into at most `thread_pool::number_of_threads()`
+ * chunks of (nearly) equal size, and the function returns once all chunks are
+ * done. The `work` must be safe to call concurrently for different chunks and
+ * must not throw.
+ */
+void parallel_for(size_t number_of_items,
+                  const std::function<void(size_t, size_t)>& work);
+}  // namespace thread_pool
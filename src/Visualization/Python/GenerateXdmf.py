@@ -262,6 +262,8 @@ def generate_xdmf(h5files, output, subfile_name, start_time, stop_time, stride,
                     components.remove('domain')
                 if 'functions_of_time' in components:
                     components.remove('functions_of_time')
+                if 'bounding_boxes' in components:
+                    components.remove('bounding_boxes')
 
                 # Write the tensors that are to be visualized.
                 for component in components:
@@ -17,6 +17,7 @@ class Cli(click.MultiCommand):
     def list_commands(self, ctx):
         return [
             "clean-output",
+            "compare-benchmarks",
             "delete-subfiles",
             "extract-dat",
             "extract-input",
@@ -35,6 +36,10 @@ class Cli(click.MultiCommand):
         if name == "clean-output":
             from spectre.tools.CleanOutput import clean_output_command
             return clean_output_command
+        elif name == "compare-benchmarks":
+            from spectre.tools.CompareBenchmarks import (
+                compare_benchmarks_command)
+            return compare_benchmarks_command
         elif name == "delete-subfiles":
             from spectre.IO.H5.DeleteSubfiles import delete_subfiles_command
             return delete_subfiles_command
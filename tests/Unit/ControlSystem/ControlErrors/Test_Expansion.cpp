@@ -4,6 +4,7 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cstddef>
+#include <optional>
 #include <string>
 
 #include "ControlSystem/Tags.hpp"
@@ -82,7 +83,8 @@ void test_expansion_control_error() {
   // global cache
   using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<metavars>;
   MockRuntimeSystem runner{{"DummyFileName", std::move(domain), 4, false,
-                            std::move(grid_center_A), std::move(grid_center_B)},
+                            std::nullopt, std::move(grid_center_A),
+                            std::move(grid_center_B)},
                            {std::move(initial_functions_of_time),
                             std::move(initial_measurement_timescales)}};
   ActionTesting::emplace_array_component<element_component>(
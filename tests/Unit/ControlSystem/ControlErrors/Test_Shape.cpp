@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <random>
 #include <string>
 #include <unordered_map>
@@ -149,7 +150,8 @@ void test_shape_control_error() {
   using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<metavars>;
   // Excision centers aren't used so their values can be anything
   MockRuntimeSystem runner{{"DummyFilename", std::move(fake_domain), 4, false,
-                            std::move(grid_center_A), std::move(grid_center_B)},
+                            std::nullopt, std::move(grid_center_A),
+                            std::move(grid_center_B)},
                            {std::move(initial_functions_of_time),
                             std::move(initial_measurement_timescales)}};
   ActionTesting::emplace_array_component<element_component>(
@@ -94,6 +94,10 @@ void test_all_tags() {
       control_system::Tags::CurrentNumberOfMeasurements;
   TestHelpers::db::test_simple_tag<current_measurement_tag>(
       "CurrentNumberOfMeasurements");
+  TestHelpers::db::test_simple_tag<control_system::Tags::WrittenHistoryTime>(
+      "WrittenHistoryTime");
+  using retention_tag = control_system::Tags::FunctionOfTimeRetention;
+  TestHelpers::db::test_simple_tag<retention_tag>("FunctionOfTimeRetention");
 }
 
 void test_control_sys_inputs() {
@@ -140,6 +144,17 @@ void test_control_sys_inputs() {
       TestHelpers::test_option_tag<control_system::OptionTags::WriteDataToDisk>(
           "true");
   CHECK(write_data);
+
+  using retention_option =
+      control_system::OptionTags::FunctionOfTimeRetention;
+  using retention_tag = control_system::Tags::FunctionOfTimeRetention;
+  CHECK_FALSE(TestHelpers::test_option_tag<retention_option>("None"));
+  const auto retention = TestHelpers::test_option_tag<retention_option>("10.0");
+  CHECK(retention == std::optional<double>{10.0});
+  CHECK(retention_tag::create_from_options(retention) == retention);
+  CHECK_THROWS_WITH(
+      retention_tag::create_from_options(std::optional<double>{-1.0}),
+      Catch::Contains("The FunctionOfTimeRetention must be non-negative"));
   // We don't check the control error because the example one is empty and
   // doesn't have a comparison operator. Once a control error is added that
   // contains member data (and thus, options), then it can be tested
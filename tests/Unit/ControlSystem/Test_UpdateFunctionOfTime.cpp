@@ -135,5 +135,31 @@ SPECTRE_TEST_CASE("Unit.ControlSystem.UpdateFunctionOfTime",
     CHECK(cache_pp.time_bounds()[1] == newer_expiration_time);
     CHECK(cache_quatfot.time_bounds()[1] == newer_expiration_time);
   }
+
+  // Discard the history before the update
+  const double truncation_time = update_time + 0.1;
+  for (auto& name : {pp_name, quatfot_name}) {
+    Parallel::mutate<domain::Tags::FunctionsOfTime,
+                     control_system::TruncateFunctionOfTime>(cache, name,
+                                                             truncation_time);
+  }
+
+  expected_pp.truncate_at_time(truncation_time);
+  expected_quatfot.truncate_at_time(truncation_time);
+  {
+    const auto& cache_pp = dynamic_cast<
+        const domain::FunctionsOfTime::PiecewisePolynomial<deriv_order>&>(
+        *(cache_f_of_t_map.at(pp_name)));
+    const auto& cache_quatfot = dynamic_cast<
+        const domain::FunctionsOfTime::QuaternionFunctionOfTime<deriv_order>&>(
+        *(cache_f_of_t_map.at(quatfot_name)));
+
+    CHECK(cache_pp == expected_pp);
+    CHECK(cache_quatfot == expected_quatfot);
+    CHECK(cache_pp.time_bounds() ==
+          std::array{update_time, newer_expiration_time});
+    CHECK(cache_quatfot.time_bounds() ==
+          std::array{update_time, newer_expiration_time});
+  }
 }
 }  // namespace
@@ -9,10 +9,13 @@
 #include <optional>
 #include <random>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "ControlSystem/Component.hpp"
 #include "ControlSystem/Protocols/ControlSystem.hpp"
 #include "ControlSystem/Tags.hpp"
+#include "ControlSystem/UpdateFunctionOfTime.hpp"
 #include "ControlSystem/WriteData.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -181,6 +184,98 @@ void check_written_data(
   }
 }
 
+// Runs two updates in a row that discard the history of the function of time.
+// The truncation of the first update hasn't been applied to the function of
+// time yet when the second update writes the discarded pieces, like when the
+// cache of this node hasn't processed the first truncation yet.
+void test_write_discarded_history() {
+  constexpr size_t deriv_order = FakeControlSystem::deriv_order;
+  using observer = ::TestHelpers::observers::MockObserverWriter<TestMetavars>;
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution<double> dist{-1.0, 1.0};
+
+  ActionTesting::MockRuntimeSystem<TestMetavars> runner{{}};
+  runner.set_phase(Parallel::Phase::Initialization);
+  ActionTesting::emplace_nodegroup_component_and_initialize<observer>(
+      make_not_null(&runner), {});
+  auto& cache = ActionTesting::cache<observer>(runner, 0);
+  runner.set_phase(Parallel::Phase::Execute);
+
+  const auto random_coefs = [&gen, &dist]() {
+    return make_with_random_values<DataVector>(
+        make_not_null(&gen), dist, DataVector{total_components, 0.0});
+  };
+  const std::string name = FakeControlSystem::name();
+  std::unordered_map<std::string, FoTPtr> functions_of_time{};
+  functions_of_time[name] = std::make_unique<
+      domain::FunctionsOfTime::PiecewisePolynomial<deriv_order>>(
+      0.0,
+      std::array<DataVector, deriv_order + 1>{
+          {random_coefs(), random_coefs(), random_coefs()}},
+      1.0);
+  // The pieces of the function of time start at t = 0, 1, 2 and 3
+  for (size_t i = 1; i < 4; ++i) {
+    const double update_time = static_cast<double>(i);
+    UpdateFunctionOfTime::apply(make_not_null(&functions_of_time), name,
+                                update_time, random_coefs(),
+                                update_time + 1.0);
+  }
+  // The truncated function of time can't be evaluated at the discarded pieces
+  const FoTPtr full_function_of_time = functions_of_time.at(name)->get_clone();
+
+  std::optional<double> written_history_time{};
+  const auto write_history = [&runner, &cache, &functions_of_time, &name,
+                                &written_history_time](
+                                   const double truncation_time) {
+    write_discarded_history_to_disk<FakeControlSystem>(
+        make_not_null(&written_history_time), truncation_time, cache,
+        functions_of_time.at(name));
+    while (ActionTesting::number_of_queued_threaded_actions<observer>(
+               runner, 0) > 0) {
+      ActionTesting::invoke_queued_threaded_action<observer>(
+          make_not_null(&runner), 0);
+    }
+  };
+  // The first update discards the piece at t = 0 and the second update the
+  // piece at t = 1, which follows the piece at t = 0 that is still there
+  write_history(1.5);
+  CHECK(written_history_time == std::optional<double>{0.0});
+  write_history(2.5);
+  CHECK(written_history_time == std::optional<double>{1.0});
+  TruncateFunctionOfTime::apply(make_not_null(&functions_of_time), name, 1.5);
+  TruncateFunctionOfTime::apply(make_not_null(&functions_of_time), name, 2.5);
+  // An update after the truncations have been applied discards the piece at
+  // t = 2
+  write_history(3.5);
+  CHECK(written_history_time == std::optional<double>{2.0});
+
+  const std::vector<std::string> expected_legend{
+      "Time", "FunctionOfTime", "dtFunctionOfTime", "d2tFunctionOfTime"};
+  const auto& read_file = ActionTesting::get_databox_tag<
+      observer, ::TestHelpers::observers::MockReductionFileTag>(runner, 0);
+  for (size_t component_num = 0; component_num < 2; ++component_num) {
+    const auto& dataset = read_file.get_dat(
+        "/ControlSystems/" + name + "/History/" +
+        *FakeControlSystem::component_name(component_num, total_components));
+    CHECK(dataset.get_legend() == expected_legend);
+    const Matrix& data = dataset.get_data();
+    REQUIRE(data.rows() == 3);
+    for (size_t row = 0; row < data.rows(); ++row) {
+      const double piece_time = static_cast<double>(row);
+      CHECK(data(row, 0) == piece_time);
+      // The function and its first derivative are continuous at the start of
+      // the piece, and the second derivative is constant within the piece
+      const auto at_piece_time =
+          full_function_of_time->func_and_2_derivs(piece_time);
+      const auto within_piece =
+          full_function_of_time->func_and_2_derivs(piece_time + 0.5);
+      CHECK(data(row, 1) == approx(at_piece_time[0][component_num]));
+      CHECK(data(row, 2) == approx(at_piece_time[1][component_num]));
+      CHECK(data(row, 3) == approx(within_piece[2][component_num]));
+    }
+  }
+}
+
 SPECTRE_TEST_CASE("Unit.ControlSystem.WriteData", "[Unit][ControlSystem]") {
   domain::FunctionsOfTime::register_derived_with_charm();
   constexpr size_t deriv_order = FakeControlSystem::deriv_order;
@@ -282,6 +377,8 @@ SPECTRE_TEST_CASE("Unit.ControlSystem.WriteData", "[Unit][ControlSystem]") {
                                         normal_q_and_derivs, normal_timescales);
   check_written_data<FakeQuatControlSystem>(runner, times, quat_fot,
                                             quat_q_and_derivs, quat_timescales);
+
+  test_write_discarded_history();
 }
 }  // namespace
 }  // namespace control_system
@@ -0,0 +1,110 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <random>
+
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/IndexType.hpp"
+#include "DataStructures/Tensor/Symmetry.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace {
+constexpr size_t dim = 3;
+using spacetime_lo = SpacetimeIndex<dim, UpLo::Lo, Frame::Inertial>;
+using spacetime_up = SpacetimeIndex<dim, UpLo::Up, Frame::Inertial>;
+using spatial_lo = SpatialIndex<dim, UpLo::Lo, Frame::Inertial>;
+
+// \brief Test that fused evaluation gives the same result as evaluating one
+// LHS component at a time
+//
+// \tparam DataType the type of data being stored in the expression operands
+template <typename Generator, typename DataType>
+void test_evaluate_fused(const gsl::not_null<Generator*> generator,
+                         const DataType& used_for_size) {
+  std::uniform_real_distribution<> distribution(0.1, 1.0);
+
+  const auto lapse = make_with_random_values<Scalar<DataType>>(
+      generator, distribution, used_for_size);
+  const auto pi = make_with_random_values<
+      Tensor<DataType, Symmetry<1, 1>, index_list<spacetime_lo, spacetime_lo>>>(
+      generator, distribution, used_for_size);
+  const auto phi = make_with_random_values<
+      Tensor<DataType, Symmetry<2, 1, 1>,
+             index_list<spatial_lo, spacetime_lo, spacetime_lo>>>(
+      generator, distribution, used_for_size);
+  const auto inverse_spacetime_metric = make_with_random_values<
+      Tensor<DataType, Symmetry<1, 1>, index_list<spacetime_up, spacetime_up>>>(
+      generator, distribution, used_for_size);
+
+  // A contraction with a symmetric LHS, into an LHS tensor that isn't sized
+  // \f$L_{ab} = \alpha \Pi_{ac} \Pi_{bd} g^{cd}\f$
+  tnsr::aa<DataType, dim, Frame::Inertial> expected_pi_squared{};
+  tenex::evaluate<ti::a, ti::b>(
+      make_not_null(&expected_pi_squared),
+      lapse() * pi(ti::a, ti::c) * pi(ti::b, ti::d) *
+          inverse_spacetime_metric(ti::C, ti::D));
+  tnsr::aa<DataType, dim, Frame::Inertial> pi_squared{};
+  tenex::evaluate_fused<ti::a, ti::b>(
+      make_not_null(&pi_squared), lapse() * pi(ti::a, ti::c) *
+                                      pi(ti::b, ti::d) *
+                                      inverse_spacetime_metric(ti::C, ti::D));
+  CHECK_ITERABLE_APPROX(pi_squared, expected_pi_squared);
+
+  // A reordered LHS and a RHS that uses a generic spatial index for a
+  // spacetime index
+  // \f$L_{bia} = \Phi_{iab} - \Pi_{ia} \Pi_{bt}\f$
+  Tensor<DataType, Symmetry<3, 2, 1>,
+         index_list<spacetime_lo, spatial_lo, spacetime_lo>>
+      expected_reordered{};
+  tenex::evaluate<ti::b, ti::i, ti::a>(
+      make_not_null(&expected_reordered),
+      phi(ti::i, ti::a, ti::b) - pi(ti::i, ti::a) * pi(ti::b, ti::t));
+  Tensor<DataType, Symmetry<3, 2, 1>,
+         index_list<spacetime_lo, spatial_lo, spacetime_lo>>
+      reordered{};
+  tenex::evaluate_fused<ti::b, ti::i, ti::a>(
+      make_not_null(&reordered),
+      phi(ti::i, ti::a, ti::b) - pi(ti::i, ti::a) * pi(ti::b, ti::t));
+  CHECK_ITERABLE_APPROX(reordered, expected_reordered);
+
+  // Only some LHS components are computed when the LHS uses a concrete time
+  // index or a generic spatial index for a spacetime index, so the other
+  // components must not change
+  // \f$L_{ti} = \Pi_{ij} g^{jk} \Pi_{kt}\f$
+  auto expected_partial = make_with_random_values<
+      Tensor<DataType, Symmetry<2, 1>, index_list<spacetime_lo, spacetime_lo>>>(
+      generator, distribution, used_for_size);
+  auto partial = expected_partial;
+  tenex::evaluate<ti::t, ti::i>(
+      make_not_null(&expected_partial),
+      pi(ti::i, ti::j) * inverse_spacetime_metric(ti::J, ti::K) *
+          pi(ti::k, ti::t));
+  tenex::evaluate_fused<ti::t, ti::i>(
+      make_not_null(&partial), pi(ti::i, ti::j) *
+                                   inverse_spacetime_metric(ti::J, ti::K) *
+                                   pi(ti::k, ti::t));
+  CHECK_ITERABLE_APPROX(partial, expected_partial);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.EvaluateFused",
+                  "[DataStructures][Unit]") {
+  MAKE_GENERATOR(generator);
+  const double nan = std::numeric_limits<double>::signaling_NaN();
+  // Fewer points than in a block, and several blocks with a remainder
+  for (const size_t number_of_points : {5_st, 131_st}) {
+    test_evaluate_fused(make_not_null(&generator),
+                        DataVector(number_of_points, nan));
+    test_evaluate_fused(make_not_null(&generator),
+                        ComplexDataVector(number_of_points, nan));
+  }
+}
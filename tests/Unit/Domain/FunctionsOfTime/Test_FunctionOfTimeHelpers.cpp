@@ -93,6 +93,47 @@ SPECTRE_TEST_CASE("Unit.Domain.FunctionsOfTime.FunctionOfTimeHelpers",
           gsl::at(all_stored_info, all_stored_info.size() - 1));
   }
 
+  INFO("Truncate StoredInfos") {
+    constexpr size_t mdp1 = 1;
+    std::vector<FunctionOfTimeHelpers::StoredInfo<mdp1>> all_stored_info{};
+    for (int t = 0; t < 10; t++) {
+      all_stored_info.emplace_back(
+          static_cast<double>(t),
+          std::array<DataVector, mdp1>{DataVector{1, static_cast<double>(t)}});
+    }
+
+    // Nothing is needed only before the first piece
+    CHECK(FunctionOfTimeHelpers::truncate_stored_infos_at_time(
+              make_not_null(&all_stored_info), 0.5) == 0);
+    CHECK(all_stored_info.size() == 10);
+
+    CHECK(FunctionOfTimeHelpers::truncate_stored_infos_at_time(
+              make_not_null(&all_stored_info), 3.5) == 3);
+    REQUIRE(all_stored_info.size() == 7);
+    CHECK(all_stored_info.front().time == 3.0);
+    CHECK(FunctionOfTimeHelpers::stored_info_from_upper_bound(
+              3.5, all_stored_info) == all_stored_info.front());
+
+    // The functions are left-continuous, so the piece starting at 4 is not
+    // enough to evaluate them at 5
+    CHECK(FunctionOfTimeHelpers::truncate_stored_infos_at_time(
+              make_not_null(&all_stored_info), 5.0) == 1);
+    CHECK(all_stored_info.front().time == 4.0);
+
+    // Truncating at an earlier time does nothing
+    CHECK(FunctionOfTimeHelpers::truncate_stored_infos_at_time(
+              make_not_null(&all_stored_info), 2.0) == 0);
+    CHECK(all_stored_info.front().time == 4.0);
+
+    // The last piece is always kept
+    CHECK(FunctionOfTimeHelpers::truncate_stored_infos_at_time(
+              make_not_null(&all_stored_info), 100.0) == 5);
+    REQUIRE(all_stored_info.size() == 1);
+    CHECK(all_stored_info.front().time == 9.0);
+    CHECK(gsl::at(all_stored_info.front().stored_quantities, 0) ==
+          DataVector{1, 9.0});
+  }
+
   CHECK_THROWS_WITH(
       []() {
         double expr_time = 4.0;
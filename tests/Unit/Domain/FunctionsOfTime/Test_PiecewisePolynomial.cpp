@@ -311,6 +311,38 @@ SPECTRE_TEST_CASE("Unit.Domain.FunctionsOfTime.PiecewisePolynomial",
     f_of_t.update(2.0, {3.0, 4.0}, 2.1);
     CHECK(f_of_t.func(2.0)[0] == DataVector{1.0, 2.0});
   }
+  {
+    INFO("Test truncation.");
+    constexpr size_t deriv_order = 3;
+    const std::array<DataVector, deriv_order + 1> init_func{
+        {{0.0, 0.0}, {0.0, 0.0}, {0.0, 2.0}, {6.0, 0.0}}};
+    FunctionsOfTime::PiecewisePolynomial<deriv_order> f_of_t(0.0, init_func,
+                                                             0.5);
+    for (size_t i = 1; i < 5; ++i) {
+      const double update_time = 0.5 * static_cast<double>(i);
+      f_of_t.update(update_time, {6.0, 0.0}, update_time + 0.5);
+    }
+    const auto expected = f_of_t.func_and_2_derivs(1.2);
+    const auto expected_at_piece = f_of_t.func_and_2_derivs(1.5);
+
+    std::unique_ptr<FunctionsOfTime::FunctionOfTime> base_f_of_t =
+        f_of_t.get_clone();
+    base_f_of_t->truncate_at_time(1.2);
+    CHECK(base_f_of_t->time_bounds() == std::array{1.0, 2.5});
+    CHECK(base_f_of_t->func_and_2_derivs(1.2) == expected);
+    CHECK(base_f_of_t->func_and_2_derivs(1.5) == expected_at_piece);
+
+    // The functions are left-continuous, so the piece starting at 1 is still
+    // needed to evaluate at 1.5
+    f_of_t.truncate_at_time(1.5);
+    CHECK(f_of_t.get_deriv_info().size() == 3);
+    CHECK(f_of_t.time_bounds() == std::array{1.0, 2.5});
+    CHECK(f_of_t.func_and_2_derivs(1.5) == expected_at_piece);
+    f_of_t.truncate_at_time(10.0);
+    CHECK(f_of_t.get_deriv_info().size() == 1);
+    CHECK(f_of_t.time_bounds() == std::array{2.0, 2.5});
+    CHECK(serialize_and_deserialize(f_of_t) == f_of_t);
+  }
 
   CHECK_THROWS_WITH(
       ([]() {
@@ -3,7 +3,9 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <array>
 #include <cmath>
+#include <cstddef>
 
 #include "DataStructures/DataVector.hpp"
 #include "Domain/FunctionsOfTime/PiecewisePolynomial.hpp"
@@ -26,6 +28,34 @@ SPECTRE_TEST_CASE("Unit.Domain.FunctionsOfTime.QuaternionFunctionOfTime",
     CHECK(qfot.time_bounds() == std::array<double, 2>({0.0, 0.6}));
   }
 
+  {
+    INFO("QuaternionFunctionOfTime: Truncation");
+    domain::FunctionsOfTime::QuaternionFunctionOfTime<2> qfot{
+        0.0, std::array<DataVector, 1>{DataVector{{1.0, 0.0, 0.0, 0.0}}},
+        std::array<DataVector, 3>{DataVector{3, 0.0},
+                                  DataVector{{0.0, 0.0, 1.0}},
+                                  DataVector{3, 0.0}},
+        0.5};
+    for (size_t i = 1; i < 4; ++i) {
+      const double update_time = 0.5 * static_cast<double>(i);
+      qfot.update(update_time, DataVector{{0.0, 0.0, 0.1}},
+                  update_time + 0.5);
+    }
+    const auto expected_quaternion = qfot.func_and_2_derivs(1.2);
+    const auto expected_angle = qfot.angle_func_and_2_derivs(1.2);
+
+    qfot.truncate_at_time(1.2);
+    CHECK(qfot.time_bounds() == std::array<double, 2>({1.0, 2.0}));
+    CHECK(qfot.get_angle_deriv_info().size() == 2);
+    CHECK(qfot.func_and_2_derivs(1.2) == expected_quaternion);
+    CHECK(qfot.angle_func_and_2_derivs(1.2) == expected_angle);
+
+    qfot.truncate_at_time(10.0);
+    CHECK(qfot.time_bounds() == std::array<double, 2>({1.5, 2.0}));
+    CHECK(qfot.get_angle_deriv_info().size() == 1);
+    CHECK(serialize_and_deserialize(qfot) == qfot);
+  }
+
   {
     INFO("QuaternionFunctionOfTime: Check output");
     domain::FunctionsOfTime::QuaternionFunctionOfTime<2> qfot{
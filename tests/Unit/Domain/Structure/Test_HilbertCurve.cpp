@@ -0,0 +1,79 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/Index.hpp"
+#include "DataStructures/IndexIterator.hpp"
+#include "Domain/Structure/HilbertCurve.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// Check that the Hilbert curve visits every point of the grid exactly once and
+// that consecutive points along the curve are adjacent along a single axis
+template <size_t Dim>
+void test_curve_is_connected(const size_t bits_per_dimension) {
+  CAPTURE(Dim);
+  CAPTURE(bits_per_dimension);
+  const Index<Dim> extents(two_to_the(bits_per_dimension));
+  std::vector<size_t> times_visited(extents.product(), 0);
+  std::vector<std::array<size_t, Dim>> points_along_curve(extents.product());
+  for (IndexIterator<Dim> index(extents); index; ++index) {
+    std::array<size_t, Dim> coords{};
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(coords, d) = index()[d];
+    }
+    const size_t curve_index =
+        domain::hilbert_curve_index(coords, bits_per_dimension);
+    REQUIRE(curve_index < extents.product());
+    ++times_visited[curve_index];
+    points_along_curve[curve_index] = coords;
+  }
+  CHECK(times_visited == std::vector<size_t>(extents.product(), 1));
+  for (size_t i = 1; i < points_along_curve.size(); ++i) {
+    size_t distance = 0;
+    for (size_t d = 0; d < Dim; ++d) {
+      const size_t previous = gsl::at(points_along_curve[i - 1], d);
+      const size_t current = gsl::at(points_along_curve[i], d);
+      distance += previous > current ? previous - current : current - previous;
+    }
+    CHECK(distance == 1);
+  }
+}
+
+void test_2d_curve() {
+  // The 4x4 curve sketched in the documentation of `hilbert_curve_index`,
+  // with rows of constant y
+  const std::array<std::array<size_t, 4>, 4> expected_indices{
+      {{{0, 1, 14, 15}}, {{3, 2, 13, 12}}, {{4, 7, 8, 11}}, {{5, 6, 9, 10}}}};
+  for (size_t y = 0; y < 4; ++y) {
+    for (size_t x = 0; x < 4; ++x) {
+      CHECK(domain::hilbert_curve_index(std::array<size_t, 2>{{x, y}}, 2) ==
+            gsl::at(gsl::at(expected_indices, y), x));
+    }
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.HilbertCurve", "[Domain][Unit]") {
+  // In 1D the curve is the identity
+  CHECK(domain::hilbert_curve_index(std::array<size_t, 1>{{12345}}, 63) ==
+        12345);
+  test_2d_curve();
+  test_curve_is_connected<1>(4);
+  for (size_t bits = 1; bits < 6; ++bits) {
+    test_curve_is_connected<2>(bits);
+  }
+  for (size_t bits = 1; bits < 4; ++bits) {
+    test_curve_is_connected<3>(bits);
+  }
+  // The 3D index fits in 63 bits when the coordinates have 21 bits
+  CHECK(domain::hilbert_curve_index(
+            std::array<size_t, 3>{{123456, 654321, 2097151}}, 21) ==
+        2119265701226572654);
+}
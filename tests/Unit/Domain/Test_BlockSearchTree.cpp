@@ -0,0 +1,249 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/BlockLogicalCoordinates.hpp"
+#include "Domain/BlockSearchTree.hpp"
+#include "Domain/CoordinateMaps/Distribution.hpp"
+#include "Domain/Creators/Sphere.hpp"
+#include "Domain/Creators/TimeDependence/UniformTranslation.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/DomainHelpers.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/EqualWithinRoundoff.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace {
+using FunctionsOfTimeMap = std::unordered_map<
+    std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>;
+
+// Random points in a spherical shell that extends beyond the domain, so some
+// points lie outside all blocks
+tnsr::I<DataVector, 3, Frame::Inertial> random_points_in_shell(
+    const size_t num_points, const double inner_radius,
+    const double outer_radius) {
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution<double> radius_dist(inner_radius,
+                                                     outer_radius);
+  std::uniform_real_distribution<double> cos_theta_dist(-1.0, 1.0);
+  std::uniform_real_distribution<double> phi_dist(0.0, 2.0 * M_PI);
+  tnsr::I<DataVector, 3, Frame::Inertial> x(num_points);
+  for (size_t s = 0; s < num_points; ++s) {
+    const double r = radius_dist(gen);
+    const double cos_theta = cos_theta_dist(gen);
+    const double sin_theta = sqrt(1.0 - square(cos_theta));
+    const double phi = phi_dist(gen);
+    get<0>(x)[s] = r * sin_theta * cos(phi);
+    get<1>(x)[s] = r * sin_theta * sin(phi);
+    get<2>(x)[s] = r * cos_theta;
+  }
+  return x;
+}
+
+// A coherent set of points on a sphere, as for a `Strahlkorper`. The sphere
+// crosses the boundaries between the wedges.
+tnsr::I<DataVector, 3, Frame::Inertial> points_on_sphere(
+    const size_t num_theta, const size_t num_phi, const double radius) {
+  tnsr::I<DataVector, 3, Frame::Inertial> x(num_theta * num_phi);
+  for (size_t i = 0; i < num_theta; ++i) {
+    const double theta =
+        M_PI * static_cast<double>(i) / static_cast<double>(num_theta - 1);
+    for (size_t j = 0; j < num_phi; ++j) {
+      const double phi =
+          2.0 * M_PI * static_cast<double>(j) / static_cast<double>(num_phi);
+      get<0>(x)[i * num_phi + j] = radius * sin(theta) * cos(phi);
+      get<1>(x)[i * num_phi + j] = radius * sin(theta) * sin(phi);
+      get<2>(x)[i * num_phi + j] = radius * cos(theta);
+    }
+  }
+  return x;
+}
+
+// Locate the point by inverting the maps of all blocks in order of their ID,
+// which doesn't use the search tree
+std::optional<std::pair<size_t, tnsr::I<double, 3, Frame::BlockLogical>>>
+locate_by_checking_all_blocks(const Domain<3>& domain,
+                              const tnsr::I<double, 3, Frame::Inertial>& x,
+                              const double time,
+                              const FunctionsOfTimeMap& functions_of_time) {
+  for (const auto& block : domain.blocks()) {
+    std::optional<tnsr::I<double, 3, Frame::BlockLogical>> x_logical{};
+    if (block.is_time_dependent()) {
+      const auto x_grid = block.moving_mesh_grid_to_inertial_map().inverse(
+          x, time, functions_of_time);
+      if (x_grid.has_value()) {
+        x_logical = block.moving_mesh_logical_to_grid_map().inverse(*x_grid);
+      }
+    } else {
+      x_logical = block.stationary_map().inverse(x);
+    }
+    if (not x_logical.has_value()) {
+      continue;
+    }
+    bool is_in_block = true;
+    for (size_t d = 0; d < 3; ++d) {
+      is_in_block = is_in_block and
+                    (abs(x_logical->get(d)) <= 1.0 or
+                     equal_within_roundoff(abs(x_logical->get(d)), 1.0));
+    }
+    if (is_in_block) {
+      return std::make_pair(block.id(), *x_logical);
+    }
+  }
+  return std::nullopt;
+}
+
+// Locate the points with the `search_tree` and compare to checking all blocks.
+// If the tree was constructed at `time` the block containing each point must
+// also be one of its candidates.
+void check_against_all_blocks(
+    const Domain<3>& domain, const tnsr::I<DataVector, 3, Frame::Inertial>& x,
+    const domain::BlockSearchTree<3, Frame::Inertial>& search_tree,
+    const bool tree_is_at_time = true,
+    const double time = std::numeric_limits<double>::signaling_NaN(),
+    const FunctionsOfTimeMap& functions_of_time = {}) {
+  const auto batched_result = block_logical_coordinates(
+      domain, x, search_tree, time, functions_of_time);
+  CHECK(batched_result ==
+        block_logical_coordinates(domain, x, time, functions_of_time));
+  std::vector<size_t> candidates{};
+  for (size_t s = 0; s < get<0>(x).size(); ++s) {
+    CAPTURE(s);
+    tnsr::I<double, 3, Frame::Inertial> x_point{};
+    for (size_t d = 0; d < 3; ++d) {
+      x_point.get(d) = x.get(d)[s];
+    }
+    const auto expected = locate_by_checking_all_blocks(domain, x_point, time,
+                                                        functions_of_time);
+    REQUIRE(batched_result[s].has_value() == expected.has_value());
+    if (expected.has_value()) {
+      CHECK(batched_result[s]->id.get_index() == expected->first);
+      CHECK_ITERABLE_APPROX(batched_result[s]->data, expected->second);
+      if (tree_is_at_time) {
+        search_tree.candidate_blocks(make_not_null(&candidates), x_point);
+        CHECK(std::find(candidates.begin(), candidates.end(),
+                        expected->first) != candidates.end());
+        CHECK(std::is_sorted(candidates.begin(), candidates.end()));
+      }
+    }
+  }
+}
+
+void test_rectilinear() {
+  const Domain<3> domain(
+      maps_for_rectilinear_domains<Frame::Inertial>(
+          Index<3>{2, 2, 2},
+          std::array<std::vector<double>, 3>{
+              {{0.0, 0.5, 1.0}, {0.0, 0.5, 1.0}, {0.0, 0.5, 1.0}}},
+          {Index<3>{}}),
+      corners_for_rectilinear_domains(Index<3>{2, 2, 2}));
+  const domain::BlockSearchTree<3, Frame::Inertial> search_tree(domain);
+  CHECK(search_tree.number_of_blocks() == 8);
+  std::vector<size_t> candidates{};
+  // Far away from the domain
+  search_tree.candidate_blocks(make_not_null(&candidates),
+                               tnsr::I<double, 3, Frame::Inertial>(10.0));
+  CHECK(candidates.empty());
+  // Well inside the first block, so no other box contains the point
+  search_tree.candidate_blocks(make_not_null(&candidates),
+                               tnsr::I<double, 3, Frame::Inertial>(0.1));
+  CHECK(candidates == std::vector<size_t>{0});
+  CHECK(search_tree.bounding_box_contains(
+      0, tnsr::I<double, 3, Frame::Inertial>(0.1)));
+  CHECK_FALSE(search_tree.bounding_box_contains(
+      7, tnsr::I<double, 3, Frame::Inertial>(0.1)));
+  // The shared corner of all blocks
+  search_tree.candidate_blocks(make_not_null(&candidates),
+                               tnsr::I<double, 3, Frame::Inertial>(0.5));
+  CHECK(candidates == std::vector<size_t>{0, 1, 2, 3, 4, 5, 6, 7});
+}
+
+void test_shell() {
+  const auto shell = domain::creators::Sphere(
+      1.5, 2.5, domain::creators::Sphere::Excision{}, 1_st, 3_st, true, {},
+      {2.0});
+  const auto domain = shell.create_domain();
+  const domain::BlockSearchTree<3, Frame::Inertial> search_tree(domain);
+  check_against_all_blocks(domain, random_points_in_shell(200, 1.0, 3.0),
+                           search_tree);
+  check_against_all_blocks(domain, points_on_sphere(9, 16, 1.8), search_tree);
+  // Points on the boundary between the radial shells
+  check_against_all_blocks(domain, points_on_sphere(9, 16, 2.0), search_tree);
+
+  // The domain constructs its search tree once
+  const auto& cached_search_tree =
+      domain.block_search_tree<Frame::Inertial>();
+  CHECK(cached_search_tree.number_of_blocks() == domain.blocks().size());
+  CHECK(&domain.block_search_tree<Frame::Inertial>() == &cached_search_tree);
+  check_against_all_blocks(domain, points_on_sphere(9, 16, 1.8),
+                           cached_search_tree);
+  // The search tree isn't serialized, so the deserialized domain constructs
+  // its own
+  const auto deserialized_domain = serialize_and_deserialize(domain);
+  CHECK(&deserialized_domain.block_search_tree<Frame::Inertial>() !=
+        &cached_search_tree);
+  check_against_all_blocks(
+      deserialized_domain, points_on_sphere(9, 16, 1.8),
+      deserialized_domain.block_search_tree<Frame::Inertial>());
+}
+
+void test_moving_shell() {
+  const std::array<double, 3> velocity{{0.5, -0.3, 0.2}};
+  const domain::creators::time_dependence::UniformTranslation<3>
+      uniform_translation(0.0, velocity);
+  const auto shell = domain::creators::Sphere(
+      1.5, 2.5, domain::creators::Sphere::Excision{}, 1_st, 3_st, true, {},
+      {2.0}, domain::CoordinateMaps::Distribution::Linear, ShellWedges::All,
+      uniform_translation.get_clone());
+  const auto domain = shell.create_domain();
+  REQUIRE(domain.is_time_dependent());
+  const auto functions_of_time = uniform_translation.functions_of_time();
+  const double time = 1.0;
+  auto x = random_points_in_shell(200, 1.0, 3.0);
+  auto x_on_sphere = points_on_sphere(9, 16, 2.0);
+  for (size_t d = 0; d < 3; ++d) {
+    x.get(d) += gsl::at(velocity, d) * time;
+    x_on_sphere.get(d) += gsl::at(velocity, d) * time;
+  }
+  const domain::BlockSearchTree<3, Frame::Inertial> search_tree(
+      domain, time, functions_of_time);
+  check_against_all_blocks(domain, x, search_tree, true, time,
+                           functions_of_time);
+  check_against_all_blocks(domain, x_on_sphere, search_tree, true, time,
+                           functions_of_time);
+  // A tree constructed at an earlier time has moved bounding boxes, so the
+  // blocks that aren't candidates must be checked as well
+  const domain::BlockSearchTree<3, Frame::Inertial> outdated_search_tree(
+      domain, 0.0, functions_of_time);
+  check_against_all_blocks(domain, x, outdated_search_tree, false, time,
+                           functions_of_time);
+  check_against_all_blocks(domain, x_on_sphere, outdated_search_tree, false,
+                           time, functions_of_time);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.BlockSearchTree", "[Domain][Unit]") {
+  test_rectilinear();
+  test_shell();
+  test_moving_shell();
+}
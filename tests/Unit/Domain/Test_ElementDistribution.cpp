@@ -20,9 +20,13 @@
 #include "Domain/ElementDistribution.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/InitialElementIds.hpp"
+#include "Domain/Structure/SegmentId.hpp"
 #include "Domain/Structure/ZCurve.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/GetOutput.hpp"
 #include "Utilities/Gsl.hpp"
 
 namespace {
@@ -498,6 +502,138 @@ void test_proc_retrieval(
     }
   }
 }
+
+// Test `domain::HilbertCurveNodeProcDistribution` and
+// `domain::element_distribution_statistics` for two blocks with four elements
+// each on a line, where the curve is ordered by position
+void test_hilbert_curve_distribution_1d() {
+  const auto domain_creator = domain::creators::AlignedLattice<1>(
+      {{{{0.0, 1.0, 2.0}}}}, {{2}}, {{3}}, {}, {}, {});
+  const auto domain = domain_creator.create_domain();
+  const auto& blocks = domain.blocks();
+  const auto initial_refinement_levels =
+      domain_creator.initial_refinement_levels();
+  const auto costs = domain::get_element_costs(
+      blocks, initial_refinement_levels, domain_creator.initial_extents(),
+      domain::ElementWeight::Uniform, std::nullopt);
+  std::vector<ElementId<1>> expected_order{};
+  for (size_t block_id = 0; block_id < 2; ++block_id) {
+    for (size_t index = 0; index < 4; ++index) {
+      expected_order.emplace_back(
+          block_id, std::array<SegmentId, 1>{{SegmentId(2, index)}});
+    }
+  }
+  const std::vector<size_t> procs_per_node{2, 2};
+
+  {
+    INFO("All procs");
+    const domain::HilbertCurveNodeProcDistribution<1> distribution(
+        costs, procs_per_node, blocks, initial_refinement_levels);
+    CHECK(distribution.ordered_element_ids() == expected_order);
+    const std::vector<size_t> expected_procs{0, 0, 1, 1, 2, 2, 3, 3};
+    for (size_t i = 0; i < expected_order.size(); ++i) {
+      CHECK(distribution.get_proc_for_element(expected_order[i]) ==
+            expected_procs[i]);
+    }
+    const auto statistics = domain::element_distribution_statistics<1>(
+        blocks, initial_refinement_levels, costs, procs_per_node,
+        [&distribution](const ElementId<1>& element_id) {
+          return distribution.get_proc_for_element(element_id);
+        });
+    CHECK(statistics.number_of_elements == 8);
+    CHECK(statistics.number_of_procs_with_elements == 4);
+    CHECK(statistics.number_of_nodes_with_elements == 2);
+    CHECK(statistics.number_of_internal_faces == 7);
+    CHECK(statistics.number_of_cross_proc_faces == 3);
+    CHECK(statistics.number_of_cross_node_faces == 1);
+    CHECK(statistics.max_surface_to_volume == approx(1.0));
+    CHECK(statistics.average_surface_to_volume == approx(0.75));
+    CHECK(statistics.load_imbalance == approx(1.0));
+  }
+  {
+    INFO("Ignored proc");
+    // The first node has only one usable proc, so it gets about a third of
+    // the elements
+    const domain::HilbertCurveNodeProcDistribution<1> distribution(
+        costs, procs_per_node, blocks, initial_refinement_levels, {1});
+    const std::vector<size_t> expected_procs{0, 0, 0, 2, 2, 3, 3, 3};
+    for (size_t i = 0; i < expected_order.size(); ++i) {
+      CHECK(distribution.get_proc_for_element(expected_order[i]) ==
+            expected_procs[i]);
+    }
+    const auto statistics = domain::element_distribution_statistics<1>(
+        blocks, initial_refinement_levels, costs, procs_per_node,
+        [&distribution](const ElementId<1>& element_id) {
+          return distribution.get_proc_for_element(element_id);
+        });
+    CHECK(statistics.number_of_procs_with_elements == 3);
+    CHECK(statistics.number_of_cross_proc_faces == 2);
+    CHECK(statistics.number_of_cross_node_faces == 1);
+    CHECK(statistics.max_surface_to_volume == approx(1.0));
+    CHECK(statistics.load_imbalance == approx(9.0 / 8.0));
+  }
+}
+
+// Test the hierarchical split of a 4x4x4 lattice of elements in 8 blocks
+// between two nodes with three procs each, one of which is ignored
+void test_hilbert_curve_distribution_3d() {
+  const auto domain_creator = domain::creators::AlignedLattice<3>(
+      {{{{0.0, 1.0, 2.0}}, {{0.0, 1.0, 2.0}}, {{0.0, 1.0, 2.0}}}}, {{1, 1, 1}},
+      {{3, 3, 3}}, {}, {}, {});
+  const auto domain = domain_creator.create_domain();
+  const auto& blocks = domain.blocks();
+  const auto initial_refinement_levels =
+      domain_creator.initial_refinement_levels();
+  const auto costs = domain::get_element_costs(
+      blocks, initial_refinement_levels, domain_creator.initial_extents(),
+      domain::ElementWeight::Uniform, std::nullopt);
+  const std::vector<size_t> procs_per_node{3, 3};
+  const domain::HilbertCurveNodeProcDistribution<3> distribution(
+      costs, procs_per_node, blocks, initial_refinement_levels, {4});
+
+  const auto& ordered_element_ids = distribution.ordered_element_ids();
+  REQUIRE(ordered_element_ids.size() == 64);
+  std::vector<size_t> elements_per_proc(6, 0);
+  size_t previous_proc = 0;
+  for (const auto& element_id : ordered_element_ids) {
+    const size_t proc = distribution.get_proc_for_element(element_id);
+    REQUIRE(proc < 6);
+    // Procs are contiguous along the curve
+    CHECK(proc >= previous_proc);
+    previous_proc = proc;
+    ++elements_per_proc[proc];
+  }
+  // The first node has three of the five usable procs, so it gets 38 of the
+  // 64 elements
+  CHECK(elements_per_proc == std::vector<size_t>{13, 12, 13, 13, 0, 13});
+
+  const auto statistics = domain::element_distribution_statistics<3>(
+      blocks, initial_refinement_levels, costs, procs_per_node,
+      [&distribution](const ElementId<3>& element_id) {
+        return distribution.get_proc_for_element(element_id);
+      });
+  CHECK(statistics.number_of_elements == 64);
+  CHECK(statistics.number_of_procs_with_elements == 5);
+  CHECK(statistics.number_of_nodes_with_elements == 2);
+  CHECK(statistics.number_of_internal_faces == 144);
+  CHECK(statistics.number_of_cross_node_faces > 0);
+  CHECK(statistics.number_of_cross_node_faces <
+        statistics.number_of_cross_proc_faces);
+  CHECK(statistics.number_of_cross_proc_faces <
+        statistics.number_of_internal_faces);
+  CHECK(statistics.load_imbalance == approx(13.0 * 5.0 / 64.0));
+}
+
+void test_strategy_options() {
+  CHECK(TestHelpers::test_creation<domain::ElementDistributionStrategy>(
+            "ZCurve") == domain::ElementDistributionStrategy::ZCurve);
+  CHECK(TestHelpers::test_creation<domain::ElementDistributionStrategy>(
+            "HilbertCurve") ==
+        domain::ElementDistributionStrategy::HilbertCurve);
+  CHECK(get_output(domain::ElementDistributionStrategy::ZCurve) == "ZCurve");
+  CHECK(get_output(domain::ElementDistributionStrategy::HilbertCurve) ==
+        "HilbertCurve");
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.ElementDistribution", "[Domain][Unit]") {
@@ -543,4 +679,8 @@ SPECTRE_TEST_CASE("Unit.Domain.ElementDistribution", "[Domain][Unit]") {
   // `Element`s in the domain
   test_proc_retrieval(domain::ElementWeight::NumGridPointsAndGridSpacing,
                       lattice_2d, 100, std::unordered_set<size_t>{17});
+
+  test_hilbert_curve_distribution_1d();
+  test_hilbert_curve_distribution_3d();
+  test_strategy_options();
 }
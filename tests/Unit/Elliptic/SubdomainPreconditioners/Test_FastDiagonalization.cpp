@@ -0,0 +1,391 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <boost/functional/hash.hpp>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Block.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.tpp"
+#include "Domain/CoordinateMaps/Identity.hpp"
+#include "Domain/CreateInitialElement.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/Element.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Tags.hpp"
+#include "Elliptic/DiscontinuousGalerkin/SubdomainOperator/Tags.hpp"
+#include "Elliptic/DiscontinuousGalerkin/Tags.hpp"
+#include "Elliptic/SubdomainPreconditioners/FastDiagonalization.hpp"
+#include "Elliptic/Systems/Poisson/BoundaryConditions/Robin.hpp"
+#include "Elliptic/Systems/Poisson/FirstOrderSystem.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "NumericalAlgorithms/Convergence/HasConverged.hpp"
+#include "NumericalAlgorithms/LinearSolver/LinearSolver.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Parallel/RegisterDerivedClassesWithCharm.hpp"
+#include "ParallelAlgorithms/LinearSolver/Schwarz/ElementCenteredSubdomainData.hpp"
+#include "ParallelAlgorithms/LinearSolver/Schwarz/OverlapHelpers.hpp"
+#include "ParallelAlgorithms/LinearSolver/Schwarz/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeWithValue.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace elliptic::subdomain_preconditioners {
+namespace {
+struct ScalarFieldTag : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+struct AnotherScalarFieldTag : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+struct OptionsGroup {};
+
+// The solver only uses the linear operator to find the options group
+struct SubdomainOperator {
+  using options_group = OptionsGroup;
+};
+
+Mesh<1> make_mesh(const size_t num_points) {
+  return {num_points, Spectral::Basis::Legendre,
+          Spectral::Quadrature::GaussLobatto};
+}
+
+DataVector solve_dense(const Matrix& matrix, const DataVector& source) {
+  Matrix inverse = matrix;
+  blaze::invert(inverse);
+  DataVector solution{source.size(), 0.};
+  for (size_t i = 0; i < source.size(); ++i) {
+    for (size_t j = 0; j < source.size(); ++j) {
+      solution[i] += inverse(i, j) * source[j];
+    }
+  }
+  return solution;
+}
+
+void test_flat_laplacian_1d() {
+  Approx custom_approx = Approx::custom().epsilon(1.e-10).scale(1.);
+  {
+    INFO("Single element");
+    // Solve -u'' = f on [-1, 1] with u = cos(pi x / 2)
+    const auto mesh = make_mesh(16);
+    Matrix stiffness{};
+    DataVector mass{};
+    detail::flat_laplacian_1d(make_not_null(&stiffness), make_not_null(&mass),
+                              {mesh}, {1.}, true, true, 1.5);
+    CHECK_MATRIX_APPROX(stiffness, Matrix{blaze::trans(stiffness)});
+    const auto& x = Spectral::collocation_points(mesh);
+    const DataVector expected_solution = cos(M_PI_2 * x);
+    const DataVector source = mass * square(M_PI_2) * expected_solution;
+    CHECK_ITERABLE_CUSTOM_APPROX(solve_dense(stiffness, source),
+                                 expected_solution, custom_approx);
+  }
+  {
+    INFO("Line of elements");
+    // Solve -u'' = f on [-3, 3] with u = cos(pi x / 6), discretized by three
+    // elements of width 2
+    const std::vector<Mesh<1>> meshes{make_mesh(10), make_mesh(12),
+                                      make_mesh(11)};
+    const std::vector<double> jacobians{1., 1., 1.};
+    Matrix stiffness{};
+    DataVector mass{};
+    detail::flat_laplacian_1d(make_not_null(&stiffness), make_not_null(&mass),
+                              meshes, jacobians, true, true, 1.5);
+    CHECK_MATRIX_APPROX(stiffness, Matrix{blaze::trans(stiffness)});
+    DataVector x{mass.size()};
+    size_t offset = 0;
+    for (size_t element = 0; element < 3; ++element) {
+      const auto& logical_x = Spectral::collocation_points(meshes[element]);
+      for (size_t i = 0; i < logical_x.size(); ++i) {
+        x[offset + i] = logical_x[i] + 2. * static_cast<double>(element) - 2.;
+      }
+      offset += logical_x.size();
+    }
+    const DataVector expected_solution = cos(M_PI / 6. * x);
+    const DataVector source = mass * square(M_PI / 6.) * expected_solution;
+    CHECK_ITERABLE_CUSTOM_APPROX(solve_dense(stiffness, source),
+                                 expected_solution, custom_approx);
+    // With Neumann conditions, constants are in the null space
+    detail::flat_laplacian_1d(make_not_null(&stiffness), make_not_null(&mass),
+                              meshes, {0.5, 2., 1.}, false, false, 1.5);
+    CHECK_MATRIX_APPROX(stiffness, Matrix{blaze::trans(stiffness)});
+    for (size_t i = 0; i < mass.size(); ++i) {
+      double row_sum = 0.;
+      for (size_t j = 0; j < mass.size(); ++j) {
+        row_sum += stiffness(i, j);
+      }
+      CHECK(row_sum == approx(0.));
+    }
+  }
+}
+
+void test_fast_diagonalization_1d() {
+  Matrix stiffness{};
+  DataVector mass{};
+  detail::flat_laplacian_1d(make_not_null(&stiffness), make_not_null(&mass),
+                            {make_mesh(6), make_mesh(5), make_mesh(4)},
+                            {0.5, 1., 2.}, true, false, 1.5);
+  const size_t first_point = 3;
+  const size_t num_points = 9;
+  for (const bool massive : {true, false}) {
+    CAPTURE(massive);
+    Matrix eigenvectors{};
+    Matrix inverse_eigenvectors{};
+    DataVector eigenvalues{};
+    detail::fast_diagonalization_1d(make_not_null(&eigenvectors),
+                                    make_not_null(&inverse_eigenvectors),
+                                    make_not_null(&eigenvalues), stiffness,
+                                    mass, first_point, num_points, massive);
+    REQUIRE(eigenvalues.size() == num_points);
+    // Reconstruct the (restricted) operator from the factorization
+    Matrix expected_operator(num_points, num_points);
+    Matrix expected_mass(num_points, num_points, 0.);
+    for (size_t i = 0; i < num_points; ++i) {
+      for (size_t j = 0; j < num_points; ++j) {
+        expected_operator(i, j) = stiffness(first_point + i, first_point + j);
+      }
+      expected_mass(i, i) = mass[first_point + i];
+    }
+    Matrix eigenvalues_matrix(num_points, num_points, 0.);
+    for (size_t i = 0; i < num_points; ++i) {
+      CHECK(eigenvalues[i] > 0.);
+      eigenvalues_matrix(i, i) = eigenvalues[i];
+    }
+    const Matrix inverse_mass = blaze::inv(expected_mass);
+    const Matrix inverse = massive ? Matrix{blaze::inv(eigenvectors) *
+                                            inverse_mass}
+                                   : Matrix{blaze::inv(eigenvectors)};
+    CHECK_MATRIX_APPROX(inverse_eigenvectors, inverse);
+    CHECK_MATRIX_APPROX(Matrix{expected_mass * eigenvectors *
+                               eigenvalues_matrix * blaze::inv(eigenvectors)},
+                        expected_operator);
+  }
+}
+
+template <typename Tag>
+using overlaps_tag =
+    LinearSolver::Schwarz::Tags::Overlaps<Tag, 2, OptionsGroup>;
+
+// Subdomain geometry:
+//
+//      D
+//   +---+---+
+// D |   |   | D
+//   +---+---+
+//      N
+//
+// The subdomain is centered on the left element of a block that is split in
+// two. It overlaps with the right element, which has a different number of
+// grid points in the overlap dimension. If the right element has a different
+// number of grid points in the other dimension as well, the overlap is not
+// conforming and is ignored by the solver.
+auto make_databox(const Index<2>& right_extents, const bool massive) {
+  constexpr size_t Dim = 2;
+  const Block<Dim> block{
+      domain::make_coordinate_map_base<Frame::BlockLogical, Frame::Inertial>(
+          domain::CoordinateMaps::Identity<Dim>{}),
+      0,
+      {}};
+  const std::vector<std::array<size_t, Dim>> refinement{{{1, 0}}};
+  const ElementId<Dim> left_id{0, {{{1, 0}, {0, 0}}}};
+  const ElementId<Dim> right_id{0, {{{1, 1}, {0, 0}}}};
+  const LinearSolver::Schwarz::OverlapId<Dim> overlap_id{
+      Direction<Dim>::upper_xi(), right_id};
+  const Mesh<Dim> mesh{{{5, 4}},
+                       Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+  const Mesh<Dim> right_mesh{right_extents.indices(),
+                             Spectral::Basis::Legendre,
+                             Spectral::Quadrature::GaussLobatto};
+  // The elements have width 1 in x and 2 in y
+  const auto make_inv_jacobian = [](const size_t num_points) {
+    InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Inertial>
+        inv_jacobian{num_points, 0.};
+    get<0, 0>(inv_jacobian) = 2.;
+    get<1, 1>(inv_jacobian) = 1.;
+    return inv_jacobian;
+  };
+  return db::create<tmpl::list<
+      domain::Tags::Element<Dim>, domain::Tags::Mesh<Dim>,
+      domain::Tags::InverseJacobian<Dim, Frame::ElementLogical,
+                                    Frame::Inertial>,
+      overlaps_tag<domain::Tags::Element<Dim>>,
+      overlaps_tag<domain::Tags::Mesh<Dim>>,
+      overlaps_tag<domain::Tags::InverseJacobian<Dim, Frame::ElementLogical,
+                                                 Frame::Inertial>>,
+      overlaps_tag<elliptic::dg::subdomain_operator::Tags::ExtrudingExtent>,
+      elliptic::dg::Tags::PenaltyParameter, elliptic::dg::Tags::Massive>>(
+      domain::Initialization::create_initial_element(left_id, block,
+                                                     refinement),
+      mesh, make_inv_jacobian(mesh.number_of_grid_points()),
+      LinearSolver::Schwarz::OverlapMap<Dim, Element<Dim>>{
+          {overlap_id, domain::Initialization::create_initial_element(
+                           right_id, block, refinement)}},
+      LinearSolver::Schwarz::OverlapMap<Dim, Mesh<Dim>>{
+          {overlap_id, right_mesh}},
+      LinearSolver::Schwarz::OverlapMap<
+          Dim, InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                               Frame::Inertial>>{
+          {overlap_id, make_inv_jacobian(right_mesh.number_of_grid_points())}},
+      LinearSolver::Schwarz::OverlapMap<Dim, size_t>{{overlap_id, 2}}, 1.5,
+      massive);
+}
+
+void test_solver() {
+  constexpr size_t Dim = 2;
+  using LinearSolverType = ::LinearSolver::Serial::LinearSolver<
+      tmpl::list<Registrars::FastDiagonalization<Dim>>>;
+  using SubdomainData = ::LinearSolver::Schwarz::ElementCenteredSubdomainData<
+      Dim, tmpl::list<ScalarFieldTag, AnotherScalarFieldTag>>;
+  using BoundaryId = std::pair<size_t, Direction<Dim>>;
+  Parallel::register_derived_classes_with_charm<LinearSolverType>();
+  const auto created =
+      TestHelpers::test_creation<std::unique_ptr<LinearSolverType>>(
+          "FastDiagonalization");
+  REQUIRE(dynamic_cast<const FastDiagonalization<Dim>*>(created.get()) !=
+          nullptr);
+
+  const Poisson::BoundaryConditions::Robin<Dim> dirichlet_bc{1., 0., 0.};
+  const Poisson::BoundaryConditions::Robin<Dim> neumann_bc{0., 1., 0.};
+  const std::unordered_map<
+      BoundaryId,
+      const typename Poisson::FirstOrderSystem<
+          Dim, Poisson::Geometry::FlatCartesian>::boundary_conditions_base&,
+      boost::hash<BoundaryId>>
+      boundary_conditions{{{0, Direction<Dim>::lower_xi()}, dirichlet_bc},
+                          {{0, Direction<Dim>::upper_xi()}, dirichlet_bc},
+                          {{0, Direction<Dim>::lower_eta()}, neumann_bc},
+                          {{0, Direction<Dim>::upper_eta()}, dirichlet_bc}};
+  const LinearSolver::Schwarz::OverlapId<Dim> overlap_id{
+      Direction<Dim>::upper_xi(), ElementId<Dim>{0, {{{1, 1}, {0, 0}}}}};
+
+  MAKE_GENERATOR(generator);
+  std::uniform_real_distribution<> dist{-1., 1.};
+  for (const bool conforming : {true, false}) {
+    for (const bool massive : {true, false}) {
+      CAPTURE(conforming);
+      CAPTURE(massive);
+      const Index<Dim> right_extents{6, conforming ? 4 : 5};
+      const auto box = make_databox(right_extents, massive);
+      SubdomainData source{};
+      source.element_data.initialize(20);
+      source.overlap_data[overlap_id].initialize(2 * right_extents[1]);
+      for (double& value : source) {
+        value = dist(generator);
+      }
+      auto solution = make_with_value<SubdomainData>(source, 0.);
+      const auto cloned_solver = created->get_clone();
+      const auto& solver =
+          dynamic_cast<const FastDiagonalization<Dim>&>(*cloned_solver);
+      const auto has_converged =
+          solver.solve(make_not_null(&solution), SubdomainOperator{}, source,
+                       std::forward_as_tuple(box, boundary_conditions));
+      CHECK(has_converged);
+
+      // Build the Kronecker sum of the 1D operators explicitly and solve it
+      // densely. In x the box extends by 2 points into the right element,
+      // where the solver should ignore a non-conforming overlap.
+      const size_t num_points_x = conforming ? 7 : 5;
+      CHECK(solver.box_extents() == Index<Dim>{num_points_x, 4});
+      Matrix stiffness_x{};
+      DataVector mass_x{};
+      if (conforming) {
+        detail::flat_laplacian_1d(
+            make_not_null(&stiffness_x), make_not_null(&mass_x),
+            {make_mesh(5), make_mesh(6)}, {0.5, 0.5}, true, true, 1.5);
+      } else {
+        detail::flat_laplacian_1d(make_not_null(&stiffness_x),
+                                  make_not_null(&mass_x), {make_mesh(5)},
+                                  {0.5}, true, true, 1.5);
+      }
+      Matrix stiffness_y{};
+      DataVector mass_y{};
+      detail::flat_laplacian_1d(make_not_null(&stiffness_y),
+                                make_not_null(&mass_y), {make_mesh(4)}, {1.},
+                                false, true, 1.5);
+      const size_t num_points = num_points_x * 4;
+      Matrix full_operator(num_points, num_points, 0.);
+      DataVector full_mass{num_points};
+      for (size_t j = 0; j < 4; ++j) {
+        for (size_t i = 0; i < num_points_x; ++i) {
+          full_mass[i + num_points_x * j] = mass_x[i] * mass_y[j];
+          for (size_t l = 0; l < 4; ++l) {
+            for (size_t k = 0; k < num_points_x; ++k) {
+              full_operator(i + num_points_x * j, k + num_points_x * l) =
+                  stiffness_x(i, k) * (j == l ? mass_y[j] : 0.) +
+                  (i == k ? mass_x[i] : 0.) * stiffness_y(j, l);
+            }
+          }
+        }
+      }
+      for (size_t component = 0; component < 2; ++component) {
+        CAPTURE(component);
+        DataVector full_source{num_points};
+        for (size_t j = 0; j < 4; ++j) {
+          for (size_t i = 0; i < num_points_x; ++i) {
+            full_source[i + num_points_x * j] =
+                i < 5 ? source.element_data.data()[component * 20 + i + 5 * j]
+                      : source.overlap_data.at(overlap_id)
+                            .data()[component * 8 + i - 5 + 2 * j];
+          }
+        }
+        if (not massive) {
+          full_source *= full_mass;
+        }
+        const DataVector expected_solution =
+            solve_dense(full_operator, full_source);
+        for (size_t j = 0; j < 4; ++j) {
+          for (size_t i = 0; i < 5; ++i) {
+            CHECK(solution.element_data.data()[component * 20 + i + 5 * j] ==
+                  approx(expected_solution[i + num_points_x * j]));
+          }
+        }
+        const auto& overlap_solution = solution.overlap_data.at(overlap_id);
+        const size_t num_points_overlap = 2 * right_extents[1];
+        for (size_t i = 0; i < num_points_overlap; ++i) {
+          CHECK(overlap_solution.data()[component * num_points_overlap + i] ==
+                approx(conforming
+                           ? expected_solution[5 + i % 2 +
+                                               num_points_x * (i / 2)]
+                           : 0.));
+        }
+      }
+
+      // The factorization is serialized with the solver
+      const auto deserialized_solver = serialize_and_deserialize(solver);
+      auto solution_from_deserialized =
+          make_with_value<SubdomainData>(source, 0.);
+      deserialized_solver.solve(
+          make_not_null(&solution_from_deserialized), SubdomainOperator{},
+          source, std::forward_as_tuple(box, boundary_conditions));
+      CHECK_ITERABLE_APPROX(solution_from_deserialized, solution);
+    }
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Elliptic.SubdomainPreconditioners.FastDiagonalization",
+                  "[Unit][Elliptic]") {
+  test_flat_laplacian_1d();
+  test_fast_diagonalization_1d();
+  test_solver();
+}
+
+}  // namespace elliptic::subdomain_preconditioners
@@ -422,7 +422,9 @@ SPECTRE_TEST_CASE("Unit.Elliptic.SubdomainPreconditioners.MinusLaplacian",
     const auto created =
         TestHelpers::test_creation<std::unique_ptr<LinearSolverType>>(
             "MinusLaplacian:\n"
-            "  Solver: ExplicitInverse\n"
+            "  Solver:\n"
+            "    ExplicitInverse:\n"
+            "      SinglePrecision: True\n"
             "  BoundaryConditions: Auto");
     const auto serialized = serialize_and_deserialize(created);
     const auto cloned = serialized->get_clone();
@@ -431,11 +433,10 @@ SPECTRE_TEST_CASE("Unit.Elliptic.SubdomainPreconditioners.MinusLaplacian",
     const auto& minus_laplacian =
         dynamic_cast<const MinusLaplacian<Dim, OptionsGroup>&>(*cloned);
     const auto& solver = minus_laplacian.solver();
-    REQUIRE(
-        dynamic_cast<
-            const LinearSolver::Serial::ExplicitInverse<typename MinusLaplacian<
-                Dim, OptionsGroup>::solver_type::registrars>*>(&solver) !=
-        nullptr);
+    using ExplicitInverseType = LinearSolver::Serial::ExplicitInverse<
+        typename MinusLaplacian<Dim, OptionsGroup>::solver_type::registrars>;
+    REQUIRE(dynamic_cast<const ExplicitInverseType*>(&solver) != nullptr);
+    CHECK(dynamic_cast<const ExplicitInverseType&>(solver).single_precision());
   }
   {
     INFO("Resetting");
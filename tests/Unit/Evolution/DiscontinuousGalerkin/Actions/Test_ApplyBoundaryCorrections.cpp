@@ -28,6 +28,7 @@
 #include "Evolution/DiscontinuousGalerkin/MortarData.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/NormalVectorTags.hpp"
+#include "Evolution/DiscontinuousGalerkin/Tags/BoundaryCorrectionWaitTimes.hpp"
 #include "Framework/ActionTesting.hpp"
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Helpers/Evolution/DiscontinuousGalerkin/Actions/SystemType.hpp"
@@ -731,6 +732,16 @@ void test_impl(const Spectral::Quadrature quadrature,
 
   ActionTesting::next_action<comp>(make_not_null(&runner), self_id);
 
+  // The action had to wait for the neighbor data before it could apply the
+  // boundary corrections
+  const auto& wait_times =
+      get_tag<evolution::dg::Tags::BoundaryCorrectionWaitTimes>(runner,
+                                                                self_id);
+  CHECK_FALSE(wait_times.is_waiting());
+  CHECK(wait_times.number_of_steps() == 1);
+  CHECK(wait_times.number_of_waits() == 1);
+  CHECK(wait_times.total_wait_time() >= 0.);
+
   // Check the inboxes are empty when doing global time stepping
   if (not UseLocalTimeStepping) {
     REQUIRE(
@@ -334,6 +334,99 @@ struct Test<3, LocalTimeStepping> {
                                  expected_normal_covector_quantities);
   }
 };
+
+void test_project_mortars() {
+  INFO("Project mortars");
+  // The element X splits in xi. Its upper child Y has a new sibling in lower
+  // xi, keeps the neighbor in upper xi and shares the neighbor in lower eta
+  // with its sibling:
+  //
+  // ^ eta
+  // +-+-+> xi    +-+-+-+> xi
+  // |X| |    ->  | |Y| |
+  // +-+-+        +-+-+-+
+  // | | |        |   | |
+  // +-+-+        +-+-+-+
+  const ElementId<2> old_id{0, {{{1, 0}, {1, 1}}}};
+  const ElementId<2> new_id{0, {{{2, 1}, {1, 1}}}};
+  const ElementId<2> sibling_id{0, {{{2, 0}, {1, 1}}}};
+  const ElementId<2> east_id{0, {{{1, 1}, {1, 1}}}};
+  const ElementId<2> south_id{0, {{{1, 0}, {1, 0}}}};
+  DirectionMap<2, Neighbors<2>> neighbors{};
+  neighbors[Direction<2>::lower_xi()] = Neighbors<2>{{sibling_id}, {}};
+  neighbors[Direction<2>::upper_xi()] = Neighbors<2>{{east_id}, {}};
+  neighbors[Direction<2>::lower_eta()] = Neighbors<2>{{south_id}, {}};
+  const Element<2> new_element{new_id, neighbors};
+  const auto quadrature = Spectral::Quadrature::GaussLobatto;
+  const Mesh<2> new_mesh{{{3, 2}}, Spectral::Basis::Legendre, quadrature};
+  const std::unordered_map<ElementId<2>, Mesh<2>> new_neighbor_meshes{
+      {sibling_id, new_mesh},
+      {east_id, Mesh<2>{{{3, 4}}, Spectral::Basis::Legendre, quadrature}},
+      {south_id, Mesh<2>{{{5, 3}}, Spectral::Basis::Legendre, quadrature}}};
+  const TimeStepId next_time_step_id{true, 3,
+                                     Time{Slab{0.2, 3.4}, {6, 100}}};
+
+  // Start with the mortars of the old element
+  const auto old_mortar_id = std::make_pair(Direction<2>::upper_xi(), east_id);
+  const auto stale_mortar_id =
+      std::make_pair(Direction<2>::upper_eta(), old_id);
+  MortarMap<2, MortarData<2>> mortar_data{{old_mortar_id, MortarData<2>{1}},
+                                          {stale_mortar_id, MortarData<2>{1}}};
+  MortarMap<2, Mesh<1>> mortar_meshes{
+      {old_mortar_id, Mesh<1>{2, Spectral::Basis::Legendre, quadrature}},
+      {stale_mortar_id, Mesh<1>{2, Spectral::Basis::Legendre, quadrature}}};
+  MortarMap<2, std::array<Spectral::MortarSize, 1>> mortar_sizes{
+      {old_mortar_id, {{Spectral::MortarSize::Full}}},
+      {stale_mortar_id, {{Spectral::MortarSize::Full}}}};
+  MortarMap<2, TimeStepId> mortar_next_temporal_ids{
+      {old_mortar_id, next_time_step_id}, {stale_mortar_id, next_time_step_id}};
+  typename Tags::NormalCovectorAndMagnitude<2>::type
+      normal_covector_quantities{};
+  normal_covector_quantities[Direction<2>::upper_xi()] =
+      Variables<tmpl::list<evolution::dg::Tags::MagnitudeOfNormal,
+                           evolution::dg::Tags::NormalCovector<2>>>{2, 1.};
+
+  Initialization::project_mortars(
+      make_not_null(&mortar_data), make_not_null(&mortar_meshes),
+      make_not_null(&mortar_sizes), make_not_null(&mortar_next_temporal_ids),
+      make_not_null(&normal_covector_quantities), new_element, new_mesh,
+      new_neighbor_meshes, next_time_step_id);
+
+  const auto sibling_mortar_id =
+      std::make_pair(Direction<2>::lower_xi(), sibling_id);
+  const auto east_mortar_id = std::make_pair(Direction<2>::upper_xi(), east_id);
+  const auto south_mortar_id =
+      std::make_pair(Direction<2>::lower_eta(), south_id);
+  const MortarMap<2, Mesh<1>> expected_mortar_meshes{
+      {sibling_mortar_id, Mesh<1>{2, Spectral::Basis::Legendre, quadrature}},
+      {east_mortar_id, Mesh<1>{4, Spectral::Basis::Legendre, quadrature}},
+      {south_mortar_id, Mesh<1>{5, Spectral::Basis::Legendre, quadrature}}};
+  CHECK(mortar_meshes == expected_mortar_meshes);
+  // The south neighbor is larger than the new element, so the mortar covers
+  // the full face
+  const MortarMap<2, std::array<Spectral::MortarSize, 1>>
+      expected_mortar_sizes{
+          {sibling_mortar_id, {{Spectral::MortarSize::Full}}},
+          {east_mortar_id, {{Spectral::MortarSize::Full}}},
+          {south_mortar_id, {{Spectral::MortarSize::Full}}}};
+  CHECK(mortar_sizes == expected_mortar_sizes);
+  CHECK(mortar_data.size() == 3);
+  CHECK(mortar_next_temporal_ids.size() == 3);
+  for (const auto& [mortar_id, mesh] : expected_mortar_meshes) {
+    CHECK(mortar_data.count(mortar_id) == 1);
+    CHECK(mortar_next_temporal_ids.at(mortar_id) == next_time_step_id);
+  }
+  const DirectionMap<
+      2, std::optional<
+             Variables<tmpl::list<evolution::dg::Tags::MagnitudeOfNormal,
+                                  evolution::dg::Tags::NormalCovector<2>>>>>
+      expected_normal_covector_quantities{{Direction<2>::lower_xi(), {}},
+                                          {Direction<2>::upper_xi(), {}},
+                                          {Direction<2>::lower_eta(), {}},
+                                          {Direction<2>::upper_eta(), {}}};
+  CHECK(static_cast<bool>(normal_covector_quantities ==
+                          expected_normal_covector_quantities));
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Evolution.DG.Initialization.Mortars",
@@ -348,5 +441,6 @@ SPECTRE_TEST_CASE("Unit.Evolution.DG.Initialization.Mortars",
     Test<2, false>::apply(quadrature);
     Test<3, false>::apply(quadrature);
   }
+  test_project_mortars();
 }
 }  // namespace evolution::dg
@@ -0,0 +1,14 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include "Evolution/DiscontinuousGalerkin/Tags/BoundaryCorrectionWaitTimes.hpp"
+#include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+
+SPECTRE_TEST_CASE("Unit.Evolution.DG.Tags.BoundaryCorrectionWaitTimes",
+                  "[Unit][Evolution]") {
+  TestHelpers::db::test_simple_tag<
+      evolution::dg::Tags::BoundaryCorrectionWaitTimes>(
+      "BoundaryCorrectionWaitTimes");
+}
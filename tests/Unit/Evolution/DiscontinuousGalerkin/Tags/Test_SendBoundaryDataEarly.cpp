@@ -0,0 +1,19 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include "Evolution/DiscontinuousGalerkin/Tags/SendBoundaryDataEarly.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+
+SPECTRE_TEST_CASE("Unit.Evolution.DG.Tags.SendBoundaryDataEarly",
+                  "[Unit][Evolution]") {
+  TestHelpers::db::test_simple_tag<evolution::dg::Tags::SendBoundaryDataEarly>(
+      "SendBoundaryDataEarly");
+  CHECK(TestHelpers::test_option_tag<
+        evolution::dg::OptionTags::SendBoundaryDataEarly>("true"));
+  CHECK_FALSE(TestHelpers::test_option_tag<
+              evolution::dg::OptionTags::SendBoundaryDataEarly>("false"));
+  CHECK(evolution::dg::Tags::SendBoundaryDataEarly::create_from_options(true));
+}
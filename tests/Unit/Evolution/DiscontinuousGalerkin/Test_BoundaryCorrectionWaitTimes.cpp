@@ -0,0 +1,51 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include "Evolution/DiscontinuousGalerkin/BoundaryCorrectionWaitTimes.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Utilities/GetOutput.hpp"
+
+SPECTRE_TEST_CASE("Unit.Evolution.DG.BoundaryCorrectionWaitTimes",
+                  "[Unit][Evolution]") {
+  evolution::dg::BoundaryCorrectionWaitTimes wait_times{};
+  CHECK_FALSE(wait_times.is_waiting());
+  CHECK(wait_times.number_of_steps() == 0);
+  CHECK(wait_times.number_of_waits() == 0);
+  CHECK(wait_times.total_wait_time() == 0.);
+  CHECK(wait_times.max_wait_time() == 0.);
+
+  // All data had already arrived
+  wait_times.stop_waiting(1.);
+  CHECK_FALSE(wait_times.is_waiting());
+  CHECK(wait_times.number_of_steps() == 1);
+  CHECK(wait_times.number_of_waits() == 0);
+  CHECK(wait_times.total_wait_time() == 0.);
+
+  // Only the first retry of a step starts the timer
+  wait_times.start_waiting(2.);
+  CHECK(wait_times.is_waiting());
+  wait_times.start_waiting(2.25);
+  wait_times.stop_waiting(2.5);
+  CHECK_FALSE(wait_times.is_waiting());
+  CHECK(wait_times.number_of_steps() == 2);
+  CHECK(wait_times.number_of_waits() == 1);
+  CHECK(wait_times.total_wait_time() == approx(0.5));
+  CHECK(wait_times.max_wait_time() == approx(0.5));
+
+  wait_times.start_waiting(3.);
+  wait_times.stop_waiting(3.25);
+  CHECK(wait_times.number_of_steps() == 3);
+  CHECK(wait_times.number_of_waits() == 2);
+  CHECK(wait_times.total_wait_time() == approx(0.75));
+  CHECK(wait_times.max_wait_time() == approx(0.5));
+  CHECK(get_output(wait_times) ==
+        "Waited in 2 of 3 steps for a total of 0.75s (max 0.5s)");
+
+  wait_times.start_waiting(4.);
+  test_serialization(wait_times);
+  const auto copy = serialize_and_deserialize(wait_times);
+  CHECK(copy.is_waiting());
+  CHECK(copy != evolution::dg::BoundaryCorrectionWaitTimes{});
+}
@@ -0,0 +1,226 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/ObservationBox.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryCorrectionWaitTimes.hpp"
+#include "Evolution/DiscontinuousGalerkin/ObserveBoundaryCorrectionWaitTimes.hpp"
+#include "Evolution/DiscontinuousGalerkin/Tags/BoundaryCorrectionWaitTimes.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/Observer/Actions/RegisterEvents.hpp"
+#include "IO/Observer/ArrayComponentId.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/TypeOfObservation.hpp"
+#include "Options/Protocols/FactoryCreation.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/Reduction.hpp"
+#include "Parallel/RegisterDerivedClassesWithCharm.hpp"
+#include "Parallel/Tags/Metavariables.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Time/Tags.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Parallel {
+template <typename Metavariables>
+class GlobalCache;
+}  // namespace Parallel
+namespace observers::Actions {
+struct ContributeReductionData;
+}  // namespace observers::Actions
+
+namespace {
+using ObserveWaitTimes =
+    evolution::dg::Events::ObserveBoundaryCorrectionWaitTimes;
+
+template <typename Metavariables>
+struct MockContributeReductionData {
+  using ReductionData = tmpl::wrap<
+      tmpl::front<ObserveWaitTimes::observed_reduction_data_tags>,
+      Parallel::ReductionData>;
+  struct Results {
+    observers::ObservationId observation_id;
+    std::string subfile_name;
+    std::vector<std::string> reduction_names;
+    ReductionData reduction_data;
+  };
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static std::optional<Results> results;
+
+  template <typename ParallelComponent, typename... DbTags, typename ArrayIndex>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const observers::ObservationId& observation_id,
+                    observers::ArrayComponentId /*sender_array_id*/,
+                    const std::string& subfile_name,
+                    const std::vector<std::string>& reduction_names,
+                    ReductionData&& reduction_data) {
+    if (results) {
+      CHECK(results->observation_id == observation_id);
+      CHECK(results->subfile_name == subfile_name);
+      CHECK(results->reduction_names == reduction_names);
+      results->reduction_data.combine(std::move(reduction_data));
+    } else {
+      results.emplace();
+      *results = {observation_id, subfile_name, reduction_names,
+                  std::move(reduction_data)};
+    }
+  }
+};
+
+template <typename Metavariables>
+std::optional<typename MockContributeReductionData<Metavariables>::Results>
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    MockContributeReductionData<Metavariables>::results{};
+
+template <typename Metavariables>
+struct ElementComponent {
+  using component_being_mocked = void;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>>;
+};
+
+template <typename Metavariables>
+struct MockObserverComponent {
+  using component_being_mocked = observers::Observer<Metavariables>;
+  using replace_these_simple_actions =
+      tmpl::list<observers::Actions::ContributeReductionData>;
+  using with_these_simple_actions =
+      tmpl::list<MockContributeReductionData<Metavariables>>;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockGroupChare;
+  using array_index = int;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<ElementComponent<Metavariables>,
+                                    MockObserverComponent<Metavariables>>;
+  using const_global_cache_tags = tmpl::list<>;
+
+  struct factory_creation
+      : tt::ConformsTo<Options::protocols::FactoryCreation> {
+    using factory_classes =
+        tmpl::map<tmpl::pair<Event, tmpl::list<ObserveWaitTimes>>>;
+  };
+};
+
+void test_observe(const Event& observer) {
+  using element_component = ElementComponent<Metavariables>;
+  using observer_component = MockObserverComponent<Metavariables>;
+
+  auto& results = MockContributeReductionData<Metavariables>::results;
+  results.reset();
+
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{}};
+  ActionTesting::emplace_group_component<observer_component>(&runner);
+
+  const double observation_time = 2.0;
+
+  // An element that has not taken a step yet
+  evolution::dg::BoundaryCorrectionWaitTimes no_steps{};
+  // An element that waited 0.5s in one of two steps
+  evolution::dg::BoundaryCorrectionWaitTimes short_wait{};
+  short_wait.stop_waiting(1.);
+  short_wait.start_waiting(2.);
+  short_wait.stop_waiting(2.5);
+  // An element that waited 1s in its only step
+  evolution::dg::BoundaryCorrectionWaitTimes long_wait{};
+  long_wait.start_waiting(1.);
+  long_wait.stop_waiting(2.);
+
+  using tag_list =
+      tmpl::list<Parallel::Tags::MetavariablesImpl<Metavariables>, Tags::Time,
+                 evolution::dg::Tags::BoundaryCorrectionWaitTimes>;
+  std::vector<db::compute_databox_type<tag_list>> element_boxes;
+  for (const auto& wait_times : {no_steps, short_wait, long_wait}) {
+    auto box =
+        db::create<tag_list>(Metavariables{}, observation_time, wait_times);
+    const auto ids_to_register =
+        observers::get_registration_observation_type_and_key(observer, box);
+    CHECK(ids_to_register->first == observers::TypeOfObservation::Reduction);
+    CHECK(ids_to_register->second ==
+          observers::ObservationKey("/wait_times_subfile.dat"));
+    element_boxes.push_back(std::move(box));
+    ActionTesting::emplace_component<element_component>(
+        &runner, element_boxes.size() - 1);
+  }
+
+  for (size_t index = 0; index < element_boxes.size(); ++index) {
+    CHECK(observer.is_ready(
+        element_boxes[index],
+        ActionTesting::cache<element_component>(runner, index),
+        static_cast<element_component::array_index>(index),
+        std::add_pointer_t<element_component>{}));
+    observer.run(
+        make_observation_box<db::AddComputeTags<>>(element_boxes[index]),
+        ActionTesting::cache<element_component>(runner, index),
+        static_cast<element_component::array_index>(index),
+        std::add_pointer_t<element_component>{});
+  }
+
+  for (size_t i = 0; i < element_boxes.size(); ++i) {
+    REQUIRE(not runner.is_simple_action_queue_empty<observer_component>(0));
+    runner.invoke_queued_simple_action<observer_component>(0);
+  }
+  CHECK(runner.is_simple_action_queue_empty<observer_component>(0));
+
+  REQUIRE(results);
+  auto& reduction_data = results->reduction_data;
+  reduction_data.finalize();
+
+  CHECK(results->observation_id.value() == observation_time);
+  CHECK(results->subfile_name == "/wait_times_subfile");
+  CHECK(results->reduction_names ==
+        std::vector<std::string>{"Time", "NumberOfElements",
+                                 "Minimum mean wait time",
+                                 "Maximum mean wait time", "Mean wait time",
+                                 "Maximum wait time"});
+  CHECK(std::get<0>(reduction_data.data()) == observation_time);
+  CHECK(std::get<1>(reduction_data.data()) == 3);
+  CHECK(std::get<2>(reduction_data.data()) == 0.);
+  CHECK(std::get<3>(reduction_data.data()) == approx(1.));
+  CHECK(std::get<4>(reduction_data.data()) == approx(1.25 / 3.));
+  CHECK(std::get<5>(reduction_data.data()) == approx(1.));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.DG.ObserveBoundaryCorrectionWaitTimes",
+                  "[Unit][Evolution]") {
+  Parallel::register_factory_classes_with_charm<Metavariables>();
+
+  const ObserveWaitTimes observer("wait_times_subfile");
+  CHECK(not observer.needs_evolved_variables());
+  test_observe(observer);
+  test_observe(serialize_and_deserialize(observer));
+
+  const auto event =
+      TestHelpers::test_creation<std::unique_ptr<Event>, Metavariables>(
+          "ObserveBoundaryCorrectionWaitTimes:\n"
+          "  SubfileName: wait_times_subfile");
+  test_observe(*event);
+  test_observe(*serialize_and_deserialize(event));
+}
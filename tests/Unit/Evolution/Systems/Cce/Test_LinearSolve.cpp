@@ -15,6 +15,7 @@
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Helpers/Evolution/Systems/Cce/CceComputationTestHelpers.hpp"
 #include "NumericalAlgorithms/Spectral/SwshCollocation.hpp"
+#include "Utilities/ThreadPool.hpp"
 #include "Utilities/VectorAlgebra.hpp"
 
 namespace Cce {
@@ -465,6 +466,17 @@ void test_pole_integration_with_linear_operator(
   CHECK_ITERABLE_CUSTOM_APPROX(expected,
                                get(db::get<BondiValueTag>(box)).data(),
                                numerical_differentiation_approximation);
+
+  // The linear solves at the angular points are split among the threads of
+  // the pool, so the result must not depend on the number of threads.
+  const ComplexDataVector serial_result =
+      get(db::get<BondiValueTag>(box)).data();
+  thread_pool::set_number_of_threads(4);
+  db::mutate_apply<RadialIntegrateBondi<Tags::BoundaryValue, BondiValueTag>>(
+      make_not_null(&box));
+  thread_pool::set_number_of_threads(1);
+  CHECK_ITERABLE_APPROX(get(db::get<BondiValueTag>(box)).data(),
+                        serial_result);
 }
 
 SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.LinearSolve", "[Unit][Cce]") {
@@ -483,6 +495,9 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.LinearSolve", "[Unit][Cce]") {
                                       number_of_radial_grid_points, l_max);
   test_pole_integration_with_linear_operator<Tags::BondiH>(
       make_not_null(&gen), number_of_radial_grid_points, l_max);
+  // The 45 angular points at l_max = 4 don't split evenly among 4 threads
+  test_pole_integration_with_linear_operator<Tags::BondiH>(
+      make_not_null(&gen), number_of_radial_grid_points, 4);
 }
 }  // namespace
 }  // namespace Cce
@@ -52,6 +52,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.OptionTags", "[Unit][Cce]") {
   TestHelpers::db::test_simple_tag<Cce::Tags::LMax>("LMax");
   TestHelpers::db::test_simple_tag<Cce::Tags::NumberOfRadialPoints>(
       "NumberOfRadialPoints");
+  TestHelpers::db::test_simple_tag<Cce::Tags::NumberOfThreads>(
+      "NumberOfThreads");
   TestHelpers::db::test_simple_tag<Cce::Tags::ObservationLMax>(
       "ObservationLMax");
   TestHelpers::db::test_simple_tag<Cce::Tags::FilterLMax>("FilterLMax");
@@ -111,6 +113,10 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.OptionTags", "[Unit][Cce]") {
             "OptionTagsCceR0100.h5") == "OptionTagsCceR0100.h5");
   CHECK(TestHelpers::test_option_tag<Cce::OptionTags::H5LookaheadTimes>("5") ==
         5_st);
+  CHECK(TestHelpers::test_option_tag<Cce::OptionTags::H5PrefetchDepth>("2") ==
+        2_st);
+  CHECK(TestHelpers::test_option_tag<Cce::OptionTags::NumberOfThreads>("4") ==
+        4_st);
   CHECK(TestHelpers::test_option_tag<Cce::OptionTags::ScriInterpolationOrder>(
             "4") == 4_st);
 
@@ -176,13 +182,15 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.OptionTags", "[Unit][Cce]") {
       filename, 4.0, 100.0, 0.0, 0.1, 8);
 
   CHECK(Cce::Tags::H5WorldtubeBoundaryDataManager::create_from_options(
-            8, filename, 3, std::make_unique<intrp::CubicSpanInterpolator>(),
+            8, filename, 3, 1,
+            std::make_unique<intrp::CubicSpanInterpolator>(),
             false, true, std::nullopt)
             ->get_l_max() == 8);
 
   CHECK(Cce::Tags::FilePrefix::create_from_options("Shrek 2") == "Shrek 2");
   CHECK(Cce::Tags::LMax::create_from_options(8u) == 8u);
   CHECK(Cce::Tags::NumberOfRadialPoints::create_from_options(6u) == 6u);
+  CHECK(Cce::Tags::NumberOfThreads::create_from_options(3u) == 3u);
 
   CHECK(Cce::Tags::StartTimeFromFile::create_from_options(
             std::optional<double>{}, "OptionTagsTestCceR0100.h5", false) ==
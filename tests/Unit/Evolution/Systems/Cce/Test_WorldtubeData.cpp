@@ -3,7 +3,10 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cmath>
 #include <cstddef>
+#include <memory>
+#include <string>
 
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
@@ -13,6 +16,7 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Evolution/Systems/Cce/BoundaryData.hpp"
+#include "Evolution/Systems/Cce/PrefetchingWorldtubeBufferUpdater.hpp"
 #include "Evolution/Systems/Cce/ReducedWorldtubeModeRecorder.hpp"
 #include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
 #include "Evolution/Systems/Cce/WorldtubeDataManager.hpp"
@@ -29,6 +33,7 @@
 #include "PointwiseFunctions/AnalyticSolutions/GeneralRelativity/KerrSchild.hpp"
 #include "Utilities/FileSystem.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 
 namespace Cce {
 
@@ -479,6 +484,77 @@ void test_data_manager_with_dummy_buffer_updater(
       });
 }
 
+// Steps through all the data in the file and checks that a prefetching updater
+// supplies the same buffers as the updater that it wraps
+template <typename BufferUpdater, typename BufferTags>
+void test_prefetching_buffer_updater(const std::string& filename,
+                                     const double extraction_radius,
+                                     const size_t l_max,
+                                     const size_t interpolator_length,
+                                     const size_t buffer_depth) {
+  Parallel::NodeLock hdf5_lock{};
+  for (const size_t prefetch_depth : {0_st, 1_st, 2_st}) {
+    CAPTURE(prefetch_depth);
+    BufferUpdater expected_updater{filename, extraction_radius};
+    const auto prefetching_updater = serialize_and_deserialize(
+        std::unique_ptr<WorldtubeBufferUpdater<BufferTags>>{
+            std::make_unique<PrefetchingWorldtubeBufferUpdater<BufferTags>>(
+                std::make_unique<BufferUpdater>(filename, extraction_radius),
+                prefetch_depth)});
+    const size_t buffer_size =
+        (buffer_depth + 2 * interpolator_length) * square(l_max + 1);
+    Variables<BufferTags> expected_buffers{buffer_size};
+    Variables<BufferTags> prefetched_buffers{buffer_size};
+    size_t expected_time_span_start = 0;
+    size_t expected_time_span_end = 0;
+    size_t prefetched_time_span_start = 0;
+    size_t prefetched_time_span_end = 0;
+
+    const DataVector& time_buffer = expected_updater.get_time_buffer();
+    CHECK(prefetching_updater->get_time_buffer() == time_buffer);
+    CHECK(prefetching_updater->get_l_max() == expected_updater.get_l_max());
+    const double time_step = 0.37 * (time_buffer[1] - time_buffer[0]);
+    for (double time = time_buffer[0] + 0.11 * time_step;
+         time < time_buffer[time_buffer.size() - 1]; time += time_step) {
+      CAPTURE(time);
+      const double expected_next_time =
+          expected_updater.update_buffers_for_time(
+              make_not_null(&expected_buffers),
+              make_not_null(&expected_time_span_start),
+              make_not_null(&expected_time_span_end), time, l_max,
+              interpolator_length, buffer_depth);
+      const double next_time =
+          prefetching_updater->update_buffers_for_time_with_lock(
+              make_not_null(&prefetched_buffers),
+              make_not_null(&prefetched_time_span_start),
+              make_not_null(&prefetched_time_span_end), time, l_max,
+              interpolator_length, buffer_depth, make_not_null(&hdf5_lock));
+      CHECK(prefetched_time_span_start == expected_time_span_start);
+      CHECK(prefetched_time_span_end == expected_time_span_end);
+      if (std::isnan(expected_next_time)) {
+        CHECK(std::isnan(next_time));
+      } else {
+        CHECK(next_time == expected_next_time);
+      }
+      CHECK(prefetched_buffers == expected_buffers);
+    }
+
+    const auto& prefetching_updater_ref =
+        dynamic_cast<const PrefetchingWorldtubeBufferUpdater<BufferTags>&>(
+            *prefetching_updater);
+    CHECK(prefetching_updater_ref.prefetch_depth() == prefetch_depth);
+    CHECK(prefetching_updater_ref.stall_time() >= 0.0);
+    if (prefetch_depth == 0) {
+      CHECK(prefetching_updater_ref.number_of_prefetched_windows() == 0);
+      CHECK(prefetching_updater_ref.number_of_synchronous_reads() > 1);
+    } else {
+      // Only the first window is read synchronously
+      CHECK(prefetching_updater_ref.number_of_prefetched_windows() > 0);
+      CHECK(prefetching_updater_ref.number_of_synchronous_reads() == 1);
+    }
+  }
+}
+
 template <typename Generator>
 void test_spec_worldtube_buffer_updater(
     const gsl::not_null<Generator*> gen,
@@ -540,6 +616,9 @@ void test_spec_worldtube_buffer_updater(
       make_not_null(&time_span_start_from_serialized),
       make_not_null(&time_span_end_from_serialized), target_time, l_max,
       interpolator_length, buffer_size);
+  test_prefetching_buffer_updater<MetricWorldtubeH5BufferUpdater,
+                                  cce_metric_input_tags>(
+      filename, extraction_radius, l_max, interpolator_length, buffer_size);
 
   if (file_system::check_if_file_exists(filename)) {
     file_system::rm(filename, true);
@@ -726,6 +805,10 @@ void test_reduced_spec_worldtube_buffer_updater(
       make_not_null(&time_span_start_from_serialized),
       make_not_null(&time_span_end_from_serialized), target_time,
       computation_l_max, interpolator_length, buffer_size);
+  test_prefetching_buffer_updater<BondiWorldtubeH5BufferUpdater,
+                                  cce_bondi_input_tags>(
+      filename, extraction_radius, computation_l_max, interpolator_length,
+      buffer_size);
 
   if (file_system::check_if_file_exists(filename)) {
     file_system::rm(filename, true);
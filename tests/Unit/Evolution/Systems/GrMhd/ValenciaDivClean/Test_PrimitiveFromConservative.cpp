@@ -6,7 +6,9 @@
 #include <cmath>
 #include <cstddef>
 #include <limits>
+#include <optional>
 #include <random>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
@@ -16,7 +18,9 @@
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/NewmanHamlin.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
 #include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Helpers/PointwiseFunctions/GeneralRelativity/TestHelpers.hpp"
 #include "Helpers/PointwiseFunctions/Hydro/TestHelpers.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
@@ -244,6 +248,89 @@ void test_primitive_from_conservative_known(const DataVector& used_for_size) {
                         divergence_cleaning_field);
 }
 
+
+// The batched recovery must agree with the pointwise recovery at every point,
+// including the points where it fails
+template <size_t ThermodynamicDim>
+void test_batched_newman_hamlin(
+    const gsl::not_null<std::mt19937*> generator,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state) {
+  using grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin;
+  using grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::
+      PrimitiveRecoveryData;
+  const size_t number_of_points = 50;
+  auto total_energy_density = make_with_random_values<DataVector>(
+      generator, std::uniform_real_distribution<>(1.0, 10.0),
+      number_of_points);
+  // Small enough that the minimum pressure bound is never active
+  auto magnetic_field_squared = make_with_random_values<DataVector>(
+      generator, std::uniform_real_distribution<>(0.0, 0.1), number_of_points);
+  const auto rest_mass_density_times_lorentz_factor =
+      make_with_random_values<DataVector>(
+          generator, std::uniform_real_distribution<>(0.1, 1.0),
+          number_of_points);
+  const auto electron_fraction = make_with_random_values<DataVector>(
+      generator, std::uniform_real_distribution<>(0.0, 0.5), number_of_points);
+  DataVector momentum_density_squared =
+      square(total_energy_density) *
+      make_with_random_values<DataVector>(
+          generator, std::uniform_real_distribution<>(0.0, 1.0),
+          number_of_points);
+  DataVector momentum_density_dot_magnetic_field =
+      sqrt(momentum_density_squared * magnetic_field_squared) *
+      make_with_random_values<DataVector>(
+          generator, std::uniform_real_distribution<>(-1.0, 1.0),
+          number_of_points);
+  const DataVector initial_guess_for_pressure(number_of_points, 0.0);
+  // Points where the recovery is known to fail: no positive root of the cubic,
+  // and inconsistent magnetic field and momentum density
+  total_energy_density[3] = -1.0;
+  magnetic_field_squared[3] = 0.0;
+  momentum_density_squared[3] = 0.0;
+  momentum_density_dot_magnetic_field[3] = 0.0;
+  momentum_density_dot_magnetic_field[7] =
+      2.0 * sqrt(momentum_density_squared[7] * magnetic_field_squared[7]) +
+      1.0;
+
+  std::vector<std::optional<PrimitiveRecoveryData>> batched_primitive_data(
+      number_of_points);
+  NewmanHamlin::apply<ThermodynamicDim>(
+      make_not_null(&batched_primitive_data), initial_guess_for_pressure,
+      total_energy_density, momentum_density_squared,
+      momentum_density_dot_magnetic_field, magnetic_field_squared,
+      rest_mass_density_times_lorentz_factor, electron_fraction,
+      equation_of_state);
+  size_t number_of_recovered_points = 0;
+  for (size_t s = 0; s < number_of_points; ++s) {
+    CAPTURE(s);
+    const std::optional<PrimitiveRecoveryData> primitive_data =
+        NewmanHamlin::apply<ThermodynamicDim>(
+            initial_guess_for_pressure[s], total_energy_density[s],
+            momentum_density_squared[s],
+            momentum_density_dot_magnetic_field[s], magnetic_field_squared[s],
+            rest_mass_density_times_lorentz_factor[s], electron_fraction[s],
+            equation_of_state);
+    REQUIRE(batched_primitive_data[s].has_value() ==
+            primitive_data.has_value());
+    if (primitive_data.has_value()) {
+      ++number_of_recovered_points;
+      CHECK(batched_primitive_data[s]->rest_mass_density ==
+            approx(primitive_data->rest_mass_density));
+      CHECK(batched_primitive_data[s]->lorentz_factor ==
+            approx(primitive_data->lorentz_factor));
+      CHECK(batched_primitive_data[s]->pressure ==
+            approx(primitive_data->pressure));
+      CHECK(batched_primitive_data[s]->rho_h_w_squared ==
+            approx(primitive_data->rho_h_w_squared));
+      CHECK(batched_primitive_data[s]->electron_fraction ==
+            primitive_data->electron_fraction);
+    }
+  }
+  CHECK_FALSE(batched_primitive_data[3].has_value());
+  CHECK_FALSE(batched_primitive_data[7].has_value());
+  CHECK(number_of_recovered_points > 0);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveFromConservative",
@@ -283,4 +370,19 @@ SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveFromConservative",
       tmpl::list<
           grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::KastaunEtAl>,
       2>(&generator, ideal_fluid, dv);
+  test_primitive_from_conservative_random<
+      tmpl::list<
+          grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin,
+          grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl>,
+      1>(&generator, polytropic_fluid, dv);
+  test_primitive_from_conservative_random<
+      tmpl::list<
+          grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::KastaunEtAl,
+          grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin,
+          grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl>,
+      2>(&generator, ideal_fluid, dv);
+  // A softer polytrope than above, so most of the random points are physical
+  EquationsOfState::PolytropicFluid<true> soft_polytropic_fluid(1.0, 2.0);
+  test_batched_newman_hamlin(make_not_null(&generator), soft_polytropic_fluid);
+  test_batched_newman_hamlin(make_not_null(&generator), ideal_fluid);
 }
@@ -88,6 +88,7 @@ using init_simple_tags =
                control_system::Tags::ControlError<ControlSystem>,
                control_system::Tags::IsActive<ControlSystem>,
                control_system::Tags::CurrentNumberOfMeasurements,
+               control_system::Tags::WrittenHistoryTime,
                typename ControlSystem::MeasurementQueue>;
 
 class FakeCreator : public DomainCreator<3> {
@@ -205,6 +206,7 @@ struct MockControlComponent {
   using const_global_cache_tags =
       tmpl::list<control_system::Tags::MeasurementsPerUpdate,
                  control_system::Tags::WriteDataToDisk,
+                 control_system::Tags::FunctionOfTimeRetention,
                  domain::Tags::ExcisionCenter<domain::ObjectLabel::A>,
                  domain::Tags::ExcisionCenter<domain::ObjectLabel::B>>;
 
@@ -766,6 +768,7 @@ struct SystemHelper {
       init_simple_tags<System>,
       tmpl::list<typename System::MeasurementQueue,
                  control_system::Tags::CurrentNumberOfMeasurements,
+                 control_system::Tags::WrittenHistoryTime,
                  control_system::Tags::MeasurementsPerUpdate>>;
 
   void parse_options(const std::string& option_string) {
@@ -797,7 +800,7 @@ struct SystemHelper {
               get<control_system::Tags::TimescaleTuner<system>>(created_tags),
               get<control_system::Tags::Controller<system>>(created_tags),
               get<control_system::Tags::ControlError<system>>(created_tags),
-              true, 0,
+              true, 0, std::nullopt,
               // Just need an empty queue. It will get filled in as the control
               // system is updated
               LinkedMessageQueue<
@@ -1008,7 +1008,8 @@ double dg_package_data(
 template <bool LocalTimeStepping, bool UseMovingMesh, size_t Dim,
           SystemType system_type, bool HasPrims, bool PassVariables>
 void test_impl(const Spectral::Quadrature quadrature,
-               const ::dg::Formulation dg_formulation) {
+               const ::dg::Formulation dg_formulation,
+               const bool send_boundary_data_early) {
   CAPTURE(LocalTimeStepping);
   CAPTURE(UseMovingMesh);
   CAPTURE(Dim);
@@ -1017,6 +1018,7 @@ void test_impl(const Spectral::Quadrature quadrature,
   CAPTURE(PassVariables);
   CAPTURE(quadrature);
   CAPTURE(dg_formulation);
+  CAPTURE(send_boundary_data_early);
   using metavars = Metavariables<Dim, system_type, LocalTimeStepping,
                                  UseMovingMesh, HasPrims, PassVariables>;
   Parallel::register_classes_with_charm<TimeSteppers::AdamsBashforth>();
@@ -1082,7 +1084,8 @@ void test_impl(const Spectral::Quadrature quadrature,
 
   const Element<Dim> element{self_id, neighbors};
   MockRuntimeSystem runner = [&dg_formulation, &element,
-                              &grid_to_inertial_map]() {
+                              &grid_to_inertial_map,
+                              &send_boundary_data_early]() {
     std::vector<DirectionMap<
         Dim, std::unique_ptr<domain::BoundaryConditions::BoundaryCondition>>>
         boundary_conditions{2};
@@ -1140,7 +1143,7 @@ void test_impl(const Spectral::Quadrature quadrature,
          typename metavars::normal_dot_numerical_flux::type{},
          std::move(domain), dg_formulation,
          std::make_unique<BoundaryTerms<Dim, HasPrims>>(),
-         std::move(boundary_conditions)}};
+         std::move(boundary_conditions), send_boundary_data_early}};
   }();
   const auto get_tag = [&runner, &self_id](auto tag_v) -> decltype(auto) {
     using tag = std::decay_t<decltype(tag_v)>;
@@ -1992,11 +1995,14 @@ void test() {
 
   const auto invoke_tests_with_quadrature_and_formulation =
       [](const Spectral::Quadrature quadrature,
-         const ::dg::Formulation local_dg_formulation) {
-        const auto moving_mesh_helper = [&local_dg_formulation,
-                                         &quadrature](auto moving_mesh) {
+         const ::dg::Formulation local_dg_formulation,
+         const bool send_boundary_data_early) {
+        const auto moving_mesh_helper = [&local_dg_formulation, &quadrature,
+                                         &send_boundary_data_early](
+                                            auto moving_mesh) {
           const auto prim_helper = [&local_dg_formulation, &moving_mesh,
-                                    &quadrature](auto use_prims) {
+                                    &quadrature, &send_boundary_data_early](
+                                       auto use_prims) {
             // Clang doesn't want moving mesh to be captured, but GCC requires
             // it. Silence the Clang warning by "using" it.
             (void)moving_mesh;
@@ -2005,18 +2011,22 @@ void test() {
               // PassVariables == false
               test_impl<false, std::decay_t<decltype(moving_mesh)>::value, Dim,
                         system_type, std::decay_t<decltype(use_prims)>::value,
-                        false>(quadrature, local_dg_formulation);
+                        false>(quadrature, local_dg_formulation,
+                               send_boundary_data_early);
               test_impl<true, std::decay_t<decltype(moving_mesh)>::value, Dim,
                         system_type, std::decay_t<decltype(use_prims)>::value,
-                        false>(quadrature, local_dg_formulation);
+                        false>(quadrature, local_dg_formulation,
+                               send_boundary_data_early);
 
               // PassVariables == true
               test_impl<false, std::decay_t<decltype(moving_mesh)>::value, Dim,
                         system_type, std::decay_t<decltype(use_prims)>::value,
-                        true>(quadrature, local_dg_formulation);
+                        true>(quadrature, local_dg_formulation,
+                              send_boundary_data_early);
               test_impl<true, std::decay_t<decltype(moving_mesh)>::value, Dim,
                         system_type, std::decay_t<decltype(use_prims)>::value,
-                        true>(quadrature, local_dg_formulation);
+                        true>(quadrature, local_dg_formulation,
+                              send_boundary_data_early);
             }
           };
           prim_helper(std::integral_constant<bool, false>{});
@@ -2027,10 +2037,14 @@ void test() {
       };
   for (const auto dg_formulation :
        {::dg::Formulation::StrongInertial, ::dg::Formulation::WeakInertial}) {
-    invoke_tests_with_quadrature_and_formulation(
-        Spectral::Quadrature::GaussLobatto, dg_formulation);
-    invoke_tests_with_quadrature_and_formulation(Spectral::Quadrature::Gauss,
-                                                 dg_formulation);
+    for (const bool send_boundary_data_early : {false, true}) {
+      invoke_tests_with_quadrature_and_formulation(
+          Spectral::Quadrature::GaussLobatto, dg_formulation,
+          send_boundary_data_early);
+      invoke_tests_with_quadrature_and_formulation(
+          Spectral::Quadrature::Gauss, dg_formulation,
+          send_boundary_data_early);
+    }
   }
 }
 }  // namespace TestHelpers::evolution::dg::Actions
@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include <cstddef>
+#include <string>
+#include <vector>
+
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "Framework/ActionTesting.hpp"
@@ -78,6 +82,44 @@ struct MockWriteReductionDataRow {
   }
 };
 
+/*!
+ * \brief Action meant to mock WriteReductionDataRows.
+ *
+ * \details Appends each row to its subfile of the MockReductionFileTag, like
+ * MockWriteReductionDataRow does for a single row.
+ */
+struct MockWriteReductionDataRows {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(::db::DataBox<DbTagsList>& box,
+                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> /*node_lock*/,
+                    const std::vector<std::string>& subfile_names,
+                    const std::vector<std::string>& legend,
+                    std::vector<std::vector<double>>&& rows) {
+    if constexpr (::db::tag_is_retrievable_v<MockReductionFileTag,
+                                             ::db::DataBox<DbTagsList>>) {
+      ::db::mutate<MockReductionFileTag>(
+          make_not_null(&box),
+          [&subfile_names, &legend,
+           &rows](const gsl::not_null<MockH5File*> mock_h5_file) {
+            for (size_t i = 0; i < subfile_names.size(); ++i) {
+              (*mock_h5_file).try_insert(subfile_names[i]).append(legend,
+                                                                   rows[i]);
+            }
+          });
+    } else {
+      (void)subfile_names;
+      (void)legend;
+      (void)rows;
+      ERROR(
+          "Wrong DataBox. Cannot retrieve the MockReductionFileTag. Expecting "
+          "DataBox for MockObserverWriter.");
+    }
+  }
+};
+
 /*!
  * \brief Component that mocks the ObserverWriter.
  *
@@ -86,8 +128,9 @@ struct MockWriteReductionDataRow {
  *
  * \snippet Test_MockWriteReductionDataRow.cpp initialize_component
  *
- * This component replaces the WriteReductionDataRow threaded action with the
- * MockWriteReductionDataRow threaded action.
+ * This component replaces the WriteReductionDataRow and WriteReductionDataRows
+ * threaded actions with the MockWriteReductionDataRow and
+ * MockWriteReductionDataRows threaded actions.
  */
 template <typename Metavariables>
 struct MockObserverWriter {
@@ -101,7 +144,9 @@ struct MockObserverWriter {
   using component_being_mocked = ::observers::ObserverWriter<Metavariables>;
 
   using replace_these_threaded_actions =
-      tmpl::list<::observers::ThreadedActions::WriteReductionDataRow>;
-  using with_these_threaded_actions = tmpl::list<MockWriteReductionDataRow>;
+      tmpl::list<::observers::ThreadedActions::WriteReductionDataRow,
+                 ::observers::ThreadedActions::WriteReductionDataRows>;
+  using with_these_threaded_actions =
+      tmpl::list<MockWriteReductionDataRow, MockWriteReductionDataRows>;
 };
 }  // namespace TestHelpers::observers
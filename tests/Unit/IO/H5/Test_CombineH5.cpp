@@ -0,0 +1,145 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/CombineH5.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/TensorData.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/FileSystem.hpp"
+
+namespace {
+const std::vector<size_t> observation_ids{2345, 3456, 4567};
+const std::vector<double> observation_values{1.0, 2.0, 3.0};
+
+// The data of grid `grid` in file `file` at observation `observation`
+template <typename DataType>
+DataType grid_data(const size_t file, const size_t grid,
+                   const size_t observation, const double offset) {
+  DataType data(2);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<typename DataType::value_type>(
+        offset + 100.0 * static_cast<double>(file) +
+        10.0 * static_cast<double>(grid) + static_cast<double>(observation) +
+        0.5 * static_cast<double>(i));
+  }
+  return data;
+}
+
+// Each file holds `file + 1` grids
+template <typename DataType>
+void setup_test_files(const std::vector<std::string>& h5_file_names) {
+  const std::vector<Spectral::Basis> bases{Spectral::Basis::Legendre};
+  const std::vector<Spectral::Quadrature> quadratures{
+      Spectral::Quadrature::Gauss};
+  const std::vector<size_t> extents{2};
+  for (size_t file = 0; file < h5_file_names.size(); ++file) {
+    if (file_system::check_if_file_exists(h5_file_names[file])) {
+      file_system::rm(h5_file_names[file], true);
+    }
+    h5::H5File<h5::AccessType::ReadWrite> h5_file{h5_file_names[file]};
+    auto& volume_file = h5_file.insert<h5::VolumeData>("/element_data", 4);
+    for (size_t observation = 0; observation < observation_ids.size();
+         ++observation) {
+      std::vector<ElementVolumeData> elements{};
+      for (size_t grid = 0; grid < file + 1; ++grid) {
+        elements.emplace_back(
+            "Grid" + std::to_string(file) + std::to_string(grid),
+            std::vector<TensorComponent>{
+                {"InertialCoordinates_1D",
+                 grid_data<DataType>(file, grid, observation, 0.0)},
+                {"TestScalar",
+                 grid_data<DataType>(file, grid, observation, -1000.0)}},
+            extents, bases, quadratures);
+      }
+      volume_file.write_volume_data(observation_ids[observation],
+                                    observation_values[observation], elements);
+    }
+    h5_file.close_current_object();
+  }
+}
+
+template <typename DataType>
+void test_combine_h5_vol() {
+  const std::vector<std::string> h5_file_names{"Unit.IO.H5.CombineH5_0.h5",
+                                               "Unit.IO.H5.CombineH5_1.h5"};
+  const std::string output_file_name{"Unit.IO.H5.CombineH5Output.h5"};
+  setup_test_files<DataType>(h5_file_names);
+
+  const auto check_combined_file =
+      [&output_file_name](const std::vector<size_t>& expected_observations,
+                          const std::vector<std::string>& expected_components) {
+        const h5::H5File<h5::AccessType::ReadOnly> combined_file{
+            output_file_name};
+        const auto& volume_file =
+            combined_file.get<h5::VolumeData>("/element_data");
+        CHECK(volume_file.get_version() == 4);
+        const std::vector<size_t> combined_observation_ids =
+            volume_file.list_observation_ids();
+        REQUIRE(combined_observation_ids.size() ==
+                expected_observations.size());
+        for (size_t i = 0; i < expected_observations.size(); ++i) {
+          const size_t observation = expected_observations[i];
+          const size_t observation_id = observation_ids[observation];
+          CHECK(combined_observation_ids[i] == observation_id);
+          CHECK(volume_file.get_observation_value(observation_id) ==
+                observation_values[observation]);
+          CHECK(volume_file.get_grid_names(observation_id) ==
+                std::vector<std::string>{"Grid00", "Grid10", "Grid11"});
+          CHECK(volume_file.get_extents(observation_id) ==
+                std::vector<std::vector<size_t>>(3, {2}));
+          CHECK(volume_file.list_tensor_components(observation_id) ==
+                expected_components);
+          std::vector<typename DataType::value_type> expected_scalar{};
+          for (const auto& [file, grid] :
+               std::vector<std::pair<size_t, size_t>>{{0, 0}, {1, 0}, {1, 1}}) {
+            const auto data =
+                grid_data<DataType>(file, grid, observation, -1000.0);
+            expected_scalar.insert(expected_scalar.end(), data.begin(),
+                                   data.end());
+          }
+          const TensorComponent scalar =
+              volume_file.get_tensor_component(observation_id, "TestScalar");
+          REQUIRE(std::holds_alternative<DataType>(scalar.data));
+          const auto& scalar_data = std::get<DataType>(scalar.data);
+          CHECK(std::vector<typename DataType::value_type>(
+                    scalar_data.begin(), scalar_data.end()) ==
+                expected_scalar);
+        }
+      };
+
+  h5::combine_h5_vol(h5_file_names, "element_data", output_file_name);
+  check_combined_file({0, 1, 2}, {"InertialCoordinates_1D", "TestScalar"});
+  file_system::rm(output_file_name, true);
+
+  h5::combine_h5_vol(h5_file_names, "element_data", output_file_name, 1.5,
+                     std::nullopt, {{"TestScalar"}});
+  check_combined_file({1, 2}, {"TestScalar"});
+  file_system::rm(output_file_name, true);
+
+  h5::combine_h5_vol(h5_file_names, "element_data", output_file_name, 1.5,
+                     2.5);
+  check_combined_file({1}, {"InertialCoordinates_1D", "TestScalar"});
+  file_system::rm(output_file_name, true);
+
+  for (const auto& file_name : h5_file_names) {
+    file_system::rm(file_name, true);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.H5.CombineH5", "[Unit][IO][H5]") {
+  test_combine_h5_vol<DataVector>();
+  test_combine_h5_vol<std::vector<float>>();
+}
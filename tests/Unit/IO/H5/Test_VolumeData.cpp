@@ -3,6 +3,7 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -26,6 +27,7 @@
 #include "NumericalAlgorithms/SphericalHarmonics/YlmSpherepack.hpp"
 #include "Parallel/Serialize.hpp"
 #include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace {
 void test_strahlkorper() {
@@ -85,6 +87,23 @@ void test_strahlkorper() {
     CHECK(read_observation_ids == std::vector<size_t>{4444});
     CHECK(volume_file_read.get_observation_value(observation_ids[0]) ==
           observation_values[0]);
+
+    // The bounding box of the grid points lies within the bounding box of the
+    // sphere
+    const auto bounding_boxes =
+        volume_file_read.get_bounding_boxes(observation_ids[0]);
+    REQUIRE(bounding_boxes.has_value());
+    REQUIRE(bounding_boxes->size() == 1);
+    REQUIRE(bounding_boxes->front().size() == 3);
+    for (size_t d = 0; d < 3; ++d) {
+      const auto& [lower, upper] = bounding_boxes->front()[d];
+      CHECK(lower == *std::min_element(tensor_and_coord_data[d].begin(),
+                                       tensor_and_coord_data[d].end()));
+      CHECK(upper == *std::max_element(tensor_and_coord_data[d].begin(),
+                                       tensor_and_coord_data[d].end()));
+      CHECK(lower > gsl::at(center, d) - sphere_radius);
+      CHECK(upper < gsl::at(center, d) + sphere_radius);
+    }
   }
 
   TestHelpers::io::VolumeData::check_volume_data(
@@ -256,6 +275,39 @@ void test() {
           extra_tensor_component);
   }
 
+  {
+    INFO("Partial reads");
+    const size_t observation_id = observation_ids.front();
+    const double observation_value = observation_values.front();
+    // Read the last point of the first grid and the first three points of the
+    // second grid
+    const auto partial_data = get<DataType>(
+        volume_file.get_tensor_component(observation_id, "S", {{7, 1}, {8, 3}})
+            .data);
+    const DataType expected_partial_data{
+        static_cast<typename DataType::value_type>(
+            observation_value * tensor_components_and_coords[0][7]),
+        static_cast<typename DataType::value_type>(
+            observation_value * tensor_components_and_coords[1][0]),
+        static_cast<typename DataType::value_type>(
+            observation_value * tensor_components_and_coords[1][1]),
+        static_cast<typename DataType::value_type>(
+            observation_value * tensor_components_and_coords[1][2])};
+    CHECK(partial_data == expected_partial_data);
+    CHECK(get<DataType>(volume_file
+                            .get_tensor_component(observation_id, "U",
+                                                  {{2, 2}, {10, 1}})
+                            .data) ==
+          DataType{extra_tensor_component[2], extra_tensor_component[3],
+                   extra_tensor_component[10]});
+    CHECK(get<DataType>(
+              volume_file.get_tensor_component(observation_id, "S", {}).data)
+              .size() == 0);
+    // No bounding boxes were written because the inertial coordinates are
+    // missing
+    CHECK_FALSE(volume_file.get_bounding_boxes(observation_id).has_value());
+  }
+
   {
     INFO("offset_and_length_for_grid");
     const size_t observation_id = observation_ids.front();
@@ -4,17 +4,22 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cstddef>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/IdPair.hpp"
 #include "DataStructures/Index.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/ElementLogicalCoordinates.hpp"
+#include "Domain/Structure/BlockId.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
 #include "Framework/ActionTesting.hpp"
@@ -246,10 +251,83 @@ void test_actions(const std::variant<double, importers::ObservationSelector>&
     }
   }
 }
+
+void test_bounding_boxes() {
+  INFO("Bounding boxes");
+  // Two source elements in a single block. The map to inertial coordinates is
+  // the identity, so the block logical coordinates of the target points are
+  // their inertial coordinates.
+  const std::vector<ElementId<1>> source_element_ids{
+      {0, {{{1, 0}}}}, {0, {{{1, 1}}}}};
+  std::vector<std::vector<std::pair<double, double>>> source_bounding_boxes{
+      {{-0.9, -0.1}}, {{0.1, 0.9}}};
+  importers::detail::widen_bounding_boxes(
+      make_not_null(&source_bounding_boxes));
+  CHECK(source_bounding_boxes[0][0].first == approx(-1.3));
+  CHECK(source_bounding_boxes[0][0].second == approx(0.3));
+  const tnsr::I<DataVector, 1> target_points{DataVector{-0.8, -0.6}};
+  CHECK(importers::detail::overlaps_bounding_box(source_bounding_boxes[0],
+                                                 target_points));
+  CHECK_FALSE(importers::detail::overlaps_bounding_box(
+      source_bounding_boxes[1], target_points));
+  const auto block_logical_coords = [](const std::vector<double>& points) {
+    std::vector<std::optional<
+        IdPair<domain::BlockId, tnsr::I<double, 1, Frame::BlockLogical>>>>
+        result{};
+    for (const double point : points) {
+      result.emplace_back(make_id_pair(
+          domain::BlockId{0}, tnsr::I<double, 1, Frame::BlockLogical>{point}));
+    }
+    return result;
+  };
+  const auto check_found_points =
+      [](const std::unordered_map<ElementId<1>, ElementLogicalCoordHolder<1>>&
+             element_logical_coords,
+         const ElementId<1>& element_id, const std::vector<size_t>& offsets) {
+        CAPTURE(element_id);
+        REQUIRE(element_logical_coords.count(element_id) == 1);
+        CHECK(element_logical_coords.at(element_id).offsets == offsets);
+      };
+  {
+    INFO("All points in the candidates");
+    const auto element_logical_coords =
+        importers::detail::element_logical_coordinates_in_bounding_boxes(
+            source_element_ids, source_bounding_boxes, target_points,
+            block_logical_coords({-0.8, -0.6}));
+    CHECK(element_logical_coords.size() == 1);
+    check_found_points(element_logical_coords, source_element_ids[0], {0, 1});
+  }
+  {
+    INFO("Points outside the bounding boxes");
+    // The bounding box of the second element doesn't contain the element,
+    // so its point is only found by searching the other elements
+    const tnsr::I<DataVector, 1> spread_target_points{DataVector{-0.5, 0.95}};
+    const std::vector<std::vector<std::pair<double, double>>>
+        wrong_bounding_boxes{{{-1., 0.}}, {{5., 6.}}};
+    const auto element_logical_coords =
+        importers::detail::element_logical_coordinates_in_bounding_boxes(
+            source_element_ids, wrong_bounding_boxes, spread_target_points,
+            block_logical_coords({-0.5, 0.95}));
+    CHECK(element_logical_coords.size() == 2);
+    check_found_points(element_logical_coords, source_element_ids[0], {0});
+    check_found_points(element_logical_coords, source_element_ids[1], {1});
+  }
+  {
+    INFO("No candidates");
+    const tnsr::I<DataVector, 1> far_target_points{DataVector{10., 11.}};
+    const auto element_logical_coords =
+        importers::detail::element_logical_coordinates_in_bounding_boxes(
+            source_element_ids, source_bounding_boxes, far_target_points,
+            block_logical_coords({0.3, 0.6}));
+    CHECK(element_logical_coords.size() == 1);
+    check_found_points(element_logical_coords, source_element_ids[1], {0, 1});
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.IO.Importers.VolumeDataReaderActions", "[Unit][IO]") {
   test_actions(0.);
   test_actions(importers::ObservationSelector::First);
   test_actions(importers::ObservationSelector::Last);
+  test_bounding_boxes();
 }
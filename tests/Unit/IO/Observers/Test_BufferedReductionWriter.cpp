@@ -0,0 +1,166 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "DataStructures/Matrix.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/Observer/BufferedReductionWriter.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+const std::vector<std::string> legend{"Time", "Value"};
+
+size_t number_of_written_rows(const std::string& file_name,
+                              const std::string& subfile_name) {
+  if (not file_system::check_if_file_exists(file_name)) {
+    return 0;
+  }
+  const h5::H5File<h5::AccessType::ReadOnly> file{file_name};
+  if (not file.exists<h5::Dat>(subfile_name)) {
+    return 0;
+  }
+  return static_cast<size_t>(
+      file.get<h5::Dat>(subfile_name).get_dimensions()[0]);
+}
+
+void check_written_rows(const std::string& file_name,
+                        const std::string& subfile_name,
+                        const std::vector<double>& expected_times) {
+  const h5::H5File<h5::AccessType::ReadOnly> file{file_name};
+  const auto& dat = file.get<h5::Dat>(subfile_name);
+  CHECK(dat.get_legend() == legend);
+  const Matrix data = dat.get_data();
+  REQUIRE(data.rows() == expected_times.size());
+  for (size_t i = 0; i < expected_times.size(); ++i) {
+    CHECK(data(i, 0) == expected_times[i]);
+    CHECK(data(i, 1) == 2. * expected_times[i]);
+  }
+}
+
+void test_write_through(const std::string& file_name) {
+  INFO("Write through");
+  Parallel::NodeLock h5_file_lock{};
+  observers::BufferedReductionWriter writer{};
+  CHECK(writer.max_buffered_rows() == 0);
+  for (size_t i = 0; i < 3; ++i) {
+    const double time = static_cast<double>(i);
+    writer.append(file_name, "/Norms", "", legend, {time, 2. * time},
+                  make_not_null(&h5_file_lock));
+    CHECK(writer.number_of_buffered_rows() == 0);
+    CHECK(writer.number_of_writes() == i + 1);
+    CHECK(number_of_written_rows(file_name, "/Norms") == i + 1);
+  }
+  check_written_rows(file_name, "/Norms", {0., 1., 2.});
+
+  // Rows for several subfiles are written at once
+  const std::vector<std::string> subfile_names{"/Norms", "/TimeSteps"};
+  writer.append(file_name, subfile_names, "", legend,
+                std::vector<std::vector<double>>{{3., 6.}, {0.5, 1.}},
+                make_not_null(&h5_file_lock));
+  CHECK(writer.number_of_buffered_rows() == 0);
+  CHECK(writer.number_of_writes() == 4);
+  check_written_rows(file_name, "/Norms", {0., 1., 2., 3.});
+  check_written_rows(file_name, "/TimeSteps", {0.5});
+}
+
+void test_buffered(const std::string& file_name) {
+  INFO("Buffered");
+  Parallel::NodeLock h5_file_lock{};
+  // Use a flush interval that is never reached in the test
+  observers::BufferedReductionWriter writer{4, 1.0e6};
+  CHECK(writer.max_buffered_rows() == 4);
+  CHECK(writer.flush_interval() == 1.0e6);
+  const auto append = [&file_name, &h5_file_lock, &writer](
+                          const std::string& subfile_name, const double time) {
+    writer.append(file_name, subfile_name, "", legend, {time, 2. * time},
+                  make_not_null(&h5_file_lock));
+  };
+  append("/Norms", 0.);
+  append("/TimeSteps", 0.5);
+  append("/Norms", 1.);
+  CHECK(writer.number_of_buffered_rows() == 3);
+  CHECK(writer.number_of_writes() == 0);
+  CHECK_FALSE(file_system::check_if_file_exists(file_name));
+
+  // Serializing keeps the buffered rows
+  auto deserialized_writer = serialize_and_deserialize(writer);
+  CHECK(deserialized_writer.max_buffered_rows() == 4);
+  CHECK(deserialized_writer.number_of_buffered_rows() == 3);
+
+  // The fourth row starts a write in the background
+  append("/Norms", 2.);
+  CHECK(writer.number_of_buffered_rows() == 0);
+  CHECK(writer.number_of_writes() == 1);
+  append("/Norms", 3.);
+  CHECK(writer.number_of_buffered_rows() == 1);
+  writer.flush(make_not_null(&h5_file_lock));
+  CHECK(writer.number_of_buffered_rows() == 0);
+  CHECK(writer.number_of_writes() == 2);
+  check_written_rows(file_name, "/Norms", {0., 1., 2., 3.});
+  check_written_rows(file_name, "/TimeSteps", {0.5});
+
+  // Rows for several subfiles are buffered like single rows
+  const std::vector<std::string> subfile_names{"/Norms", "/TimeSteps"};
+  writer.append(file_name, subfile_names, "", legend,
+                std::vector<std::vector<double>>{{4., 8.}, {1.5, 3.}},
+                make_not_null(&h5_file_lock));
+  CHECK(writer.number_of_buffered_rows() == 2);
+  CHECK(writer.number_of_writes() == 2);
+  writer.flush(make_not_null(&h5_file_lock));
+  CHECK(writer.number_of_writes() == 3);
+  check_written_rows(file_name, "/Norms", {0., 1., 2., 3., 4.});
+  check_written_rows(file_name, "/TimeSteps", {0.5, 1.5});
+
+  // Flushing without buffered rows does nothing
+  writer.flush(make_not_null(&h5_file_lock));
+  CHECK(writer.number_of_writes() == 3);
+
+  // The deserialized writer still writes its buffered rows
+  file_system::rm(file_name, true);
+  deserialized_writer.flush(make_not_null(&h5_file_lock));
+  CHECK(deserialized_writer.number_of_writes() == 1);
+  check_written_rows(file_name, "/Norms", {0., 1.});
+  check_written_rows(file_name, "/TimeSteps", {0.5});
+}
+
+void test_flush_interval(const std::string& file_name) {
+  INFO("Flush interval");
+  Parallel::NodeLock h5_file_lock{};
+  // Every row is older than a zero flush interval when the next row arrives
+  observers::BufferedReductionWriter writer{100, 0.};
+  writer.append(file_name, "/Norms", "", legend, {0., 0.},
+                make_not_null(&h5_file_lock));
+  CHECK(writer.number_of_buffered_rows() == 0);
+  CHECK(writer.number_of_writes() == 1);
+  writer.flush(make_not_null(&h5_file_lock));
+  check_written_rows(file_name, "/Norms", {0.});
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.BufferedReductionWriter",
+                  "[Unit][Observers]") {
+  const std::string file_name =
+      "./Unit.IO.Observers.BufferedReductionWriter.h5";
+  const auto remove_file = [&file_name]() {
+    if (file_system::check_if_file_exists(file_name)) {
+      file_system::rm(file_name, true);
+    }
+  };
+  remove_file();
+  test_write_through(file_name);
+  remove_file();
+  test_buffered(file_name);
+  remove_file();
+  test_flush_interval(file_name);
+  remove_file();
+}
@@ -79,6 +79,10 @@ void test() {
   TestHelpers::fd::reconstruction::test_with_python(
       Index<Dim>{4}, 3, "MonotonisedCentral", "test_monotonised_central",
       recons, recons_neighbor_data);
+  // More stripes than fill whole blocks of vectorized stripes
+  TestHelpers::fd::reconstruction::test_with_python(
+      Index<Dim>{5}, 3, "MonotonisedCentral", "test_monotonised_central",
+      recons, recons_neighbor_data);
   if constexpr (Dim == 1) {
     TestHelpers::fd::reconstruction::test_positivity_with_roundoff(3, recons);
   }
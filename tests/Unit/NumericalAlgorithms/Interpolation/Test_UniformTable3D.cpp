@@ -0,0 +1,122 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "NumericalAlgorithms/Interpolation/UniformTable3D.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// Reproduced exactly by trilinear interpolation
+double trilinear_function(const double x0, const double x1, const double x2) {
+  return 1.0 + 2.0 * x0 - 0.5 * x1 + 3.0 * x2 + 0.25 * x0 * x1 * x2;
+}
+
+// Increases monotonically with x0, but is not trilinear
+double monotonic_function(const double x0, const double x1, const double x2) {
+  return exp(0.7 * x0) * (1.0 + 0.3 * square(x1)) + x2 +
+         0.5 * cube(x0) / (1.0 + square(x1));
+}
+
+intrp::UniformTable3D<2> make_table(const std::array<double, 3>& lower_bounds,
+                                    const std::array<double, 3>& upper_bounds,
+                                    const Index<3>& extents) {
+  std::vector<double> table_data(2 * extents.product());
+  for (size_t k = 0; k < extents[2]; ++k) {
+    for (size_t j = 0; j < extents[1]; ++j) {
+      for (size_t i = 0; i < extents[0]; ++i) {
+        const std::array<size_t, 3> node_index{{i, j, k}};
+        std::array<double, 3> x{};
+        for (size_t d = 0; d < 3; ++d) {
+          gsl::at(x, d) =
+              gsl::at(lower_bounds, d) +
+              static_cast<double>(gsl::at(node_index, d)) *
+                  (gsl::at(upper_bounds, d) - gsl::at(lower_bounds, d)) /
+                  static_cast<double>(extents[d] - 1);
+        }
+        const size_t node = i + extents[0] * (j + extents[1] * k);
+        table_data[2 * node] = trilinear_function(x[0], x[1], x[2]);
+        table_data[2 * node + 1] = monotonic_function(x[0], x[1], x[2]);
+      }
+    }
+  }
+  return {lower_bounds, upper_bounds, extents, std::move(table_data), 1};
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Numerical.Interpolation.UniformTable3D",
+                  "[Unit][NumericalAlgorithms]") {
+  MAKE_GENERATOR(generator);
+  const std::array<double, 3> lower_bounds{{-2.0, -1.0, 0.05}};
+  const std::array<double, 3> upper_bounds{{3.0, 2.0, 0.5}};
+  const Index<3> extents{17, 9, 5};
+  const auto table = make_table(lower_bounds, upper_bounds, extents);
+  CHECK(table.extents() == extents);
+  for (size_t d = 0; d < 3; ++d) {
+    CHECK(table.lower_bound(d) == gsl::at(lower_bounds, d));
+    CHECK(table.upper_bound(d) == gsl::at(upper_bounds, d));
+  }
+
+  const size_t number_of_points = 1000;
+  std::array<DataVector, 3> x{};
+  for (size_t d = 0; d < 3; ++d) {
+    gsl::at(x, d) = make_with_random_values<DataVector>(
+        make_not_null(&generator),
+        std::uniform_real_distribution<>(gsl::at(lower_bounds, d),
+                                         gsl::at(upper_bounds, d)),
+        number_of_points);
+  }
+
+  DataVector interpolated_trilinear{};
+  table.interpolate<0>(make_not_null(&interpolated_trilinear), x[0], x[1],
+                       x[2]);
+  DataVector interpolated_monotonic{};
+  table.interpolate<1>(make_not_null(&interpolated_monotonic), x[0], x[1],
+                       x[2]);
+  DataVector inverted{};
+  table.invert_first_coordinate(make_not_null(&inverted),
+                                interpolated_monotonic, x[1], x[2]);
+  for (size_t s = 0; s < number_of_points; ++s) {
+    CAPTURE(s);
+    CHECK(interpolated_trilinear[s] ==
+          approx(trilinear_function(x[0][s], x[1][s], x[2][s])));
+    const auto location = table.locate(x[0][s], x[1][s], x[2][s]);
+    const auto both_variables = table.interpolate<0, 1>(location);
+    CHECK(both_variables[0] == interpolated_trilinear[s]);
+    CHECK(both_variables[1] == interpolated_monotonic[s]);
+    // The inversion is exact for the interpolated variable
+    CHECK(inverted[s] == approx(x[0][s]));
+    CHECK(table.invert_first_coordinate(interpolated_monotonic[s], x[1][s],
+                                        x[2][s]) == inverted[s]);
+  }
+
+  // Nodes and the corners of the table
+  CHECK(table.interpolate<0>(table.locate(3.0, 2.0, 0.5))[0] ==
+        approx(trilinear_function(3.0, 2.0, 0.5)));
+  CHECK(table.interpolate<0>(table.locate(-2.0, -1.0, 0.05))[0] ==
+        approx(trilinear_function(-2.0, -1.0, 0.05)));
+  CHECK(table.invert_first_coordinate(monotonic_function(0.5, 0.5, 0.275),
+                                      0.5, 0.275) == approx(0.5));
+  // Values outside the column are clamped to the table bounds
+  CHECK(table.invert_first_coordinate(-1.e10, 0.3, 0.2) == -2.0);
+  CHECK(table.invert_first_coordinate(1.e10, 0.3, 0.2) == 3.0);
+
+  const auto deserialized_table = serialize_and_deserialize(table);
+  CHECK(deserialized_table == table);
+  CHECK(deserialized_table.invert_first_coordinate(interpolated_monotonic[0],
+                                                   x[1][0], x[2][0]) ==
+        inverted[0]);
+  CHECK(table != make_table(lower_bounds, {{3.0, 2.0, 0.6}}, extents));
+}
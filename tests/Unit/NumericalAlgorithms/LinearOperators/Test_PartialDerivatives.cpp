@@ -11,6 +11,7 @@
 #include <string>
 #include <type_traits>
 
+#include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"  // IWYU pragma: keep
@@ -19,6 +20,7 @@
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
 #include "DataStructures/IndexIterator.hpp"
+#include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"  // IWYU pragma: keep
 #include "DataStructures/VariablesTag.hpp"
@@ -35,6 +37,7 @@
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/MakeArray.hpp"
 #include "Utilities/TMPL.hpp"
 // IWYU pragma: no_forward_declare Tags::deriv
@@ -492,8 +495,63 @@ void test_partial_derivatives_3d(const Mesh<3>& mesh) {
     }
   }
 }
+
+// Compares the logical derivatives to applying the differentiation matrix
+// along each dimension with `apply_matrices`. This covers both the
+// fixed-extent kernels and the BLAS-based fallback for meshes with more points
+// per dimension than the kernels are instantiated for.
+template <size_t Dim>
+void test_logical_partial_derivatives_against_apply_matrices(
+    const Mesh<Dim>& mesh) {
+  CAPTURE(mesh);
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  Variables<two_vars<Dim>> u(number_of_grid_points);
+  for (size_t i = 0; i < u.size(); ++i) {
+    u.data()[i] = sin(0.3 * static_cast<double>(i));  // NOLINT
+  }
+  const DataVector u_view{u.data(), u.size()};
+  const auto du = logical_partial_derivatives<two_vars<Dim>>(u, mesh);
+  for (size_t d = 0; d < Dim; ++d) {
+    auto matrices = make_array<Dim>(Matrix{});
+    gsl::at(matrices, d) =
+        Spectral::differentiation_matrix(mesh.slice_through(d));
+    const DataVector expected =
+        apply_matrices(matrices, u_view, mesh.extents());
+    const DataVector du_view{const_cast<double*>(gsl::at(du, d).data()),
+                             gsl::at(du, d).size()};
+    CHECK_ITERABLE_APPROX(du_view, expected);
+  }
+  test_logical_partial_derivative_per_tensor(du, u, mesh);
+}
 }  // namespace
 
+SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.LogicalDerivs.Kernels",
+                  "[NumericalAlgorithms][LinearOperators][Unit]") {
+  // Spectral meshes use the fixed-extent kernels, while finite-difference
+  // meshes with more than 12 points per dimension use the fallback.
+  for (const size_t n : {1_st, 2_st, 5_st, 12_st}) {
+    test_logical_partial_derivatives_against_apply_matrices(
+        Mesh<1>{n, Spectral::Basis::Legendre, Spectral::Quadrature::Gauss});
+    test_logical_partial_derivatives_against_apply_matrices(
+        Mesh<2>{{{n, 4}}, Spectral::Basis::Legendre,
+                Spectral::Quadrature::Gauss});
+    test_logical_partial_derivatives_against_apply_matrices(
+        Mesh<3>{{{3, n, 7}}, Spectral::Basis::Legendre,
+                Spectral::Quadrature::Gauss});
+  }
+  for (const size_t n : {6_st, 13_st, 15_st}) {
+    test_logical_partial_derivatives_against_apply_matrices(
+        Mesh<1>{n, Spectral::Basis::FiniteDifference,
+                Spectral::Quadrature::CellCentered});
+    test_logical_partial_derivatives_against_apply_matrices(
+        Mesh<2>{{{6, n}}, Spectral::Basis::FiniteDifference,
+                Spectral::Quadrature::CellCentered});
+    test_logical_partial_derivatives_against_apply_matrices(
+        Mesh<3>{{{n, 6, 7}}, Spectral::Basis::FiniteDifference,
+                Spectral::Quadrature::CellCentered});
+  }
+}
+
 SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.LogicalDerivs",
                   "[NumericalAlgorithms][LinearOperators][Unit]") {
   constexpr size_t min_points =
@@ -15,6 +15,7 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "Framework/TestCreation.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/NumericalAlgorithms/LinearSolver/TestHelpers.hpp"
 #include "NumericalAlgorithms/LinearSolver/ExplicitInverse.hpp"
@@ -43,6 +44,7 @@ SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.ExplicitInverse",
     const blaze::DynamicVector<double> expected_solution{-1., 5.};
     blaze::DynamicVector<double> solution(2);
     const ExplicitInverse<> solver{};
+    CHECK_FALSE(solver.single_precision());
     const auto has_converged =
         solver.solve(make_not_null(&solution), linear_operator, source);
     REQUIRE(has_converged);
@@ -71,6 +73,56 @@ SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.ExplicitInverse",
       CHECK_ITERABLE_APPROX(solution, expected_solution);
     }
   }
+  {
+    INFO("Single precision");
+    const auto solver =
+        TestHelpers::test_creation<ExplicitInverse<>>("SinglePrecision: True");
+    CHECK(solver.single_precision());
+    CHECK_FALSE(TestHelpers::test_creation<ExplicitInverse<>>(
+                    "SinglePrecision: False")
+                    .single_precision());
+    const blaze::DynamicMatrix<double> matrix{
+        {4., 1., 0.}, {1., 3., 1.}, {0., 1., 2.}};
+    const helpers::ApplyMatrix linear_operator{matrix};
+    const blaze::DynamicVector<double> source{1., 2., 3.};
+    const blaze::DynamicVector<double> expected_solution =
+        blaze::inv(matrix) * source;
+    blaze::DynamicVector<double> solution(3);
+    const auto has_converged =
+        solver.solve(make_not_null(&solution), linear_operator, source);
+    REQUIRE(has_converged);
+    CHECK(solver.size() == 3);
+    // The inverse and the solution are only accurate to single precision
+    Approx single_precision_approx = Approx::custom().epsilon(1.e-6).scale(1.);
+    const blaze::DynamicMatrix<double, blaze::columnMajor> stored_inverse =
+        solver.single_precision_matrix_representation();
+    const blaze::DynamicMatrix<double, blaze::columnMajor> expected_inverse =
+        blaze::inv(matrix);
+    CHECK_MATRIX_CUSTOM_APPROX(stored_inverse, expected_inverse,
+                               single_precision_approx);
+    CHECK_ITERABLE_CUSTOM_APPROX(solution, expected_solution,
+                                 single_precision_approx);
+    // The stored inverse survives serialization
+    const auto serialized_solver = serialize_and_deserialize(solver);
+    CHECK(serialized_solver.single_precision());
+    blaze::DynamicVector<double> solution_after_serialization(3);
+    serialized_solver.solve(make_not_null(&solution_after_serialization),
+                            linear_operator, source);
+    CHECK(solution_after_serialization == solution);
+    // Rebuild the inverse for a different operator
+    auto reset_solver = solver;
+    reset_solver.reset();
+    const blaze::DynamicMatrix<double> other_matrix{
+        {2., 1., 0.}, {1., 4., 1.}, {0., 1., 3.}};
+    const helpers::ApplyMatrix other_linear_operator{other_matrix};
+    reset_solver.solve(make_not_null(&solution), other_linear_operator,
+                       source);
+    CHECK(reset_solver.size() == 3);
+    const blaze::DynamicVector<double> other_expected_solution =
+        blaze::inv(other_matrix) * source;
+    CHECK_ITERABLE_CUSTOM_APPROX(solution, other_expected_solution,
+                                 single_precision_approx);
+  }
   {
     INFO("Solve a heterogeneous data structure");
     using SubdomainData = ::LinearSolver::Schwarz::ElementCenteredSubdomainData<
@@ -0,0 +1,33 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <string>
+#include <utility>
+
+#include "Framework/TestCreation.hpp"
+#include "NumericalAlgorithms/LinearSolver/Orthogonalization.hpp"
+#include "Utilities/GetOutput.hpp"
+
+SPECTRE_TEST_CASE("Unit.LinearSolver.Orthogonalization",
+                  "[Unit][NumericalAlgorithms][LinearSolver]") {
+  for (const auto& [orthogonalization, name] :
+       {std::make_pair(LinearSolver::Orthogonalization::ModifiedGramSchmidt,
+                       std::string{"ModifiedGramSchmidt"}),
+        std::make_pair(LinearSolver::Orthogonalization::ClassicalGramSchmidt,
+                       std::string{"ClassicalGramSchmidt"}),
+        std::make_pair(LinearSolver::Orthogonalization::Pipelined,
+                       std::string{"Pipelined"})}) {
+    CHECK(get_output(orthogonalization) == name);
+    CHECK(TestHelpers::test_creation<LinearSolver::Orthogonalization>(name) ==
+          orthogonalization);
+  }
+}
+
+// [[OutputRegex, Failed to convert "Lanczos" to LinearSolver]]
+SPECTRE_TEST_CASE("Unit.LinearSolver.Orthogonalization.FailOptionParsing",
+                  "[Unit][NumericalAlgorithms][LinearSolver]") {
+  ERROR_TEST();
+  TestHelpers::test_creation<LinearSolver::Orthogonalization>("Lanczos");
+}
@@ -3,6 +3,7 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <array>
 #include <cstddef>
 #include <limits>
 #include <random>
@@ -27,6 +28,7 @@
 #include "NumericalAlgorithms/Spectral/SwshTransform.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/ThreadPool.hpp"
 #include "Utilities/TypeTraits.hpp"
 
 // IWYU pragma: no_forward_declare ComplexModalVector
@@ -235,6 +237,59 @@ void test_transform_and_inverse_transform() {
       transform_approx);
 }
 
+// The transforms of a batch are split among the threads of the pool, so the
+// result must not depend on the number of threads. The batch has more
+// transforms than threads, so the threads get blocks of different sizes.
+template <ComplexRepresentation Representation, int S>
+void test_threaded_transform_and_inverse_transform() {
+  MAKE_GENERATOR(gen);
+  UniformCustomDistribution<size_t> sdist{2, 7};
+  const size_t l_max = sdist(gen);
+  const size_t number_of_radial_points = 7;
+  UniformCustomDistribution<double> coefficient_distribution{-10.0, 10.0};
+
+  std::array<SpinWeighted<ComplexModalVector, S>, 2> modes{};
+  for (auto& modes_to_transform : modes) {
+    modes_to_transform.data() = ComplexModalVector{
+        number_of_radial_points * size_of_libsharp_coefficient_vector(l_max)};
+    TestHelpers::generate_swsh_modes<S>(
+        make_not_null(&modes_to_transform.data()), make_not_null(&gen),
+        make_not_null(&coefficient_distribution), number_of_radial_points,
+        l_max);
+  }
+
+  const auto inverse_transform = [&l_max, &modes]() {
+    std::array<SpinWeighted<ComplexDataVector, S>, 2> collocation{};
+    inverse_swsh_transform<Representation>(
+        l_max, number_of_radial_points, make_not_null(&collocation[0]),
+        make_not_null(&collocation[1]), modes[0], modes[1]);
+    return collocation;
+  };
+  thread_pool::set_number_of_threads(1);
+  const auto serial_collocation = inverse_transform();
+  thread_pool::set_number_of_threads(4);
+  const auto threaded_collocation = inverse_transform();
+  for (size_t i = 0; i < 2; ++i) {
+    CHECK_ITERABLE_APPROX(threaded_collocation[i].data(),
+                          serial_collocation[i].data());
+  }
+
+  const auto transform = [&l_max, &serial_collocation]() {
+    std::array<SpinWeighted<ComplexModalVector, S>, 2> transformed_modes{};
+    swsh_transform<Representation>(
+        l_max, number_of_radial_points, make_not_null(&transformed_modes[0]),
+        make_not_null(&transformed_modes[1]), serial_collocation[0],
+        serial_collocation[1]);
+    return transformed_modes;
+  };
+  const auto threaded_modes = transform();
+  thread_pool::set_number_of_threads(1);
+  const auto serial_modes = transform();
+  for (size_t i = 0; i < 2; ++i) {
+    CHECK_ITERABLE_APPROX(threaded_modes[i].data(), serial_modes[i].data());
+  }
+}
+
 template <int Spin>
 void test_interpolate_to_collocation() {
   // generate parameters for the points to transform
@@ -312,6 +367,15 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Spectral.SwshTransform",
     test_transform_and_inverse_transform<ComplexRepresentation::RealsThenImags,
                                          2>();
   }
+  {
+    INFO("Testing with multiple threads");
+    test_threaded_transform_and_inverse_transform<
+        ComplexRepresentation::Interleaved, -2>();
+    test_threaded_transform_and_inverse_transform<
+        ComplexRepresentation::Interleaved, 0>();
+    test_threaded_transform_and_inverse_transform<
+        ComplexRepresentation::RealsThenImags, 1>();
+  }
   {
     INFO("Testing interpolate_to_collocation");
     test_interpolate_to_collocation<2>();
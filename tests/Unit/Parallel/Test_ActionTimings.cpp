@@ -0,0 +1,239 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <pup.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "DataStructures/Matrix.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/IO/Observers/MockWriteReductionDataRow.hpp"
+#include "Parallel/ActionTimings.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Phase.hpp"
+#include "ParallelAlgorithms/Actions/WriteActionTimings.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/PrettyType.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct Component {};
+struct Action {};
+namespace first {
+struct Action {};
+}  // namespace first
+namespace second {
+struct Action {};
+}  // namespace second
+
+template <typename Metavariables>
+using obs_writer = TestHelpers::observers::MockObserverWriter<Metavariables>;
+
+struct Metavariables {
+  using component_list = tmpl::list<obs_writer<Metavariables>>;
+
+  void pup(PUP::er& /*p*/) {}
+};
+
+void test_histogram() {
+  INFO("Histogram");
+  namespace at = Parallel::action_timings;
+  CHECK(at::bin(0.0) == 0);
+  CHECK(at::bin(0.5e-6) == 0);
+  CHECK(at::bin(1.0e-6) == 1);
+  CHECK(at::bin(1.9e-6) == 1);
+  CHECK(at::bin(2.0e-6) == 2);
+  CHECK(at::bin(1.0e-3) == 10);
+  CHECK(at::bin(1.0e3) == at::number_of_bins - 1);
+
+  at::Histogram histogram{};
+  histogram.add(0.5e-6);
+  histogram.add(3.0e-6);
+  histogram.add(3.5e-6);
+  CHECK(histogram.calls == 3);
+  CHECK(histogram.total_time == approx(7.0e-6));
+  CHECK(histogram.max_time == 3.5e-6);
+  CHECK(histogram.counts[0] == 1);
+  CHECK(histogram.counts[2] == 2);
+
+  at::Histogram other{};
+  other.add(10.0);
+  CHECK(other != histogram);
+  histogram += other;
+  CHECK(histogram.calls == 4);
+  CHECK(histogram.max_time == 10.0);
+  CHECK(histogram.counts[at::number_of_bins - 1] == 1);
+  test_serialization(histogram);
+}
+
+void test_records() {
+  INFO("Records");
+  namespace at = Parallel::action_timings;
+  at::reset();
+  const std::string action_name = pretty_type::get_name<Action>();
+  const size_t id =
+      at::timer_id<Component, at::InPhase<Parallel::Phase::Testing>, Action>();
+  CHECK(id == at::register_timer("Component/Testing/" + action_name));
+  CHECK(id == at::timer_id<Component, at::InPhase<Parallel::Phase::Testing>,
+                           Action>());
+  const size_t simple_id =
+      at::timer_id<Component, at::SimpleActions, Action>();
+  CHECK(simple_id != id);
+  CHECK(at::register_timer("Component/SimpleActions/" + action_name) ==
+        simple_id);
+  // Registered but never called
+  at::register_timer("Component/ThreadedActions/" + action_name);
+
+  const size_t number_of_threads = 4;
+  const size_t calls_per_thread = 100;
+  std::vector<std::thread> threads{};
+  for (size_t i = 0; i < number_of_threads; ++i) {
+    threads.emplace_back([&id, &simple_id]() {
+      for (size_t j = 0; j < calls_per_thread; ++j) {
+        at::record(id, 1.5e-6);
+        at::record(simple_id, 1.0e-3);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  at::record(id, 0.5);
+
+  const auto timings = at::node_timings();
+  REQUIRE(timings.size() == 2);
+  CHECK(timings[0].first == "Component/SimpleActions/" + action_name);
+  CHECK(timings[0].second.calls == number_of_threads * calls_per_thread);
+  CHECK(timings[0].second.counts[10] == number_of_threads * calls_per_thread);
+  CHECK(timings[1].first == "Component/Testing/" + action_name);
+  CHECK(timings[1].second.calls == number_of_threads * calls_per_thread + 1);
+  CHECK(timings[1].second.total_time ==
+        approx(number_of_threads * calls_per_thread * 1.5e-6 + 0.5));
+  CHECK(timings[1].second.max_time == 0.5);
+  CHECK(timings[1].second.counts[1] == number_of_threads * calls_per_thread);
+
+  at::reset();
+  CHECK(at::node_timings().empty());
+  // Ids stay valid after a reset
+  at::record(id, 1.0);
+  CHECK(at::node_timings().size() == 1);
+  at::reset();
+}
+
+void test_same_name_in_different_namespaces() {
+  INFO("Same name in different namespaces");
+  namespace at = Parallel::action_timings;
+  at::reset();
+  const size_t first_id =
+      at::timer_id<Component, at::SimpleActions, first::Action>();
+  const size_t second_id =
+      at::timer_id<Component, at::SimpleActions, second::Action>();
+  CHECK(first_id != second_id);
+  CHECK(first_id != at::timer_id<Component, at::SimpleActions, Action>());
+  at::record(first_id, 1.0e-3);
+  at::record(second_id, 2.0e-3);
+  at::record(second_id, 2.0e-3);
+
+  const auto timings = at::node_timings();
+  REQUIRE(timings.size() == 2);
+  const auto find_timing = [&timings](const std::string& name) {
+    for (const auto& [timer_name, histogram] : timings) {
+      if (timer_name == name) {
+        return histogram;
+      }
+    }
+    return at::Histogram{};
+  };
+  const auto first_timing = find_timing(
+      "Component/SimpleActions/" + pretty_type::get_name<first::Action>());
+  CHECK(first_timing.calls == 1);
+  CHECK(first_timing.total_time == approx(1.0e-3));
+  const auto second_timing = find_timing(
+      "Component/SimpleActions/" + pretty_type::get_name<second::Action>());
+  CHECK(second_timing.calls == 2);
+  CHECK(second_timing.total_time == approx(4.0e-3));
+  at::reset();
+}
+
+void test_write_action_timings() {
+  INFO("WriteActionTimings");
+  namespace at = Parallel::action_timings;
+  at::reset();
+  at::record(at::timer_id<Component, at::SimpleActions, Action>(), 1.5e-6);
+  at::record(at::timer_id<Component, at::SimpleActions, Action>(), 2.5e-6);
+  at::record(at::timer_id<Component, at::ThreadedActions, Action>(), 1.0);
+
+  using obs_writer_comp = obs_writer<Metavariables>;
+  const size_t num_nodes = 2;
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{
+      {}, {}, std::vector<size_t>(num_nodes, 1)};
+  ActionTesting::emplace_nodegroup_component_and_initialize<obs_writer_comp>(
+      make_not_null(&runner), {});
+
+  auto& cache = ActionTesting::cache<obs_writer_comp>(runner, 0);
+  const double time = 1.5;
+  Parallel::simple_action<Actions::WriteActionTimings>(
+      Parallel::get_parallel_component<obs_writer_comp>(cache), time);
+  // All mock nodes share the timings of this process, so each writes a row
+  // per timer. The rows of all timers of a node are sent in one message.
+  for (size_t node = 0; node < num_nodes; ++node) {
+    ActionTesting::invoke_queued_simple_action<obs_writer_comp>(
+        make_not_null(&runner), node);
+  }
+  CHECK(ActionTesting::number_of_queued_threaded_actions<obs_writer_comp>(
+            runner, 0) == num_nodes);
+  for (size_t node = 0; node < num_nodes; ++node) {
+    ActionTesting::invoke_queued_threaded_action<obs_writer_comp>(
+        make_not_null(&runner), 0);
+  }
+
+  const auto& read_file = ActionTesting::get_databox_tag<
+      obs_writer_comp, TestHelpers::observers::MockReductionFileTag>(runner, 0);
+  const auto& dataset =
+      read_file.get_dat("/ActionTimings/Component/SimpleActions/" +
+                        pretty_type::get_name<Action>());
+  const auto& legend = dataset.get_legend();
+  REQUIRE(legend.size() == 5 + at::number_of_bins);
+  CHECK(legend[4] == "Max time (s)");
+  CHECK(legend[5] == "< 1us");
+  CHECK(legend[6] == "< 2us");
+  CHECK(legend.back() == ">= 4194304us");
+  const Matrix data = dataset.get_data();
+  REQUIRE(data.rows() == num_nodes);
+  for (size_t node = 0; node < num_nodes; ++node) {
+    CHECK(data(node, 0) == time);
+    CHECK(data(node, 1) == static_cast<double>(node));
+    CHECK(data(node, 2) == 2.0);
+    CHECK(data(node, 3) == approx(4.0e-6));
+    CHECK(data(node, 4) == 2.5e-6);
+    CHECK(data(node, 5) == 0.0);
+    CHECK(data(node, 6) == 1.0);
+    CHECK(data(node, 7) == 1.0);
+  }
+  const Matrix threaded_data =
+      read_file
+          .get_dat("/ActionTimings/Component/ThreadedActions/" +
+                   pretty_type::get_name<Action>())
+          .get_data();
+  REQUIRE(threaded_data.rows() == num_nodes);
+  for (size_t node = 0; node < num_nodes; ++node) {
+    CHECK(threaded_data(node, 1) == static_cast<double>(node));
+    CHECK(threaded_data(node, 2) == 1.0);
+    CHECK(threaded_data(node, 4) == 1.0);
+  }
+  at::reset();
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.ActionTimings", "[Unit][Parallel]") {
+  test_histogram();
+  test_records();
+  test_same_name_in_different_namespaces();
+  test_write_action_timings();
+}
@@ -0,0 +1,221 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#define CATCH_CONFIG_RUNNER
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <pup.h>
+#include <pup_stl.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Helpers/Parallel/RoundRobinArrayElements.hpp"
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/Algorithms/AlgorithmArray.hpp"
+#include "Parallel/Algorithms/AlgorithmNodegroup.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/InitializationFunctions.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
+#include "Parallel/Main.hpp"
+#include "Parallel/ParallelComponentHelpers.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"  // IWYU pragma: keep
+#include "Parallel/Printf.hpp"
+#include "Utilities/ErrorHandling/FloatingPointExceptions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MemoryHelpers.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+// Stress test of data sent to a nodegroup from all cores of the node at once.
+// Every array element sends `messages_per_element` messages to the nodegroup
+// branch on its node, which checks that all of them arrived and prints the
+// message throughput of the node. To use this as a benchmark, run it on a
+// single node with many cores, e.g. `+p32` to `+p128` (plus `+setcpuaffinity`
+// and a `+ppn` matching the cores of the node in SMP builds).
+
+static constexpr size_t number_of_array_elements_per_core = 2;
+static constexpr size_t messages_per_element = 2000;
+
+struct TestMetavariables;
+
+template <class Metavariables>
+struct NodegroupParallelComponent;
+
+namespace Tags {
+// Counts the messages from each array element
+struct ReceivedMessages {
+  struct Counts {
+    std::unordered_map<int, size_t> messages_per_sender{};
+    size_t number_of_messages = 0;
+    double earliest_send_time = std::numeric_limits<double>::max();
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p) {
+      p | messages_per_sender;
+      p | number_of_messages;
+      p | earliest_send_time;
+    }
+  };
+
+  using temporal_id = int;
+  using type = Counts;
+
+  template <typename Inbox>
+  static void insert_into_inbox(const gsl::not_null<Inbox*> inbox,
+                                const temporal_id& sender,
+                                const double send_time) {
+    ++inbox->messages_per_sender[sender];
+    ++inbox->number_of_messages;
+    if (send_time < inbox->earliest_send_time) {
+      inbox->earliest_send_time = send_time;
+    }
+  }
+};
+}  // namespace Tags
+
+struct CountMessages {
+  using inbox_tags = tmpl::list<Tags::ReceivedMessages>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& /*box*/,
+      const tuples::TaggedTuple<InboxTags...>& inboxes,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    const auto& counts = tuples::get<Tags::ReceivedMessages>(inboxes);
+    const size_t number_of_senders =
+        number_of_array_elements_per_core *
+        static_cast<size_t>(sys::procs_on_node(sys::my_node()));
+    if (counts.number_of_messages <
+        number_of_senders * messages_per_element) {
+      return {Parallel::AlgorithmExecution::Retry, std::nullopt};
+    }
+    const double elapsed_time = sys::wall_time() - counts.earliest_send_time;
+    SPECTRE_PARALLEL_REQUIRE(counts.number_of_messages ==
+                             number_of_senders * messages_per_element);
+    SPECTRE_PARALLEL_REQUIRE(counts.messages_per_sender.size() ==
+                             number_of_senders);
+    for (const auto& sender_and_count : counts.messages_per_sender) {
+      SPECTRE_PARALLEL_REQUIRE(sender_and_count.second == messages_per_element);
+    }
+    Parallel::printf(
+        "Node %d received %zu messages from %d cores in %.3e s (%.3e messages "
+        "per second)\n",
+        sys::my_node(), counts.number_of_messages,
+        sys::procs_on_node(sys::my_node()), elapsed_time,
+        static_cast<double>(counts.number_of_messages) / elapsed_time);
+    return {Parallel::AlgorithmExecution::Pause, std::nullopt};
+  }
+};
+
+struct SendMessages {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& array_index) {
+    auto& nodegroup_proxy = Parallel::get_parallel_component<
+        NodegroupParallelComponent<Metavariables>>(cache);
+    for (size_t i = 0; i < messages_per_element; ++i) {
+      Parallel::receive_data<Tags::ReceivedMessages>(
+          nodegroup_proxy[sys::my_node()], array_index, sys::wall_time());
+    }
+  }
+};
+
+template <class Metavariables>
+struct ArrayParallelComponent {
+  using chare_type = Parallel::Algorithms::Array;
+  using metavariables = Metavariables;
+  using array_index = int;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>,
+      Parallel::PhaseActions<Parallel::Phase::Execute, tmpl::list<>>>;
+  using simple_tags_from_options = Parallel::get_simple_tags_from_options<
+      Parallel::get_initialization_actions_list<phase_dependent_action_list>>;
+
+  static void allocate_array(
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache,
+      const tuples::tagged_tuple_from_typelist<simple_tags_from_options>&
+      /*initialization_items*/,
+      const std::unordered_set<size_t>& procs_to_ignore = {}) {
+    auto& local_cache = *Parallel::local_branch(global_cache);
+    auto& array_proxy =
+        Parallel::get_parallel_component<ArrayParallelComponent>(local_cache);
+
+    const size_t number_of_procs = static_cast<size_t>(sys::number_of_procs());
+    TestHelpers::Parallel::assign_array_elements_round_robin_style(
+        array_proxy, number_of_array_elements_per_core * number_of_procs,
+        number_of_procs, {}, global_cache, procs_to_ignore);
+  }
+
+  static void execute_next_phase(
+      const Parallel::Phase next_phase,
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache) {
+    auto& local_cache = *Parallel::local_branch(global_cache);
+    auto& array_proxy =
+        Parallel::get_parallel_component<ArrayParallelComponent>(local_cache);
+    if (next_phase == Parallel::Phase::Execute) {
+      Parallel::simple_action<SendMessages>(array_proxy);
+    }
+  }
+};
+
+template <class Metavariables>
+struct NodegroupParallelComponent {
+  using chare_type = Parallel::Algorithms::Nodegroup;
+  using metavariables = Metavariables;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>,
+      Parallel::PhaseActions<Parallel::Phase::Execute,
+                             tmpl::list<CountMessages>>>;
+  using simple_tags_from_options = Parallel::get_simple_tags_from_options<
+      Parallel::get_initialization_actions_list<phase_dependent_action_list>>;
+
+  static void execute_next_phase(
+      const Parallel::Phase next_phase,
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache) {
+    auto& local_cache = *Parallel::local_branch(global_cache);
+    Parallel::get_parallel_component<NodegroupParallelComponent>(local_cache)
+        .start_phase(next_phase);
+  }
+};
+
+struct TestMetavariables {
+  using component_list =
+      tmpl::list<ArrayParallelComponent<TestMetavariables>,
+                 NodegroupParallelComponent<TestMetavariables>>;
+
+  static constexpr const char* const help{
+      "Stress test of sending data to a nodegroup from all cores"};
+  static constexpr bool ignore_unrecognized_command_line_options = false;
+
+  static constexpr std::array<Parallel::Phase, 3> default_phase_order{
+      {Parallel::Phase::Initialization, Parallel::Phase::Execute,
+       Parallel::Phase::Exit}};
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& /*p*/) {}
+};
+
+static const std::vector<void (*)()> charm_init_node_funcs{
+    &setup_error_handling, &setup_memory_allocation_failure_reporting};
+static const std::vector<void (*)()> charm_init_proc_funcs{
+    &enable_floating_point_exceptions};
+
+using charmxx_main_component = Parallel::Main<TestMetavariables>;
+
+#include "Parallel/CharmMain.tpp"  // IWYU pragma: keep
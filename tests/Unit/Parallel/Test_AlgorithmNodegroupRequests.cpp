@@ -0,0 +1,241 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#define CATCH_CONFIG_RUNNER
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <pup.h>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/Algorithms/AlgorithmNodegroup.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/InitializationFunctions.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
+#include "Parallel/Main.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Parallel/ParallelComponentHelpers.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"  // IWYU pragma: keep
+#include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
+#include "Utilities/ErrorHandling/FloatingPointExceptions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MemoryHelpers.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+// Tests that a nodegroup runs its algorithm when `start_phase` or
+// `perform_algorithm` is called while another thread holds the node lock, e.g.
+// a threaded action. The calls are made from inside a threaded action that
+// holds the lock, so the test doesn't depend on the timing of the threads. The
+// nodegroup must run the algorithm for them once the threaded action has
+// released the lock.
+
+struct TestMetavariables;
+
+namespace Tags {
+struct PhaseStarted : db::SimpleTag {
+  using type = bool;
+};
+
+struct UnblockRequested : db::SimpleTag {
+  using type = bool;
+};
+
+struct Unblocked : db::SimpleTag {
+  using type = bool;
+};
+
+struct ProceededAfterUnblock : db::SimpleTag {
+  using type = bool;
+};
+}  // namespace Tags
+
+struct InitializeNodegroup {
+  using simple_tags =
+      tmpl::list<Tags::PhaseStarted, Tags::UnblockRequested, Tags::Unblocked,
+                 Tags::ProceededAfterUnblock>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    Initialization::mutate_assign<simple_tags>(make_not_null(&box), false,
+                                               false, false, false);
+    return {Parallel::AlgorithmExecution::Pause, std::nullopt};
+  }
+};
+
+// Starts the phase while holding the node lock, like a `start_phase` that
+// arrives on another thread while a threaded action runs
+struct StartPhaseWhileHoldingLock {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock,
+                    const Parallel::Phase next_phase) {
+    node_lock->lock();
+    Parallel::local_branch(
+        Parallel::get_parallel_component<ParallelComponent>(cache))
+        ->start_phase(next_phase);
+    node_lock->unlock();
+  }
+};
+
+struct RecordPhaseStarted {
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    db::mutate<Tags::PhaseStarted>(
+        make_not_null(&box),
+        [](const gsl::not_null<bool*> phase_started) {
+          *phase_started = true;
+        });
+    return {Parallel::AlgorithmExecution::Pause, std::nullopt};
+  }
+};
+
+// Changes the state of the nodegroup and then asks it to run its algorithm
+// while holding the node lock, like a simple action on another thread that
+// calls `perform_algorithm` while a threaded action runs
+struct UnblockWhileHoldingLock {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock) {
+    node_lock->lock();
+    db::mutate<Tags::Unblocked>(
+        make_not_null(&box),
+        [](const gsl::not_null<bool*> unblocked) { *unblocked = true; });
+    Parallel::local_branch(
+        Parallel::get_parallel_component<ParallelComponent>(cache))
+        ->perform_algorithm();
+    node_lock->unlock();
+  }
+};
+
+struct WaitForUnblock {
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    if (not db::get<Tags::Unblocked>(box)) {
+      if (not db::get<Tags::UnblockRequested>(box)) {
+        db::mutate<Tags::UnblockRequested>(
+            make_not_null(&box),
+            [](const gsl::not_null<bool*> unblock_requested) {
+              *unblock_requested = true;
+            });
+        Parallel::threaded_action<UnblockWhileHoldingLock>(
+            Parallel::get_parallel_component<ParallelComponent>(
+                cache)[sys::my_node()]);
+      }
+      return {Parallel::AlgorithmExecution::Retry, std::nullopt};
+    }
+    db::mutate<Tags::ProceededAfterUnblock>(
+        make_not_null(&box),
+        [](const gsl::not_null<bool*> proceeded) { *proceeded = true; });
+    return {Parallel::AlgorithmExecution::Pause, std::nullopt};
+  }
+};
+
+struct CheckResults {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/) {
+    SPECTRE_PARALLEL_REQUIRE(db::get<Tags::PhaseStarted>(box));
+    SPECTRE_PARALLEL_REQUIRE(db::get<Tags::UnblockRequested>(box));
+    SPECTRE_PARALLEL_REQUIRE(db::get<Tags::Unblocked>(box));
+    SPECTRE_PARALLEL_REQUIRE(db::get<Tags::ProceededAfterUnblock>(box));
+  }
+};
+
+template <class Metavariables>
+struct NodegroupParallelComponent {
+  using chare_type = Parallel::Algorithms::Nodegroup;
+  using metavariables = Metavariables;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization,
+                             tmpl::list<InitializeNodegroup>>,
+      Parallel::PhaseActions<Parallel::Phase::Register,
+                             tmpl::list<RecordPhaseStarted>>,
+      Parallel::PhaseActions<Parallel::Phase::Execute,
+                             tmpl::list<WaitForUnblock>>,
+      Parallel::PhaseActions<Parallel::Phase::Testing, tmpl::list<>>>;
+  using simple_tags_from_options = Parallel::get_simple_tags_from_options<
+      Parallel::get_initialization_actions_list<phase_dependent_action_list>>;
+
+  static void execute_next_phase(
+      const Parallel::Phase next_phase,
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache) {
+    auto& local_cache = *Parallel::local_branch(global_cache);
+    auto& nodegroup_proxy =
+        Parallel::get_parallel_component<NodegroupParallelComponent>(
+            local_cache);
+    if (next_phase == Parallel::Phase::Register) {
+      Parallel::threaded_action<StartPhaseWhileHoldingLock>(nodegroup_proxy,
+                                                            next_phase);
+    } else if (next_phase == Parallel::Phase::Testing) {
+      Parallel::simple_action<CheckResults>(nodegroup_proxy);
+    } else {
+      nodegroup_proxy.start_phase(next_phase);
+    }
+  }
+};
+
+struct TestMetavariables {
+  using component_list =
+      tmpl::list<NodegroupParallelComponent<TestMetavariables>>;
+
+  static constexpr const char* const help{
+      "Test that nodegroups run the algorithm for requests made while the node "
+      "lock is held"};
+  static constexpr bool ignore_unrecognized_command_line_options = false;
+
+  static constexpr std::array<Parallel::Phase, 5> default_phase_order{
+      {Parallel::Phase::Initialization, Parallel::Phase::Register,
+       Parallel::Phase::Execute, Parallel::Phase::Testing,
+       Parallel::Phase::Exit}};
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& /*p*/) {}
+};
+
+static const std::vector<void (*)()> charm_init_node_funcs{
+    &setup_error_handling, &setup_memory_allocation_failure_reporting};
+static const std::vector<void (*)()> charm_init_proc_funcs{
+    &enable_floating_point_exceptions};
+
+using charmxx_main_component = Parallel::Main<TestMetavariables>;
+
+#include "Parallel/CharmMain.tpp"  // IWYU pragma: keep
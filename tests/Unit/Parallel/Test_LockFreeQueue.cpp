@@ -0,0 +1,88 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Parallel/LockFreeQueue.hpp"
+
+namespace {
+void test_single_thread() {
+  INFO("Single thread");
+  Parallel::LockFreeQueue<std::unique_ptr<int>> queue{};
+  CHECK(queue.empty());
+  CHECK(queue.consume_all([](std::unique_ptr<int>&& /*value*/) {}) == 0);
+  for (int i = 0; i < 5; ++i) {
+    queue.push(std::make_unique<int>(i));
+  }
+  CHECK_FALSE(queue.empty());
+  std::vector<int> consumed{};
+  CHECK(queue.consume_all([&consumed](std::unique_ptr<int>&& value) {
+    consumed.push_back(*value);
+  }) == 5);
+  CHECK(consumed == std::vector<int>{0, 1, 2, 3, 4});
+  CHECK(queue.empty());
+
+  // Elements pushed while consuming stay in the queue
+  queue.push(std::make_unique<int>(5));
+  consumed.clear();
+  CHECK(queue.consume_all([&queue, &consumed](std::unique_ptr<int>&& value) {
+    consumed.push_back(*value);
+    queue.push(std::make_unique<int>(*value + 1));
+  }) == 1);
+  CHECK(consumed == std::vector<int>{5});
+  CHECK_FALSE(queue.empty());
+  // The destructor frees the remaining element
+}
+
+void test_concurrent_producers() {
+  INFO("Concurrent producers");
+  const size_t number_of_producers = 8;
+  const size_t pushes_per_producer = 10000;
+  Parallel::LockFreeQueue<std::pair<size_t, size_t>> queue{};
+  std::atomic<size_t> finished_producers{0};
+  std::vector<std::thread> producers{};
+  for (size_t producer = 0; producer < number_of_producers; ++producer) {
+    producers.emplace_back([&queue, &finished_producers, producer]() {
+      for (size_t i = 0; i < pushes_per_producer; ++i) {
+        queue.push(std::make_pair(producer, i));
+      }
+      ++finished_producers;
+    });
+  }
+
+  // Consume while the producers push. The elements of each producer must
+  // arrive in the order they were pushed.
+  std::vector<size_t> next_expected(number_of_producers, 0);
+  bool in_order = true;
+  const auto consume = [&next_expected,
+                        &in_order](std::pair<size_t, size_t>&& value) {
+    in_order = in_order and value.second == next_expected[value.first];
+    ++next_expected[value.first];
+  };
+  size_t number_consumed = 0;
+  while (finished_producers.load() < number_of_producers) {
+    number_consumed += queue.consume_all(consume);
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  number_consumed += queue.consume_all(consume);
+  CHECK(in_order);
+  CHECK(number_consumed == number_of_producers * pushes_per_producer);
+  CHECK(next_expected ==
+        std::vector<size_t>(number_of_producers, pushes_per_producer));
+  CHECK(queue.empty());
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.LockFreeQueue", "[Unit][Parallel]") {
+  test_single_thread();
+  test_concurrent_producers();
+}
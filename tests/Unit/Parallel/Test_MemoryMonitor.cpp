@@ -7,6 +7,7 @@
 #include <type_traits>
 #include <unordered_map>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
@@ -23,11 +24,14 @@
 #include "Parallel/Serialize.hpp"
 #include "Parallel/TypeTraits.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ContributeMemoryData.hpp"
+#include "ParallelAlgorithms/Actions/MemoryMonitor/ContributeMemoryPoolData.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessArray.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessGroups.hpp"
+#include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessMemoryPool.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessSingleton.hpp"
 #include "ParallelAlgorithms/Events/MonitorMemory.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MemoryPool.hpp"
 #include "Utilities/Numeric.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
@@ -43,7 +47,8 @@ struct MockMemoryMonitor {
   using array_index = int;
   using component_being_mocked = mem_monitor::MemoryMonitor<Metavariables>;
   using metavariables = Metavariables;
-  using simple_tags = tmpl::list<mem_monitor::Tags::MemoryHolder>;
+  using simple_tags = tmpl::list<mem_monitor::Tags::MemoryHolder,
+                                 mem_monitor::Tags::MemoryPoolHolder>;
   using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
       Parallel::Phase::Initialization,
       tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>>;
@@ -123,6 +128,8 @@ void test_tags() {
   INFO("Test Tags");
   using holder_tag = mem_monitor::Tags::MemoryHolder;
   TestHelpers::db::test_simple_tag<holder_tag>("MemoryHolder");
+  TestHelpers::db::test_simple_tag<mem_monitor::Tags::MemoryPoolHolder>(
+      "MemoryPoolHolder");
 
   const std::string subpath =
       mem_monitor::subfile_name<MockMemoryMonitor<TestMetavariables>>();
@@ -475,6 +482,81 @@ void test_process_singleton() {
   check_output<sing_comp<metavars>>(runner, time, num_nodes, sizes);
 }
 
+void test_process_memory_pool() {
+  INFO("Test ProcessMemoryPool");
+
+  // 4 mock nodes, 3 mock cores per node
+  const size_t num_nodes = 4;
+  const size_t num_procs_per_node = 3;
+  const size_t num_procs = num_nodes * num_procs_per_node;
+  ActionTesting::MockRuntimeSystem<metavars> runner{
+      {}, {}, std::vector<size_t>(num_nodes, num_procs_per_node)};
+
+  setup_runner(make_not_null(&runner));
+
+  auto& cache = ActionTesting::cache<group_comp<metavars>>(runner, 0);
+  auto& group_proxy =
+      Parallel::get_parallel_component<group_comp<metavars>>(cache);
+
+  memory_pool::enable();
+  memory_pool::release_cached_memory();
+  memory_pool::reset_statistics();
+  {
+    const DataVector first{100, 1.0};
+  }
+  {
+    const DataVector second{100, 2.0};
+  }
+
+  const double time = 0.5;
+  Parallel::simple_action<mem_monitor::ProcessMemoryPool>(group_proxy, time);
+  // All mock procs share the counters of this thread, so the first proc
+  // reports both allocations and resets the counters for the other procs.
+  for (size_t proc = 0; proc < num_procs; ++proc) {
+    ActionTesting::invoke_queued_simple_action<group_comp<metavars>>(
+        make_not_null(&runner), proc);
+  }
+  memory_pool::release_cached_memory();
+  memory_pool::disable();
+
+  for (size_t proc = 0; proc < num_procs; ++proc) {
+    CHECK(ActionTesting::number_of_queued_simple_actions<
+              mem_mon_comp<metavars>>(runner, 0) == num_procs - proc);
+    CHECK(ActionTesting::number_of_queued_threaded_actions<
+              obs_writer_comp<metavars>>(runner, 0) == 0);
+    ActionTesting::invoke_queued_simple_action<mem_mon_comp<metavars>>(
+        make_not_null(&runner), 0);
+  }
+  CHECK(ActionTesting::get_databox_tag<mem_mon_comp<metavars>,
+                                       mem_monitor::Tags::MemoryPoolHolder>(
+            runner, 0)
+            .empty());
+
+  CHECK(ActionTesting::number_of_queued_threaded_actions<
+            obs_writer_comp<metavars>>(runner, 0) == 1);
+  ActionTesting::invoke_queued_threaded_action<obs_writer_comp<metavars>>(
+      make_not_null(&runner), 0);
+
+  auto& read_file = ActionTesting::get_databox_tag<
+      obs_writer_comp<metavars>, TestHelpers::observers::MockReductionFileTag>(
+      runner, 0);
+  const auto& dataset = read_file.get_dat("/MemoryMonitors/MemoryPool");
+  CHECK(dataset.get_legend().size() == 8);
+  const Matrix data = dataset.get_data();
+  CHECK(data.rows() == 1);
+  CHECK(data(0, 0) == time);
+  // Allocations and pool hits
+  CHECK(data(0, 1) == 2.0);
+  CHECK(data(0, 2) == 1.0);
+  CHECK(data(0, 3) == 0.5);
+  // 100 doubles are rounded up to 832 bytes
+  CHECK(data(0, 4) == approx(2 * 832 / 1.0e6));
+  CHECK(data(0, 5) == approx(num_procs * 832 / 1.0e6));
+  // Proc of max peak and its peak
+  CHECK(data(0, 6) == 0.0);
+  CHECK(data(0, 7) == approx(832 / 1.0e6));
+}
+
 struct BadArrayChareMetavariables {
   using component_list =
       tmpl::list<ArrayParallelComponent<BadArrayChareMetavariables>>;
@@ -663,6 +745,7 @@ SPECTRE_TEST_CASE("Unit.Parallel.MemoryMonitor", "[Unit][Parallel]") {
   test_contribute_memory_data(make_not_null(&gen), true);
   test_process_array(make_not_null(&gen));
   test_process_singleton();
+  test_process_memory_pool();
   test_event_construction();
   test_monitor_memory_event();
 }
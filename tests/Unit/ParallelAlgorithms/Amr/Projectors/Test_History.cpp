@@ -0,0 +1,138 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Domain/Structure/Side.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "ParallelAlgorithms/Amr/Projectors/History.hpp"
+#include "Time/History.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct ScalarField : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+
+using Vars = Variables<tmpl::list<ScalarField>>;
+using DerivVars = Variables<tmpl::list<::Tags::dt<ScalarField>>>;
+using History = TimeSteppers::History<Vars>;
+
+// A linear function on the grid points of an element in 1D, which all meshes
+// in this test represent exactly
+template <typename VarsType>
+VarsType linear(const Mesh<1>& mesh, const ElementId<1>& element_id,
+                const double slope) {
+  const auto& segment_id = element_id.segment_ids()[0];
+  const double half_width = 0.5 * (segment_id.endpoint(Side::Upper) -
+                                   segment_id.endpoint(Side::Lower));
+  VarsType result{mesh.number_of_grid_points()};
+  get(get<tmpl::front<typename VarsType::tags_list>>(result)) =
+      1. + slope * (segment_id.midpoint() +
+                    half_width * Spectral::collocation_points(mesh));
+  return result;
+}
+
+// Two steps with values, where the value of the first step is discarded, and
+// a substep
+History make_history(const Mesh<1>& mesh, const ElementId<1>& element_id) {
+  const Slab slab{0., 1.};
+  History history{2};
+  history.insert(TimeStepId{true, 0, slab.start()},
+                 linear<Vars>(mesh, element_id, 1.),
+                 linear<DerivVars>(mesh, element_id, 2.));
+  history.insert(TimeStepId{true, 0, slab.start() + slab.duration() / 2},
+                 linear<Vars>(mesh, element_id, 3.),
+                 linear<DerivVars>(mesh, element_id, 4.));
+  history.insert(TimeStepId{true, 0, slab.start() + slab.duration() / 2, 1,
+                            slab.duration() / 2, 0.5},
+                 linear<Vars>(mesh, element_id, 5.),
+                 linear<DerivVars>(mesh, element_id, 6.));
+  history.discard_value(history[0].time_step_id);
+  return history;
+}
+
+void check_history(const History& history, const History& expected_history) {
+  CHECK(history.integration_order() == expected_history.integration_order());
+  REQUIRE(history.size() == expected_history.size());
+  REQUIRE(history.substeps().size() == expected_history.substeps().size());
+  const auto check_record = [](const auto& record,
+                               const auto& expected_record) {
+    CHECK(record.time_step_id == expected_record.time_step_id);
+    REQUIRE(record.value.has_value() == expected_record.value.has_value());
+    if (record.value.has_value()) {
+      CHECK_VARIABLES_APPROX(*record.value, *expected_record.value);
+    }
+    CHECK_VARIABLES_APPROX(record.derivative, expected_record.derivative);
+  };
+  for (size_t i = 0; i < history.size(); ++i) {
+    check_record(history[i], expected_history[i]);
+  }
+  for (size_t i = 0; i < history.substeps().size(); ++i) {
+    check_record(history.substeps()[i], expected_history.substeps()[i]);
+  }
+}
+
+void test_p_refinement() {
+  INFO("p-refinement");
+  const ElementId<1> element_id{0, {{{1, 1}}}};
+  const Mesh<1> old_mesh{3, Spectral::Basis::Legendre,
+                         Spectral::Quadrature::GaussLobatto};
+  const Mesh<1> new_mesh{5, Spectral::Basis::Legendre,
+                         Spectral::Quadrature::GaussLobatto};
+  auto history = make_history(old_mesh, element_id);
+  amr::projectors::history(make_not_null(&history), old_mesh, new_mesh);
+  check_history(history, make_history(new_mesh, element_id));
+  amr::projectors::history(make_not_null(&history), new_mesh, old_mesh);
+  check_history(history, make_history(old_mesh, element_id));
+}
+
+void test_split_and_join() {
+  INFO("h-refinement");
+  const ElementId<1> parent_id{0, {{{1, 1}}}};
+  const ElementId<1> lower_child_id{0, {{{2, 2}}}};
+  const ElementId<1> upper_child_id{0, {{{2, 3}}}};
+  const Mesh<1> parent_mesh{4, Spectral::Basis::Legendre,
+                            Spectral::Quadrature::GaussLobatto};
+  const Mesh<1> child_mesh{3, Spectral::Basis::Legendre,
+                           Spectral::Quadrature::GaussLobatto};
+  const auto parent_history = make_history(parent_mesh, parent_id);
+  std::unordered_map<ElementId<1>, History> children_histories{};
+  std::unordered_map<ElementId<1>, Mesh<1>> children_meshes{};
+  for (const auto& child_id : {lower_child_id, upper_child_id}) {
+    CAPTURE(child_id);
+    auto child_history = amr::projectors::child_history(
+        parent_history, parent_mesh, parent_id, child_mesh, child_id);
+    check_history(child_history, make_history(child_mesh, child_id));
+    children_histories.emplace(child_id, std::move(child_history));
+    children_meshes.emplace(child_id, child_mesh);
+  }
+  check_history(
+      amr::projectors::parent_history(parent_mesh, parent_id,
+                                      children_histories, children_meshes),
+      parent_history);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.Amr.Projectors.History",
+                  "[Unit][ParallelAlgorithms]") {
+  test_p_refinement();
+  test_split_and_join();
+}
@@ -0,0 +1,161 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/IndexIterator.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Domain/Structure/Side.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "ParallelAlgorithms/Amr/Projectors/Variables.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/StdHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct ScalarField : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+
+using Vars = Variables<tmpl::list<ScalarField>>;
+
+// A polynomial of degree two in each dimension, which all meshes in this test
+// represent exactly, on the grid points of the element
+template <size_t Dim>
+Vars polynomial(const Mesh<Dim>& mesh, const ElementId<Dim>& element_id) {
+  Vars result{mesh.number_of_grid_points(), 1.};
+  auto& field = get(get<ScalarField>(result));
+  for (IndexIterator<Dim> index(mesh.extents()); index; ++index) {
+    for (size_t d = 0; d < Dim; ++d) {
+      const auto& segment_id = gsl::at(element_id.segment_ids(), d);
+      const double xi =
+          Spectral::collocation_points(mesh.slice_through(d))[index()[d]];
+      const double x = segment_id.midpoint() +
+                       0.5 *
+                           (segment_id.endpoint(Side::Upper) -
+                            segment_id.endpoint(Side::Lower)) *
+                           xi;
+      field[index.collapsed_index()] *=
+          1. + static_cast<double>(d + 1) * x - 2. * square(x);
+    }
+  }
+  return result;
+}
+
+template <size_t Dim>
+Mesh<Dim> make_mesh(const std::array<size_t, Dim>& extents) {
+  return {extents, Spectral::Basis::Legendre,
+          Spectral::Quadrature::GaussLobatto};
+}
+
+void test_p_refinement() {
+  INFO("p-refinement");
+  const ElementId<2> element_id{0, {{{1, 0}, {2, 3}}}};
+  for (const auto& [old_extents, new_extents] :
+       {std::pair{std::array{3_st, 3_st}, std::array{5_st, 4_st}},
+        std::pair{std::array{5_st, 4_st}, std::array{3_st, 3_st}},
+        std::pair{std::array{3_st, 5_st}, std::array{4_st, 3_st}},
+        std::pair{std::array{4_st, 4_st}, std::array{4_st, 4_st}}}) {
+    CAPTURE(old_extents);
+    CAPTURE(new_extents);
+    const auto old_mesh = make_mesh(old_extents);
+    const auto new_mesh = make_mesh(new_extents);
+    auto vars = polynomial(old_mesh, element_id);
+    CHECK_VARIABLES_APPROX(
+        amr::projectors::variables(vars, old_mesh, new_mesh),
+        polynomial(new_mesh, element_id));
+    amr::projectors::variables(make_not_null(&vars), old_mesh, new_mesh);
+    CHECK_VARIABLES_APPROX(vars, polynomial(new_mesh, element_id));
+  }
+}
+
+void test_split_and_join() {
+  INFO("h-refinement");
+  // The parent splits in xi and keeps its segment in eta
+  const ElementId<2> parent_id{0, {{{1, 1}, {2, 0}}}};
+  const std::array<ElementId<2>, 2> children_ids{
+      ElementId<2>{0, {{{2, 2}, {2, 0}}}}, ElementId<2>{0, {{{2, 3}, {2, 0}}}}};
+  for (const auto& [parent_extents, children_extents] :
+       {std::pair{std::array{3_st, 4_st}, std::array{3_st, 4_st}},
+        std::pair{std::array{3_st, 4_st}, std::array{5_st, 3_st}},
+        std::pair{std::array{5_st, 4_st}, std::array{3_st, 4_st}}}) {
+    CAPTURE(parent_extents);
+    CAPTURE(children_extents);
+    const auto parent_mesh = make_mesh(parent_extents);
+    const auto child_mesh = make_mesh(children_extents);
+    const auto parent_vars = polynomial(parent_mesh, parent_id);
+    std::unordered_map<ElementId<2>, Vars> children_vars{};
+    std::unordered_map<ElementId<2>, Mesh<2>> children_meshes{};
+    for (const auto& child_id : children_ids) {
+      CAPTURE(child_id);
+      const auto child_vars = amr::projectors::child_variables(
+          parent_vars, parent_mesh, parent_id, child_mesh, child_id);
+      CHECK_VARIABLES_APPROX(child_vars, polynomial(child_mesh, child_id));
+      children_vars.emplace(child_id, child_vars);
+      children_meshes.emplace(child_id, child_mesh);
+    }
+    CHECK_VARIABLES_APPROX(
+        amr::projectors::parent_variables(parent_mesh, parent_id,
+                                          children_vars, children_meshes),
+        parent_vars);
+  }
+
+  // Children with different meshes join
+  const auto parent_mesh = make_mesh(std::array{4_st, 4_st});
+  const std::unordered_map<ElementId<2>, Mesh<2>> children_meshes{
+      {children_ids[0], make_mesh(std::array{3_st, 4_st})},
+      {children_ids[1], make_mesh(std::array{4_st, 3_st})}};
+  std::unordered_map<ElementId<2>, Vars> children_vars{};
+  for (const auto& [child_id, child_mesh] : children_meshes) {
+    children_vars.emplace(child_id, polynomial(child_mesh, child_id));
+  }
+  CHECK_VARIABLES_APPROX(
+      amr::projectors::parent_variables(parent_mesh, parent_id, children_vars,
+                                        children_meshes),
+      polynomial(parent_mesh, parent_id));
+}
+
+void test_1d() {
+  INFO("1D");
+  const ElementId<1> parent_id{0, {{{0, 0}}}};
+  const ElementId<1> lower_child_id{0, {{{1, 0}}}};
+  const ElementId<1> upper_child_id{0, {{{1, 1}}}};
+  const auto mesh = make_mesh(std::array{4_st});
+  const auto parent_vars = polynomial(mesh, parent_id);
+  const std::unordered_map<ElementId<1>, Mesh<1>> children_meshes{
+      {lower_child_id, mesh}, {upper_child_id, mesh}};
+  std::unordered_map<ElementId<1>, Vars> children_vars{};
+  for (const auto& child_id : {lower_child_id, upper_child_id}) {
+    children_vars.emplace(child_id, amr::projectors::child_variables(
+                                        parent_vars, mesh, parent_id, mesh,
+                                        child_id));
+    CHECK_VARIABLES_APPROX(children_vars.at(child_id),
+                           polynomial(mesh, child_id));
+  }
+  CHECK_VARIABLES_APPROX(
+      amr::projectors::parent_variables(mesh, parent_id, children_vars,
+                                        children_meshes),
+      parent_vars);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.Amr.Projectors.Variables",
+                  "[Unit][ParallelAlgorithms]") {
+  test_p_refinement();
+  test_split_and_join();
+  test_1d();
+}
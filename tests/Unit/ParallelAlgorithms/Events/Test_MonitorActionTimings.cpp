@@ -0,0 +1,145 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/ObservationBox.hpp"
+#include "Domain/Structure/Element.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Domain/Tags.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "Options/Protocols/FactoryCreation.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/RegisterDerivedClassesWithCharm.hpp"
+#include "Parallel/Tags/Metavariables.hpp"
+#include "ParallelAlgorithms/Actions/WriteActionTimings.hpp"
+#include "ParallelAlgorithms/Events/MonitorActionTimings.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Time/Tags.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+constexpr size_t volume_dim = 1;
+
+struct MockWriteActionTimings {
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static std::vector<double> times;
+
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex>
+  static void apply(db::DataBox<DbTags>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/, const double time) {
+    times.push_back(time);
+  }
+};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::vector<double> MockWriteActionTimings::times{};
+
+template <typename Metavariables>
+struct ElementComponent {
+  using component_being_mocked = void;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>>;
+};
+
+template <typename Metavariables>
+struct MockObserverWriter {
+  using component_being_mocked = observers::ObserverWriter<Metavariables>;
+  using replace_these_simple_actions = tmpl::list<Actions::WriteActionTimings>;
+  using with_these_simple_actions = tmpl::list<MockWriteActionTimings>;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockNodeGroupChare;
+  using array_index = int;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<ElementComponent<Metavariables>,
+                                    MockObserverWriter<Metavariables>>;
+  using const_global_cache_tags = tmpl::list<>;
+
+  struct factory_creation
+      : tt::ConformsTo<Options::protocols::FactoryCreation> {
+    using factory_classes = tmpl::map<tmpl::pair<
+        Event,
+        tmpl::list<Events::MonitorActionTimings<volume_dim, Tags::Time>>>>;
+  };
+};
+
+void test_monitor(const Event& event) {
+  using element_component = ElementComponent<Metavariables>;
+  using observer_writer = MockObserverWriter<Metavariables>;
+
+  MockWriteActionTimings::times.clear();
+
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{}};
+  ActionTesting::emplace_nodegroup_component<observer_writer>(&runner);
+
+  const double observation_time = 2.5;
+  const std::vector<ElementId<volume_dim>> element_ids{
+      ElementId<volume_dim>{1},
+      ElementId<volume_dim>{0, std::array{SegmentId{1, 1}}},
+      ElementId<volume_dim>{0, std::array{SegmentId{1, 0}}}};
+  for (size_t index = 0; index < element_ids.size(); ++index) {
+    ActionTesting::emplace_component<element_component>(&runner, index);
+    const auto box = db::create<
+        tmpl::list<Parallel::Tags::MetavariablesImpl<Metavariables>,
+                   Tags::Time, domain::Tags::Element<volume_dim>>>(
+        Metavariables{}, observation_time,
+        Element<volume_dim>{element_ids[index], {}});
+    CHECK(event.is_ready(box,
+                         ActionTesting::cache<element_component>(runner, index),
+                         static_cast<element_component::array_index>(index),
+                         std::add_pointer_t<element_component>{}));
+    event.run(make_observation_box<db::AddComputeTags<>>(box),
+              ActionTesting::cache<element_component>(runner, index),
+              static_cast<element_component::array_index>(index),
+              std::add_pointer_t<element_component>{});
+  }
+
+  // Only the zeroth element, which was run last, asks the writer to write the
+  // timings
+  REQUIRE(not runner.is_simple_action_queue_empty<observer_writer>(0));
+  runner.invoke_queued_simple_action<observer_writer>(0);
+  CHECK(runner.is_simple_action_queue_empty<observer_writer>(0));
+  CHECK(MockWriteActionTimings::times == std::vector<double>{observation_time});
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.Events.MonitorActionTimings",
+                  "[Unit][ParallelAlgorithms]") {
+  Parallel::register_factory_classes_with_charm<Metavariables>();
+
+  const Events::MonitorActionTimings<volume_dim, Tags::Time> monitor{};
+  CHECK(not monitor.needs_evolved_variables());
+  test_monitor(monitor);
+  test_monitor(serialize_and_deserialize(monitor));
+
+  const auto event =
+      TestHelpers::test_creation<std::unique_ptr<Event>, Metavariables>(
+          "MonitorActionTimings");
+  test_monitor(*event);
+  test_monitor(*serialize_and_deserialize(event));
+}
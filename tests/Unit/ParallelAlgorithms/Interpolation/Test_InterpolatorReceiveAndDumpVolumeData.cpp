@@ -36,6 +36,8 @@
 #include "IO/H5/AccessType.hpp"
 #include "IO/H5/File.hpp"
 #include "IO/H5/VolumeData.hpp"
+#include "IO/Logging/Tags.hpp"
+#include "IO/Logging/Verbosity.hpp"
 #include "IO/Observer/Initialize.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
@@ -46,6 +48,7 @@
 #include "ParallelAlgorithms/Interpolation/Actions/DumpInterpolatorVolumeData.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/InitializeInterpolationTarget.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/InitializeInterpolator.hpp"
+#include "ParallelAlgorithms/Interpolation/Actions/InterpolatorReceivePoints.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/InterpolatorReceiveVolumeData.hpp"  // IWYU pragma: keep
 #include "ParallelAlgorithms/Interpolation/Actions/InterpolatorRegisterElement.hpp"  // IWYU pragma: keep
 #include "ParallelAlgorithms/Interpolation/Actions/TryToInterpolate.hpp"
@@ -55,6 +58,7 @@
 #include "ParallelAlgorithms/Interpolation/Protocols/ComputeVarsToInterpolate.hpp"
 #include "ParallelAlgorithms/Interpolation/Protocols/InterpolationTargetTag.hpp"
 #include "ParallelAlgorithms/Interpolation/Targets/LineSegment.hpp"
+#include "ParallelAlgorithms/Interpolation/Tags.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "Time/Slab.hpp"
 #include "Time/Tags.hpp"
@@ -181,6 +185,32 @@ struct AddToTemporalIdsWhenDataHasBeenInterpolated {
   }
 };
 
+// Action that (artificially, for the test) adds an interpolant for an element
+// that doesn't send data anymore, like an element that AMR has removed.
+template <typename InterpolationTargetTag>
+struct AddStaleInterpolant {
+  template <
+      typename ParallelComponent, typename DbTags, typename Metavariables,
+      typename ArrayIndex,
+      Requires<tmpl::list_contains_v<DbTags, intrp::Tags::NumberOfElements>> =
+          nullptr>
+  static void apply(db::DataBox<DbTags>& box,
+                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ElementId<Metavariables::volume_dim>& element_id) {
+    db::mutate<intrp::Tags::InterpolatedVarsHolders<Metavariables>>(
+        make_not_null(&box),
+        [&element_id](
+            const gsl::not_null<typename intrp::Tags::InterpolatedVarsHolders<
+                Metavariables>::type*>
+                holders) {
+          get<intrp::Vars::HolderTag<InterpolationTargetTag, Metavariables>>(
+              *holders)
+              .interpolant_cache.interpolants[element_id];
+        });
+  }
+};
+
 template <typename InterpolationTargetTag>
 struct MockInterpolationTargetReceiveVars {
   template <typename ParallelComponent, typename DbTags, typename Metavariables,
@@ -274,7 +304,8 @@ struct mock_interpolator {
   using chare_type = ActionTesting::MockGroupChare;
   using array_index = int;
   using const_global_cache_tags =
-      tmpl::list<intrp::Tags::DumpVolumeDataOnFailure>;
+      tmpl::list<intrp::Tags::DumpVolumeDataOnFailure,
+                 logging::Tags::Verbosity<intrp::OptionTags::Interpolator>>;
   using simple_tags = typename intrp::Actions::InitializeInterpolator<
       intrp::Tags::VolumeVarsInfo<Metavariables, ::Tags::TimeStepId>,
       intrp::Tags::InterpolatedVarsHolders<Metavariables>>::simple_tags;
@@ -432,7 +463,8 @@ void test(const bool dump_vol_data) {
   }
 
   ActionTesting::MockRuntimeSystem<metavars> runner{
-      {domain_creator.create_domain(), dump_vol_data, filename}};
+      {domain_creator.create_domain(), dump_vol_data, ::Verbosity::Verbose,
+       filename}};
   ActionTesting::emplace_group_component_and_initialize<interp_component>(
       &runner,
       {0_st,
@@ -610,6 +642,43 @@ void test(const bool dump_vol_data) {
   // No more queued simple actions.
   CHECK(runner.is_simple_action_queue_empty<target_component>(0));
 
+  // The interpolants were computed for all elements at the first temporal_id.
+  // Interpolating onto the same points at a later temporal_id reuses them.
+  const auto& interpolant_cache =
+      get<intrp::Vars::HolderTag<metavars::InterpolationTargetA, metavars>>(
+          holders)
+          .interpolant_cache;
+  CHECK(interpolant_cache.generation == 1);
+  CHECK(interpolant_cache.interpolants.size() == element_ids.size());
+  CHECK(interpolant_cache.number_of_misses == element_ids.size());
+  CHECK(interpolant_cache.number_of_hits == 0);
+  CHECK(interpolant_cache.time_computing_interpolants >= 0.0);
+  CHECK(interpolant_cache.time_validating >= 0.0);
+  // An element that no longer sends data is evicted once the next temporal_id
+  // has been interpolated
+  const ElementId<3> removed_element_id{domain.blocks().size()};
+  runner.simple_action<interp_component,
+                       AddStaleInterpolant<metavars::InterpolationTargetA>>(
+      0, removed_element_id);
+  CHECK(interpolant_cache.interpolants.size() == element_ids.size() + 1);
+  const TimeStepId later_temporal_id(true, 0, Time(slab, Rational(13, 15)));
+  auto block_coord_holders = interpolant_cache.block_coord_holders;
+  runner.simple_action<
+      interp_component,
+      intrp::Actions::ReceivePoints<metavars::InterpolationTargetA>>(
+      0, later_temporal_id, std::move(block_coord_holders));
+  create_volume_data_and_send_it_to_interpolator<interp_component>(
+      make_not_null(&runner), domain_creator, domain, element_ids,
+      later_temporal_id);
+  // MockInterpolationTargetReceiveVars checks the interpolated values
+  runner.invoke_queued_simple_action<target_component>(0);
+  CHECK(runner.is_simple_action_queue_empty<target_component>(0));
+  CHECK(interpolant_cache.generation == 1);
+  CHECK(interpolant_cache.interpolants.size() == element_ids.size());
+  CHECK(interpolant_cache.interpolants.count(removed_element_id) == 0);
+  CHECK(interpolant_cache.number_of_misses == element_ids.size());
+  CHECK(interpolant_cache.number_of_hits == element_ids.size());
+
   // Remove file
   if (file_system::check_if_file_exists(filename + "0.h5")) {
     file_system::rm(filename + "0.h5", true);
@@ -18,6 +18,7 @@
 #include "ParallelAlgorithms/LinearSolver/ConjugateGradient/ElementActions.hpp"
 #include "ParallelAlgorithms/LinearSolver/ConjugateGradient/InitializeElement.hpp"
 #include "ParallelAlgorithms/LinearSolver/ConjugateGradient/Tags/InboxTags.hpp"
+#include "ParallelAlgorithms/LinearSolver/ConjugateGradient/Tags/Pipelined.hpp"
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/TMPL.hpp"
@@ -38,6 +39,13 @@ using operand_tag = LinearSolver::Tags::Operand<fields_tag>;
 using operator_applied_to_operand_tag =
     LinearSolver::Tags::OperatorAppliedTo<operand_tag>;
 using residual_tag = LinearSolver::Tags::Residual<fields_tag>;
+using search_direction_tag =
+    LinearSolver::cg::Tags::SearchDirection<fields_tag>;
+using operator_applied_to_search_direction_tag =
+    LinearSolver::Tags::OperatorAppliedTo<search_direction_tag>;
+using operator_squared_applied_to_search_direction_tag =
+    LinearSolver::Tags::OperatorAppliedTo<
+        operator_applied_to_search_direction_tag>;
 
 template <typename Metavariables>
 struct ElementArray {
@@ -54,6 +62,8 @@ struct ElementArray {
           Parallel::Phase::Testing,
           tmpl::list<LinearSolver::cg::detail::InitializeHasConverged<
                          fields_tag, DummyOptionsGroup, DummyOptionsGroup>,
+                     LinearSolver::cg::detail::UpdateFieldValues<
+                         fields_tag, DummyOptionsGroup, DummyOptionsGroup>,
                      LinearSolver::cg::detail::UpdateOperand<
                          fields_tag, DummyOptionsGroup, DummyOptionsGroup>,
                      Parallel::Actions::TerminatePhase>>>;
@@ -70,7 +80,9 @@ SPECTRE_TEST_CASE(
     "[Unit][ParallelAlgorithms][LinearSolver][Actions]") {
   using element_array = ElementArray<Metavariables>;
 
-  ActionTesting::MockRuntimeSystem<Metavariables> runner{{}};
+  // Enable the pipelined algorithm. The actions that don't depend on it are
+  // the same in both cases.
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{true}};
 
   // Setup mock element array
 
@@ -105,8 +117,11 @@ SPECTRE_TEST_CASE(
     INFO("InitializeElement");
     CHECK(get_tag(Convergence::Tags::IterationId<DummyOptionsGroup>{}) ==
           std::numeric_limits<size_t>::max());
-    tmpl::for_each<tmpl::list<operator_applied_to_fields_tag, operand_tag,
-                              operator_applied_to_operand_tag, residual_tag>>(
+    tmpl::for_each<tmpl::list<
+        operator_applied_to_fields_tag, operand_tag,
+        operator_applied_to_operand_tag, residual_tag, search_direction_tag,
+        operator_applied_to_search_direction_tag,
+        operator_squared_applied_to_search_direction_tag>>(
         [&tag_is_retrievable](auto tag_v) {
           using tag = tmpl::type_from<decltype(tag_v)>;
           CAPTURE(db::tag_name<tag>());
@@ -132,7 +147,7 @@ SPECTRE_TEST_CASE(
         CHECK(get_tag(Convergence::Tags::HasConverged<DummyOptionsGroup>{}) ==
               has_converged);
         CHECK(ActionTesting::get_next_action_index<element_array>(runner, 0) ==
-              (has_converged ? 2 : 1));
+              (has_converged ? 3 : 1));
       };
   SECTION("InitializeHasConverged (not yet converged: continue loop)") {
     test_initialize_has_converged(Convergence::HasConverged{1, 0});
@@ -168,7 +183,7 @@ SPECTRE_TEST_CASE(
     CHECK(get_tag(Convergence::Tags::HasConverged<DummyOptionsGroup>{}) ==
           has_converged);
     CHECK(ActionTesting::get_next_action_index<element_array>(runner, 0) ==
-          (has_converged ? 2 : 1));
+          (has_converged ? 3 : 1));
   };
   SECTION("UpdateOperand (not yet converged: continue loop)") {
     test_update_operand(Convergence::HasConverged{1, 0});
@@ -176,4 +191,33 @@ SPECTRE_TEST_CASE(
   SECTION("UpdateOperand (has converged: terminate loop)") {
     test_update_operand(Convergence::HasConverged{1, 1});
   }
+
+  SECTION("UpdateFieldValues (pipelined, has converged: terminate loop)") {
+    // The operator is applied to the operand of iteration 2 while the
+    // reduction is in flight, so the iteration ID has advanced already
+    const size_t iteration_id = 2;
+    set_tag(Convergence::Tags::IterationId<DummyOptionsGroup>{},
+            iteration_id + 1);
+    set_tag(VectorTag{}, blaze::DynamicVector<double>(3, 1.));
+    runner.template force_next_action_to_be<
+        element_array, LinearSolver::cg::detail::UpdateFieldValues<
+                           fields_tag, DummyOptionsGroup, DummyOptionsGroup>>(
+        0);
+    REQUIRE_FALSE(ActionTesting::next_action_if_ready<element_array>(
+        make_not_null(&runner), 0));
+    auto& inbox = ActionTesting::get_inbox_tag<
+        element_array,
+        LinearSolver::cg::detail::Tags::PipelinedStep<DummyOptionsGroup>>(
+        make_not_null(&runner), 0);
+    const Convergence::HasConverged has_converged{2, 2};
+    inbox[iteration_id] = std::make_tuple(0., 0., has_converged);
+    ActionTesting::next_action<element_array>(make_not_null(&runner), 0);
+    // The fields are final, so they are not updated anymore
+    CHECK(get_tag(VectorTag{}) == blaze::DynamicVector<double>(3, 1.));
+    CHECK(get_tag(Convergence::Tags::IterationId<DummyOptionsGroup>{}) ==
+          iteration_id);
+    CHECK(get_tag(Convergence::Tags::HasConverged<DummyOptionsGroup>{}) ==
+          has_converged);
+    CHECK(ActionTesting::get_next_action_index<element_array>(runner, 0) == 3);
+  }
 }
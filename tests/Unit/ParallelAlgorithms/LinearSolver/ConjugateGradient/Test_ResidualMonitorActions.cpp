@@ -24,6 +24,7 @@
 #include "Parallel/Phase.hpp"
 #include "ParallelAlgorithms/LinearSolver/ConjugateGradient/ResidualMonitor.hpp"
 #include "ParallelAlgorithms/LinearSolver/ConjugateGradient/ResidualMonitorActions.hpp"
+#include "ParallelAlgorithms/LinearSolver/ConjugateGradient/Tags/Pipelined.hpp"
 #include "ParallelAlgorithms/LinearSolver/Observe.hpp"
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
 #include "Utilities/Gsl.hpp"
@@ -51,6 +52,10 @@ using residual_square_tag = LinearSolver::Tags::MagnitudeSquare<
     LinearSolver::Tags::Residual<fields_tag>>;
 using initial_residual_magnitude_tag = ::Tags::Initial<
     LinearSolver::Tags::Magnitude<LinearSolver::Tags::Residual<fields_tag>>>;
+using step_length_tag =
+    LinearSolver::cg::detail::Tags::StepLength<TestLinearSolver>;
+using pipelined_step_tag =
+    LinearSolver::cg::detail::Tags::PipelinedStep<TestLinearSolver>;
 
 template <typename Metavariables>
 struct MockResidualMonitor {
@@ -82,7 +87,8 @@ struct MockElementArray {
       LinearSolver::cg::detail::Tags::InitialHasConverged<TestLinearSolver>,
       LinearSolver::cg::detail::Tags::Alpha<TestLinearSolver>,
       LinearSolver::cg::detail::Tags::ResidualRatioAndHasConverged<
-          TestLinearSolver>>;
+          TestLinearSolver>,
+      pipelined_step_tag>;
 };
 
 struct Metavariables {
@@ -301,4 +307,89 @@ SPECTRE_TEST_CASE(
     REQUIRE(has_converged);
     CHECK(has_converged.reason() == Convergence::Reason::RelativeResidual);
   }
+
+  SECTION("UpdatePipelinedResidual") {
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::cg::detail::UpdatePipelinedResidual<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 0_st, 4., 2.);
+    ActionTesting::invoke_queued_threaded_action<observer_writer>(
+        make_not_null(&runner), 0);
+    // Test residual monitor state
+    CHECK(get_residual_monitor_tag(residual_square_tag{}) == 4.);
+    CHECK(get_residual_monitor_tag(initial_residual_magnitude_tag{}) == 2.);
+    // alpha = gamma / delta = 4 / 2
+    CHECK(get_residual_monitor_tag(step_length_tag{}) == 2.);
+    // Test element state
+    {
+      const auto& element_inbox =
+          get_element_inbox_tag(pipelined_step_tag{}).at(0);
+      CHECK(get<0>(element_inbox) == 2.);
+      CHECK(get<1>(element_inbox) == 0.);
+      CHECK_FALSE(get<2>(element_inbox));
+    }
+    // Test observer writer state
+    CHECK(get_observer_writer_tag(helpers::CheckSubfileNameTag{}) ==
+          "/TestLinearSolverResiduals");
+    CHECK(get<0>(get_observer_writer_tag(helpers::CheckReductionDataTag{})) ==
+          0);
+    CHECK(get<1>(get_observer_writer_tag(helpers::CheckReductionDataTag{})) ==
+          approx(2.));
+
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::cg::detail::UpdatePipelinedResidual<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 1_st, 2.25, 3.);
+    ActionTesting::invoke_queued_threaded_action<observer_writer>(
+        make_not_null(&runner), 0);
+    // Test residual monitor state
+    CHECK(get_residual_monitor_tag(residual_square_tag{}) == 2.25);
+    CHECK(get_residual_monitor_tag(initial_residual_magnitude_tag{}) == 2.);
+    // beta = 2.25 / 4 = 0.5625
+    // alpha = 2.25 / (3 - 0.5625 * 2.25 / 2) = 0.9504950495049505
+    CHECK(get_residual_monitor_tag(step_length_tag{}) ==
+          approx(0.9504950495049505));
+    // Test element state
+    {
+      const auto& element_inbox =
+          get_element_inbox_tag(pipelined_step_tag{}).at(1);
+      CHECK(get<0>(element_inbox) == approx(0.9504950495049505));
+      CHECK(get<1>(element_inbox) == approx(0.5625));
+      CHECK_FALSE(get<2>(element_inbox));
+    }
+    // Test observer writer state
+    CHECK(get<0>(get_observer_writer_tag(helpers::CheckReductionDataTag{})) ==
+          1);
+    CHECK(get<1>(get_observer_writer_tag(helpers::CheckReductionDataTag{})) ==
+          approx(1.5));
+
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::cg::detail::UpdatePipelinedResidual<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 2_st, 2.25, 1.);
+    // Test element state
+    const auto& element_inbox =
+        get_element_inbox_tag(pipelined_step_tag{}).at(2);
+    const auto& has_converged = get<2>(element_inbox);
+    REQUIRE(has_converged);
+    CHECK(has_converged.reason() == Convergence::Reason::MaxIterations);
+  }
+
+  SECTION("UpdatePipelinedResidualAndConverge") {
+    // Must not divide by the vanishing inner products
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::cg::detail::UpdatePipelinedResidual<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 0_st, 0., 0.);
+    // Test residual monitor state
+    CHECK(get_residual_monitor_tag(residual_square_tag{}) == 0.);
+    CHECK(get_residual_monitor_tag(initial_residual_magnitude_tag{}) == 0.);
+    // Test element state
+    const auto& element_inbox =
+        get_element_inbox_tag(pipelined_step_tag{}).at(0);
+    CHECK(get<0>(element_inbox) == 0.);
+    const auto& has_converged = get<2>(element_inbox);
+    REQUIRE(has_converged);
+    CHECK(has_converged.reason() == Convergence::Reason::AbsoluteResidual);
+  }
 }
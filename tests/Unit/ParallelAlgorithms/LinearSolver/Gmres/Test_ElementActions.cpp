@@ -13,7 +13,9 @@
 #include "DataStructures/DataBox/TagName.hpp"
 #include "DataStructures/DynamicVector.hpp"
 #include "Framework/ActionTesting.hpp"
+#include "IO/Logging/Verbosity.hpp"
 #include "NumericalAlgorithms/Convergence/HasConverged.hpp"
+#include "NumericalAlgorithms/LinearSolver/Orthogonalization.hpp"
 #include "Parallel/Phase.hpp"
 #include "ParallelAlgorithms/Actions/SetData.hpp"
 #include "ParallelAlgorithms/Actions/TerminatePhase.hpp"
@@ -50,6 +52,8 @@ using orthogonalization_iteration_id_tag =
 using basis_history_tag = LinearSolver::Tags::KrylovSubspaceBasis<operand_tag>;
 using preconditioned_basis_history_tag =
     LinearSolver::Tags::KrylovSubspaceBasis<preconditioned_operand_tag>;
+using operator_basis_history_tag =
+    LinearSolver::Tags::KrylovSubspaceBasis<operator_applied_to_operand_tag>;
 
 template <typename Metavariables, bool Preconditioned>
 struct ElementArray {
@@ -71,6 +75,9 @@ struct ElementArray {
               LinearSolver::gmres::detail::PrepareStep<
                   fields_tag, DummyOptionsGroup, Preconditioned,
                   DummyOptionsGroup, void>,
+              LinearSolver::gmres::detail::PerformStep<
+                  fields_tag, DummyOptionsGroup, Preconditioned,
+                  DummyOptionsGroup, void>,
               LinearSolver::gmres::detail::NormalizeOperandAndUpdateField<
                   fields_tag, DummyOptionsGroup, Preconditioned,
                   DummyOptionsGroup, void>,
@@ -84,12 +91,17 @@ struct Metavariables {
 };
 
 template <bool Preconditioned>
-void test_element_actions() {
+void test_element_actions(
+    const LinearSolver::Orthogonalization orthogonalization) {
   CAPTURE(Preconditioned);
+  CAPTURE(orthogonalization);
   using metavariables = Metavariables<Preconditioned>;
   using element_array = typename metavariables::element_array;
+  const bool pipelined =
+      orthogonalization == LinearSolver::Orthogonalization::Pipelined;
 
-  ActionTesting::MockRuntimeSystem<metavariables> runner{{}};
+  ActionTesting::MockRuntimeSystem<metavariables> runner{
+      {::Verbosity::Silent, orthogonalization}};
 
   // Setup mock element array
   ActionTesting::emplace_component_and_initialize<element_array>(
@@ -137,6 +149,8 @@ void test_element_actions() {
     CHECK(tag_is_retrievable(preconditioned_operand_tag{}) == Preconditioned);
     CHECK(tag_is_retrievable(preconditioned_basis_history_tag{}) ==
           Preconditioned);
+    CHECK(tag_is_retrievable(operator_basis_history_tag{}) ==
+          not Preconditioned);
     CHECK_FALSE(get_tag(Convergence::Tags::HasConverged<DummyOptionsGroup>{}));
   }
 
@@ -171,7 +185,7 @@ void test_element_actions() {
         CHECK(get_tag(Convergence::Tags::HasConverged<DummyOptionsGroup>{}) ==
               has_converged);
         CHECK(ActionTesting::get_next_action_index<element_array>(runner, 0) ==
-              (has_converged ? 3 : 1));
+              (has_converged ? 4 : 1));
       };
   SECTION("NormalizeInitialOperand (not yet converged: continue loop)") {
     test_normalize_initial_operand(Convergence::HasConverged{1, 0});
@@ -181,11 +195,12 @@ void test_element_actions() {
   }
 
   const auto test_normalize_operand_and_update_field =
-      [&runner, &get_tag,
-       &set_tag](const Convergence::HasConverged& has_converged) {
+      [&runner, &get_tag, &set_tag,
+       pipelined](const Convergence::HasConverged& has_converged) {
         const size_t iteration_id = 2;
+        // The pipelined scheme has incremented the iteration ID already
         set_tag(Convergence::Tags::IterationId<DummyOptionsGroup>{},
-                iteration_id);
+                iteration_id + (pipelined ? 1 : 0));
         set_tag(initial_fields_tag{}, blaze::DynamicVector<double>(3, -1.));
         set_tag(operand_tag{}, blaze::DynamicVector<double>(3, 2.));
         set_tag(basis_history_tag{}, std::vector<blaze::DynamicVector<double>>{
@@ -194,6 +209,9 @@ void test_element_actions() {
         if constexpr (Preconditioned) {
           set_tag(preconditioned_basis_history_tag{},
                   get_tag(basis_history_tag{}));
+        } else {
+          set_tag(operator_applied_to_operand_tag{},
+                  blaze::DynamicVector<double>(3, 8.));
         }
         runner.template force_next_action_to_be<
             element_array,
@@ -223,8 +241,19 @@ void test_element_actions() {
               3);
         CHECK(get_tag(Convergence::Tags::HasConverged<DummyOptionsGroup>{}) ==
               has_converged);
-        CHECK(ActionTesting::get_next_action_index<element_array>(runner, 0) ==
-              (has_converged ? 3 : 1));
+        if (pipelined) {
+          // The operator applied to the new operand gets normalized as well,
+          // and the next step skips ahead to `PerformStep`
+          CHECK_ITERABLE_APPROX(get_tag(operator_applied_to_operand_tag{}),
+                                blaze::DynamicVector<double>(3, 2.));
+          CHECK(ActionTesting::get_next_action_index<element_array>(runner,
+                                                                    0) ==
+                (has_converged ? 4 : 2));
+        } else {
+          CHECK(ActionTesting::get_next_action_index<element_array>(runner,
+                                                                    0) ==
+                (has_converged ? 4 : 1));
+        }
       };
   SECTION("NormalizeOperandAndUpdateField (not yet converged: continue loop)") {
     test_normalize_operand_and_update_field(Convergence::HasConverged{1, 0});
@@ -238,6 +267,13 @@ void test_element_actions() {
 
 SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.LinearSolver.Gmres.ElementActions",
                   "[Unit][ParallelAlgorithms][LinearSolver][Actions]") {
-  test_element_actions<true>();
-  test_element_actions<false>();
+  test_element_actions<true>(
+      LinearSolver::Orthogonalization::ModifiedGramSchmidt);
+  test_element_actions<true>(
+      LinearSolver::Orthogonalization::ClassicalGramSchmidt);
+  test_element_actions<false>(
+      LinearSolver::Orthogonalization::ModifiedGramSchmidt);
+  test_element_actions<false>(
+      LinearSolver::Orthogonalization::ClassicalGramSchmidt);
+  test_element_actions<false>(LinearSolver::Orthogonalization::Pipelined);
 }
@@ -22,6 +22,7 @@
 #include "NumericalAlgorithms/Convergence/Criteria.hpp"
 #include "NumericalAlgorithms/Convergence/HasConverged.hpp"
 #include "NumericalAlgorithms/Convergence/Reason.hpp"
+#include "NumericalAlgorithms/LinearSolver/Orthogonalization.hpp"
 #include "Parallel/Phase.hpp"
 #include "ParallelAlgorithms/LinearSolver/Gmres/ResidualMonitor.hpp"
 #include "ParallelAlgorithms/LinearSolver/Gmres/ResidualMonitorActions.hpp"
@@ -83,6 +84,8 @@ struct MockElementArray {
       LinearSolver::gmres::detail::Tags::InitialOrthogonalization<
           TestLinearSolver>,
       LinearSolver::gmres::detail::Tags::Orthogonalization<TestLinearSolver>,
+      LinearSolver::gmres::detail::Tags::FusedOrthogonalization<
+          TestLinearSolver>,
       LinearSolver::gmres::detail::Tags::FinalOrthogonalization<
           TestLinearSolver>>;
 };
@@ -104,7 +107,8 @@ SPECTRE_TEST_CASE(
 
   const Convergence::Criteria convergence_criteria{2, 0., 0.5};
   ActionTesting::MockRuntimeSystem<Metavariables> runner{
-      {::Verbosity::Verbose, convergence_criteria}};
+      {::Verbosity::Verbose, convergence_criteria,
+       LinearSolver::Orthogonalization::ClassicalGramSchmidt}};
 
   // Setup mock residual monitor
   ActionTesting::emplace_component<residual_monitor>(make_not_null(&runner), 0);
@@ -263,6 +267,110 @@ SPECTRE_TEST_CASE(
           approx(residual_magnitude));
   }
 
+  SECTION("StoreFusedOrthogonalization") {
+    ActionTesting::simple_action<
+        residual_monitor,
+        LinearSolver::gmres::detail::InitializeResidualMagnitude<
+            fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 2.);
+    // The operand retains 16 of its magnitude squared of 25, so no
+    // reorthogonalization is needed
+    ActionTesting::simple_action<
+        residual_monitor,
+        LinearSolver::gmres::detail::StoreFusedOrthogonalization<
+            fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 0_st, 0_st, std::vector<double>{3., 25.});
+    // Test residual monitor state
+    // H = [[3.], [4.]]
+    CHECK(get_residual_monitor_tag(orthogonalization_history_tag{}) ==
+          blaze::DynamicMatrix<double>({{3.}, {4.}}));
+    // Test element state
+    const auto& fused_inbox =
+        get_element_inbox_tag(
+            LinearSolver::gmres::detail::Tags::FusedOrthogonalization<
+                TestLinearSolver>{})
+            .at(0);
+    CHECK(get<0>(fused_inbox) == blaze::DynamicVector<double>({3.}));
+    CHECK_FALSE(get<1>(fused_inbox));
+    const auto& element_inbox =
+        get_element_inbox_tag(
+            LinearSolver::gmres::detail::Tags::FinalOrthogonalization<
+                TestLinearSolver>{})
+            .at(0);
+    CHECK(get<0>(element_inbox) == approx(4.));
+    // beta = [2., 0.]
+    // minres = inv(qr_R(H)) * trans(qr_Q(H)) * beta = [0.24]
+    const auto& minres = get<1>(element_inbox);
+    CHECK(minres.size() == 1);
+    CHECK_ITERABLE_APPROX(minres, blaze::DynamicVector<double>({0.24}));
+    // r = beta - H * minres = [1.28, -0.96]
+    // |r| = 1.6
+    const auto& has_converged = get<2>(element_inbox);
+    CHECK_FALSE(has_converged);
+  }
+
+  SECTION("StoreFusedOrthogonalization (reorthogonalize)") {
+    ActionTesting::simple_action<
+        residual_monitor,
+        LinearSolver::gmres::detail::InitializeResidualMagnitude<
+            fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 2.);
+    // The operand retains only 1 of its magnitude squared of 10, so it gets
+    // orthogonalized a second time
+    ActionTesting::simple_action<
+        residual_monitor,
+        LinearSolver::gmres::detail::StoreFusedOrthogonalization<
+            fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 0_st, 0_st, std::vector<double>{3., 10.});
+    // Test intermediate residual monitor state
+    CHECK(get_residual_monitor_tag(orthogonalization_history_tag{})(0, 0) ==
+          3.);
+    // Test intermediate element state
+    {
+      const auto& fused_inbox =
+          get_element_inbox_tag(
+              LinearSolver::gmres::detail::Tags::FusedOrthogonalization<
+                  TestLinearSolver>{})
+              .at(0);
+      CHECK(get<0>(fused_inbox) == blaze::DynamicVector<double>({3.}));
+      CHECK(get<1>(fused_inbox));
+      CHECK(get_element_inbox_tag(
+                LinearSolver::gmres::detail::Tags::FinalOrthogonalization<
+                    TestLinearSolver>{})
+                .empty());
+    }
+    // The second pass corrects the projection and never repeats
+    ActionTesting::simple_action<
+        residual_monitor,
+        LinearSolver::gmres::detail::StoreFusedOrthogonalization<
+            fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 0_st, 1_st, std::vector<double>{0.5, 1.25});
+    // Test residual monitor state
+    // H = [[3.5], [1.]]
+    CHECK(get_residual_monitor_tag(orthogonalization_history_tag{}) ==
+          blaze::DynamicMatrix<double>({{3.5}, {1.}}));
+    // Test element state
+    const auto& fused_inbox =
+        get_element_inbox_tag(
+            LinearSolver::gmres::detail::Tags::FusedOrthogonalization<
+                TestLinearSolver>{})
+            .at(0);
+    CHECK(get<0>(fused_inbox) == blaze::DynamicVector<double>({0.5}));
+    CHECK_FALSE(get<1>(fused_inbox));
+    const auto& element_inbox =
+        get_element_inbox_tag(
+            LinearSolver::gmres::detail::Tags::FinalOrthogonalization<
+                TestLinearSolver>{})
+            .at(0);
+    CHECK(get<0>(element_inbox) == approx(1.));
+    // beta = [2., 0.]
+    // minres = inv(qr_R(H)) * trans(qr_Q(H)) * beta = [0.5283018867924528]
+    const auto& minres = get<1>(element_inbox);
+    CHECK(minres.size() == 1);
+    CHECK_ITERABLE_APPROX(minres,
+                          blaze::DynamicVector<double>({0.5283018867924528}));
+  }
+
   SECTION("ConvergeByAbsoluteResidual") {
     ActionTesting::simple_action<
         residual_monitor,
@@ -0,0 +1,96 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <map>
+#include <type_traits>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DynamicMatrix.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "IO/Logging/Tags.hpp"
+#include "IO/Logging/Verbosity.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Actions/ResetCoarseOperator.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Tags.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace {
+
+struct DummyOptionsGroup {};
+
+using coarse_grid_layout_tag =
+    LinearSolver::multigrid::Tags::CoarseGridLayout<1, DummyOptionsGroup>;
+using coarse_operator_column_tag =
+    LinearSolver::multigrid::Tags::CoarseOperatorColumn<DummyOptionsGroup>;
+using coarse_operator_lu_tag =
+    LinearSolver::multigrid::Tags::CoarseOperatorLu<DummyOptionsGroup>;
+using coarse_operator_pivots_tag =
+    LinearSolver::multigrid::Tags::CoarseOperatorPivots<DummyOptionsGroup>;
+
+template <typename Metavariables>
+struct ElementArray {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = ElementId<1>;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<
+          Parallel::Phase::Initialization,
+          tmpl::list<ActionTesting::InitializeDataBox<
+              tmpl::list<coarse_grid_layout_tag, coarse_operator_column_tag,
+                         coarse_operator_lu_tag, coarse_operator_pivots_tag>>>>,
+      Parallel::PhaseActions<
+          Parallel::Phase::Testing,
+          tmpl::list<LinearSolver::multigrid::Actions::ResetCoarseOperator<
+              1, DummyOptionsGroup>>>>;
+};
+
+struct Metavariables {
+  using element_array = ElementArray<Metavariables>;
+  using component_list = tmpl::list<element_array>;
+};
+
+void test_reset_coarse_operator(const bool direct_solve_at_bottom) {
+  CAPTURE(direct_solve_at_bottom);
+
+  using element_array = typename Metavariables::element_array;
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{tuples::TaggedTuple<
+      LinearSolver::multigrid::Tags::DirectSolveAtBottom<DummyOptionsGroup>,
+      logging::Tags::Verbosity<DummyOptionsGroup>>{direct_solve_at_bottom,
+                                                   Verbosity::Verbose}};
+  const ElementId<1> element_id{0};
+  // An assembled 2x2 coarse-grid operator
+  ActionTesting::emplace_component_and_initialize<element_array>(
+      make_not_null(&runner), element_id,
+      {std::map<ElementId<1>, size_t>{{element_id, 2}}, size_t{2},
+       blaze::DynamicMatrix<double, blaze::columnMajor>{{2., 0.}, {0., 2.}},
+       std::vector<int>{1, 2}});
+  ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Testing);
+  ActionTesting::next_action<element_array>(make_not_null(&runner), element_id);
+  const auto get_tag = [&runner, &element_id](auto tag_v) -> const auto& {
+    using tag = std::decay_t<decltype(tag_v)>;
+    return ActionTesting::get_databox_tag<element_array, tag>(runner,
+                                                               element_id);
+  };
+  CHECK(get_tag(coarse_grid_layout_tag{}).empty() == direct_solve_at_bottom);
+  CHECK((get_tag(coarse_operator_column_tag{}) == 0) ==
+        direct_solve_at_bottom);
+  CHECK((get_tag(coarse_operator_lu_tag{}).rows() == 0) ==
+        direct_solve_at_bottom);
+  CHECK(get_tag(coarse_operator_pivots_tag{}).empty() ==
+        direct_solve_at_bottom);
+}
+
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ParallelMultigrid.Action.ResetCoarseOperator",
+                  "[Unit][ParallelAlgorithms][LinearSolver][Actions]") {
+  test_reset_coarse_operator(true);
+  test_reset_coarse_operator(false);
+}
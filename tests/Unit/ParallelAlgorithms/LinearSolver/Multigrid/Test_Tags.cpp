@@ -30,11 +30,21 @@ SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.LinearSolver.Multigrid.Tags",
       "MaxLevels(TestSolver)");
   TestHelpers::db::test_simple_tag<Tags::OutputVolumeData<TestSolver>>(
       "OutputVolumeData(TestSolver)");
+  TestHelpers::db::test_simple_tag<Tags::DirectSolveAtBottom<TestSolver>>(
+      "DirectSolveAtBottom(TestSolver)");
   TestHelpers::db::test_simple_tag<Tags::MultigridLevel>("MultigridLevel");
   TestHelpers::db::test_simple_tag<Tags::IsFinestGrid>("IsFinestGrid");
   TestHelpers::db::test_simple_tag<Tags::ParentId<1>>("ParentId");
   TestHelpers::db::test_simple_tag<Tags::ChildIds<1>>("ChildIds");
   TestHelpers::db::test_simple_tag<Tags::ParentMesh<1>>("ParentMesh");
+  TestHelpers::db::test_simple_tag<Tags::CoarseGridLayout<1, TestSolver>>(
+      "CoarseGridLayout(TestSolver)");
+  TestHelpers::db::test_simple_tag<Tags::CoarseOperatorColumn<TestSolver>>(
+      "CoarseOperatorColumn(TestSolver)");
+  TestHelpers::db::test_simple_tag<Tags::CoarseOperatorLu<TestSolver>>(
+      "CoarseOperatorLu(TestSolver)");
+  TestHelpers::db::test_simple_tag<Tags::CoarseOperatorPivots<TestSolver>>(
+      "CoarseOperatorPivots(TestSolver)");
   TestHelpers::db::test_simple_tag<Tags::ObservationId<TestSolver>>(
       "ObservationId(TestSolver)");
   TestHelpers::db::test_prefix_tag<Tags::PreSmoothingInitial<Tag>>(
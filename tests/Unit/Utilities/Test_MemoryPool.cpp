@@ -0,0 +1,146 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <complex>
+#include <cstddef>
+
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/DynamicBuffer.hpp"
+#include "DataStructures/Tags/TempTensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Utilities/MemoryPool.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+void test_disabled() {
+  INFO("Disabled");
+  memory_pool::disable();
+  memory_pool::reset_statistics();
+  {
+    const DataVector vector{100, 1.0};
+    CHECK(vector[99] == 1.0);
+  }
+  const auto statistics = memory_pool::statistics();
+  CHECK(statistics.allocations == 0);
+  CHECK(statistics.bytes_cached == 0);
+  CHECK(statistics.hit_rate() == 0.0);
+  CHECK_FALSE(memory_pool::is_enabled());
+}
+
+void test_reuse() {
+  INFO("Reuse");
+  memory_pool::enable();
+  CHECK(memory_pool::is_enabled());
+  memory_pool::release_cached_memory();
+  memory_pool::reset_statistics();
+
+  const double* first_data = nullptr;
+  {
+    const DataVector vector{100, 1.0};
+    first_data = vector.data();
+    const auto statistics = memory_pool::statistics();
+    CHECK(statistics.allocations == 1);
+    CHECK(statistics.pool_hits == 0);
+    CHECK(statistics.bytes_allocated == 832);
+    CHECK(statistics.bytes_in_use == 832);
+    CHECK(statistics.bytes_cached == 0);
+  }
+  CHECK(memory_pool::statistics().bytes_cached == 832);
+  CHECK(memory_pool::statistics().bytes_in_use == 0);
+  {
+    // 101 doubles fall into the same size class as 100 doubles
+    const DataVector vector{101, 2.0};
+    CHECK(vector.data() == first_data);
+    CHECK(vector[100] == 2.0);
+    const auto statistics = memory_pool::statistics();
+    CHECK(statistics.allocations == 2);
+    CHECK(statistics.pool_hits == 1);
+    CHECK(statistics.bytes_cached == 0);
+    CHECK(statistics.hit_rate() == 0.5);
+  }
+  {
+    // A different size class doesn't reuse the memory
+    const DataVector vector{200, 3.0};
+    CHECK(vector.data() != first_data);
+    CHECK(memory_pool::statistics().pool_hits == 1);
+  }
+  {
+    const ComplexDataVector vector{50, std::complex<double>{1.0, 2.0}};
+    CHECK(vector[49] == std::complex<double>{1.0, 2.0});
+    CHECK(memory_pool::statistics().pool_hits == 2);
+  }
+  {
+    Variables<tmpl::list<::Tags::TempScalar<0>, ::Tags::TempScalar<1>>> vars{
+        50, 4.0};
+    CHECK(get(get<::Tags::TempScalar<1>>(vars))[49] == 4.0);
+    CHECK(memory_pool::statistics().pool_hits == 3);
+    const auto copied_vars = vars;
+    CHECK(copied_vars == vars);
+  }
+  {
+    DynamicBuffer<DataVector> buffer{2, 50};
+    buffer[1] = 5.0;
+    CHECK(buffer.at(1)[49] == 5.0);
+    CHECK(memory_pool::statistics().pool_hits == 4);
+  }
+
+  auto statistics = memory_pool::statistics();
+  CHECK(statistics.allocations == 7);
+  CHECK(statistics.peak_bytes_in_use == 2 * 832);
+  CHECK(statistics.bytes_in_use == 0);
+  CHECK(serialize_and_deserialize(statistics).peak_bytes_in_use ==
+        statistics.peak_bytes_in_use);
+  CHECK(serialize_and_deserialize(statistics).hit_rate() ==
+        statistics.hit_rate());
+
+  memory_pool::reset_statistics();
+  statistics = memory_pool::statistics();
+  CHECK(statistics.allocations == 0);
+  CHECK(statistics.pool_hits == 0);
+  CHECK(statistics.peak_bytes_in_use == 0);
+  CHECK(statistics.bytes_cached == 2 * 832 + 1600);
+
+  memory_pool::release_cached_memory();
+  CHECK(memory_pool::statistics().bytes_cached == 0);
+}
+
+void test_max_cached_bytes() {
+  INFO("Max cached bytes");
+  memory_pool::enable();
+  memory_pool::release_cached_memory();
+  memory_pool::reset_statistics();
+  const size_t default_max_cached_bytes = memory_pool::max_cached_bytes();
+  memory_pool::set_max_cached_bytes(1024);
+  {
+    // Larger than the cache, so it bypasses the pool
+    const DataVector vector{1000, 1.0};
+  }
+  CHECK(memory_pool::statistics().allocations == 0);
+  {
+    const DataVector first{100, 1.0};
+    const DataVector second{100, 2.0};
+  }
+  // Only one of the vectors fits into the cache
+  CHECK(memory_pool::statistics().allocations == 2);
+  CHECK(memory_pool::statistics().bytes_cached == 832);
+  memory_pool::set_max_cached_bytes(default_max_cached_bytes);
+
+  // Memory allocated from the pool can be freed after it is disabled
+  auto data = memory_pool::make_unique_for_overwrite<double>(10);
+  memory_pool::disable();
+  data.reset();
+  memory_pool::enable();
+  memory_pool::release_cached_memory();
+  memory_pool::disable();
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Utilities.MemoryPool", "[Unit][Utilities]") {
+  test_disabled();
+  test_reuse();
+  test_max_cached_bytes();
+}
@@ -0,0 +1,172 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif  // defined(__linux__)
+
+#include "Utilities/Literals.hpp"
+#include "Utilities/ThreadPool.hpp"
+
+// Catch's assertions are not thread-safe, so the loops only record what they
+// see and the results are checked on the main thread.
+namespace {
+void check_every_item_visited_once(const size_t number_of_items) {
+  std::vector<size_t> visits(number_of_items, 0);
+  std::atomic<size_t> number_of_chunks{0};
+  std::atomic<size_t> number_of_empty_chunks{0};
+  thread_pool::parallel_for(
+      number_of_items, [&visits, &number_of_chunks, &number_of_empty_chunks](
+                           const size_t begin, const size_t end) {
+        ++number_of_chunks;
+        if (begin >= end) {
+          ++number_of_empty_chunks;
+        }
+        for (size_t i = begin; i < end; ++i) {
+          ++visits[i];
+        }
+      });
+  CHECK(number_of_empty_chunks.load() == 0);
+  for (const size_t count : visits) {
+    CHECK(count == 1);
+  }
+  CHECK(number_of_chunks.load() <=
+        std::min(number_of_items, thread_pool::number_of_threads()));
+}
+
+void test_serial() {
+  INFO("Serial");
+  thread_pool::set_number_of_threads(1);
+  CHECK(thread_pool::number_of_threads() == 1);
+  const auto caller = std::this_thread::get_id();
+  size_t number_of_chunks = 0;
+  thread_pool::parallel_for(10, [&caller, &number_of_chunks](
+                                    const size_t begin, const size_t end) {
+    CHECK(std::this_thread::get_id() == caller);
+    CHECK(begin == 0);
+    CHECK(end == 10);
+    ++number_of_chunks;
+  });
+  CHECK(number_of_chunks == 1);
+  // An empty loop does nothing
+  thread_pool::parallel_for(
+      0, [](const size_t /*begin*/, const size_t /*end*/) { CHECK(false); });
+}
+
+void test_parallel() {
+  INFO("Parallel");
+  thread_pool::set_number_of_threads(4);
+  CHECK(thread_pool::number_of_threads() == 4);
+  for (const size_t number_of_items : {1_st, 3_st, 4_st, 17_st, 1000_st}) {
+    CAPTURE(number_of_items);
+    check_every_item_visited_once(number_of_items);
+  }
+
+  // Nested loops run serially on the thread of the chunk
+  std::atomic<size_t> nested_items{0};
+  std::atomic<size_t> nested_items_on_other_threads{0};
+  thread_pool::parallel_for(8, [&nested_items, &nested_items_on_other_threads](
+                                   const size_t begin, const size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      const auto chunk_thread = std::this_thread::get_id();
+      thread_pool::parallel_for(
+          5, [&nested_items, &nested_items_on_other_threads, &chunk_thread](
+                 const size_t nested_begin, const size_t nested_end) {
+            nested_items += nested_end - nested_begin;
+            if (std::this_thread::get_id() != chunk_thread) {
+              nested_items_on_other_threads += nested_end - nested_begin;
+            }
+          });
+    }
+  });
+  CHECK(nested_items.load() == 40);
+  CHECK(nested_items_on_other_threads.load() == 0);
+
+  // Loops started from several threads at once all complete
+  std::atomic<size_t> total_items{0};
+  std::vector<std::thread> callers{};
+  for (size_t i = 0; i < 3; ++i) {
+    callers.emplace_back([&total_items]() {
+      for (size_t j = 0; j < 100; ++j) {
+        thread_pool::parallel_for(
+            10, [&total_items](const size_t begin, const size_t end) {
+              total_items += end - begin;
+            });
+      }
+    });
+  }
+  for (auto& caller : callers) {
+    caller.join();
+  }
+  CHECK(total_items.load() == 3000);
+
+  // The pool can be resized
+  thread_pool::set_number_of_threads(2);
+  CHECK(thread_pool::number_of_threads() == 2);
+  check_every_item_visited_once(7);
+  thread_pool::set_number_of_threads(1);
+}
+
+void test_affinity() {
+#ifdef __linux__
+  INFO("Affinity");
+  cpu_set_t original_cpus;
+  CPU_ZERO(&original_cpus);
+  REQUIRE(sched_getaffinity(0, sizeof(cpu_set_t), &original_cpus) == 0);
+  if (CPU_COUNT(&original_cpus) < 2) {
+    return;
+  }
+  // Pin this thread to a single core, like a Charm++ PE with +setcpuaffinity
+  int pinned_cpu = 0;
+  while (not CPU_ISSET(pinned_cpu, &original_cpus)) {
+    ++pinned_cpu;
+  }
+  cpu_set_t pinned_cpus;
+  CPU_ZERO(&pinned_cpus);
+  CPU_SET(pinned_cpu, &pinned_cpus);
+  REQUIRE(pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t),
+                                 &pinned_cpus) == 0);
+  thread_pool::set_number_of_threads(2);
+  // Each chunk waits for the other to start, so the worker runs one of them
+  const auto caller = std::this_thread::get_id();
+  std::atomic<size_t> started_chunks{0};
+  std::atomic<bool> worker_ran{false};
+  std::atomic<bool> worker_on_pinned_cpu{true};
+  thread_pool::parallel_for(2, [&caller, &started_chunks, &worker_ran,
+                                &worker_on_pinned_cpu](const size_t /*begin*/,
+                                                       const size_t /*end*/) {
+    ++started_chunks;
+    while (started_chunks.load() < 2) {
+      std::this_thread::yield();
+    }
+    if (std::this_thread::get_id() != caller) {
+      cpu_set_t worker_cpus;
+      CPU_ZERO(&worker_cpus);
+      sched_getaffinity(0, sizeof(cpu_set_t), &worker_cpus);
+      worker_ran = true;
+      worker_on_pinned_cpu = CPU_ISSET(pinned_cpu, &worker_cpus) != 0;
+    }
+  });
+  CHECK(worker_ran.load());
+  CHECK_FALSE(worker_on_pinned_cpu.load());
+  thread_pool::set_number_of_threads(1);
+  REQUIRE(pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t),
+                                 &original_cpus) == 0);
+#endif  // defined(__linux__)
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Utilities.ThreadPool", "[Unit][Utilities]") {
+  test_serial();
+  test_parallel();
+  test_affinity();
+}
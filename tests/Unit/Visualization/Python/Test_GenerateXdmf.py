@@ -53,6 +53,43 @@ class TestGenerateXdmf(unittest.TestCase):
                                                       data_files[0])
         self.assertEqual(output, expected_output)
 
+    def test_generate_xdmf_with_bounding_boxes(self):
+        # Volume files can hold the bounding boxes of their grids, which are
+        # not tensor data and must not end up in the XDMF file
+        data_files = []
+        for data_file in glob.glob(
+                os.path.join(self.data_dir, 'VolTestData*.h5')):
+            data_files.append(
+                shutil.copy(data_file,
+                            os.path.join(self.test_dir,
+                                         os.path.basename(data_file))))
+        for data_file in data_files:
+            with h5py.File(data_file, 'a') as open_h5_file:
+                volume_data = open_h5_file['element_data.vol']
+                for observation_id in volume_data.keys():
+                    # One lower and upper bound per dimension and grid
+                    num_extents = len(
+                        volume_data[observation_id]['total_extents'][()])
+                    volume_data[observation_id].create_dataset(
+                        'bounding_boxes', data=[0., 1.] * num_extents)
+        output_filename = os.path.join(
+            self.test_dir, 'Test_GenerateXdmf_bounding_boxes_output')
+        generate_xdmf(h5files=data_files,
+                      output=output_filename,
+                      subfile_name="element_data",
+                      start_time=0.,
+                      stop_time=1.,
+                      stride=1,
+                      coordinates='InertialCoordinates')
+        with open(output_filename + ".xmf") as open_file:
+            output = open_file.read()
+        self.assertNotIn('bounding_boxes', output)
+        with open(os.path.join(self.data_dir, 'VolTestData.xmf')) as open_file:
+            expected_output = open_file.read()
+            expected_output = expected_output.replace('VolTestData0.h5',
+                                                      data_files[0])
+        self.assertEqual(output, expected_output)
+
     def test_surface_generate_xdmf(self):
         data_files = [os.path.join(self.data_dir, 'SurfaceTestData.h5')]
         output_filename = os.path.join(self.test_dir,
@@ -0,0 +1,139 @@
+# Distributed under the MIT License.
+# See LICENSE.txt for details.
+
+import json
+import os
+import shutil
+import unittest
+from click.testing import CliRunner
+from spectre import Informer
+from spectre.tools.CompareBenchmarks import (compare_benchmarks,
+                                             compare_benchmarks_command,
+                                             load_benchmark_times)
+
+
+def _write_benchmarks(filename, benchmarks):
+    with open(filename, "w") as open_file:
+        json.dump({"context": {}, "benchmarks": benchmarks}, open_file)
+
+
+class TestCompareBenchmarks(unittest.TestCase):
+    def setUp(self):
+        self.test_dir = os.path.join(Informer.unit_test_build_path(), "tools",
+                                     "CompareBenchmarks")
+        os.makedirs(self.test_dir, exist_ok=True)
+        self.baseline_file = os.path.join(self.test_dir, "Baseline.json")
+        self.benchmark_file = os.path.join(self.test_dir, "Benchmark.json")
+        _write_benchmarks(self.baseline_file, [
+            {
+                "name": "bench_a/4",
+                "run_name": "bench_a/4",
+                "run_type": "iteration",
+                "real_time": 1.,
+                "cpu_time": 1.,
+                "time_unit": "us"
+            },
+            {
+                "name": "bench_b/4",
+                "run_name": "bench_b/4",
+                "run_type": "iteration",
+                "real_time": 200.,
+                "cpu_time": 200.,
+                "time_unit": "ns"
+            },
+            {
+                "name": "bench_removed",
+                "run_name": "bench_removed",
+                "run_type": "iteration",
+                "real_time": 1.,
+                "cpu_time": 1.,
+                "time_unit": "ns"
+            },
+        ])
+        _write_benchmarks(self.benchmark_file, [
+            {
+                "name": "bench_a/4",
+                "run_name": "bench_a/4",
+                "run_type": "iteration",
+                "real_time": 1500.,
+                "cpu_time": 1500.,
+                "time_unit": "ns"
+            },
+            {
+                "name": "bench_b/4",
+                "run_name": "bench_b/4",
+                "run_type": "iteration",
+                "real_time": 300.,
+                "cpu_time": 150.,
+                "time_unit": "ns"
+            },
+            {
+                "name": "bench_b/4_median",
+                "run_name": "bench_b/4",
+                "run_type": "aggregate",
+                "aggregate_name": "median",
+                "real_time": 300.,
+                "cpu_time": 190.,
+                "time_unit": "ns"
+            },
+            {
+                "name": "bench_b/4_mean",
+                "run_name": "bench_b/4",
+                "run_type": "aggregate",
+                "aggregate_name": "mean",
+                "real_time": 300.,
+                "cpu_time": 180.,
+                "time_unit": "ns"
+            },
+            {
+                "name": "bench_new",
+                "run_name": "bench_new",
+                "run_type": "iteration",
+                "real_time": 1.,
+                "cpu_time": 1.,
+                "time_unit": "ns"
+            },
+        ])
+
+    def tearDown(self):
+        shutil.rmtree(self.test_dir)
+
+    def test_load_benchmark_times(self):
+        self.assertEqual(load_benchmark_times(self.baseline_file), {
+            "bench_a/4": 1000.,
+            "bench_b/4": 200.,
+            "bench_removed": 1.
+        })
+        self.assertEqual(
+            load_benchmark_times(self.benchmark_file, metric="real_time"), {
+                "bench_a/4": 1500.,
+                "bench_b/4": 300.,
+                "bench_new": 1.
+            })
+
+    def test_compare_benchmarks(self):
+        ratios = compare_benchmarks(self.baseline_file, self.benchmark_file)
+        self.assertEqual(set(ratios.keys()), {"bench_a/4", "bench_b/4"})
+        self.assertAlmostEqual(ratios["bench_a/4"], 1.5)
+        self.assertAlmostEqual(ratios["bench_b/4"], 0.95)
+        ratios = compare_benchmarks(self.baseline_file,
+                                    self.benchmark_file,
+                                    metric="real_time")
+        self.assertAlmostEqual(ratios["bench_b/4"], 1.5)
+
+    def test_cli(self):
+        runner = CliRunner()
+        result = runner.invoke(compare_benchmarks_command,
+                               [self.baseline_file, self.benchmark_file])
+        self.assertEqual(result.exit_code, 1, result.output)
+        result = runner.invoke(
+            compare_benchmarks_command,
+            [self.baseline_file, self.benchmark_file, "-t", "0.6"])
+        self.assertEqual(result.exit_code, 0, result.output)
+        result = runner.invoke(compare_benchmarks_command,
+                               [self.baseline_file, self.baseline_file])
+        self.assertEqual(result.exit_code, 0, result.output)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
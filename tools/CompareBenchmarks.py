@@ -0,0 +1,133 @@
+# Distributed under the MIT License.
+# See LICENSE.txt for details.
+
+import click
+import json
+import logging
+import rich.console
+import rich.table
+import statistics
+
+logger = logging.getLogger(__name__)
+
+# Factors to convert the time units of Google Benchmark to nanoseconds
+_TIME_UNITS = {"ns": 1., "us": 1.e3, "ms": 1.e6, "s": 1.e9}
+
+
+def load_benchmark_times(benchmark_file, metric="cpu_time"):
+    """
+    Load the times of all benchmarks in a Google Benchmark JSON file, in
+    nanoseconds.
+
+    The JSON file is written by the `Benchmark` executable with the options
+    `--benchmark_out=<file> --benchmark_out_format=json`. When the benchmarks
+    were run with repetitions, the median over the repetitions is used.
+
+    Arguments:
+      benchmark_file: Path to the JSON file.
+      metric: Either "cpu_time" or "real_time".
+
+    Returns: Dictionary of the times keyed by the benchmark names.
+    """
+    with open(benchmark_file, "r") as open_file:
+        benchmarks = json.load(open_file)["benchmarks"]
+    medians = {}
+    iterations = {}
+    for benchmark in benchmarks:
+        time_unit = benchmark.get("time_unit", "ns")
+        time = benchmark[metric] * _TIME_UNITS[time_unit]
+        name = benchmark.get("run_name", benchmark["name"])
+        if benchmark.get("run_type", "iteration") == "aggregate":
+            if benchmark["aggregate_name"] == "median":
+                medians[name] = time
+        else:
+            iterations.setdefault(name, []).append(time)
+    times = {name: statistics.median(values)
+             for name, values in iterations.items()}
+    times.update(medians)
+    return times
+
+
+def compare_benchmarks(baseline_file, benchmark_file, metric="cpu_time"):
+    """
+    Compare benchmark results to a baseline and flag regressions
+
+    Both files are Google Benchmark JSON files written by the `Benchmark`
+    executable. Benchmarks that are slower than the baseline by more than the
+    relative threshold are regressions, and the command fails if there are
+    any. Benchmarks that only exist in one of the two files are reported but
+    don't count as regressions.
+
+    Arguments:
+      baseline_file: Google Benchmark JSON file with the baseline results.
+      benchmark_file: Google Benchmark JSON file with the new results.
+      metric: Either "cpu_time" or "real_time".
+
+    Returns: Dictionary keyed by the names of the benchmarks that exist in
+      both files, holding the ratio of the new time to the baseline time.
+    """
+    baseline_times = load_benchmark_times(baseline_file, metric=metric)
+    times = load_benchmark_times(benchmark_file, metric=metric)
+    for name in baseline_times.keys() - times.keys():
+        logger.warning(f"Benchmark '{name}' is missing from the results.")
+    for name in times.keys() - baseline_times.keys():
+        logger.info(f"Benchmark '{name}' has no baseline.")
+    return {
+        name: times[name] / baseline_times[name]
+        for name in times if name in baseline_times
+    }
+
+
+def _format_time_ratio(ratio, threshold):
+    change = f"{100. * (ratio - 1.):+.1f}%"
+    if ratio > 1. + threshold:
+        return f"[red]{change}[/red]"
+    elif ratio < 1. / (1. + threshold):
+        return f"[green]{change}[/green]"
+    return change
+
+
+@click.command(help=compare_benchmarks.__doc__)
+@click.argument("baseline_file",
+                type=click.Path(exists=True,
+                                file_okay=True,
+                                dir_okay=False,
+                                readable=True))
+@click.argument("benchmark_file",
+                type=click.Path(exists=True,
+                                file_okay=True,
+                                dir_okay=False,
+                                readable=True))
+@click.option("--threshold",
+              "-t",
+              type=float,
+              default=0.1,
+              show_default=True,
+              help=("Relative slowdown above which a benchmark is flagged as "
+                    "a regression."))
+@click.option("--metric",
+              type=click.Choice(["cpu_time", "real_time"]),
+              default="cpu_time",
+              show_default=True,
+              help=("Time to compare. Use 'real_time' for benchmarks that run "
+                    "on multiple threads."))
+@click.pass_context
+def compare_benchmarks_command(ctx, baseline_file, benchmark_file, threshold,
+                               metric):
+    _rich_traceback_guard = True  # Hide traceback until here
+    ratios = compare_benchmarks(baseline_file, benchmark_file, metric=metric)
+    table = rich.table.Table("Benchmark", "Change", box=None)
+    for name, ratio in ratios.items():
+        table.add_row(name, _format_time_ratio(ratio, threshold))
+    rich.console.Console().print(table)
+    regressions = [
+        name for name, ratio in ratios.items() if ratio > 1. + threshold
+    ]
+    if len(regressions) > 0:
+        logger.error(f"{len(regressions)} benchmarks regressed by more than "
+                     f"{100. * threshold:.0f}%: {', '.join(regressions)}")
+        ctx.exit(1)
+
+
+if __name__ == "__main__":
+    compare_benchmarks_command(help_option_names=["-h", "--help"])